@@ -0,0 +1,337 @@
+// Alias analysis.
+//
+// Answers whether two lvalues (ND_VAR, ND_MEMBER or ND_DEREF nodes)
+// evaluated at the same point may refer to overlapping memory. An
+// lvalue is decomposed into a base and a byte offset from it. The
+// base is either a variable, if the object is known, or a pointer
+// expression. Accesses are then disambiguated by
+//
+//  - base: distinct variables never overlap, and a variable whose
+//    address is never taken can't be accessed through a pointer,
+//  - offset: different fields or constant indices of the same base
+//    don't overlap, e.g. `p->x` and `p->y`, and
+//  - type: with -fstrict-aliasing (the default), an int can't be
+//    accessed through a pointer to another type except char, and
+//  - restrict: an object accessed through a restrict-qualified param
+//    is not accessed through another param or by name.
+#include "occ.h"
+
+typedef struct {
+  Var *var;    // Object accessed, or NULL if it is only known as `ptr`
+  Node *ptr;   // Address the offset is relative to if var is NULL
+  int offset;
+  bool exact;  // false if the offset is not a constant
+  int size;
+} Loc;
+
+//
+// Address-taken variables
+//
+
+static Var *path_base(Node *node);
+
+// Returns the variable an address expression points into,
+// e.g. `a` of `a + 2` where `a` is an array.
+static Var *addr_base(Node *node) {
+  switch (node->kind) {
+    case ND_ADD:
+    case ND_SUB:
+      return addr_base(node->lhs);
+    case ND_ADDR:
+      return path_base(node->lhs);
+    case ND_COMMA:
+      return addr_base(node->rhs);
+  }
+
+  if (node->ty->kind == TY_ARRAY)
+    return path_base(node);
+  return NULL;
+}
+
+// Returns the variable an lvalue is a part of, e.g. `s`
+// of `s.a[1]`, or NULL if it is accessed through a pointer.
+static Var *path_base(Node *node) {
+  switch (node->kind) {
+    case ND_VAR:
+      return node->var;
+    case ND_MEMBER:
+      return path_base(node->lhs);
+    case ND_DEREF:
+      return addr_base(node->lhs);
+    case ND_COMMA:
+      return path_base(node->rhs);
+  }
+  return NULL;
+}
+
+Var *lvalue_base(Node *node) {
+  return path_base(node);
+}
+
+static void walk(Node *node);
+
+// Walks an lvalue without taking its address.
+static void walk_path(Node *node) {
+  switch (node->kind) {
+    case ND_VAR:
+      return;
+    case ND_MEMBER:
+      walk_path(node->lhs);
+      return;
+    case ND_DEREF: {
+      // Indexing an array doesn't let its address escape.
+      Node *addr = node->lhs;
+      while (addr->kind == ND_ADD || addr->kind == ND_SUB) {
+        walk(addr->rhs);
+        addr = addr->lhs;
+      }
+      if (addr->ty->kind == TY_ARRAY)
+        walk_path(addr);
+      else
+        walk(addr);
+      return;
+    }
+    case ND_COMMA:
+      walk(node->lhs);
+      walk_path(node->rhs);
+      return;
+  }
+  walk(node);
+}
+
+// Returns the variable an address is computed from by adding an
+// offset, e.g. `p` of `p + 4`.
+static Var *offset_base(Node *node) {
+  while (node->kind == ND_ADD || node->kind == ND_SUB)
+    node = node->lhs;
+  return (node->kind == ND_VAR) ? node->var : NULL;
+}
+
+static void walk(Node *node) {
+  if (!node)
+    return;
+
+  switch (node->kind) {
+    case ND_ASSIGN:
+      // `p += n` and `p++` keep a restrict param pointing into the
+      // same object, while any other assignment may not.
+      if (node->lhs->kind == ND_VAR && node->lhs->var->is_noalias &&
+          offset_base(node->rhs) != node->lhs->var)
+        node->lhs->var->is_noalias = false;
+      break;
+    case ND_ADDR: {
+      Var *var = path_base(node->lhs);
+      if (var)
+        var->is_addr_taken = true;
+      walk_path(node->lhs);
+      return;
+    }
+    case ND_VAR:
+    case ND_MEMBER:
+    case ND_DEREF:
+    case ND_COMMA:
+      // An array used as a value decays to a pointer to it.
+      if (node->ty->kind == TY_ARRAY) {
+        Var *var = path_base(node);
+        if (var)
+          var->is_addr_taken = true;
+      }
+      if (node->kind != ND_COMMA) {
+        walk_path(node);
+        return;
+      }
+  }
+
+  walk(node->lhs);
+  walk(node->rhs);
+  walk(node->cond);
+  walk(node->then);
+  walk(node->els);
+  walk(node->init);
+  walk(node->inc);
+  for (Node *n = node->body; n; n = n->next)
+    walk(n);
+  for (Node *n = node->args; n; n = n->next)
+    walk(n);
+}
+
+// Recomputes which local variables of a function have their address
+// taken, and which of its restrict params can be trusted. Global
+// variables whose address is taken in the function are marked as
+// well, but never unmarked.
+//
+// Only the function's own params count: the promise of restrict
+// holds during a call, not in a caller the function is inlined into.
+void mark_address_taken(Function *fn) {
+  for (Var *var = fn->locals; var; var = var->next) {
+    var->is_addr_taken = false;
+    var->is_noalias = false;
+  }
+  for (Var *var = fn->params; var; var = var->next)
+    var->is_noalias = var->ty->is_restrict;
+
+  walk(fn->node);
+
+  for (Var *var = fn->params; var; var = var->next)
+    if (var->is_addr_taken)
+      var->is_noalias = false;
+}
+
+// Recomputes which variables of a program have their address taken.
+void mark_all_address_taken(Program *prog) {
+  for (Var *var = prog->globals; var; var = var->next)
+    var->is_addr_taken = false;
+  for (Var *var = prog->globals; var; var = var->next)
+    for (Relocation *rel = var->rel; rel; rel = rel->next)
+      rel->var->is_addr_taken = true;
+  for (Function *fn = prog->funcs; fn; fn = fn->next)
+    mark_address_taken(fn);
+}
+
+//
+// Alias queries
+//
+
+// Returns true if two expressions without side effects
+// compute the same value.
+bool same_expr(Node *a, Node *b) {
+  if (!a || !b)
+    return a == b;
+  if (a->kind != b->kind)
+    return false;
+
+  switch (a->kind) {
+    case ND_NUM:
+      return a->val == b->val;
+    case ND_VAR:
+      return a->var == b->var;
+    case ND_MEMBER:
+      return a->member == b->member && same_expr(a->lhs, b->lhs);
+    case ND_ASSIGN:
+    case ND_FUNCALL:
+    case ND_STMT_EXPR:
+      return false;
+  }
+  return same_expr(a->lhs, b->lhs) && same_expr(a->rhs, b->rhs);
+}
+
+static bool get_loc(Node *node, Loc *loc);
+
+// Computes the location an address expression points to.
+static bool get_addr_loc(Node *node, Loc *loc) {
+  switch (node->kind) {
+    case ND_ADD:
+    case ND_SUB:
+      if (!get_addr_loc(node->lhs, loc))
+        return false;
+      if (node->rhs->kind == ND_NUM)
+        loc->offset += (node->kind == ND_ADD) ? node->rhs->val : -node->rhs->val;
+      else if (!has_side_effects(node->rhs))
+        loc->exact = false;
+      else
+        return false;
+      return true;
+    case ND_ADDR:
+      return get_loc(node->lhs, loc);
+  }
+
+  if (node->ty->kind == TY_ARRAY)
+    return get_loc(node, loc);
+
+  if (has_side_effects(node))
+    return false;
+  *loc = (Loc){NULL, node, 0, true, 0};
+  return true;
+}
+
+// Decomposes an lvalue into a base and an offset. Returns false
+// if the lvalue is not understood.
+static bool get_loc(Node *node, Loc *loc) {
+  switch (node->kind) {
+    case ND_VAR:
+      *loc = (Loc){node->var, NULL, 0, true, 0};
+      break;
+    case ND_MEMBER:
+      if (!get_loc(node->lhs, loc))
+        return false;
+      loc->offset += node->member->offset;
+      break;
+    case ND_DEREF:
+      if (!get_addr_loc(node->lhs, loc))
+        return false;
+      break;
+    default:
+      return false;
+  }
+
+  loc->size = node->ty->size;
+  return true;
+}
+
+static bool same_base(Loc *a, Loc *b) {
+  if (a->var || b->var)
+    return a->var == b->var;
+  return same_expr(a->ptr, b->ptr);
+}
+
+// Type-based rule: an object can only be accessed through an lvalue
+// of its own type or of a character type. Enums are ints.
+static bool compatible(Type *a, Type *b) {
+  if (a->kind == TY_CHAR || b->kind == TY_CHAR)
+    return true;
+  if (a->kind == TY_STRUCT || b->kind == TY_STRUCT ||
+      a->kind == TY_ARRAY || b->kind == TY_ARRAY)
+    return true;
+
+  TypeKind ka = (a->kind == TY_ENUM) ? TY_INT : a->kind;
+  TypeKind kb = (b->kind == TY_ENUM) ? TY_INT : b->kind;
+  return ka == kb;
+}
+
+// Returns whether two lvalues evaluated at the same point may
+// overlap. The analysis relies on the address-taken flags computed
+// by mark_all_address_taken().
+AliasResult alias(Node *a, Node *b) {
+  Loc la, lb;
+  if (!get_loc(a, &la) || !get_loc(b, &lb))
+    return MAY_ALIAS;
+
+  if (same_base(&la, &lb)) {
+    if (!la.exact || !lb.exact)
+      return MAY_ALIAS;
+    if (la.offset == lb.offset && la.size == lb.size)
+      return MUST_ALIAS;
+    if (la.offset + la.size <= lb.offset || lb.offset + lb.size <= la.offset)
+      return NO_ALIAS;
+    return MAY_ALIAS;
+  }
+
+  if (la.var && lb.var)
+    return NO_ALIAS;
+
+  // Objects accessed through distinct restrict params are distinct,
+  // and not accessed by name.
+  Var *ra = la.var ? NULL : offset_base(la.ptr);
+  Var *rb = lb.var ? NULL : offset_base(lb.ptr);
+  bool na = ra && ra->is_noalias;
+  bool nb = rb && rb->is_noalias;
+  if ((na && nb && ra != rb) || (na && lb.var) || (nb && la.var))
+    return NO_ALIAS;
+
+  // A pointer can only point to a variable whose address is taken.
+  Var *var = la.var ? la.var : lb.var;
+  if (var && !var->is_addr_taken)
+    return NO_ALIAS;
+
+  if (opt_strict_aliasing && !compatible(a->ty, b->ty))
+    return NO_ALIAS;
+  return MAY_ALIAS;
+}
+
+// Returns true if a call to another function may write to an lvalue.
+bool call_may_modify(Node *node) {
+  Loc loc;
+  if (!get_loc(node, &loc))
+    return true;
+  return !loc.var || !loc.var->is_local || loc.var->is_addr_taken;
+}
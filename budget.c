@@ -0,0 +1,119 @@
+// Compile-time budgets.
+//
+// Some passes take time or memory that grows faster than the size of
+// a function, e.g. dataflow analyses store a set of definitions or
+// variables for each basic block. Generated code can contain single
+// functions with tens of thousands of statements, so each such pass
+// has limits on the complexity of a function below, and uses a
+// cheaper algorithm on functions beyond them.
+//
+// Optimization fuel is a global limit on the number of transformations
+// made by the passes, given by -fopt-fuel=N. A miscompilation can be
+// tracked down to a single transformation by bisecting on N.
+#include "occ.h"
+
+typedef struct {
+  char *pass;
+  int max_blocks;
+  int max_insns;
+  int max_loop_depth;
+} Budget;
+
+static Budget budgets[] = {
+  // pass       blocks   nodes  loop depth
+  {"constprop", 4000,    40000, 8},
+  {"dse",       8000,    80000, 8},
+  {"forward",   INT_MAX, 20000, INT_MAX},
+};
+
+#define NBUDGETS (sizeof(budgets) / sizeof(*budgets))
+
+static void measure(Node *node, int depth, Complexity *c) {
+  if (!node)
+    return;
+  c->insns++;
+
+  // Blocks a node starts besides the one it is in
+  switch (node->kind) {
+    case ND_IF:
+    case ND_LOGAND:
+    case ND_LOGOR:
+      c->blocks += 2;
+      break;
+    case ND_FOR:
+    case ND_WHILE:
+      c->blocks += 3;
+      if (c->loop_depth < ++depth)
+        c->loop_depth = depth;
+      break;
+    case ND_CASE:
+      c->blocks++;
+      break;
+  }
+
+  measure(node->lhs, depth, c);
+  measure(node->rhs, depth, c);
+  measure(node->cond, depth, c);
+  measure(node->then, depth, c);
+  measure(node->els, depth, c);
+  measure(node->init, depth, c);
+  measure(node->inc, depth, c);
+  for (Node *n = node->body; n; n = n->next)
+    measure(n, depth, c);
+  for (Node *n = node->args; n; n = n->next)
+    measure(n, depth, c);
+}
+
+// Returns the number of basic blocks (estimated from the statements
+// that branch), nodes and the deepest nesting of loops of a function.
+Complexity measure_function(Function *fn) {
+  Complexity c = {1, 0, 0};
+  for (Node *n = fn->node; n; n = n->next)
+    measure(n, 0, &c);
+  return c;
+}
+
+// Returns true if a function is simple enough for a pass to use its
+// full algorithm. Thresholds are scaled by -fopt-budget=<percent>.
+bool within_budget(Function *fn, char *pass) {
+  Budget *b = NULL;
+  for (int i = 0; i < NBUDGETS; i++)
+    if (!strcmp(budgets[i].pass, pass))
+      b = &budgets[i];
+  if (!b)
+    return true;
+
+  Complexity c = measure_function(fn);
+  long scale = opt_budget;
+  if (c.blocks * 100L <= b->max_blocks * scale &&
+      c.insns * 100L <= b->max_insns * scale &&
+      c.loop_depth * 100L <= b->max_loop_depth * scale)
+    return true;
+
+  if (opt_budget_report)
+    fprintf(stderr, "budget: %s: %s has %d blocks, %d nodes, loop depth %d; "
+            "using the cheaper algorithm\n",
+            pass, fn->name, c.blocks, c.insns, c.loop_depth);
+  return false;
+}
+
+//
+// Optimization fuel
+//
+
+static long fuel_used;
+
+// Returns true if a pass may make one more transformation, which
+// takes one unit of fuel. Without -fopt-fuel, fuel is unlimited.
+bool use_fuel(char *pass, Function *fn) {
+  if (opt_fuel < 0)
+    return true;
+
+  if (fuel_used < opt_fuel) {
+    fuel_used++;
+    if (fuel_used == opt_fuel)
+      fprintf(stderr, "opt-fuel: last transformation: %s in %s\n", pass, fn->name);
+    return true;
+  }
+  return false;
+}
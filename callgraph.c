@@ -0,0 +1,141 @@
+// Call graph of a translation unit.
+//
+// occ has no function pointers, so every call names its callee
+// and the graph is exact.
+#include "occ.h"
+
+Function *find_func(Program *prog, char *name) {
+  for (Function *fn = prog->funcs; fn; fn = fn->next)
+    if (!strcmp(fn->name, name))
+      return fn;
+  return NULL;
+}
+
+static void add_call(Program *prog, Function *fn, char *name) {
+  for (Callee *c = fn->callees; c; c = c->next) {
+    if (!strcmp(c->name, name)) {
+      c->ncalls++;
+      return;
+    }
+  }
+
+  Callee *c = calloc(1, sizeof(Callee));
+  c->name = name;
+  c->fn = find_func(prog, name);
+  c->ncalls = 1;
+  c->next = fn->callees;
+  fn->callees = c;
+}
+
+static void find_calls(Program *prog, Function *fn, Node *node) {
+  if (!node)
+    return;
+
+  if (node->kind == ND_FUNCALL)
+    add_call(prog, fn, node->funcname);
+
+  find_calls(prog, fn, node->lhs);
+  find_calls(prog, fn, node->rhs);
+  find_calls(prog, fn, node->cond);
+  find_calls(prog, fn, node->then);
+  find_calls(prog, fn, node->els);
+  find_calls(prog, fn, node->init);
+  find_calls(prog, fn, node->inc);
+
+  for (Node *n = node->body; n; n = n->next)
+    find_calls(prog, fn, n);
+  for (Node *n = node->args; n; n = n->next)
+    find_calls(prog, fn, n);
+}
+
+// Tarjan's strongly connected components algorithm.
+// Functions in a component with more than one member,
+// or which call themselves, are recursive.
+typedef struct {
+  Function *fn;
+  int index;
+  int lowlink;
+  bool on_stack;
+} SCCNode;
+
+static SCCNode *scc_nodes;
+static int nfuncs;
+static SCCNode **scc_stack;
+static int scc_sp;
+static int scc_index;
+static Function **scc_order; // Functions in the order components are found
+static int scc_norder;
+
+static SCCNode *scc_node(Function *fn) {
+  for (int i = 0; i < nfuncs; i++)
+    if (scc_nodes[i].fn == fn)
+      return &scc_nodes[i];
+  return NULL;
+}
+
+static void strongconnect(SCCNode *v) {
+  v->index = v->lowlink = ++scc_index;
+  scc_stack[scc_sp++] = v;
+  v->on_stack = true;
+
+  for (Callee *c = v->fn->callees; c; c = c->next) {
+    if (!c->fn)
+      continue;
+
+    if (c->fn == v->fn)
+      v->fn->is_recursive = true;
+
+    SCCNode *w = scc_node(c->fn);
+    if (!w->index) {
+      strongconnect(w);
+      if (w->lowlink < v->lowlink)
+        v->lowlink = w->lowlink;
+    } else if (w->on_stack && w->index < v->lowlink) {
+      v->lowlink = w->index;
+    }
+  }
+
+  if (v->lowlink != v->index)
+    return;
+
+  // v is the root of a component. Pop it.
+  int top = scc_sp;
+  do {
+    scc_stack[--scc_sp]->on_stack = false;
+    scc_order[scc_norder++] = scc_stack[scc_sp]->fn;
+  } while (scc_stack[scc_sp] != v);
+
+  if (top - scc_sp > 1)
+    for (int i = scc_sp; i < top; i++)
+      scc_stack[i]->fn->is_recursive = true;
+}
+
+void build_callgraph(Program *prog) {
+  nfuncs = 0;
+  for (Function *fn = prog->funcs; fn; fn = fn->next) {
+    fn->callees = NULL;
+    fn->is_recursive = false;
+    find_calls(prog, fn, fn->node);
+    nfuncs++;
+  }
+
+  scc_nodes = calloc(nfuncs, sizeof(SCCNode));
+  scc_stack = calloc(nfuncs, sizeof(SCCNode *));
+  scc_order = calloc(nfuncs + 1, sizeof(Function *));
+  scc_sp = scc_index = scc_norder = 0;
+
+  int i = 0;
+  for (Function *fn = prog->funcs; fn; fn = fn->next)
+    scc_nodes[i++].fn = fn;
+
+  for (i = 0; i < nfuncs; i++)
+    if (!scc_nodes[i].index)
+      strongconnect(&scc_nodes[i]);
+}
+
+// Returns the functions of a program as a NULL-terminated array in
+// which callees come before their callers, except within a cycle.
+Function **bottom_up_order(Program *prog) {
+  build_callgraph(prog);
+  return scc_order;
+}
@@ -0,0 +1,101 @@
+// Copying functions.
+//
+// A copy of a function gets its own local variables and nodes. Nodes
+// shared within the original, e.g. the lvalue of `x += 1`, are shared
+// in the copy as well, so a map from original to copied objects is
+// kept while copying.
+#include "occ.h"
+
+static HashMap map;  // Original node -> copy
+static HashMap vars; // Original variable -> copy
+
+static Node *clone_node(Node *node);
+
+static Node *clone_list(Node *node) {
+  Node head = {};
+  Node *cur = &head;
+  for (Node *n = node; n; n = n->next)
+    cur = cur->next = clone_node(n);
+  return head.next;
+}
+
+static Node *clone_node(Node *node) {
+  if (!node)
+    return NULL;
+
+  Node *copy = hashmap_get(&map, node);
+  if (copy)
+    return copy;
+
+  copy = calloc(1, sizeof(Node));
+  *copy = *node;
+  copy->next = NULL;
+  hashmap_put(&map, node, copy);
+
+  Var *var = hashmap_get(&vars, node->var);
+  if (var)
+    copy->var = var;
+
+  copy->lhs = clone_node(node->lhs);
+  copy->rhs = clone_node(node->rhs);
+  copy->cond = clone_node(node->cond);
+  copy->then = clone_node(node->then);
+  copy->els = clone_node(node->els);
+  copy->init = clone_node(node->init);
+  copy->inc = clone_node(node->inc);
+  copy->body = clone_list(node->body);
+  copy->args = clone_list(node->args);
+  return copy;
+}
+
+// Points the case labels of copied switch statements to the
+// copied case statements.
+static void fix_cases(void) {
+  for (int i = 0; i < map.capacity; i++) {
+    if (!map.buckets[i].key)
+      continue;
+    Node *orig = map.buckets[i].key;
+    Node *copy = map.buckets[i].val;
+    if (orig->kind == ND_SWITCH || orig->kind == ND_CASE) {
+      copy->case_next = hashmap_get(&map, orig->case_next);
+      copy->default_case = hashmap_get(&map, orig->default_case);
+    }
+  }
+}
+
+// Returns a static copy of a function with a new name. The copy
+// is not added to the program.
+Function *clone_function(Function *fn, char *name) {
+  hashmap_clear(&map);
+  hashmap_clear(&vars);
+
+  Function *copy = calloc(1, sizeof(Function));
+  copy->name = name;
+  copy->is_static = true;
+  copy->line_no = fn->line_no;
+  copy->return_ty = fn->return_ty;
+  copy->is_pure = fn->is_pure;
+  copy->is_const = fn->is_const;
+
+  Var head = {};
+  Var *cur = &head;
+  for (Var *var = fn->locals; var; var = var->next) {
+    cur = cur->next = calloc(1, sizeof(Var));
+    cur->name = var->name;
+    cur->ty = var->ty;
+    cur->is_local = true;
+    cur->is_noalias = var->is_noalias;
+    hashmap_put(&vars, var, cur);
+  }
+  copy->locals = head.next;
+  copy->params = hashmap_get(&vars, fn->params);
+
+  copy->node = clone_list(fn->node);
+  fix_cases();
+
+  for (Var *var = fn->locals; var; var = var->next) {
+    Var *v = hashmap_get(&vars, var);
+    v->scope = hashmap_get(&map, var->scope);
+  }
+  return copy;
+}
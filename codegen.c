@@ -8,69 +8,351 @@ static char *argreg8[] = {"dil", "sil", "dl", "cl", "r8b", "r9b"};
 static char *argreg32[] = {"edi", "esi", "edx", "ecx", "r8d", "r9d"};
 static char *argreg64[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
 static Function *current_func;
+static int ret_ptr_offset; // Slot of the hidden pointer to the return value
+
+// Appends a line of assembly to the function being generated.
+static void println(char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  strarray_push(&current_func->code, vformat(fmt, ap));
+  va_end(ap);
+}
+
+// The first registers of the expression stack are caller-saved
+// and the rest are callee-saved.
+#define NUM_CALLER_SAVED 2
+#define ALL_CALLER_SAVED ((1 << NUM_CALLER_SAVED) - 1)
 
 static char *reg(int idx) {
   char *r[] = {"r10", "r11", "r12", "r13", "r14", "r15"};
   if (idx < 0 || sizeof(r) / sizeof(*r) <= idx)
     error("register out of range: %d", idx);
+  if (current_func->nregs <= idx)
+    current_func->nregs = idx + 1;
+  if (idx < NUM_CALLER_SAVED)
+    current_func->clobbers |= 1 << idx;
   return r[idx];
 }
 
-// Load the value from where the stack top is pointing to.
-static void load(Type *ty) {
-  if (ty->kind == TY_ARRAY)
-    return;
+// Returns the caller-saved registers a call may overwrite. Functions
+// are generated callees first, so the registers used by a callee in
+// this translation unit are known unless the call is recursive.
+static int call_clobbers(char *funcname) {
+  for (Callee *c = current_func->callees; c; c = c->next)
+    if (!strcmp(c->name, funcname) && c->fn && c->fn->code.len)
+      return c->fn->clobbers;
+  return ALL_CALLER_SAVED;
+}
 
+// Returns the symbol a call jumps to. A position-independent
+// executable calls functions of shared libraries through the PLT.
+static char *call_target(char *funcname) {
+  if (!opt_pie)
+    return funcname;
+  for (Callee *c = current_func->callees; c; c = c->next)
+    if (!strcmp(c->name, funcname) && c->fn)
+      return funcname;
+  return format("%s@PLT", funcname);
+}
+
+// Loads a scalar from memory at `addr` into register `r`.
+static void load_from(char *r, char *addr, Type *ty) {
   if (ty->size == 1)
-    printf("  movsx %s, byte ptr [%s]\n", reg(top - 1), reg(top - 1));
+    println("  movsx %s, byte ptr [%s]", r, addr);
   else if (ty->size == 4)
-    printf("  movsx %s, dword ptr [%s]\n", reg(top - 1), reg(top - 1));
+    println("  movsx %s, dword ptr [%s]", r, addr);
   else
-    printf("  mov %s, [%s]\n", reg(top - 1), reg(top - 1));
+    println("  mov %s, [%s]", r, addr);
 }
 
-static void store(Type *ty) {
+// Load the value from where the stack top is pointing to. The value
+// of an array or a struct is its address.
+static void load(Type *ty) {
+  if (ty->kind == TY_ARRAY || ty->kind == TY_STRUCT)
+    return;
+  load_from(reg(top - 1), reg(top - 1), ty);
+}
+
+// Stores a scalar in register `r` to memory at `addr`.
+static void store_to(char *addr, char *r, Type *ty) {
   if (ty->kind == TY_BOOL) {
     // Convert _Bool value to 1 if non-zero value.
-    printf("cmp %s, 0\n", reg(top - 2));
-    printf("setne %sb\n", reg(top - 2));
-    printf("movzx %s, %sb\n", reg(top - 2), reg(top - 2));
+    println("cmp %s, 0", r);
+    println("setne %sb", r);
+    println("movzx %s, %sb", r, r);
   }
 
   if (ty->size == 1)
-    printf("  mov [%s], %sb\n", reg(top - 1), reg(top - 2));
+    println("  mov [%s], %sb", addr, r);
   else if (ty->size == 4)
-    printf("  mov [%s], %sd\n", reg(top - 1), reg(top - 2));
+    println("  mov [%s], %sd", addr, r);
   else
-    printf("  mov [%s], %s\n", reg(top - 1), reg(top - 2));
+    println("  mov [%s], %s", addr, r);
+}
 
+static void store(Type *ty) {
+  store_to(reg(top - 1), reg(top - 2), ty);
   top--;
 }
 
+// Returns the RIP-relative memory operand of a global variable or a
+// member of one, e.g. "rip+g+8", or NULL for any other lvalue.
+// Instructions address globals relative to the next instruction, so
+// the code is position-independent and needs no register to hold the
+// address.
+static char *global_operand(Node *node) {
+  if (node->kind == ND_VAR && !node->var->is_local)
+    return format("rip+%s", node->var->name);
+  if (node->kind == ND_MEMBER) {
+    char *base = global_operand(node->lhs);
+    if (base)
+      return format("%s+%d", base, node->member->offset);
+  }
+  return NULL;
+}
+
+static bool is_scalar(Type *ty) {
+  return ty->kind != TY_ARRAY && ty->kind != TY_STRUCT;
+}
+
 static void gen_expr();
 static void gen_stmt();
+static void gen_addr(Node *node);
+
+// Aggregates up to this size are copied or zeroed with unrolled
+// moves, and larger ones with rep movsb or rep stosq.
+#define INLINE_COPY_SIZE 128
+
+static char *subregs[][4] = {
+  {"rax", "eax", "ax", "al"},      {"rcx", "ecx", "cx", "cl"},
+  {"rdx", "edx", "dx", "dl"},      {"rsi", "esi", "si", "sil"},
+  {"rdi", "edi", "di", "dil"},     {"r8", "r8d", "r8w", "r8b"},
+  {"r9", "r9d", "r9w", "r9b"},     {"r10", "r10d", "r10w", "r10b"},
+  {"r11", "r11d", "r11w", "r11b"}, {"r12", "r12d", "r12w", "r12b"},
+  {"r13", "r13d", "r13w", "r13b"}, {"r14", "r14d", "r14w", "r14b"},
+  {"r15", "r15d", "r15w", "r15b"},
+};
+
+static char *ptrs[] = {"qword", "dword", "word", "byte"};
+
+// Index into subregs and ptrs of an operand of 8, 4, 2 or 1 bytes
+static int size_index(int size) {
+  return (size == 8) ? 0 : (size == 4) ? 1 : (size == 2) ? 2 : 3;
+}
+
+// Returns the name of the low `size` bytes of a 64-bit register.
+static char *sub_reg(char *r, int size) {
+  for (int i = 0; i < sizeof(subregs) / sizeof(*subregs); i++)
+    if (!strcmp(subregs[i][0], r))
+      return subregs[i][size_index(size)];
+  error("internal error: unknown register %s", r);
+}
+
+// Copies `size` bytes from the address `src` to the address `dst`,
+// or zeroes them if `src` is NULL. Addresses are a register, or a
+// register and a displacement, e.g. "rsp+8".
+//
+// Blocks smaller than 16 bytes are moved through rax in the largest
+// moves that fit, blocks up to INLINE_COPY_SIZE through xmm0 in
+// 16-byte moves. The last move overlaps the previous one if the size
+// is not a multiple of the move.
+static void gen_copy(char *dst, char *src, int size) {
+  if (size > INLINE_COPY_SIZE) {
+    if (!src) {
+      println("  lea rdi, [%s]", dst);
+      println("  xor eax, eax");
+      println("  mov ecx, %d", size / 8);
+      println("  rep stosq");
+      if (size % 8)
+        println("  mov qword ptr [rdi-%d], 0", 8 - size % 8);
+      return;
+    }
+    println("  lea rsi, [%s]", src);
+    println("  lea rdi, [%s]", dst);
+    println("  mov ecx, %d", size);
+    println("  rep movsb");
+    return;
+  }
+
+  int n = (size >= 16) ? 16 : (size >= 8) ? 8 : (size >= 4) ? 4 : (size >= 2) ? 2 : 1;
+  if (!src && n == 16)
+    println("  pxor xmm0, xmm0");
+
+  for (int i = 0; i < size; i += n) {
+    int off = (i + n <= size) ? i : size - n;
+    if (n == 16) {
+      if (src)
+        println("  movups xmm0, [%s+%d]", src, off);
+      println("  movups [%s+%d], xmm0", dst, off);
+    } else if (!src) {
+      println("  mov %s ptr [%s+%d], 0", ptrs[size_index(n)], dst, off);
+    } else {
+      println("  mov %s, [%s+%d]", sub_reg("rax", n), src, off);
+      println("  mov [%s+%d], %s", dst, off, sub_reg("rax", n));
+    }
+  }
+}
+
+// Assigns a struct or an array as a whole. The right-hand side is
+// another aggregate to copy, or the number 0 to zero the left-hand
+// side, which the parser does to initialize large local variables.
+// The value is the address of the left-hand side.
+static void gen_aggregate_assign(Node *node) {
+  if (node->rhs->kind == ND_NUM) {
+    gen_addr(node->lhs);
+    gen_copy(reg(top - 1), NULL, node->ty->size);
+    return;
+  }
+
+  gen_expr(node->rhs);
+  gen_addr(node->lhs);
+  char *src = reg(top - 2);
+  char *dst = reg(top - 1);
+  gen_copy(dst, src, node->ty->size);
+  println("  mov %s, %s", src, dst);
+  top--;
+}
+
+//
+// Struct arguments and return values
+//
+// As the SysV ABI has it, a struct of up to 16 bytes is passed in one
+// or two general-purpose registers, and a larger one on the stack. A
+// larger struct is returned into memory pointed to by a hidden first
+// argument, which the callee returns in rax; a smaller one is
+// returned in rax and rdx.
+//
+
+static bool in_memory(Type *ty) {
+  return ty && ty->kind == TY_STRUCT && ty->size > 16;
+}
+
+// Where an argument is passed: in the argument registers from `reg`
+// on, or at `offset` in the argument area at the bottom of the
+// caller's frame if `reg` is -1.
+typedef struct {
+  int reg;
+  int offset;
+} ArgLoc;
+
+// Assigns locations to arguments of the given types and returns the
+// size of the argument area. Arguments that don't fit in the
+// registers left are passed on the stack.
+static int classify_args(Type **types, int n, bool ret_in_memory, ArgLoc *locs) {
+  int gp = ret_in_memory ? 1 : 0;
+  int offset = 0;
+  for (int i = 0; i < n; i++) {
+    bool is_struct = types[i]->kind == TY_STRUCT;
+    int nregs = is_struct ? (types[i]->size + 7) / 8 : 1;
+    if (!in_memory(types[i]) && gp + nregs <= 6) {
+      locs[i] = (ArgLoc){gp, 0};
+      gp += nregs;
+      continue;
+    }
+    locs[i] = (ArgLoc){-1, offset};
+    offset += align_to(types[i]->size, 8);
+  }
+  return offset;
+}
+
+// Loads `size` bytes, at most 8, at an address into a register,
+// zero-extended. A size no single move reads is assembled from
+// moves of 4, 2 and 1 bytes, the highest first, through `tmp`.
+static void load_bytes(char *r, char *addr, int size, char *tmp) {
+  if (size == 8) {
+    println("  mov %s, [%s]", r, addr);
+    return;
+  }
+
+  int offs[3], sizes[3], n = 0;
+  for (int sz = 4, off = 0; sz; sz /= 2) {
+    if (size - off >= sz) {
+      offs[n] = off;
+      sizes[n++] = sz;
+      off += sz;
+    }
+  }
+
+  for (int i = n - 1; i >= 0; i--) {
+    char *dst = (i == n - 1) ? r : tmp;
+    if (sizes[i] == 4)
+      println("  mov %s, [%s+%d]", sub_reg(dst, 4), addr, offs[i]);
+    else
+      println("  movzx %s, %s ptr [%s+%d]", sub_reg(dst, 4),
+              ptrs[size_index(sizes[i])], addr, offs[i]);
+    if (dst == tmp) {
+      println("  shl %s, %d", r, sizes[i] * 8);
+      println("  or %s, %s", r, tmp);
+    }
+  }
+}
+
+// Stores the low `size` bytes, at most 8, of a register to an
+// address. The register is shifted right as the bytes are stored.
+static void store_bytes(char *addr, char *r, int size) {
+  if (size == 8) {
+    println("  mov [%s], %s", addr, r);
+    return;
+  }
+
+  int off = 0, last = 0;
+  for (int sz = 4; sz; sz /= 2) {
+    if (size - off < sz)
+      continue;
+    if (last)
+      println("  shr %s, %d", r, last * 8);
+    println("  mov [%s+%d], %s", addr, off, sub_reg(r, sz));
+    off += sz;
+    last = sz;
+  }
+}
+
+// Loads a struct of up to 16 bytes into the one or two registers it
+// is passed or returned in.
+static void load_struct(char *r1, char *r2, char *addr, int size, char *tmp) {
+  load_bytes(r1, addr, (size < 8) ? size : 8, tmp);
+  if (size > 8)
+    load_bytes(r2, format("%s+8", addr), size - 8, tmp);
+}
+
+static void store_struct(char *addr, char *r1, char *r2, int size) {
+  store_bytes(addr, r1, (size < 8) ? size : 8);
+  if (size > 8)
+    store_bytes(format("%s+8", addr), r2, size - 8);
+}
 
 // Pushes the given node's address to the stack.
 static void gen_addr(Node *node) {
+  char *op = global_operand(node);
+  if (op) {
+    println("  lea %s, [%s]", reg(top++), op);
+    return;
+  }
+
   switch (node->kind) {
     case ND_VAR:
-      if (node->var->is_local)
-        printf("  lea %s, [rbp-%d]\n", reg(top++), node->var->offset);
-      else
-        printf("  mov %s, offset %s\n", reg(top++), node->var->name);
+      println("  lea %s, [rbp-%d]", reg(top++), node->var->offset);
       return;
     case ND_DEREF:
       gen_expr(node->lhs);
       return;
     case ND_MEMBER:
       gen_addr(node->lhs);
-      printf("  add %s, %d\n", reg(top - 1), node->member->offset);
+      println("  add %s, %d", reg(top - 1), node->member->offset);
       return;
     case ND_COMMA:
       gen_expr(node->lhs);
       top--;
       gen_addr(node->rhs);
       return;
+    case ND_FUNCALL:
+    case ND_STMT_EXPR:
+      // A struct value is already an address.
+      if (node->ty->kind == TY_STRUCT) {
+        gen_expr(node);
+        return;
+      }
+      error("expected a variable or dereferencer");
     default:
       error("expected a variable or dereferencer");
   }
@@ -79,13 +361,19 @@ static void gen_addr(Node *node) {
 static void gen_expr(Node *node) {
   switch (node->kind) {
     case ND_NUM:
-      printf("  mov %s, %d\n", reg(top++), node->val);
+      println("  mov %s, %d", reg(top++), node->val);
       return;
     case ND_VAR:
-    case ND_MEMBER:
+    case ND_MEMBER: {
+      char *op = global_operand(node);
+      if (op && is_scalar(node->ty)) {
+        load_from(reg(top++), op, node->ty);
+        return;
+      }
       gen_addr(node);
       load(node->ty);
       return;
+    }
     case ND_DEREF:
       gen_expr(node->lhs);
       load(node->ty);
@@ -94,42 +382,50 @@ static void gen_expr(Node *node) {
       gen_addr(node->lhs);
       return;
     case ND_ASSIGN:
+      if (node->ty->kind == TY_ARRAY || node->ty->kind == TY_STRUCT) {
+        gen_aggregate_assign(node);
+        return;
+      }
       gen_expr(node->rhs);
+      if (global_operand(node->lhs)) {
+        store_to(global_operand(node->lhs), reg(top - 1), node->ty);
+        return;
+      }
       gen_addr(node->lhs);
       store(node->ty);
       return;
     case ND_BITNOT:
       gen_expr(node->lhs);
-      printf("  not %s\n", reg(top - 1));
+      println("  not %s", reg(top - 1));
       return;
     case ND_LOGAND: {
       int seq = labelseq++;
       gen_expr(node->lhs);
-      printf("  cmp %s, 0\n", reg(--top));
-      printf("  je .L.false.%d\n", seq);
+      println("  cmp %s, 0", reg(--top));
+      println("  je .L.false.%d", seq);
       gen_expr(node->rhs);
-      printf("  cmp %s, 0\n", reg(--top));
-      printf("  je .L.false.%d\n", seq);
-      printf("  mov %s, 1\n", reg(top));
-      printf("  jmp .L.end.%d\n", seq);
-      printf(".L.false.%d:\n", seq);
-      printf("  mov %s, 0\n", reg(top++));
-      printf(".L.end.%d:\n", seq);
+      println("  cmp %s, 0", reg(--top));
+      println("  je .L.false.%d", seq);
+      println("  mov %s, 1", reg(top));
+      println("  jmp .L.end.%d", seq);
+      println(".L.false.%d:", seq);
+      println("  mov %s, 0", reg(top++));
+      println(".L.end.%d:", seq);
       return;
     }
     case ND_LOGOR: {
       int seq = labelseq++;
       gen_expr(node->lhs);
-      printf("  cmp %s, 0\n", reg(--top));
-      printf("  jne .L.true.%d\n", seq);
+      println("  cmp %s, 0", reg(--top));
+      println("  jne .L.true.%d", seq);
       gen_expr(node->rhs);
-      printf("  cmp %s, 0\n", reg(--top));
-      printf("  jne .L.true.%d\n", seq);
-      printf("  mov %s, 0\n", reg(top));
-      printf("  jmp .L.end.%d\n", seq);
-      printf(".L.true.%d:\n", seq);
-      printf("  mov %s, 1\n", reg(top++));
-      printf(".L.end.%d:\n", seq);
+      println("  cmp %s, 0", reg(--top));
+      println("  jne .L.true.%d", seq);
+      println("  mov %s, 0", reg(top));
+      println("  jmp .L.end.%d", seq);
+      println(".L.true.%d:", seq);
+      println("  mov %s, 1", reg(top++));
+      println(".L.end.%d:", seq);
       return;
     }
     case ND_COMMA:
@@ -138,23 +434,81 @@ static void gen_expr(Node *node) {
       gen_expr(node->rhs);
       return;
     case ND_FUNCALL: {
-      int nargs = 0;
       // First, evaluate args and put them to the stack.
+      int nargs = 0;
       for (Node *arg = node->args; arg; arg = arg->next) {
         gen_expr(arg);
         nargs++;
       }
-      // Then, move arg values to the argreg.
-      for (int i = 1; i <= nargs; i++)
-        printf("  mov %s, %s\n", argreg64[nargs - i], reg(--top));
-
-      printf("  push r10\n");
-      printf("  push r11\n");
-      printf("  mov rax, 0\n");
-      printf("  call %s\n", node->funcname);
-      printf("  pop r11\n");
-      printf("  pop r10\n");
-      printf("  mov %s, rax\n", reg(top++));
+      int base = top - nargs;
+
+      Type **types = calloc(nargs, sizeof(Type *));
+      ArgLoc *locs = calloc(nargs, sizeof(ArgLoc));
+      int i = 0;
+      for (Node *arg = node->args; arg; arg = arg->next)
+        types[i++] = arg->ty ? arg->ty : ty_int; // `~` has no type
+      Type *ret_ty = node->var ? node->var->ty : NULL;
+      int args_size = align_to(classify_args(types, nargs, in_memory(ret_ty), locs), 16);
+
+      // Save the live registers the callee may overwrite, keeping
+      // the stack 16-byte aligned.
+      int clobbers = call_clobbers(node->funcname);
+      current_func->clobbers |= clobbers;
+
+      int nsaved = 0;
+      for (i = 0; i < base && i < NUM_CALLER_SAVED; i++) {
+        if (clobbers & (1 << i)) {
+          println("  push %s", reg(i));
+          nsaved++;
+        }
+      }
+      int adjust = args_size + (nsaved % 2) * 8;
+      if (adjust)
+        println("  sub rsp, %d", adjust);
+
+      // Copy the args passed on the stack first, as copying a large
+      // struct uses rsi, rdi and rcx. Then move the other args to
+      // the argument registers.
+      for (i = 0; i < nargs; i++) {
+        if (locs[i].reg != -1)
+          continue;
+        if (types[i]->kind == TY_STRUCT)
+          gen_copy(format("rsp+%d", locs[i].offset), reg(base + i), types[i]->size);
+        else
+          println("  mov [rsp+%d], %s", locs[i].offset, reg(base + i));
+      }
+      for (i = 0; i < nargs; i++) {
+        int r = locs[i].reg;
+        if (r == -1)
+          continue;
+        if (types[i]->kind == TY_STRUCT)
+          load_struct(argreg64[r], argreg64[r + 1], reg(base + i), types[i]->size, "rax");
+        else
+          println("  mov %s, %s", argreg64[r], reg(base + i));
+      }
+      if (in_memory(ret_ty))
+        println("  lea rdi, [rbp-%d]", node->var->offset);
+
+      println("  mov rax, 0");
+      println("  call %s", call_target(node->funcname));
+
+      if (adjust)
+        println("  add rsp, %d", adjust);
+      for (i = NUM_CALLER_SAVED - 1; i >= 0; i--)
+        if (i < base && (clobbers & (1 << i)))
+          println("  pop %s", reg(i));
+      top = base;
+
+      // A struct is returned into a temporary, and its value is
+      // the address of the temporary.
+      if (!ret_ty) {
+        println("  mov %s, rax", reg(top++));
+        return;
+      }
+      println("  lea %s, [rbp-%d]", reg(top), node->var->offset);
+      if (!in_memory(ret_ty))
+        store_struct(reg(top), "rax", "rdx", ret_ty->size);
+      top++;
       return;
     }
     case ND_STMT_EXPR:
@@ -173,52 +527,52 @@ static void gen_expr(Node *node) {
 
   switch (node->kind) {
     case ND_ADD:
-      printf("  add %s, %s\n", rd, rs);
+      println("  add %s, %s", rd, rs);
       return;
     case ND_SUB:
-      printf("  sub %s, %s\n", rd, rs);
+      println("  sub %s, %s", rd, rs);
       return;
     case ND_MUL:
-      printf("  imul %s, %s\n", rd, rs);
+      println("  imul %s, %s", rd, rs);
       return;
     case ND_DIV:
-      printf("  mov rax, %s\n", rd);
-      printf("  cqo\n");
-      printf("  idiv %s\n", rs);
-      printf("  mov %s, rax\n", rd);
+      println("  mov rax, %s", rd);
+      println("  cqo");
+      println("  idiv %s", rs);
+      println("  mov %s, rax", rd);
       return;
     case ND_EQ:
-      printf("  cmp %s, %s\n", rd, rs);
-      printf("  sete al\n");
-      printf("  movzx %s, al\n", rd);
+      println("  cmp %s, %s", rd, rs);
+      println("  sete al");
+      println("  movzx %s, al", rd);
       return;
     case ND_NE:
-      printf("  cmp %s, %s\n", rd, rs);
-      printf("  setne al\n");
-      printf("  movzx %s, al\n", rd);
+      println("  cmp %s, %s", rd, rs);
+      println("  setne al");
+      println("  movzx %s, al", rd);
       return;
     case ND_LAT:
-      printf("  cmp %s, %s\n", rs, rd);
-      printf("  setl al\n");
-      printf("  movzx %s, al\n", rd);
+      println("  cmp %s, %s", rs, rd);
+      println("  setl al");
+      println("  movzx %s, al", rd);
       return;
     case ND_LET:
-      printf("  cmp %s, %s\n", rd, rs);
-      printf("  setl al\n");
-      printf("  movzx %s, al\n", rd);
+      println("  cmp %s, %s", rd, rs);
+      println("  setl al");
+      println("  movzx %s, al", rd);
       return;
     case ND_LAE:
-      printf("  cmp %s, %s\n", rs, rd);
-      printf("  setle al\n");
-      printf("  movzx %s, al\n", rd);
+      println("  cmp %s, %s", rs, rd);
+      println("  setle al");
+      println("  movzx %s, al", rd);
       return;
     case ND_LEE:
-      printf("  cmp %s, %s\n", rd, rs);
-      printf("  setle al\n");
-      printf("  movzx %s, al\n", rd);
+      println("  cmp %s, %s", rd, rs);
+      println("  setle al");
+      println("  movzx %s, al", rd);
       return;
     case ND_BITAND:
-      printf("  and %s, %s\n", rd, rs);
+      println("  and %s, %s", rd, rs);
       return;
     default:
       error("invalid expression");
@@ -231,19 +585,19 @@ static void gen_stmt(Node *node) {
       int seq = labelseq++;
       if (node->els) {
         gen_expr(node->cond);
-        printf("  cmp %s, 0\n", reg(--top));
-        printf("  je  .L.else.%d\n", seq);
+        println("  cmp %s, 0", reg(--top));
+        println("  je  .L.else.%d", seq);
         gen_stmt(node->then);
-        printf("  jmp .L.end.%d\n", seq);
-        printf(".L.else.%d:\n", seq);
+        println("  jmp .L.end.%d", seq);
+        println(".L.else.%d:", seq);
         gen_stmt(node->els);
-        printf(".L.end.%d:\n", seq);
+        println(".L.end.%d:", seq);
       } else {
         gen_expr(node->cond);
-        printf("  cmp %s, 0\n", reg(--top));
-        printf("  je  .L.end.%d\n", seq);
+        println("  cmp %s, 0", reg(--top));
+        println("  je  .L.end.%d", seq);
         gen_stmt(node->then);
-        printf(".L.end.%d:\n", seq);
+        println(".L.end.%d:", seq);
       }
       return;
     }
@@ -256,18 +610,18 @@ static void gen_stmt(Node *node) {
 
       if (node->init)
         gen_stmt(node->init);
-      printf(".L.begin.%d:\n", seq);
+      println(".L.begin.%d:", seq);
       if (node->cond) {
         gen_expr(node->cond);
-        printf("  cmp %s, 0\n", reg(--top));
-        printf("  je  .L.break.%d\n", seq);
+        println("  cmp %s, 0", reg(--top));
+        println("  je  .L.break.%d", seq);
       }
       gen_stmt(node->then);
-      printf(".L.continue.%d:\n", seq);
+      println(".L.continue.%d:", seq);
       if (node->inc)
         gen_stmt(node->inc);
-      printf("  jmp .L.begin.%d\n", seq);
-      printf(".L.break.%d:\n", seq);
+      println("  jmp .L.begin.%d", seq);
+      println(".L.break.%d:", seq);
 
       brkseq = brk;
       contseq = cont;
@@ -280,16 +634,16 @@ static void gen_stmt(Node *node) {
       int cont = contseq;
       contseq = seq;
 
-      printf(".L.begin.%d:\n", seq);
+      println(".L.begin.%d:", seq);
       if (node->cond) {
         gen_expr(node->cond);
-        printf("  cmp %s, 0\n", reg(--top));
-        printf("  je  .L.break.%d\n", seq);
+        println("  cmp %s, 0", reg(--top));
+        println("  je  .L.break.%d", seq);
       }
       gen_stmt(node->then);
-      printf(".L.continue.%d:\n", seq);
-      printf("  jmp .L.begin.%d\n", seq);
-      printf(".L.break.%d:\n", seq);
+      println(".L.continue.%d:", seq);
+      println("  jmp .L.begin.%d", seq);
+      println(".L.break.%d:", seq);
 
       brkseq = brk;
       contseq = cont;
@@ -304,46 +658,58 @@ static void gen_stmt(Node *node) {
 
       for (Node *n = node->case_next; n; n = n->case_next) {
         n->case_label = labelseq++;
-        printf("  cmp %s, %d\n", reg(top - 1), n->val);
-        printf("  je .L.case.%d\n", n->case_label);
+        println("  cmp %s, %d", reg(top - 1), n->val);
+        println("  je .L.case.%d", n->case_label);
       }
       top--;
 
       if (node->default_case) {
         int label_num = labelseq++;
         node->default_case->case_label = label_num;
-        printf("  jmp .L.case.%d\n", label_num);
+        println("  jmp .L.case.%d", label_num);
       }
 
-      printf("  jmp .L.break.%d\n", seq);
+      println("  jmp .L.break.%d", seq);
       gen_stmt(node->then);
-      printf(".L.break.%d:\n", seq);
+      println(".L.break.%d:", seq);
 
       brkseq = brk;
       return;
     }
     case ND_CASE:
-      printf(".L.case.%d:\n", node->case_label);
+      println(".L.case.%d:", node->case_label);
       gen_stmt(node->lhs);
       return;
     case ND_BREAK:
       if (brkseq == 0)
         error("stray break");
-      printf("  jmp .L.break.%d\n", brkseq);
+      println("  jmp .L.break.%d", brkseq);
       return;
     case ND_CONTINUE:
       if (contseq == 0)
         error("stray continue");
-      printf("  jmp .L.continue.%d\n", contseq);
+      println("  jmp .L.continue.%d", contseq);
       return;
     case ND_BLOCK:
       for (Node *n = node->body; n; n = n->next)
         gen_stmt(n);
       return;
     case ND_RETURN:
-      gen_expr(node->lhs);
-      printf("  mov rax, %s\n", reg(--top));
-      printf("  jmp .L.return.%s\n", current_func->name);
+      if (node->lhs) {
+        gen_expr(node->lhs);
+        Type *ty = current_func->return_ty;
+        if (in_memory(ty)) {
+          println("  mov rdx, [rbp-%d]", ret_ptr_offset);
+          gen_copy("rdx", reg(top - 1), ty->size);
+          println("  mov rax, rdx");
+        } else if (ty && ty->kind == TY_STRUCT) {
+          load_struct("rax", "rdx", reg(top - 1), ty->size, "rcx");
+        } else {
+          println("  mov rax, %s", reg(top - 1));
+        }
+        top--;
+      }
+      println("  jmp .L.return.%s", current_func->name);
       return;
     case ND_EXPR_STMT:
       gen_expr(node->lhs);
@@ -354,76 +720,406 @@ static void gen_stmt(Node *node) {
   }
 }
 
+// Generates the code of a function into fn->code. The frame is laid
+// out here, after the optimization passes, which may add and remove
+// variables, and the prologue is emitted after the body, once the
+// registers to save are known.
+static void gen_func(Function *fn) {
+  current_func = fn;
+  int offset = layout_frame(fn);
+
+  // A struct returned in memory is copied to where the hidden first
+  // argument points, which is saved below the locals.
+  if (in_memory(fn->return_ty)) {
+    offset += 8;
+    ret_ptr_offset = offset;
+    println("  mov [rbp-%d], rdi", offset);
+  }
+
+  // Save arguments to the stack. Params are listed in the reverse
+  // order of arguments.
+  int nparams = 0;
+  for (Var *param = fn->params; param; param = param->next)
+    nparams++;
+  Var **params = calloc(nparams, sizeof(Var *));
+  Type **types = calloc(nparams, sizeof(Type *));
+  ArgLoc *locs = calloc(nparams, sizeof(ArgLoc));
+  int i = nparams;
+  for (Var *param = fn->params; param; param = param->next) {
+    params[--i] = param;
+    types[i] = param->ty;
+  }
+  classify_args(types, nparams, in_memory(fn->return_ty), locs);
+
+  for (i = 0; i < nparams; i++) {
+    Var *param = params[i];
+    int r = locs[i].reg;
+    if (r == -1)
+      continue;
+    if (param->ty->kind == TY_STRUCT)
+      store_struct(format("rbp-%d", param->offset), argreg64[r], argreg64[r + 1], param->ty->size);
+    else if (param->ty->size == 1)
+      println("  mov [rbp-%d], %s", param->offset, argreg8[r]);
+    else if (param->ty->size == 4)
+      println("  mov [rbp-%d], %s", param->offset, argreg32[r]);
+    else if (param->ty->size == 8)
+      println("  mov [rbp-%d], %s", param->offset, argreg64[r]);
+    else
+      error("unknown type size");
+  }
+
+  // The args passed on the stack are above the return address,
+  // which is above the saved rsp in a realigned frame.
+  char *args = "rbp+16";
+  for (i = 0; i < nparams; i++) {
+    Var *param = params[i];
+    if (locs[i].reg != -1)
+      continue;
+    if (fn->frame_align > 16 && !strcmp(args, "rbp+16")) {
+      println("  mov rdx, [rbp+8]");
+      args = "rdx+8";
+    }
+    char *src = format("%s+%d", args, locs[i].offset);
+    if (param->ty->kind == TY_STRUCT) {
+      gen_copy(format("rbp-%d", param->offset), src, param->ty->size);
+    } else {
+      println("  mov %s, [%s]", sub_reg("rax", param->ty->size), src);
+      println("  mov [rbp-%d], %s", param->offset, sub_reg("rax", param->ty->size));
+    }
+  }
+
+  // Emit code
+  for (Node *n = fn->node; n; n = n->next) {
+    gen_stmt(n);
+    assert(top == 0);
+  }
+
+  // Only the callee-saved registers the body used have to be saved.
+  // They are saved below local variables, so the prologue is emitted
+  // now that the body is known.
+  StringArray body = fn->code;
+  fn->code = (StringArray){};
+
+  int nsaved = (fn->nregs > NUM_CALLER_SAVED) ? fn->nregs - NUM_CALLER_SAVED : 0;
+  fn->stack_size = align_to(offset + nsaved * 8, 16);
+
+  // Prologue. A frame aligned to more than 16 bytes is placed below
+  // the caller's rsp rounded down, which is saved above it. rax is
+  // free here, while callers may keep values in r10 and r11 if they
+  // know a callee doesn't use them.
+  if (fn->frame_align > 16) {
+    println("  mov rax, rsp");
+    println("  and rsp, -%d", fn->frame_align);
+    println("  push rax");
+  }
+  println("  push rbp");
+  println("  mov rbp, rsp");
+  if (fn->stack_size)
+    println("  sub rsp, %d", fn->stack_size);
+  for (i = 0; i < nsaved; i++)
+    println("  mov [rbp-%d], %s", offset + (i + 1) * 8, reg(NUM_CALLER_SAVED + i));
+
+  for (i = 0; i < body.len; i++)
+    strarray_push(&fn->code, body.data[i]);
+
+  // Epilogue
+  println(".L.return.%s:", fn->name);
+  for (i = 0; i < nsaved; i++)
+    println("  mov %s, [rbp-%d]", reg(NUM_CALLER_SAVED + i), offset + (i + 1) * 8);
+  println("  mov rsp, rbp");
+  println("  pop rbp");
+  if (fn->frame_align > 16)
+    println("  pop rsp");
+  println("  ret");
+}
+
 static void emit_text(Function *funcs) {
   printf(".text\n");
 
   for (Function *fn = funcs; fn; fn = fn->next) {
+    // Put each function in its own section so that the linker
+    // can discard unused ones with --gc-sections.
+    if (opt_function_sections)
+      printf(".section .text.%s,\"ax\",@progbits\n", fn->name);
     if (!fn->is_static)
       printf(".globl %s\n", fn->name);
+
+    if (fn->folded_into && !fn->is_thunk) {
+      printf(".set %s, %s\n", fn->name, fn->folded_into->name);
+      continue;
+    }
+
     printf("%s:\n", fn->name);
+    for (int i = 0; i < fn->code.len; i++)
+      printf("%s\n", fn->code.data[i]);
+  }
+}
+
+// Prints bytes as the operand of .ascii or .string.
+static void print_quoted(char *buf, int len) {
+  printf("\"");
+  for (int i = 0; i < len; i++) {
+    unsigned char c = buf[i];
+    if (c == '"' || c == '\\')
+      printf("\\%c", c);
+    else if (isprint(c))
+      printf("%c", c);
+    else
+      printf("\\%03o", c);
+  }
+  printf("\"");
+}
 
-    current_func = fn;
-
-    // Prologue
-    // r12-15 are callee-saved registers.
-    printf("  push rbp\n");
-    printf("  mov rbp, rsp\n");
-    printf("  sub rsp, %d\n", fn->stack_size);
-    printf("  mov [rbp-8], r12\n");
-    printf("  mov [rbp-16], r13\n");
-    printf("  mov [rbp-24], r14\n");
-    printf("  mov [rbp-32], r15\n");
-
-    // Save arguments to the stack
-    int i = 0;
-    for (Var *param = fn->params; param; param = param->next)
-      i++;
-    for (Var *param = fn->params; param; param = param->next) {
-      if (param->ty->size == 1)
-        printf("  mov [rbp-%d], %s\n", param->offset, argreg8[--i]);
-      else if (param->ty->size == 4)
-        printf("  mov [rbp-%d], %s\n", param->offset, argreg32[--i]);
-      else if (param->ty->size == 8)
-        printf("  mov [rbp-%d], %s\n", param->offset, argreg64[--i]);
-      else
-        error("unknown type size");
+static bool is_zero(char *buf, int len) {
+  for (int i = 0; i < len; i++)
+    if (buf[i])
+      return false;
+  return true;
+}
+
+// Emits bytes i to len of an object as 8-byte words, with long runs
+// of zeros written as .zero.
+static void emit_words(char *buf, int i, int len) {
+  while (i + 8 <= len) {
+    int n = 0;
+    while (i + n + 8 <= len && is_zero(buf + i + n, 8))
+      n += 8;
+    if (n >= 16) {
+      printf("  .zero %d\n", n);
+      i += n;
+      continue;
     }
 
-    // Emit code
-    for (Node *n = fn->node; n; n = n->next) {
-      gen_stmt(n);
-      assert(top == 0);
+    printf("  .quad ");
+    for (int j = 0; j < 8 && i + 8 <= len; j++, i += 8) {
+      uint64_t val;
+      memcpy(&val, buf + i, 8);
+      printf(j ? ", %#lx" : "%#lx", (unsigned long)val);
+      if (i + 24 <= len && is_zero(buf + i + 8, 16)) {
+        i += 8;
+        break;
+      }
     }
+    printf("\n");
+  }
 
-    // Epilogue
-    printf(".L.return.%s:\n", fn->name);
-    printf("  mov r12, [rbp-8]\n");
-    printf("  mov r13, [rbp-16]\n");
-    printf("  mov r14, [rbp-24]\n");
-    printf("  mov r15, [rbp-32]\n");
-    printf("  mov rsp, rbp\n");
-    printf("  pop rbp\n");
-    printf("  ret\n");
+  if (i < len) {
+    printf("  .byte ");
+    for (int j = i; j < len; j++)
+      printf(j > i ? ", %d" : "%d", (unsigned char)buf[j]);
+    printf("\n");
   }
 }
 
-static void emit_data(Var *globals) {
-  printf(".data\n");
+// Emits the initial value of an object. Character arrays are written
+// as text and other objects as words, with the addresses of other
+// variables at the offsets of their relocations.
+static void emit_bytes(Type *ty, char *buf, int len, Relocation *rel) {
+  if (ty->kind == TY_ARRAY && ty->base->size == 1) {
+    for (int i = 0; i < len; i += 64) {
+      printf("  .ascii ");
+      print_quoted(buf + i, (len - i < 64) ? len - i : 64);
+      printf("\n");
+    }
+    return;
+  }
+
+  int i = 0;
+  for (; rel; rel = rel->next) {
+    emit_words(buf, i, rel->offset);
+    if (rel->addend)
+      printf("  .quad %s%+ld\n", rel->var->name, rel->addend);
+    else
+      printf("  .quad %s\n", rel->var->name);
+    i = rel->offset + 8;
+  }
+  emit_words(buf, i, len);
+}
 
-  for (Var *gvar = globals; gvar; gvar = gvar->next) {
-    printf("%s:\n", gvar->name);
+// A string literal can be put in a section of mergeable strings if
+// it is a single NUL-terminated string.
+static bool is_mergeable(Var *var) {
+  int len = var->ty->size;
+  return len > 0 && !var->init_data[len - 1] && !memchr(var->init_data, 0, len - 1);
+}
+
+static char *cur_section;
+
+// Switches sections only if needed, so that consecutive variables
+// of the same section are emitted together.
+static void section(char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  char *sect = vformat(fmt, ap);
+  va_end(ap);
+
+  if (cur_section && !strcmp(cur_section, sect))
+    return;
+  printf("%s\n", sect);
+  cur_section = sect;
+}
 
-    if (!gvar->init_data) {
-      printf("  .zero %d\n", gvar->ty->size);
+// Literals that are the tail of a longer one, e.g. "bar" of "foobar",
+// are not emitted but point into the longer one.
+static HashMap tails; // Var -> the literal it is a tail of
+static int ntails;
+static int tail_bytes;
+
+// Orders strings by their reversed contents, descending, so that a
+// string comes right after the strings it is a tail of, or after
+// other strings that have it as a tail.
+static int cmp_reversed(const void *a, const void *b) {
+  Var *x = *(Var **)a;
+  Var *y = *(Var **)b;
+  int i = x->ty->size - 2;
+  int j = y->ty->size - 2;
+  for (; i >= 0 && j >= 0; i--, j--)
+    if (x->init_data[i] != y->init_data[j])
+      return (unsigned char)y->init_data[j] - (unsigned char)x->init_data[i];
+  return (j >= 0) - (i >= 0);
+}
+
+static bool is_tail(Var *var, Var *of) {
+  int len = var->ty->size;
+  return len <= of->ty->size &&
+         !memcmp(var->init_data, of->init_data + of->ty->size - len, len);
+}
+
+static void merge_tails(Var *globals) {
+  int n = 0;
+  for (Var *var = globals; var; var = var->next)
+    if (var->is_string && is_mergeable(var))
+      n++;
+
+  Var **strs = calloc(n, sizeof(Var *));
+  n = 0;
+  for (Var *var = globals; var; var = var->next)
+    if (var->is_string && is_mergeable(var))
+      strs[n++] = var;
+  qsort(strs, n, sizeof(Var *), cmp_reversed);
+
+  hashmap_clear(&tails);
+  Var *last = NULL;
+  for (int i = 0; i < n; i++) {
+    if (last && is_tail(strs[i], last)) {
+      hashmap_put(&tails, strs[i], last);
+      ntails++;
+      tail_bytes += strs[i]->ty->size;
       continue;
     }
+    last = strs[i];
+  }
+  free(strs);
+}
+
+void print_string_pool_report(FILE *out) {
+  fprintf(out, "string pool: %d duplicate literals removed, %d merged into the tail "
+          "of another, %d bytes of .rodata saved\n",
+          npooled_strings, ntails, pooled_string_bytes + tail_bytes);
+}
 
-    for (int i = 0; i < gvar->ty->size; i++)
-      printf("  .byte %d\n", gvar->init_data[i]);
+static void emit_string(Var *var) {
+  if (is_mergeable(var)) {
+    Var *of = hashmap_get(&tails, var);
+    if (of) {
+      printf("  .set %s, %s+%d\n", var->name, of->name, of->ty->size - var->ty->size);
+      return;
+    }
+
+    // The linker merges identical strings across object files.
+    section(".section .rodata.str1.1,\"aMS\",@progbits,1");
+    printf("%s:\n", var->name);
+    printf("  .string ");
+    print_quoted(var->init_data, var->ty->size - 1);
+    printf("\n");
+    return;
+  }
+
+  if (opt_data_sections)
+    section(".section .rodata.%s,\"a\",@progbits", var->name);
+  else
+    section(".section .rodata");
+  printf("%s:\n", var->name);
+  emit_bytes(var->ty, var->init_data, var->ty->size, NULL);
+}
+
+static bool is_bss(Var *var) {
+  return !var->is_readonly &&
+         (!var->init_data || (!var->rel && is_zero(var->init_data, var->ty->size)));
+}
+
+static void emit_gvar(Var *gvar) {
+  if (gvar->is_readonly && opt_pie && gvar->rel) {
+    // The addresses in a position-independent executable are known
+    // only when it is loaded, so the dynamic loader has to write them.
+    if (opt_data_sections)
+      section(".section .data.rel.ro.%s,\"aw\",@progbits", gvar->name);
+    else
+      section(".section .data.rel.ro,\"aw\",@progbits");
+  } else if (gvar->is_readonly) {
+    if (opt_data_sections)
+      section(".section .rodata.%s,\"a\",@progbits", gvar->name);
+    else
+      section(".section .rodata");
+  } else {
+    char *sect = is_bss(gvar) ? "bss" : "data";
+    if (opt_data_sections)
+      section(".section .%s.%s,\"aw\",@%s", sect, gvar->name,
+              is_bss(gvar) ? "nobits" : "progbits");
+    else
+      section(".%s", sect);
   }
+
+  // Like GCC, arrays of 16 bytes or more are aligned to 16 bytes.
+  int align = gvar->ty->align;
+  if (gvar->ty->kind == TY_ARRAY && gvar->ty->size >= 16 && align < 16)
+    align = 16;
+
+  printf("  .align %d\n", align);
+  printf("  .type %s, @object\n", gvar->name);
+  printf("  .size %s, %d\n", gvar->name, gvar->ty->size);
+  printf("%s:\n", gvar->name);
+
+  if (is_bss(gvar))
+    printf("  .zero %d\n", gvar->ty->size);
+  else
+    emit_bytes(gvar->ty, gvar->init_data, gvar->ty->size, gvar->rel);
+}
+
+// Emits global variables. Variables that are all zeros go to .bss,
+// which takes no space in the object file, and string literals and
+// read-only variables to read-only sections. Identical literals were
+// already merged by the parser. Variables are grouped by section.
+static void emit_data(Var *globals) {
+  merge_tails(globals);
+  for (Var *gvar = globals; gvar; gvar = gvar->next)
+    if (gvar->is_string)
+      emit_string(gvar);
+  for (Var *gvar = globals; gvar; gvar = gvar->next)
+    if (!gvar->is_string && gvar->is_readonly)
+      emit_gvar(gvar);
+  for (Var *gvar = globals; gvar; gvar = gvar->next)
+    if (!gvar->is_string && !gvar->is_readonly && !is_bss(gvar))
+      emit_gvar(gvar);
+  for (Var *gvar = globals; gvar; gvar = gvar->next)
+    if (!gvar->is_string && is_bss(gvar))
+      emit_gvar(gvar);
 }
 
 void codegen(Program *prog) {
+  if (opt_icf)
+    fold_identical_data(prog);
+
+  Function **funcs = bottom_up_order(prog);
+  for (int i = 0; funcs[i]; i++)
+    gen_func(funcs[i]);
+
+  if (opt_icf)
+    fold_identical_code(prog);
+
+  if (opt_size)
+    outline_functions(prog);
+
   printf(".intel_syntax noprefix\n");
   emit_data(prog->globals);
   emit_text(prog->funcs);
@@ -0,0 +1,296 @@
+// Constant propagation.
+//
+// Replaces a read of a local variable with a number if every
+// definition of the variable that reaches the read assigns that
+// same number, e.g. `x` in `int x = 3; return x + 1;`. Reaching
+// definitions are computed by dataflow.c.
+//
+// Functions too large for dataflow analysis within the compile-time
+// budget are handled by a cheaper algorithm, which only propagates
+// values from assignments in the same basic block.
+#include "occ.h"
+
+typedef struct {
+  Var *var;
+  bool is_const; // `x = <num>;` as a whole statement
+  int val;
+} Def;
+
+// Definitions 0 to nvars-1 stand for the values variables
+// have on entry to the function (parameters or garbage).
+static Def *defs;
+static int ndefs;
+static int defs_cap;
+
+static BitSet **defs_of; // Definitions of each variable
+static BitSet *excluded; // Variables defined within the current statement
+
+static Function *cur_fn;
+
+// Reaching definitions, or NULL with the cheaper algorithm, which
+// knows the value of a variable if local_block[id] is the current
+// block.
+static BitSet *reach;
+static int *local_block;
+static int *local_val;
+static int cur_block;
+
+static void add_def(Var *var, bool is_const, int val) {
+  if (ndefs == defs_cap) {
+    defs_cap = defs_cap ? defs_cap * 2 : 64;
+    defs = realloc(defs, sizeof(Def) * defs_cap);
+  }
+  defs[ndefs++] = (Def){var, is_const, val};
+}
+
+static bool is_tracked(Node *node) {
+  return node->kind == ND_VAR && node->var->is_local && node->var->id >= 0;
+}
+
+static void find_defs(Node *node) {
+  if (!node)
+    return;
+
+  if (node->kind == ND_ASSIGN && is_tracked(node->lhs))
+    add_def(node->lhs->var, false, 0);
+
+  find_defs(node->lhs);
+  find_defs(node->rhs);
+  find_defs(node->cond);
+  find_defs(node->then);
+  find_defs(node->els);
+  find_defs(node->init);
+  find_defs(node->inc);
+  for (Node *n = node->body; n; n = n->next)
+    find_defs(n);
+  for (Node *n = node->args; n; n = n->next)
+    find_defs(n);
+}
+
+// Returns true if a number keeps its value when it is stored
+// to a variable of the given type.
+static bool fits(Type *ty, int val) {
+  switch (ty->kind) {
+    case TY_BOOL:
+      return val == 0 || val == 1;
+    case TY_CHAR:
+      return -128 <= val && val <= 127;
+    case TY_INT:
+    case TY_ENUM:
+      return true;
+  }
+  return false;
+}
+
+// Adds the definitions of a statement to the list. The first one
+// is the statement's own definition, if it has one.
+static void add_insn_defs(Node *node) {
+  Var *var = insn_def(node);
+  if (!var) {
+    find_defs(node);
+    return;
+  }
+
+  Node *rhs = node->lhs->rhs;
+  bool is_const = rhs->kind == ND_NUM && fits(var->ty, rhs->val);
+  add_def(var, is_const, rhs->val);
+  find_defs(rhs);
+}
+
+// Applies the effect of a statement whose definitions are
+// defs[first] to defs[last-1] to a set of reaching definitions.
+static void apply_insn(Node *node, int first, int last, BitSet *gen, BitSet *kill) {
+  Var *var = insn_def(node);
+  if (var) {
+    bitset_diff(gen, defs_of[var->id]);
+    if (kill)
+      bitset_union(kill, defs_of[var->id]);
+  }
+  for (int i = first; i < last; i++)
+    bitset_set(gen, i);
+}
+
+// Returns true and sets *val if all definitions of a variable
+// in `reach` assign the same number.
+static bool const_value(Var *var, BitSet *reach, int *val) {
+  bool found = false;
+
+  for (int i = 0; i < ndefs; i += 64) {
+    uint64_t w = defs_of[var->id]->words[i / 64] & reach->words[i / 64];
+    for (; w; w &= w - 1) {
+      Def *def = &defs[i + __builtin_ctzll(w)];
+      if (!def->is_const || (found && def->val != *val))
+        return false;
+      *val = def->val;
+      found = true;
+    }
+  }
+  return found;
+}
+
+static bool known_value(Var *var, int *val) {
+  if (reach)
+    return const_value(var, reach, val);
+  if (local_block[var->id] != cur_block)
+    return false;
+  *val = local_val[var->id];
+  return true;
+}
+
+static void replace_uses(Node **slot) {
+  Node *node = *slot;
+  if (!node)
+    return;
+
+  if (is_tracked(node) && !bitset_test(excluded, node->var->id)) {
+    int val;
+    if (known_value(node->var, &val) && use_fuel("constprop", cur_fn)) {
+      Node *num = calloc(1, sizeof(Node));
+      num->kind = ND_NUM;
+      num->val = val;
+      num->ty = ty_int;
+      num->next = node->next;
+      *slot = num;
+    }
+    return;
+  }
+
+  // The left-hand side of `x = ...` is not a read.
+  if (node->kind != ND_ASSIGN || !is_tracked(node->lhs))
+    replace_uses(&node->lhs);
+
+  replace_uses(&node->rhs);
+  replace_uses(&node->cond);
+  replace_uses(&node->then);
+  replace_uses(&node->els);
+  replace_uses(&node->init);
+  replace_uses(&node->inc);
+  for (Node **p = &node->body; *p; p = &(*p)->next)
+    replace_uses(p);
+  for (Node **p = &node->args; *p; p = &(*p)->next)
+    replace_uses(p);
+}
+
+// Propagates values within basic blocks only. Definitions are
+// enumerated one statement at a time, so this takes time linear
+// in the size of the function.
+static void propagate_local(CFG *cfg, int nvars) {
+  reach = NULL;
+  excluded = new_bitset(nvars);
+  local_block = calloc(nvars, sizeof(int));
+  local_val = calloc(nvars, sizeof(int));
+
+  for (int i = 0; i < cfg->nreachable; i++) {
+    BasicBlock *bb = cfg->blocks[i];
+    cur_block = i + 1;
+
+    for (int j = 0; j < bb->ninsns; j++) {
+      Node *node = *bb->insns[j];
+      Var *var = insn_def(node);
+      ndefs = 0;
+      add_insn_defs(node);
+
+      for (int k = var ? 1 : 0; k < ndefs; k++)
+        bitset_set(excluded, defs[k].var->id);
+      replace_uses(bb->insns[j]);
+      for (int k = 0; k < ndefs; k++) {
+        bitset_clear(excluded, defs[k].var->id);
+        local_block[defs[k].var->id] = 0;
+      }
+
+      if (var && defs[0].is_const) {
+        local_block[var->id] = cur_block;
+        local_val[var->id] = defs[0].val;
+      }
+    }
+  }
+}
+
+static void propagate(Function *fn) {
+  int nvars = track_vars(fn);
+  if (nvars == 0)
+    return;
+
+  CFG *cfg = build_cfg(fn);
+  if (!cfg)
+    return;
+
+  cur_fn = fn;
+  if (!within_budget(fn, "constprop")) {
+    propagate_local(cfg, nvars);
+    return;
+  }
+
+  // Enumerate definitions.
+  ndefs = 0;
+  for (Var *var = fn->locals; var; var = var->next)
+    if (var->id >= 0)
+      add_def(var, false, 0);
+
+  int **first_def = calloc(cfg->nblocks, sizeof(int *));
+  for (int i = 0; i < cfg->nblocks; i++) {
+    BasicBlock *bb = cfg->blocks[i];
+    first_def[i] = calloc(bb->ninsns + 1, sizeof(int));
+    for (int j = 0; j < bb->ninsns; j++) {
+      first_def[i][j] = ndefs;
+      add_insn_defs(*bb->insns[j]);
+    }
+    first_def[i][bb->ninsns] = ndefs;
+  }
+
+  defs_of = calloc(nvars, sizeof(BitSet *));
+  for (int i = 0; i < nvars; i++)
+    defs_of[i] = new_bitset(ndefs);
+  for (int i = 0; i < ndefs; i++)
+    bitset_set(defs_of[defs[i].var->id], i);
+
+  // Solve reaching definitions.
+  Dataflow df = {};
+  df.forward = true;
+  df.may = true;
+  df.nbits = ndefs;
+  df.boundary = new_bitset(ndefs);
+  for (int i = 0; i < nvars; i++)
+    bitset_set(df.boundary, i);
+
+  df.gen = calloc(cfg->nblocks, sizeof(BitSet *));
+  df.kill = calloc(cfg->nblocks, sizeof(BitSet *));
+  for (int i = 0; i < cfg->nblocks; i++) {
+    BasicBlock *bb = cfg->blocks[i];
+    df.gen[i] = new_bitset(ndefs);
+    df.kill[i] = new_bitset(ndefs);
+    for (int j = 0; j < bb->ninsns; j++)
+      apply_insn(*bb->insns[j], first_def[i][j], first_def[i][j + 1],
+                 df.gen[i], df.kill[i]);
+  }
+  solve_dataflow(cfg, &df);
+
+  // Rewrite reads of variables with a known value.
+  reach = new_bitset(ndefs);
+  excluded = new_bitset(nvars);
+
+  for (int i = 0; i < cfg->nreachable; i++) {
+    BasicBlock *bb = cfg->blocks[i];
+    bitset_copy(reach, df.in[i]);
+
+    for (int j = 0; j < bb->ninsns; j++) {
+      int first = first_def[i][j];
+      int last = first_def[i][j + 1];
+      Node *node = *bb->insns[j];
+
+      // A variable assigned within an expression may have
+      // different values in different parts of it.
+      memset(excluded->words, 0, ((nvars + 63) / 64) * sizeof(uint64_t));
+      for (int k = insn_def(node) ? first + 1 : first; k < last; k++)
+        bitset_set(excluded, defs[k].var->id);
+
+      replace_uses(bb->insns[j]);
+      apply_insn(node, first, last, reach, NULL);
+    }
+  }
+}
+
+void propagate_constants(Program *prog) {
+  for (Function *fn = prog->funcs; fn; fn = fn->next)
+    propagate(fn);
+}
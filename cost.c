@@ -0,0 +1,260 @@
+// Static cost model of the generated code.
+//
+// This file looks at the assembly emitted by codegen and estimates
+// how large and how expensive each function is. It doesn't run an
+// assembler; instruction sizes are computed from a simplified model
+// of the x86-64 encoding and cycle counts come from a latency table.
+#include "occ.h"
+
+typedef struct {
+  char mnemonic[16];
+  char *ops[3];
+  int nops;
+} Insn;
+
+// Approximate latencies in cycles of a modern x86-64 core.
+// Instructions not listed here are assumed to take one cycle.
+static struct {
+  char *mnemonic;
+  int latency;
+} latency_table[] = {
+  {"imul", 3}, {"idiv", 42}, {"call", 3}, {"ret", 2},
+  {"push", 3}, {"pop", 2},
+};
+
+// Extra latency of an instruction that reads memory.
+static int load_latency = 4;
+
+static char *skip_space(char *p) {
+  while (*p == ' ' || *p == '\t')
+    p++;
+  return p;
+}
+
+// Returns true if the given line is an instruction as opposed to
+// a label or an assembler directive.
+bool is_insn(char *line) {
+  char *p = skip_space(line);
+  if (*p == '\0' || *p == '.')
+    return false;
+  return p[strlen(p) - 1] != ':';
+}
+
+static bool parse_insn(char *line, Insn *insn) {
+  if (!is_insn(line))
+    return false;
+
+  char *p = skip_space(line);
+  int len = 0;
+  while (*p && *p != ' ' && len < sizeof(insn->mnemonic) - 1)
+    insn->mnemonic[len++] = *p++;
+  insn->mnemonic[len] = '\0';
+
+  insn->nops = 0;
+  p = skip_space(p);
+  while (*p && insn->nops < 3) {
+    char *end = strchr(p, ',');
+    if (!end)
+      end = p + strlen(p);
+    insn->ops[insn->nops++] = strndup(p, end - p);
+    p = *end ? skip_space(end + 1) : end;
+  }
+  return true;
+}
+
+static bool is_mem(char *op) {
+  return strchr(op, '[');
+}
+
+// Returns the width in bytes of the given register operand,
+// or 0 if the operand is not a register.
+static int reg_width(char *op) {
+  static char *r64[] = {"rax", "rbx", "rcx", "rdx", "rsi", "rdi", "rbp", "rsp"};
+  static char *r32[] = {"eax", "ebx", "ecx", "edx", "esi", "edi", "ebp", "esp"};
+  static char *r8[] = {"al", "bl", "cl", "dl", "sil", "dil", "bpl", "spl"};
+
+  for (int i = 0; i < sizeof(r64) / sizeof(*r64); i++) {
+    if (!strcmp(op, r64[i]))
+      return 8;
+    if (!strcmp(op, r32[i]))
+      return 4;
+    if (!strcmp(op, r8[i]))
+      return 1;
+  }
+
+  // r8-r15 and their subregisters
+  if (op[0] == 'r' && isdigit(op[1])) {
+    char *p = op + 1;
+    while (isdigit(*p))
+      p++;
+    if (*p == '\0')
+      return 8;
+    if (!strcmp(p, "d"))
+      return 4;
+    if (!strcmp(p, "b"))
+      return 1;
+  }
+  return 0;
+}
+
+// Returns true if encoding the operand needs a REX prefix.
+static bool needs_rex(char *op) {
+  if (reg_width(op) == 8)
+    return true;
+  if (!strcmp(op, "sil") || !strcmp(op, "dil") ||
+      !strcmp(op, "bpl") || !strcmp(op, "spl"))
+    return true;
+
+  // Any operand that refers to r8-r15
+  char *p = strchr(op, '[');
+  p = p ? p + 1 : op;
+  return p[0] == 'r' && isdigit(p[1]);
+}
+
+// Returns the number of SIB and displacement bytes of a memory operand.
+static int mem_size(char *op) {
+  char *p = strchr(op, '[') + 1;
+
+  if (!strncmp(p, "rip", 3))
+    return 4;
+
+  int size = 0;
+  if (!strncmp(p, "rsp", 3) || !strncmp(p, "r12", 3))
+    size++; // SIB
+
+  char *disp = strpbrk(p, "+-");
+  if (!disp) {
+    // [rbp] and [r13] need a zero displacement.
+    if (!strncmp(p, "rbp", 3) || !strncmp(p, "r13", 3))
+      size++;
+    return size;
+  }
+
+  long val = strtol(disp, NULL, 10);
+  return size + ((-128 <= val && val <= 127) ? 1 : 4);
+}
+
+static int imm_size(Insn *insn, char *op) {
+  // mov and symbol addresses always take a 32-bit immediate.
+  if (!strcmp(insn->mnemonic, "mov") || !strncmp(op, "offset ", 7))
+    return 4;
+
+  long val = strtol(op, NULL, 10);
+  return (-128 <= val && val <= 127) ? 1 : 4;
+}
+
+static bool is_imm(char *op) {
+  return isdigit(*op) || *op == '-' || !strncmp(op, "offset ", 7);
+}
+
+// Estimates the encoded size in bytes of an instruction.
+int insn_size(char *line) {
+  Insn insn;
+  if (!parse_insn(line, &insn))
+    return 0;
+
+  char *m = insn.mnemonic;
+  if (!strcmp(m, "ret"))
+    return 1;
+  if (!strcmp(m, "cqo"))
+    return 2;
+  if (!strcmp(m, "call") || !strcmp(m, "jmp"))
+    return 5;
+  if (m[0] == 'j')
+    return 6;
+  if (!strcmp(m, "push") || !strcmp(m, "pop"))
+    return 1 + (insn.ops[0][0] == 'r' && isdigit(insn.ops[0][1]));
+
+  // Opcode and ModRM byte
+  int size = 2;
+  if (!strncmp(m, "movsx", 5) || !strncmp(m, "movzx", 5) ||
+      !strcmp(m, "imul") || !strncmp(m, "set", 3))
+    size++;
+
+  bool rex = false;
+  for (int i = 0; i < insn.nops; i++) {
+    char *op = insn.ops[i];
+    if (needs_rex(op))
+      rex = true;
+    if (is_mem(op))
+      size += mem_size(op);
+    else if (i > 0 && is_imm(op))
+      size += imm_size(&insn, op);
+  }
+  return size + rex;
+}
+
+static int insn_latency(char *line) {
+  Insn insn;
+  if (!parse_insn(line, &insn))
+    return 0;
+
+  int latency = 1;
+  for (int i = 0; i < sizeof(latency_table) / sizeof(*latency_table); i++)
+    if (!strcmp(insn.mnemonic, latency_table[i].mnemonic))
+      latency = latency_table[i].latency;
+
+  // Reads from memory. Stores and lea don't wait for a load.
+  if (strcmp(insn.mnemonic, "lea"))
+    for (int i = 1; i < insn.nops; i++)
+      if (is_mem(insn.ops[i]))
+        latency += load_latency;
+  return latency;
+}
+
+static bool is_caller_saved_push(char *line, char *mnemonic) {
+  Insn insn;
+  if (!parse_insn(line, &insn) || strcmp(insn.mnemonic, mnemonic))
+    return false;
+  return !strcmp(insn.ops[0], "r10") || !strcmp(insn.ops[0], "r11");
+}
+
+static void func_cost(Function *fn, FILE *out) {
+  int insns = 0, bytes = 0, cycles = 0;
+  int spills = 0, reloads = 0, calls = 0;
+
+  for (int i = 0; i < fn->code.len; i++) {
+    char *line = fn->code.data[i];
+    if (!is_insn(line))
+      continue;
+
+    insns++;
+    bytes += insn_size(line);
+    cycles += insn_latency(line);
+
+    // Caller-saved registers are spilled around calls.
+    if (is_caller_saved_push(line, "push"))
+      spills++;
+    else if (is_caller_saved_push(line, "pop"))
+      reloads++;
+    else if (!strncmp(skip_space(line), "call ", 5))
+      calls++;
+  }
+
+  // A function folded into another one has no frame of its own.
+  bool folded = fn->folded_into;
+  fprintf(out, "    {\"name\": \"%s\", \"instructions\": %d, \"bytes\": %d, "
+          "\"stack_size\": %d, \"callee_saved\": [",
+          fn->name, insns, bytes, folded ? 0 : fn->stack_size);
+
+  // The expression stack is r10, r11, r12, ..., r15;
+  // r12 and above are callee-saved.
+  for (int i = 2; !folded && i < fn->nregs; i++)
+    fprintf(out, "%s\"r%d\"", i == 2 ? "" : ", ", 10 + i);
+
+  fprintf(out, "], \"spills\": %d, \"reloads\": %d, \"calls\": %d, "
+          "\"cycles\": %d}",
+          spills, reloads, calls, cycles);
+}
+
+// Prints the per-function cost report as JSON.
+void cost_report(Program *prog, FILE *out) {
+  fprintf(out, "{\n");
+  fprintf(out, "  \"functions\": [\n");
+  for (Function *fn = prog->funcs; fn; fn = fn->next) {
+    func_cost(fn, out);
+    fprintf(out, fn->next ? ",\n" : "\n");
+  }
+  fprintf(out, "  ]\n");
+  fprintf(out, "}\n");
+}
@@ -0,0 +1,529 @@
+// Dataflow analysis over the control flow graph of a function.
+//
+// The parser produces a tree, so this file first lowers the body
+// of a function to basic blocks. The statements and conditions in
+// a block stay AST nodes; an analysis looks at them one by one.
+// Any bit-vector problem (liveness, reaching definitions, ...) is
+// then solved by a single worklist solver in reverse postorder.
+#include "occ.h"
+
+//
+// Bit sets
+//
+
+BitSet *new_bitset(int nbits) {
+  BitSet *set = calloc(1, sizeof(BitSet));
+  set->nbits = nbits;
+  set->words = calloc((nbits + 63) / 64 + 1, sizeof(uint64_t));
+  return set;
+}
+
+static int nwords(BitSet *set) {
+  return (set->nbits + 63) / 64;
+}
+
+void bitset_set(BitSet *set, int i) {
+  set->words[i / 64] |= (uint64_t)1 << (i % 64);
+}
+
+void bitset_clear(BitSet *set, int i) {
+  set->words[i / 64] &= ~((uint64_t)1 << (i % 64));
+}
+
+bool bitset_test(BitSet *set, int i) {
+  return set->words[i / 64] & ((uint64_t)1 << (i % 64));
+}
+
+void bitset_copy(BitSet *dst, BitSet *src) {
+  memcpy(dst->words, src->words, nwords(dst) * sizeof(uint64_t));
+}
+
+void bitset_union(BitSet *dst, BitSet *src) {
+  for (int i = 0; i < nwords(dst); i++)
+    dst->words[i] |= src->words[i];
+}
+
+void bitset_diff(BitSet *dst, BitSet *src) {
+  for (int i = 0; i < nwords(dst); i++)
+    dst->words[i] &= ~src->words[i];
+}
+
+static void bitset_intersect(BitSet *dst, BitSet *src) {
+  for (int i = 0; i < nwords(dst); i++)
+    dst->words[i] &= src->words[i];
+}
+
+void bitset_fill(BitSet *set) {
+  memset(set->words, 0xff, nwords(set) * sizeof(uint64_t));
+  if (set->nbits % 64)
+    set->words[set->nbits / 64] = ((uint64_t)1 << (set->nbits % 64)) - 1;
+}
+
+// dst = gen | (src & ~kill). Returns true if dst has changed.
+static bool transfer(BitSet *dst, BitSet *gen, BitSet *src, BitSet *kill) {
+  bool changed = false;
+  for (int i = 0; i < nwords(dst); i++) {
+    uint64_t w = gen->words[i] | (src->words[i] & ~kill->words[i]);
+    if (w != dst->words[i]) {
+      dst->words[i] = w;
+      changed = true;
+    }
+  }
+  return changed;
+}
+
+// Returns the lowest set bit at or above `from`, or -1.
+static int next_bit(BitSet *set, int from) {
+  for (int i = from / 64; i < nwords(set); i++) {
+    uint64_t w = set->words[i];
+    if (i == from / 64)
+      w &= ~(uint64_t)0 << (from % 64);
+    if (w)
+      return i * 64 + __builtin_ctzll(w);
+  }
+  return -1;
+}
+
+//
+// Control flow graph
+//
+
+static BasicBlock **all_blocks;
+static int nall_blocks;
+static int all_blocks_cap;
+
+static BasicBlock *brk_target;
+static BasicBlock *cont_target;
+static BasicBlock *switch_block;
+static BasicBlock *exit_block;
+static bool unsupported;
+
+static BasicBlock *new_block(void) {
+  BasicBlock *bb = calloc(1, sizeof(BasicBlock));
+  if (nall_blocks == all_blocks_cap) {
+    all_blocks_cap = all_blocks_cap ? all_blocks_cap * 2 : 64;
+    all_blocks = realloc(all_blocks, sizeof(BasicBlock *) * all_blocks_cap);
+  }
+  all_blocks[nall_blocks++] = bb;
+  return bb;
+}
+
+static void push_block(BasicBlock ***arr, int *len, BasicBlock *bb) {
+  // Capacity is doubled at every power of two.
+  if ((*len & (*len - 1)) == 0)
+    *arr = realloc(*arr, sizeof(BasicBlock *) * (*len ? *len * 2 : 1));
+  (*arr)[(*len)++] = bb;
+}
+
+static void add_edge(BasicBlock *from, BasicBlock *to) {
+  push_block(&from->succs, &from->nsuccs, to);
+  push_block(&to->preds, &to->npreds, from);
+}
+
+// Returns true if an expression contains a jump out of itself,
+// e.g. `({ break; })` or `({ return 1; })`. Such jumps are not
+// modeled by the CFG.
+static bool has_jump(Node *node, bool in_loop, bool in_switch) {
+  if (!node)
+    return false;
+
+  switch (node->kind) {
+    case ND_RETURN:
+      return true;
+    case ND_BREAK:
+      return !in_loop && !in_switch;
+    case ND_CONTINUE:
+      return !in_loop;
+    case ND_CASE:
+      return !in_switch;
+    case ND_FOR:
+    case ND_WHILE:
+      in_loop = true;
+      break;
+    case ND_SWITCH:
+      in_switch = true;
+      break;
+  }
+
+  if (has_jump(node->lhs, in_loop, in_switch) ||
+      has_jump(node->rhs, in_loop, in_switch) ||
+      has_jump(node->cond, in_loop, in_switch) ||
+      has_jump(node->then, in_loop, in_switch) ||
+      has_jump(node->els, in_loop, in_switch) ||
+      has_jump(node->init, in_loop, in_switch) ||
+      has_jump(node->inc, in_loop, in_switch))
+    return true;
+
+  for (Node *n = node->body; n; n = n->next)
+    if (has_jump(n, in_loop, in_switch))
+      return true;
+  for (Node *n = node->args; n; n = n->next)
+    if (has_jump(n, in_loop, in_switch))
+      return true;
+  return false;
+}
+
+static void add_insn(BasicBlock *bb, Node **slot) {
+  Node *node = *slot;
+  if (node->kind == ND_RETURN || node->kind == ND_EXPR_STMT)
+    node = node->lhs;
+  if (has_jump(node, false, false))
+    unsupported = true;
+
+  if ((bb->ninsns & (bb->ninsns - 1)) == 0)
+    bb->insns = realloc(bb->insns, sizeof(Node **) * (bb->ninsns ? bb->ninsns * 2 : 1));
+  bb->insns[bb->ninsns++] = slot;
+}
+
+// Adds the statement at `slot` to the CFG. `cur` is the block
+// control reaches the statement from. Returns the block that
+// control leaves the statement to.
+static BasicBlock *build_stmt(Node **slot, BasicBlock *cur) {
+  Node *node = *slot;
+
+  switch (node->kind) {
+    case ND_IF: {
+      add_insn(cur, &node->cond);
+      BasicBlock *then = new_block();
+      BasicBlock *join = new_block();
+      add_edge(cur, then);
+      add_edge(build_stmt(&node->then, then), join);
+
+      if (node->els) {
+        BasicBlock *els = new_block();
+        add_edge(cur, els);
+        add_edge(build_stmt(&node->els, els), join);
+      } else {
+        add_edge(cur, join);
+      }
+      return join;
+    }
+    case ND_FOR:
+    case ND_WHILE: {
+      if (node->init)
+        cur = build_stmt(&node->init, cur);
+
+      BasicBlock *header = new_block();
+      BasicBlock *body = new_block();
+      BasicBlock *cont = new_block();
+      BasicBlock *join = new_block();
+      add_edge(cur, header);
+
+      if (node->cond) {
+        add_insn(header, &node->cond);
+        add_edge(header, join);
+      }
+      add_edge(header, body);
+
+      BasicBlock *brk = brk_target;
+      BasicBlock *cont2 = cont_target;
+      brk_target = join;
+      cont_target = cont;
+      add_edge(build_stmt(&node->then, body), cont);
+      brk_target = brk;
+      cont_target = cont2;
+
+      if (node->inc)
+        cont = build_stmt(&node->inc, cont);
+      add_edge(cont, header);
+      return join;
+    }
+    case ND_SWITCH: {
+      add_insn(cur, &node->cond);
+      BasicBlock *join = new_block();
+
+      BasicBlock *brk = brk_target;
+      BasicBlock *sw = switch_block;
+      brk_target = join;
+      switch_block = cur;
+      add_edge(build_stmt(&node->then, new_block()), join);
+      brk_target = brk;
+      switch_block = sw;
+
+      if (!node->default_case)
+        add_edge(cur, join);
+      return join;
+    }
+    case ND_CASE: {
+      BasicBlock *bb = new_block();
+      add_edge(cur, bb);
+      add_edge(switch_block, bb);
+      return build_stmt(&node->lhs, bb);
+    }
+    case ND_BLOCK:
+      for (Node **p = &node->body; *p; p = &(*p)->next)
+        cur = build_stmt(p, cur);
+      return cur;
+    case ND_BREAK:
+      add_edge(cur, brk_target);
+      return new_block();
+    case ND_CONTINUE:
+      add_edge(cur, cont_target);
+      return new_block();
+    case ND_RETURN:
+      add_insn(cur, slot);
+      add_edge(cur, exit_block);
+      return new_block();
+    case ND_EXPR_STMT:
+      add_insn(cur, slot);
+      return cur;
+    default:
+      error("invalid statement");
+  }
+}
+
+// Numbers blocks reachable from the entry in reverse postorder.
+// Unreachable blocks are numbered after them.
+static void number_blocks(CFG *cfg, BasicBlock *entry) {
+  BasicBlock **post = calloc(nall_blocks, sizeof(BasicBlock *));
+  int npost = 0;
+
+  // Iterative DFS. Each stack entry is a block and the index of
+  // the next successor to visit.
+  BasicBlock **stack = calloc(nall_blocks, sizeof(BasicBlock *));
+  int *next = calloc(nall_blocks, sizeof(int));
+  int sp = 0;
+
+  entry->reachable = true;
+  stack[sp++] = entry;
+  while (sp > 0) {
+    BasicBlock *bb = stack[sp - 1];
+    if (next[sp - 1] < bb->nsuccs) {
+      BasicBlock *succ = bb->succs[next[sp - 1]++];
+      if (!succ->reachable) {
+        succ->reachable = true;
+        next[sp] = 0;
+        stack[sp++] = succ;
+      }
+      continue;
+    }
+    post[npost++] = bb;
+    sp--;
+  }
+
+  cfg->blocks = calloc(nall_blocks, sizeof(BasicBlock *));
+  cfg->nblocks = nall_blocks;
+  cfg->nreachable = npost;
+
+  for (int i = 0; i < npost; i++)
+    cfg->blocks[i] = post[npost - 1 - i];
+
+  int n = npost;
+  for (int i = 0; i < nall_blocks; i++)
+    if (!all_blocks[i]->reachable)
+      cfg->blocks[n++] = all_blocks[i];
+
+  for (int i = 0; i < nall_blocks; i++)
+    cfg->blocks[i]->id = i;
+}
+
+// Builds the CFG of a function. Returns NULL if the function has
+// control flow the CFG can't represent.
+CFG *build_cfg(Function *fn) {
+  all_blocks = NULL;
+  nall_blocks = all_blocks_cap = 0;
+  brk_target = cont_target = switch_block = NULL;
+  unsupported = false;
+
+  BasicBlock *entry = new_block();
+  exit_block = new_block();
+  add_edge(build_stmt(&fn->node, entry), exit_block);
+
+  if (unsupported)
+    return NULL;
+
+  CFG *cfg = calloc(1, sizeof(CFG));
+  cfg->exit = exit_block;
+  number_blocks(cfg, entry);
+  return cfg;
+}
+
+//
+// Solver
+//
+
+// Solves a dataflow problem. Blocks are visited in reverse postorder
+// for forward problems and in postorder for backward ones, so that
+// an acyclic CFG is solved in a single pass. Unreachable blocks are
+// not visited; they keep the initial value of the problem.
+void solve_dataflow(CFG *cfg, Dataflow *df) {
+  int n = cfg->nblocks;
+  df->in = calloc(n, sizeof(BitSet *));
+  df->out = calloc(n, sizeof(BitSet *));
+
+  for (int i = 0; i < n; i++) {
+    df->in[i] = new_bitset(df->nbits);
+    df->out[i] = new_bitset(df->nbits);
+    if (!df->may) {
+      bitset_fill(df->in[i]);
+      bitset_fill(df->out[i]);
+    }
+  }
+
+  // The worklist is a set of positions in visiting order.
+  int nr = cfg->nreachable;
+  BitSet *worklist = new_bitset(nr);
+  for (int i = 0; i < nr; i++)
+    bitset_set(worklist, i);
+
+  BitSet *meet = new_bitset(df->nbits);
+  int pos = 0;
+
+  // `pos` is lowered whenever a block before it is added, so
+  // the next block to visit is always at or after it.
+  while ((pos = next_bit(worklist, pos)) != -1) {
+    bitset_clear(worklist, pos);
+    BasicBlock *bb = cfg->blocks[df->forward ? pos : nr - 1 - pos];
+
+    BasicBlock **from = df->forward ? bb->preds : bb->succs;
+    int nfrom = df->forward ? bb->npreds : bb->nsuccs;
+    BitSet **from_sets = df->forward ? df->out : df->in;
+
+    if ((df->forward && bb->id == 0) || (!df->forward && bb == cfg->exit)) {
+      bitset_copy(meet, df->boundary);
+    } else {
+      if (df->may)
+        memset(meet->words, 0, nwords(meet) * sizeof(uint64_t));
+      else
+        bitset_fill(meet);
+
+      for (int i = 0; i < nfrom; i++) {
+        if (df->may)
+          bitset_union(meet, from_sets[from[i]->id]);
+        else
+          bitset_intersect(meet, from_sets[from[i]->id]);
+      }
+    }
+
+    BitSet *before = df->forward ? df->in[bb->id] : df->out[bb->id];
+    BitSet *after = df->forward ? df->out[bb->id] : df->in[bb->id];
+    bitset_copy(before, meet);
+    if (!transfer(after, df->gen[bb->id], meet, df->kill[bb->id]))
+      continue;
+
+    BasicBlock **to = df->forward ? bb->succs : bb->preds;
+    int nto = df->forward ? bb->nsuccs : bb->npreds;
+    for (int i = 0; i < nto; i++) {
+      if (!to[i]->reachable)
+        continue;
+      int p = df->forward ? to[i]->id : nr - 1 - to[i]->id;
+      bitset_set(worklist, p);
+      if (p < pos)
+        pos = p;
+    }
+  }
+}
+
+//
+// Variables
+//
+
+static bool is_scalar(Type *ty) {
+  return is_integer(ty) || ty->kind == TY_PTR;
+}
+
+// Assigns an index to each local variable that can be tracked by
+// dataflow analyses and sets the others' index to -1. A variable is
+// tracked if it is a scalar whose address is never taken, so that it
+// can only be accessed by name. Returns the number of tracked
+// variables.
+int track_vars(Function *fn) {
+  mark_address_taken(fn);
+
+  int n = 0;
+  for (Var *var = fn->locals; var; var = var->next)
+    var->id = (!var->is_addr_taken && is_scalar(var->ty)) ? n++ : -1;
+  return n;
+}
+
+static bool is_tracked(Node *node) {
+  return node->kind == ND_VAR && node->var->is_local && node->var->id >= 0;
+}
+
+// Returns the variable a statement assigns to as a whole,
+// i.e. `x` of `x = expr;`, or NULL.
+Var *insn_def(Node *node) {
+  if (node->kind == ND_EXPR_STMT && node->lhs->kind == ND_ASSIGN &&
+      is_tracked(node->lhs->lhs))
+    return node->lhs->lhs->var;
+  return NULL;
+}
+
+static void add_uses(Node *node, BitSet *set) {
+  if (!node)
+    return;
+
+  if (is_tracked(node))
+    bitset_set(set, node->var->id);
+
+  add_uses(node->lhs, set);
+  add_uses(node->rhs, set);
+  add_uses(node->cond, set);
+  add_uses(node->then, set);
+  add_uses(node->els, set);
+  add_uses(node->init, set);
+  add_uses(node->inc, set);
+  for (Node *n = node->body; n; n = n->next)
+    add_uses(n, set);
+  for (Node *n = node->args; n; n = n->next)
+    add_uses(n, set);
+}
+
+// Adds the tracked variables a statement or condition may read to
+// `set`. The variable of `x = expr;` is written, not read.
+void insn_uses(Node *node, BitSet *set) {
+  if (insn_def(node))
+    add_uses(node->lhs->rhs, set);
+  else
+    add_uses(node, set);
+}
+
+//
+// Liveness
+//
+
+// Computes the set of tracked variables live at the entry and
+// exit of each block.
+Dataflow *liveness(CFG *cfg, int nvars) {
+  Dataflow *df = calloc(1, sizeof(Dataflow));
+  df->forward = false;
+  df->may = true;
+  df->nbits = nvars;
+  df->boundary = new_bitset(nvars);
+  df->gen = calloc(cfg->nblocks, sizeof(BitSet *));
+  df->kill = calloc(cfg->nblocks, sizeof(BitSet *));
+
+  for (int i = 0; i < cfg->nblocks; i++) {
+    BasicBlock *bb = cfg->blocks[i];
+    BitSet *use = df->gen[i] = new_bitset(nvars);
+    BitSet *def = df->kill[i] = new_bitset(nvars);
+
+    for (int j = bb->ninsns - 1; j >= 0; j--) {
+      Node *node = *bb->insns[j];
+      Var *var = insn_def(node);
+      if (var) {
+        bitset_clear(use, var->id);
+        bitset_set(def, var->id);
+      }
+      insn_uses(node, use);
+    }
+  }
+
+  solve_dataflow(cfg, df);
+  return df;
+}
+
+// Returns true if evaluating an expression may have an effect
+// other than computing its value.
+bool has_side_effects(Node *node) {
+  if (!node)
+    return false;
+
+  switch (node->kind) {
+    case ND_ASSIGN:
+    case ND_FUNCALL:
+    case ND_STMT_EXPR:
+      return true;
+  }
+  return has_side_effects(node->lhs) || has_side_effects(node->rhs);
+}
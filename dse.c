@@ -0,0 +1,57 @@
+// Dead store elimination.
+//
+// Removes assignments to local variables whose values are never read
+// afterwards, based on liveness of the variables tracked by dataflow.c.
+// For functions beyond the compile-time budget, liveness is not
+// computed and every variable is assumed to be live at the end of
+// each basic block, so only stores overwritten in the same block
+// are removed.
+#include "occ.h"
+
+static void eliminate(Function *fn) {
+  int nvars = track_vars(fn);
+  if (nvars == 0)
+    return;
+
+  CFG *cfg = build_cfg(fn);
+  if (!cfg)
+    return;
+
+  Dataflow *df = within_budget(fn, "dse") ? liveness(cfg, nvars) : NULL;
+  BitSet *live = new_bitset(nvars);
+
+  for (int i = 0; i < cfg->nreachable; i++) {
+    BasicBlock *bb = cfg->blocks[i];
+    if (df)
+      bitset_copy(live, df->out[i]);
+    else
+      bitset_fill(live);
+
+    for (int j = bb->ninsns - 1; j >= 0; j--) {
+      Node *node = *bb->insns[j];
+      Var *var;
+
+      while ((var = insn_def(node)) && !bitset_test(live, var->id) &&
+             use_fuel("dse", fn)) {
+        Node *rhs = node->lhs->rhs;
+        if (has_side_effects(rhs)) {
+          // Keep evaluating the right-hand side for its effects.
+          node->lhs = rhs;
+        } else {
+          node->kind = ND_BLOCK;
+          node->lhs = NULL;
+          node->body = NULL;
+        }
+      }
+
+      if (var)
+        bitset_clear(live, var->id);
+      insn_uses(node, live);
+    }
+  }
+}
+
+void eliminate_dead_stores(Program *prog) {
+  for (Function *fn = prog->funcs; fn; fn = fn->next)
+    eliminate(fn);
+}
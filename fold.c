@@ -0,0 +1,291 @@
+// Constant folding.
+//
+// Codegen evaluates every expression in 64-bit registers, so folding
+// is done in 64 bits as well, and a result that doesn't fit in an
+// int is left alone because ND_NUM can't represent it.
+//
+// Loads of integers from const globals at constant offsets, e.g.
+// `tab[2]` or `cfg.size`, are replaced with the values they load,
+// which are known from the initializers of the globals.
+#include "occ.h"
+
+static Node *new_num(int val) {
+  Node *node = calloc(1, sizeof(Node));
+  node->kind = ND_NUM;
+  node->val = val;
+  node->ty = ty_int;
+  return node;
+}
+
+static bool is_num(Node *node) {
+  return node && node->kind == ND_NUM;
+}
+
+// Returns true if a statement contains a case label, which
+// makes it reachable even if the code around it is not.
+static bool has_case(Node *node) {
+  if (!node)
+    return false;
+  if (node->kind == ND_CASE)
+    return true;
+  if (node->kind == ND_SWITCH)
+    return false;
+
+  if (has_case(node->then) || has_case(node->els))
+    return true;
+  for (Node *n = node->body; n; n = n->next)
+    if (has_case(n))
+      return true;
+  return false;
+}
+
+static bool eval_binary(NodeKind kind, long a, long b, long *val) {
+  switch (kind) {
+    case ND_ADD: *val = a + b; break;
+    case ND_SUB: *val = a - b; break;
+    case ND_MUL: *val = a * b; break;
+    case ND_DIV:
+      if (b == 0)
+        return false;
+      *val = a / b;
+      break;
+    case ND_EQ: *val = a == b; break;
+    case ND_NE: *val = a != b; break;
+    case ND_LAT: *val = a > b; break;
+    case ND_LET: *val = a < b; break;
+    case ND_LAE: *val = a >= b; break;
+    case ND_LEE: *val = a <= b; break;
+    case ND_BITAND: *val = a & b; break;
+    case ND_LOGAND: *val = a && b; break;
+    case ND_LOGOR: *val = a || b; break;
+    default:
+      return false;
+  }
+  return *val == (int)*val;
+}
+
+static Var *readonly_addr(Node *node, long *off);
+
+// Returns the read-only global that an lvalue designates a part of,
+// and sets `*off` to the offset of the part in it.
+static Var *readonly_part(Node *node, long *off) {
+  switch (node->kind) {
+    case ND_VAR:
+      if (node->var->is_local || !node->var->is_readonly || !node->var->init_data)
+        return NULL;
+      *off = 0;
+      return node->var;
+    case ND_MEMBER: {
+      Var *var = readonly_part(node->lhs, off);
+      if (var)
+        *off += node->member->offset;
+      return var;
+    }
+    case ND_DEREF:
+      return readonly_addr(node->lhs, off);
+  }
+  return NULL;
+}
+
+// Same as readonly_part(), for an expression computing an address
+// into a read-only global. Array indices have been scaled and folded
+// into numbers by the time this is called.
+static Var *readonly_addr(Node *node, long *off) {
+  switch (node->kind) {
+    case ND_VAR:
+    case ND_MEMBER:
+      // An array decays to the address of its first element.
+      if (node->ty->kind != TY_ARRAY)
+        return NULL;
+      return readonly_part(node, off);
+    case ND_ADDR:
+      return readonly_part(node->lhs, off);
+    case ND_ADD:
+    case ND_SUB: {
+      if (!is_num(node->rhs))
+        return NULL;
+      Var *var = readonly_addr(node->lhs, off);
+      if (var)
+        *off += (node->kind == ND_ADD) ? node->rhs->val : -node->rhs->val;
+      return var;
+    }
+  }
+  return NULL;
+}
+
+// Returns the value loaded by an integer lvalue in a read-only
+// global, if it is known.
+static bool eval_load(Node *node, long *val) {
+  if (!node->ty || !is_integer(node->ty))
+    return false;
+
+  long off;
+  Var *var = readonly_part(node, &off);
+  int size = node->ty->size;
+  if (!var || off < 0 || var->ty->size < off + size)
+    return false;
+  for (Relocation *rel = var->rel; rel; rel = rel->next)
+    if (off < rel->offset + 8 && rel->offset < off + size)
+      return false;
+
+  char *p = var->init_data + off;
+  switch (size) {
+    case 1: *val = *(signed char *)p; return node->ty->kind != TY_BOOL || *val <= 1;
+    case 4: *val = *(int *)p; return true;
+  }
+  return false;
+}
+
+static void fold_stmt(Node *node);
+static Node *fold_expr(Node *node);
+
+// Folds the subexpressions of an lvalue, but not the lvalue itself:
+// the target of an assignment or `&` must stay a location.
+static Node *fold_lvalue(Node *node) {
+  switch (node->kind) {
+    case ND_DEREF:
+      node->lhs = fold_expr(node->lhs);
+      break;
+    case ND_MEMBER:
+      node->lhs = fold_lvalue(node->lhs);
+      break;
+  }
+  return node;
+}
+
+static Node *fold_expr(Node *node) {
+  if (!node)
+    return NULL;
+
+  switch (node->kind) {
+    case ND_STMT_EXPR:
+      for (Node *n = node->body; n; n = n->next)
+        fold_stmt(n);
+      return node;
+    case ND_FUNCALL:
+      for (Node **arg = &node->args; *arg; arg = &(*arg)->next) {
+        Node *next = (*arg)->next;
+        *arg = fold_expr(*arg);
+        (*arg)->next = next;
+      }
+      return node;
+    case ND_ADDR:
+      node->lhs = fold_lvalue(node->lhs);
+      return node;
+    case ND_ASSIGN:
+      node->lhs = fold_lvalue(node->lhs);
+      node->rhs = fold_expr(node->rhs);
+      return node;
+  }
+
+  node->lhs = fold_expr(node->lhs);
+  node->rhs = fold_expr(node->rhs);
+
+  Node *lhs = node->lhs;
+  Node *rhs = node->rhs;
+
+  long val;
+  switch (node->kind) {
+    case ND_VAR:
+    case ND_MEMBER:
+    case ND_DEREF:
+      if (eval_load(node, &val))
+        return new_num(val);
+      return node;
+    case ND_BITNOT:
+      if (is_num(lhs))
+        return new_num(~lhs->val);
+      return node;
+    case ND_COMMA:
+      if (is_num(lhs))
+        return rhs;
+      return node;
+    case ND_LOGAND:
+      // The right-hand side of `0 && x` is never evaluated.
+      if (is_num(lhs) && lhs->val == 0)
+        return new_num(0);
+      break;
+    case ND_LOGOR:
+      if (is_num(lhs) && lhs->val != 0)
+        return new_num(1);
+      break;
+    case ND_ADD:
+      if (is_num(rhs) && rhs->val == 0 && !is_num(lhs))
+        return lhs;
+      break;
+    case ND_MUL:
+      if (is_num(rhs) && rhs->val == 1 && !is_num(lhs))
+        return lhs;
+      break;
+  }
+
+  if (is_num(lhs) && is_num(rhs) && eval_binary(node->kind, lhs->val, rhs->val, &val))
+    return new_num(val);
+  return node;
+}
+
+// Folds a statement in place. A statement may be replaced with
+// another one, so it is overwritten rather than returned.
+static void replace_stmt(Node *node, Node *with) {
+  Node *next = node->next;
+  if (with) {
+    *node = *with;
+  } else {
+    memset(node, 0, sizeof(Node));
+    node->kind = ND_BLOCK;
+  }
+  node->next = next;
+}
+
+static void fold_stmt(Node *node) {
+  if (!node)
+    return;
+
+  switch (node->kind) {
+    case ND_IF:
+      node->cond = fold_expr(node->cond);
+      fold_stmt(node->then);
+      fold_stmt(node->els);
+
+      if (is_num(node->cond)) {
+        Node *taken = node->cond->val ? node->then : node->els;
+        Node *dead = node->cond->val ? node->els : node->then;
+        // A case label must stay the node the switch refers to.
+        if (!has_case(dead) && !(taken && taken->kind == ND_CASE))
+          replace_stmt(node, taken);
+      }
+      return;
+    case ND_FOR:
+      fold_stmt(node->init);
+      node->cond = fold_expr(node->cond);
+      fold_stmt(node->inc);
+      fold_stmt(node->then);
+      return;
+    case ND_WHILE:
+      node->cond = fold_expr(node->cond);
+      fold_stmt(node->then);
+      if (is_num(node->cond) && node->cond->val == 0 && !has_case(node->then))
+        replace_stmt(node, NULL);
+      return;
+    case ND_SWITCH:
+      node->cond = fold_expr(node->cond);
+      fold_stmt(node->then);
+      return;
+    case ND_CASE:
+      fold_stmt(node->lhs);
+      return;
+    case ND_BLOCK:
+      for (Node *n = node->body; n; n = n->next)
+        fold_stmt(n);
+      return;
+    case ND_RETURN:
+    case ND_EXPR_STMT:
+      node->lhs = fold_expr(node->lhs);
+      return;
+  }
+}
+
+void fold_constants(Program *prog) {
+  for (Function *fn = prog->funcs; fn; fn = fn->next)
+    fold_stmt(fn->node);
+}
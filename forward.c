@@ -0,0 +1,222 @@
+// Store-to-load forwarding.
+//
+// Within a basic block, replaces a load from memory with the number
+// most recently stored there, e.g. `p->x` in
+// `p->x = 1; p->y = 2; return p->x;`. Alias analysis decides which
+// of the stored values a store or a call in between may overwrite.
+//
+// Each statement is checked against all the stores remembered in its
+// block, so in functions beyond the compile-time budget only the
+// most recent MAX_STORES stores are remembered.
+#include "occ.h"
+
+typedef struct Store Store;
+struct Store {
+  Store *next;
+  Node *lvalue;
+  int val;
+};
+
+#define MAX_STORES 16
+
+// Stores whose values are known in the current block
+static Store *stores;
+static int max_stores;
+static Function *cur_fn;
+
+static bool fits(Type *ty, int val) {
+  switch (ty->kind) {
+    case TY_BOOL:
+      return val == 0 || val == 1;
+    case TY_CHAR:
+      return -128 <= val && val <= 127;
+    case TY_INT:
+    case TY_ENUM:
+      return true;
+  }
+  return false;
+}
+
+static bool is_lvalue(Node *node) {
+  return node->kind == ND_VAR || node->kind == ND_MEMBER || node->kind == ND_DEREF;
+}
+
+//
+// Invalidation
+//
+
+static bool may_write_path(Node *store, Node *lvalue);
+static bool may_write_addr(Node *store, Node *lvalue);
+
+// Returns true if a store may change the value of an
+// expression without side effects.
+static bool may_write_expr(Node *store, Node *node) {
+  if (!node)
+    return false;
+  if (is_lvalue(node)) {
+    if (node->ty->kind == TY_ARRAY)
+      return may_write_addr(store, node);
+    return may_write_path(store, node);
+  }
+  return may_write_expr(store, node->lhs) || may_write_expr(store, node->rhs);
+}
+
+// Returns true if a store may write to a location the address
+// of an lvalue is computed from. `store` is NULL for a call.
+static bool may_write_addr(Node *store, Node *lvalue) {
+  if (lvalue->kind == ND_MEMBER)
+    return may_write_addr(store, lvalue->lhs);
+  if (lvalue->kind == ND_DEREF)
+    return may_write_expr(store, lvalue->lhs);
+  return false;
+}
+
+// Returns true if a store or, if `store` is NULL, a call may
+// change the value read from an lvalue.
+static bool may_write_path(Node *store, Node *lvalue) {
+  if (store ? alias(store, lvalue) != NO_ALIAS : call_may_modify(lvalue))
+    return true;
+  return may_write_addr(store, lvalue);
+}
+
+static void invalidate(Node *store) {
+  for (Store **p = &stores; *p;) {
+    if (may_write_path(store, (*p)->lvalue))
+      *p = (*p)->next;
+    else
+      p = &(*p)->next;
+  }
+}
+
+// Forgets the stores a statement may overwrite.
+static void apply_effects(Node *node) {
+  if (!node)
+    return;
+
+  if (node->kind == ND_ASSIGN)
+    invalidate(node->lhs);
+  else if (node->kind == ND_FUNCALL)
+    invalidate(NULL);
+
+  apply_effects(node->lhs);
+  apply_effects(node->rhs);
+  apply_effects(node->cond);
+  apply_effects(node->then);
+  apply_effects(node->els);
+  apply_effects(node->init);
+  apply_effects(node->inc);
+  for (Node *n = node->body; n; n = n->next)
+    apply_effects(n);
+  for (Node *n = node->args; n; n = n->next)
+    apply_effects(n);
+}
+
+//
+// Replacement
+//
+
+static void replace_loads(Node **slot);
+
+// Replaces the loads an lvalue's address is computed from.
+static void replace_in_path(Node *node) {
+  if (node->kind == ND_MEMBER)
+    replace_in_path(node->lhs);
+  else if (node->kind == ND_DEREF)
+    replace_loads(&node->lhs);
+}
+
+static Store *find_store(Node *node) {
+  for (Store *s = stores; s; s = s->next)
+    if (fits(node->ty, s->val) && alias(node, s->lvalue) == MUST_ALIAS)
+      return s;
+  return NULL;
+}
+
+// Replaces loads in an expression without side effects.
+static void replace_loads(Node **slot) {
+  Node *node = *slot;
+  if (!node)
+    return;
+
+  if (node->kind == ND_ADDR) {
+    replace_in_path(node->lhs);
+    return;
+  }
+
+  if (!is_lvalue(node)) {
+    replace_loads(&node->lhs);
+    replace_loads(&node->rhs);
+    return;
+  }
+
+  Store *s = (node->ty->kind == TY_ARRAY) ? NULL : find_store(node);
+  if (!s || !use_fuel("forward", cur_fn)) {
+    replace_in_path(node);
+    return;
+  }
+
+  Node *num = calloc(1, sizeof(Node));
+  num->kind = ND_NUM;
+  num->val = s->val;
+  num->ty = ty_int;
+  num->next = node->next;
+  *slot = num;
+}
+
+static void forward_insn(Node **slot) {
+  Node *node = *slot;
+  Node *assign = NULL;
+
+  if (node->kind == ND_EXPR_STMT && node->lhs->kind == ND_ASSIGN) {
+    assign = node->lhs;
+    if (!has_side_effects(assign->lhs) && !has_side_effects(assign->rhs)) {
+      replace_loads(&assign->rhs);
+      replace_in_path(assign->lhs);
+    }
+  } else if (node->kind == ND_RETURN || node->kind == ND_EXPR_STMT) {
+    if (!has_side_effects(node->lhs))
+      replace_loads(&node->lhs);
+  } else if (!has_side_effects(node)) {
+    replace_loads(slot);
+  }
+
+  apply_effects(*slot);
+
+  // Remember `lvalue = <num>;`.
+  if (assign && assign->rhs->kind == ND_NUM && is_lvalue(assign->lhs) &&
+      fits(assign->lhs->ty, assign->rhs->val) &&
+      !has_side_effects(assign->lhs) && !may_write_addr(assign->lhs, assign->lhs)) {
+    Store *s = calloc(1, sizeof(Store));
+    s->lvalue = assign->lhs;
+    s->val = assign->rhs->val;
+    s->next = stores;
+    stores = s;
+
+    // Forget the oldest store.
+    int n = 0;
+    for (Store **p = &stores; *p; p = &(*p)->next)
+      if (++n > max_stores) {
+        *p = NULL;
+        break;
+      }
+  }
+}
+
+void forward_stores(Program *prog) {
+  mark_all_address_taken(prog);
+
+  for (Function *fn = prog->funcs; fn; fn = fn->next) {
+    CFG *cfg = build_cfg(fn);
+    if (!cfg)
+      continue;
+
+    cur_fn = fn;
+    max_stores = within_budget(fn, "forward") ? INT_MAX : MAX_STORES;
+    for (int i = 0; i < cfg->nreachable; i++) {
+      BasicBlock *bb = cfg->blocks[i];
+      stores = NULL;
+      for (int j = 0; j < bb->ninsns; j++)
+        forward_insn(bb->insns[j]);
+    }
+  }
+}
@@ -0,0 +1,215 @@
+// Stack frame layout.
+//
+// Assigns each local variable an offset below rbp. Slots are aligned
+// as their types require and sorted by decreasing alignment, so no
+// padding is needed between them. The most used scalars come first,
+// within 128 bytes of rbp, where instructions can address them with
+// an 8-bit displacement instead of a 32-bit one.
+//
+// Locals declared in blocks that are not nested in one another, e.g.
+// the two arrays in `if (x) { int a[64]; ... } else { int b[64]; ... }`,
+// are never live at the same time and share frame space. The frame
+// is laid out like the blocks: the locals of a block go below those
+// of the enclosing blocks, and sibling blocks start at the same offset.
+//
+// Arrays of at least N bytes are aligned to N bytes for vector loads,
+// where N is given by -fstack-array-align=N (16 by default). rbp is
+// only 16-byte aligned, so a function with slots aligned to more than
+// that realigns its frame in the prologue.
+#include "occ.h"
+
+#define DISP8_LIMIT 128
+
+typedef struct Slot Slot;
+struct Slot {
+  Slot *next; // Next slot in the same scope
+  Var *var;
+  int align;
+  intptr_t weight; // Number of uses, weighted by loop nesting
+  bool near;       // Placed within DISP8_LIMIT of rbp
+  bool placed;
+};
+
+static HashMap weights;
+static HashMap scopes; // Block -> list of the slots declared in it
+static int bias;
+
+static void count_uses(Node *node, intptr_t weight) {
+  if (!node)
+    return;
+
+  if (node->kind == ND_VAR && node->var->is_local)
+    hashmap_put(&weights, node->var,
+                (void *)((intptr_t)hashmap_get(&weights, node->var) + weight));
+
+  // A use in a loop counts as 8 uses, up to 3 levels of nesting.
+  intptr_t w = weight;
+  if ((node->kind == ND_FOR || node->kind == ND_WHILE) && w < 512)
+    w *= 8;
+
+  count_uses(node->lhs, weight);
+  count_uses(node->rhs, weight);
+  count_uses(node->init, weight);
+  count_uses(node->cond, w);
+  count_uses(node->then, w);
+  count_uses(node->els, weight);
+  count_uses(node->inc, w);
+  for (Node *n = node->body; n; n = n->next)
+    count_uses(n, w);
+  for (Node *n = node->args; n; n = n->next)
+    count_uses(n, weight);
+}
+
+static bool is_scalar(Type *ty) {
+  return ty->kind != TY_ARRAY && ty->kind != TY_STRUCT;
+}
+
+// Like GCC, arrays of 16 bytes or more are aligned to 16 bytes
+// even without -fstack-array-align.
+static int slot_align(Type *ty) {
+  int align = ty->align;
+  if (ty->kind != TY_ARRAY)
+    return align;
+  if (ty->size >= 16 && align < 16)
+    align = 16;
+  if (ty->size >= opt_stack_array_align && align < opt_stack_array_align)
+    align = opt_stack_array_align;
+  return align;
+}
+
+static int cmp_weight(const void *a, const void *b) {
+  Slot *x = (Slot *)a;
+  Slot *y = (Slot *)b;
+  if (x->weight != y->weight)
+    return (x->weight > y->weight) ? -1 : 1;
+  return x->var->offset - y->var->offset;
+}
+
+// Any order of the near slots gives them short displacements, so
+// slots are only sorted by alignment, and otherwise keep their order
+// in the list of locals.
+static int cmp_layout(const void *a, const void *b) {
+  Slot *x = (Slot *)a;
+  Slot *y = (Slot *)b;
+  if (x->near != y->near)
+    return x->near ? -1 : 1;
+  if (x->align != y->align)
+    return y->align - x->align;
+  return x->var->offset - y->var->offset;
+}
+
+// Places a slot below `offset` and returns its offset. A realigned
+// rbp is 16 bytes below a multiple of frame_align, hence the bias.
+static int place_slot(Slot *s, int offset) {
+  s->placed = true;
+  s->var->offset = align_to(offset + s->var->ty->size + bias, s->align) - bias;
+  return s->var->offset;
+}
+
+static int place(Slot *s, int offset) {
+  for (; s; s = s->next)
+    offset = place_slot(s, offset);
+  return offset;
+}
+
+static int place_blocks(Node *node, int offset);
+
+static int max_end(int end, Node *node, int offset) {
+  int e = place_blocks(node, offset);
+  return (end < e) ? e : end;
+}
+
+// Places the locals declared in the blocks within a node below
+// `offset` and returns the lowest end of them. Blocks that are not
+// nested in one another never run at the same time, so their locals
+// share the same space.
+static int place_blocks(Node *node, int offset) {
+  if (!node)
+    return offset;
+
+  if (node->kind == ND_BLOCK || node->kind == ND_STMT_EXPR) {
+    Slot *s = hashmap_get(&scopes, node);
+    if (s && !s->placed)
+      offset = place(s, offset);
+  }
+
+  Node *kids[] = {node->lhs, node->rhs, node->cond, node->then,
+                  node->els, node->init, node->inc};
+  int end = offset;
+  for (int i = 0; i < sizeof(kids) / sizeof(*kids); i++)
+    end = max_end(end, kids[i], offset);
+  for (Node *n = node->body; n; n = n->next)
+    end = max_end(end, n, offset);
+  for (Node *n = node->args; n; n = n->next)
+    end = max_end(end, n, offset);
+  return end;
+}
+
+// Assigns offsets to the locals of a function and returns the size
+// of the area they take, a multiple of 8.
+int layout_frame(Function *fn) {
+  int n = 0;
+  for (Var *var = fn->locals; var; var = var->next)
+    n++;
+
+  Slot *slots = calloc(n, sizeof(Slot));
+  hashmap_clear(&weights);
+  for (Node *node = fn->node; node; node = node->next)
+    count_uses(node, 1);
+
+  // The original order breaks ties, so that the layout is stable.
+  n = 0;
+  for (Var *var = fn->locals; var; var = var->next) {
+    var->offset = n;
+    slots[n].var = var;
+    slots[n].align = slot_align(var->ty);
+    slots[n].weight = (intptr_t)hashmap_get(&weights, var);
+    n++;
+  }
+
+  // Pick the most used scalars that fit within the reach of an
+  // 8-bit displacement. Sorted by alignment, they need no padding.
+  qsort(slots, n, sizeof(Slot), cmp_weight);
+  int size = 0;
+  for (int i = 0; i < n; i++) {
+    if (is_scalar(slots[i].var->ty) && size + slots[i].var->ty->size <= DISP8_LIMIT) {
+      slots[i].near = true;
+      size += slots[i].var->ty->size;
+    }
+  }
+  qsort(slots, n, sizeof(Slot), cmp_layout);
+
+  fn->frame_align = 16;
+  for (int i = 0; i < n; i++)
+    if (fn->frame_align < slots[i].align)
+      fn->frame_align = slots[i].align;
+  bias = (fn->frame_align > 16) ? 16 : 0;
+
+  // Near slots are placed first, whatever their scope, and then the
+  // other locals of the whole function.
+  hashmap_clear(&scopes);
+  Slot *root = NULL;
+  for (int i = n - 1; i >= 0; i--) {
+    Node *scope = slots[i].var->scope;
+    if (slots[i].near || !scope) {
+      slots[i].next = root;
+      root = &slots[i];
+    } else {
+      slots[i].next = hashmap_get(&scopes, scope);
+      hashmap_put(&scopes, scope, &slots[i]);
+    }
+  }
+
+  int offset = place(root, 0);
+  int end = offset;
+  for (Node *node = fn->node; node; node = node->next)
+    end = max_end(end, node, offset);
+
+  // Locals of blocks that are no longer in the function
+  for (int i = 0; i < n; i++)
+    if (!slots[i].placed)
+      end = place_slot(&slots[i], end);
+
+  free(slots);
+  return align_to(end, 8);
+}
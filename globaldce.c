@@ -0,0 +1,78 @@
+// Dead function and global variable elimination.
+//
+// Functions and global variables that cannot be reached from a
+// non-static function, e.g. unused static functions or string
+// literals whose only use was folded away, are removed from the
+// program. Global variables are not visible outside the translation
+// unit, so only non-static functions are roots.
+#include "occ.h"
+
+static void mark_func(Program *prog, Function *fn);
+
+// A variable is live if a live variable points to it.
+static void mark_var(Var *var) {
+  if (var->is_live)
+    return;
+  var->is_live = true;
+  for (Relocation *rel = var->rel; rel; rel = rel->next)
+    mark_var(rel->var);
+}
+
+static void mark_node(Program *prog, Node *node) {
+  if (!node)
+    return;
+
+  if (node->kind == ND_VAR && !node->var->is_local)
+    mark_var(node->var);
+
+  if (node->kind == ND_FUNCALL) {
+    Function *fn = find_func(prog, node->funcname);
+    if (fn)
+      mark_func(prog, fn);
+  }
+
+  mark_node(prog, node->lhs);
+  mark_node(prog, node->rhs);
+  mark_node(prog, node->cond);
+  mark_node(prog, node->then);
+  mark_node(prog, node->els);
+  mark_node(prog, node->init);
+  mark_node(prog, node->inc);
+  for (Node *n = node->body; n; n = n->next)
+    mark_node(prog, n);
+  for (Node *n = node->args; n; n = n->next)
+    mark_node(prog, n);
+}
+
+static void mark_func(Program *prog, Function *fn) {
+  if (fn->is_live)
+    return;
+  fn->is_live = true;
+  for (Node *n = fn->node; n; n = n->next)
+    mark_node(prog, n);
+}
+
+void eliminate_dead_globals(Program *prog) {
+  for (Function *fn = prog->funcs; fn; fn = fn->next)
+    fn->is_live = false;
+  for (Var *var = prog->globals; var; var = var->next)
+    var->is_live = false;
+
+  for (Function *fn = prog->funcs; fn; fn = fn->next)
+    if (!fn->is_static)
+      mark_func(prog, fn);
+
+  for (Function **p = &prog->funcs; *p;) {
+    if ((*p)->is_live)
+      p = &(*p)->next;
+    else
+      *p = (*p)->next;
+  }
+
+  for (Var **p = &prog->globals; *p;) {
+    if ((*p)->is_live)
+      p = &(*p)->next;
+    else
+      *p = (*p)->next;
+  }
+}
@@ -0,0 +1,105 @@
+// Hash map using open addressing with linear probing. Keys are
+// either pointers, compared by address, or strings, compared by
+// contents; a map must use only one kind. Entries cannot be removed.
+#include "occ.h"
+
+static uint64_t hash(void *p) {
+  uint64_t x = (uint64_t)p;
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  return x;
+}
+
+static uint64_t str_hash(char *s) {
+  uint64_t h = 0xcbf29ce484222325;
+  for (; *s; s++) {
+    h ^= (unsigned char)*s;
+    h *= 0x100000001b3;
+  }
+  return h;
+}
+
+static void rehash(HashMap *map) {
+  HashMap map2 = {};
+  map2.capacity = map->capacity ? map->capacity * 2 : 256;
+  map2.buckets = calloc(map2.capacity, sizeof(HashEntry));
+
+  map2.strings = map->strings;
+  for (int i = 0; i < map->capacity; i++) {
+    HashEntry *ent = &map->buckets[i];
+    if (!ent->key)
+      continue;
+    if (map->strings)
+      hashmap_sput(&map2, ent->key, ent->val);
+    else
+      hashmap_put(&map2, ent->key, ent->val);
+  }
+
+  free(map->buckets);
+  *map = map2;
+}
+
+static bool match(HashMap *map, void *a, void *b) {
+  if (a == b)
+    return true;
+  return map->strings && a && b && !strcmp(a, b);
+}
+
+static uint64_t index_of(HashMap *map, void *key) {
+  return (map->strings ? str_hash(key) : hash(key)) & (map->capacity - 1);
+}
+
+static HashEntry *get_entry(HashMap *map, void *key) {
+  if (!map->capacity)
+    return NULL;
+
+  for (uint64_t i = index_of(map, key);; i = (i + 1) & (map->capacity - 1)) {
+    HashEntry *ent = &map->buckets[i];
+    if (!ent->key)
+      return NULL;
+    if (match(map, ent->key, key))
+      return ent;
+  }
+}
+
+void *hashmap_get(HashMap *map, void *key) {
+  HashEntry *ent = get_entry(map, key);
+  return ent ? ent->val : NULL;
+}
+
+static void put(HashMap *map, void *key, void *val) {
+  HashEntry *ent = get_entry(map, key);
+  if (ent) {
+    ent->val = val;
+    return;
+  }
+
+  if ((map->used + 1) * 2 > map->capacity)
+    rehash(map);
+
+  uint64_t i = index_of(map, key);
+  while (map->buckets[i].key)
+    i = (i + 1) & (map->capacity - 1);
+  map->buckets[i] = (HashEntry){key, val};
+  map->used++;
+}
+
+void hashmap_put(HashMap *map, void *key, void *val) {
+  put(map, key, val);
+}
+
+void *hashmap_sget(HashMap *map, char *key) {
+  map->strings = true;
+  return hashmap_get(map, key);
+}
+
+void hashmap_sput(HashMap *map, char *key, void *val) {
+  map->strings = true;
+  put(map, key, val);
+}
+
+void hashmap_clear(HashMap *map) {
+  free(map->buckets);
+  *map = (HashMap){};
+}
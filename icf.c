@@ -0,0 +1,227 @@
+// Identical code folding.
+//
+// Functions whose generated code is the same, after renaming the
+// labels local to each function, are folded into one body. Calls
+// are compared by the function they end up in, so callers of
+// folded functions can become identical as well; functions are
+// visited callees first for that reason.
+//
+// occ cannot take the address of a function, so a static function
+// is folded into another by making its name an alias. A non-static
+// function may have its address compared in another translation
+// unit, so it keeps an address of its own and becomes a jump to the
+// other body, unless -ficf=all is given.
+//
+// Read-only data with the same contents, e.g. string literals, the
+// templates of local initializers and const globals, is merged before
+// code is generated, which also makes functions using it identical.
+// Like a non-static function, a const global keeps an address of its
+// own unless -ficf=all is given.
+#include "occ.h"
+
+#define THUNK_SIZE 5 // jmp rel32
+
+typedef struct Body Body;
+struct Body {
+  Body *next;
+  uint64_t hash;
+  char *code;
+  Function *fn;
+};
+
+static int code_saved;
+static int data_saved;
+static int nfolded;
+
+static uint64_t fnv_hash(char *s, int len) {
+  uint64_t h = 0xcbf29ce484222325;
+  for (int i = 0; i < len; i++) {
+    h ^= (unsigned char)s[i];
+    h *= 0x100000001b3;
+  }
+  return h;
+}
+
+static void redirect_vars(Node *node, Var *from, Var *to) {
+  if (!node)
+    return;
+  if (node->kind == ND_VAR && node->var == from)
+    node->var = to;
+
+  redirect_vars(node->lhs, from, to);
+  redirect_vars(node->rhs, from, to);
+  redirect_vars(node->cond, from, to);
+  redirect_vars(node->then, from, to);
+  redirect_vars(node->els, from, to);
+  redirect_vars(node->init, from, to);
+  redirect_vars(node->inc, from, to);
+  for (Node *n = node->body; n; n = n->next)
+    redirect_vars(n, from, to);
+  for (Node *n = node->args; n; n = n->next)
+    redirect_vars(n, from, to);
+}
+
+// Returns true if a global is never written and holds no addresses,
+// which would only be known once linked.
+static bool is_constant_data(Var *var) {
+  return (var->is_string || var->is_readonly) && var->init_data && !var->rel;
+}
+
+// Returns true if a global may share the storage of another one.
+// Only the unnamed data made by the compiler has no address that
+// the program can tell apart.
+static bool is_mergeable_data(Var *var) {
+  if (!is_constant_data(var))
+    return false;
+  return var->is_string || !strncmp(var->name, ".L.", 3) || opt_icf_all;
+}
+
+static bool same_data(Var *a, Var *b) {
+  return is_constant_data(a) && a->is_string == b->is_string &&
+         a->ty->kind == b->ty->kind && a->ty->size == b->ty->size &&
+         a->ty->align >= b->ty->align &&
+         !memcmp(a->init_data, b->init_data, a->ty->size);
+}
+
+// Merges read-only data with the same contents. Such data is never
+// modified, so it can share storage.
+void fold_identical_data(Program *prog) {
+  for (Var **p = &prog->globals; *p;) {
+    Var *var = *p;
+    Var *same = NULL;
+
+    // Data before this one in the list has no duplicates left.
+    if (is_mergeable_data(var))
+      for (Var *v = prog->globals; v != var && !same; v = v->next)
+        if (same_data(v, var))
+          same = v;
+
+    if (!same) {
+      p = &var->next;
+      continue;
+    }
+
+    for (Function *fn = prog->funcs; fn; fn = fn->next)
+      for (Node *n = fn->node; n; n = n->next)
+        redirect_vars(n, var, same);
+    for (Var *v = prog->globals; v; v = v->next)
+      for (Relocation *rel = v->rel; rel; rel = rel->next)
+        if (rel->var == var)
+          rel->var = same;
+    data_saved += var->ty->size;
+    *p = var->next;
+  }
+}
+
+static Function *final_func(Function *fn) {
+  while (fn->folded_into)
+    fn = fn->folded_into;
+  return fn;
+}
+
+static bool is_label_char(char c) {
+  return isalnum(c) || c == '_' || c == '.';
+}
+
+// Returns the code of a function with local labels numbered in the
+// order they appear and call targets replaced by the functions
+// they are folded into.
+static char *normalize(Program *prog, Function *fn) {
+  char *buf;
+  size_t buflen;
+  FILE *out = open_memstream(&buf, &buflen);
+
+  HashMap labels = {};
+  int nlabels = 0;
+  char *ret = format(".L.return.%s", fn->name);
+
+  for (int i = 0; i < fn->code.len; i++) {
+    char *line = fn->code.data[i];
+
+    if (!strncmp(line, "  call ", 7)) {
+      Function *callee = find_func(prog, line + 7);
+      fprintf(out, "  call %s\n", callee ? final_func(callee)->name : line + 7);
+      continue;
+    }
+
+    for (char *p = line; *p;) {
+      if (strncmp(p, ".L.", 3) || (p != line && is_label_char(p[-1]))) {
+        fputc(*p++, out);
+        continue;
+      }
+
+      char *start = p;
+      while (is_label_char(*p))
+        p++;
+      char *label = strndup(start, p - start);
+
+      if (!strncmp(label, ".L.data.", 8)) {
+        fputs(label, out);
+      } else if (!strcmp(label, ret)) {
+        fputs(".L.return", out);
+      } else {
+        intptr_t j = (intptr_t)hashmap_sget(&labels, label);
+        if (!j) {
+          j = ++nlabels;
+          hashmap_sput(&labels, label, (void *)j);
+        }
+        fprintf(out, ".L.%d", (int)j - 1);
+      }
+    }
+    fputc('\n', out);
+  }
+
+  fclose(out);
+  return buf;
+}
+
+static int code_size(Function *fn) {
+  int size = 0;
+  for (int i = 0; i < fn->code.len; i++)
+    if (is_insn(fn->code.data[i]))
+      size += insn_size(fn->code.data[i]);
+  return size;
+}
+
+// Folds functions with identical code. Must be called after code
+// has been generated for all functions.
+void fold_identical_code(Program *prog) {
+  Body *bodies = NULL;
+  Function **funcs = bottom_up_order(prog);
+
+  for (int i = 0; funcs[i]; i++) {
+    Function *fn = funcs[i];
+    char *code = normalize(prog, fn);
+    uint64_t hash = fnv_hash(code, strlen(code));
+
+    Body *b = bodies;
+    while (b && (b->hash != hash || strcmp(b->code, code)))
+      b = b->next;
+
+    if (!b) {
+      b = calloc(1, sizeof(Body));
+      b->hash = hash;
+      b->code = code;
+      b->fn = fn;
+      b->next = bodies;
+      bodies = b;
+      continue;
+    }
+
+    fn->folded_into = b->fn;
+    fn->is_thunk = !fn->is_static && !opt_icf_all;
+    code_saved += code_size(fn) - (fn->is_thunk ? THUNK_SIZE : 0);
+    nfolded++;
+
+    // The code left is what is emitted for the function, which the
+    // reports on the generated code look at.
+    fn->code = (StringArray){};
+    if (fn->is_thunk)
+      strarray_push(&fn->code, format("  jmp %s", b->fn->name));
+  }
+}
+
+void print_icf_report(FILE *out) {
+  fprintf(out, "icf: %d functions folded, %d bytes of code and %d bytes of data saved\n",
+          nfolded, code_saved, data_saved);
+}
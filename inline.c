@@ -0,0 +1,258 @@
+// Function inlining.
+//
+// Replaces calls to small functions with a copy of their body, e.g.
+//
+//   static int sq(int x) { return x * x; }  ... sq(a + 1) ...
+//
+// becomes `({ int x; x = a + 1; x * x; })` in the caller, where `x`
+// is a new local of the caller. Only functions whose single return
+// statement is the last statement of the body can be inlined, since
+// a return in the middle of a statement expression cannot be
+// expressed. Functions are visited callees first, so that a caller
+// becomes small enough to be inlined after its callees are.
+//
+// Small functions are inlined at every call site. A static function
+// called only once is inlined whatever its size, as its original is
+// then removed. With -Os, only those are inlined: even the smallest
+// functions take more code inlined than a call to them does, as an
+// inlined copy stores its arguments to new locals.
+#include "occ.h"
+
+// Functions up to this many nodes are inlined everywhere
+#define SMALL_SIZE 40
+
+// Callers do not grow beyond this many nodes, except by inlining
+// functions that are no larger than the code of a call
+#define MAX_CALLER_SIZE 4000
+#define TINY_SIZE 10
+
+typedef struct Site Site;
+struct Site {
+  Site *next;
+  Node *call;
+};
+
+static int count_nodes(Node *node) {
+  if (!node)
+    return 0;
+
+  int n = 1 + count_nodes(node->lhs) + count_nodes(node->rhs) +
+          count_nodes(node->cond) + count_nodes(node->then) +
+          count_nodes(node->els) + count_nodes(node->init) +
+          count_nodes(node->inc);
+  for (Node *c = node->body; c; c = c->next)
+    n += count_nodes(c);
+  for (Node *c = node->args; c; c = c->next)
+    n += count_nodes(c);
+  return n;
+}
+
+static bool has_return(Node *node) {
+  if (!node)
+    return false;
+  if (node->kind == ND_RETURN)
+    return true;
+
+  if (has_return(node->lhs) || has_return(node->rhs) ||
+      has_return(node->cond) || has_return(node->then) ||
+      has_return(node->els) || has_return(node->init) ||
+      has_return(node->inc))
+    return true;
+  for (Node *n = node->body; n; n = n->next)
+    if (has_return(n))
+      return true;
+  return false;
+}
+
+// Returns true if the only return of a function is its last
+// statement, if it has one.
+static bool can_inline(Function *fn) {
+  if (fn->is_recursive || !fn->node || fn->node->next || fn->node->kind != ND_BLOCK)
+    return false;
+
+  for (Node *n = fn->node->body; n; n = n->next) {
+    if (!n->next && n->kind == ND_RETURN)
+      return !has_return(n->lhs);
+    if (has_return(n))
+      return false;
+  }
+  return true;
+}
+
+static Site *find_sites(Node *node, Site *sites) {
+  if (!node)
+    return sites;
+
+  if (node->kind == ND_FUNCALL) {
+    Site *s = sites;
+    while (s && s->call != node)
+      s = s->next;
+    if (s)
+      return sites;
+
+    s = calloc(1, sizeof(Site));
+    s->call = node;
+    s->next = sites;
+    sites = s;
+  }
+
+  sites = find_sites(node->lhs, sites);
+  sites = find_sites(node->rhs, sites);
+  sites = find_sites(node->cond, sites);
+  sites = find_sites(node->then, sites);
+  sites = find_sites(node->els, sites);
+  sites = find_sites(node->init, sites);
+  sites = find_sites(node->inc, sites);
+  for (Node *n = node->body; n; n = n->next)
+    sites = find_sites(n, sites);
+  for (Node *n = node->args; n; n = n->next)
+    sites = find_sites(n, sites);
+  return sites;
+}
+
+static int count_params(Function *fn) {
+  int n = 0;
+  for (Var *var = fn->params; var; var = var->next)
+    n++;
+  return n;
+}
+
+static Node *new_node(NodeKind kind, Type *ty) {
+  Node *node = calloc(1, sizeof(Node));
+  node->kind = kind;
+  node->ty = ty;
+  return node;
+}
+
+static Node *new_expr_stmt(Node *expr) {
+  Node *node = new_node(ND_EXPR_STMT, NULL);
+  node->lhs = expr;
+  return node;
+}
+
+// Turns a call into a statement expression evaluating a copy of
+// the callee's body. The call node is changed in place, as it may
+// be shared, e.g. in `*f() += 1`.
+static void inline_call(Function *caller, Node *call, Function *callee) {
+  Function *copy = clone_function(callee, callee->name);
+
+  // Assign the arguments to the params. Params are listed in the
+  // reverse order of arguments.
+  int nargs = count_params(copy);
+  Var **params = calloc(nargs, sizeof(Var *));
+  int i = nargs;
+  for (Var *var = copy->params; var; var = var->next)
+    params[--i] = var;
+
+  Node **args = calloc(nargs, sizeof(Node *));
+  i = 0;
+  for (Node *arg = call->args; arg; arg = arg->next)
+    args[i++] = arg;
+
+  Node head = {};
+  Node *cur = &head;
+  for (i = 0; i < nargs; i++) {
+    args[i]->next = NULL;
+    Node *var = new_node(ND_VAR, params[i]->ty);
+    var->var = params[i];
+    Node *assign = new_node(ND_ASSIGN, params[i]->ty);
+    assign->lhs = var;
+    assign->rhs = args[i];
+    cur = cur->next = new_expr_stmt(assign);
+  }
+
+  // The value of the return statement becomes the value of the
+  // statement expression.
+  Node *ret = NULL;
+  for (Node *n = copy->node->body; n; n = n->next) {
+    if (n->kind == ND_RETURN && !n->next) {
+      ret = n;
+      break;
+    }
+    cur = cur->next = n;
+  }
+
+  Node *val = ret ? ret->lhs : NULL;
+  if (!val) {
+    val = new_node(ND_NUM, ty_int);
+    val->val = 0;
+  }
+
+  // A struct is returned into the temporary of the call as before,
+  // as the locals of the callee end with the statement expression.
+  if (call->var) {
+    Node *var = new_node(ND_VAR, call->var->ty);
+    var->var = call->var;
+    Node *assign = new_node(ND_ASSIGN, call->var->ty);
+    assign->lhs = var;
+    assign->rhs = val;
+    val = assign;
+  }
+  cur = cur->next = new_expr_stmt(val);
+
+  call->kind = ND_STMT_EXPR;
+  call->body = head.next;
+  call->args = NULL;
+  call->funcname = NULL;
+  call->var = NULL;
+
+  // Add the locals of the copy to the caller. They go before the
+  // params, which must be the last locals. Locals of the whole
+  // callee live as long as the statement expression.
+  for (Var *var = copy->locals; var; var = var->next)
+    if (!var->scope || var->scope == copy->node)
+      var->scope = call;
+
+  if (copy->locals) {
+    Var *last = copy->locals;
+    while (last->next)
+      last = last->next;
+    last->next = caller->locals;
+    caller->locals = copy->locals;
+  }
+}
+
+void inline_functions(Program *prog) {
+  Function **order = bottom_up_order(prog);
+
+  // Number of call sites of each function
+  HashMap ncalls = {};
+  for (int i = 0; order[i]; i++)
+    for (Site *s = find_sites(order[i]->node, NULL); s; s = s->next) {
+      Function *fn = find_func(prog, s->call->funcname);
+      if (fn)
+        hashmap_put(&ncalls, fn, (void *)((intptr_t)hashmap_get(&ncalls, fn) + 1));
+    }
+
+  for (int i = 0; order[i]; i++) {
+    Function *caller = order[i];
+    int size = count_nodes(caller->node);
+
+    for (Site *s = find_sites(caller->node, NULL); s; s = s->next) {
+      Function *callee = find_func(prog, s->call->funcname);
+      if (!callee || callee == caller || !can_inline(callee))
+        continue;
+
+      int nargs = 0;
+      for (Node *arg = s->call->args; arg; arg = arg->next)
+        nargs++;
+      if (nargs != count_params(callee))
+        continue;
+
+      int callee_size = count_nodes(callee->node);
+      bool called_once = callee->is_static && (intptr_t)hashmap_get(&ncalls, callee) == 1;
+      if (callee_size > SMALL_SIZE && !called_once)
+        continue;
+      if (opt_size && !called_once)
+        continue;
+      if (size + callee_size > MAX_CALLER_SIZE && callee_size > TINY_SIZE)
+        continue;
+
+      if (!use_fuel("inline", caller))
+        continue;
+
+      inline_call(caller, s->call, callee);
+      size += callee_size;
+    }
+  }
+}
@@ -0,0 +1,568 @@
+// Interprocedural optimizations.
+//
+// A static function can only be called from this translation unit,
+// and occ has no function pointers, so all of its call sites are
+// known. That makes it possible to change its signature:
+//
+//  - ipcp: a parameter that is passed the same number at every call
+//    site becomes a local variable initialized to that number.
+//  - dae: a parameter that is never used is removed, and so is the
+//    return value if no caller uses it.
+//
+// For all functions, pure-const infers whether a function only
+// depends on its arguments (const) or on its arguments and memory
+// (pure) without writing to anything but its own locals, and
+// call-cse evaluates identical calls to such functions in an
+// expression only once.
+#include "occ.h"
+
+typedef struct CallSite CallSite;
+struct CallSite {
+  CallSite *next;
+  Node *node;
+  bool used; // The return value is used
+};
+
+static CallSite *sites;
+
+static void find_calls(Node *node, bool used) {
+  if (!node)
+    return;
+
+  if (node->kind == ND_FUNCALL) {
+    // Compound assignments share their lvalue, so
+    // the same call may be found twice.
+    CallSite *cs = sites;
+    while (cs && cs->node != node)
+      cs = cs->next;
+    if (!cs) {
+      cs = calloc(1, sizeof(CallSite));
+      cs->node = node;
+      cs->next = sites;
+      sites = cs;
+    }
+    cs->used |= used;
+  }
+
+  switch (node->kind) {
+    case ND_EXPR_STMT:
+      find_calls(node->lhs, false);
+      return;
+    case ND_COMMA:
+      find_calls(node->lhs, false);
+      find_calls(node->rhs, used);
+      return;
+    case ND_STMT_EXPR:
+      // The last statement is the value of a statement expression.
+      for (Node *n = node->body; n; n = n->next) {
+        if (!n->next && n->kind == ND_EXPR_STMT)
+          find_calls(n->lhs, used);
+        else
+          find_calls(n, true);
+      }
+      return;
+  }
+
+  find_calls(node->lhs, true);
+  find_calls(node->rhs, true);
+  find_calls(node->cond, true);
+  find_calls(node->then, true);
+  find_calls(node->els, true);
+  find_calls(node->init, true);
+  find_calls(node->inc, true);
+  for (Node *n = node->body; n; n = n->next)
+    find_calls(n, true);
+  for (Node *n = node->args; n; n = n->next)
+    find_calls(n, true);
+}
+
+static void find_all_calls(Program *prog) {
+  sites = NULL;
+  for (Function *fn = prog->funcs; fn; fn = fn->next)
+    find_calls(fn->node, true);
+}
+
+static int count_params(Function *fn) {
+  int n = 0;
+  for (Var *var = fn->params; var; var = var->next)
+    n++;
+  return n;
+}
+
+static int count_args(Node *node) {
+  int n = 0;
+  for (Node *arg = node->args; arg; arg = arg->next)
+    n++;
+  return n;
+}
+
+// Returns true if the signature of a function can be changed,
+// i.e. all calls to it are known and pass the right number of
+// arguments.
+static bool can_change_signature(Function *fn) {
+  if (!fn->is_static)
+    return false;
+
+  int nparams = count_params(fn);
+  for (CallSite *cs = sites; cs; cs = cs->next)
+    if (!strcmp(cs->node->funcname, fn->name) && count_args(cs->node) != nparams)
+      return false;
+  return true;
+}
+
+static Node **arg_slot(Node *call, int idx) {
+  Node **p = &call->args;
+  for (int i = 0; i < idx; i++)
+    p = &(*p)->next;
+  return p;
+}
+
+// Returns the index of the argument a param is passed in. Params
+// are listed in the reverse order of arguments.
+static int param_index(Function *fn, Var *param) {
+  int i = 0;
+  for (Var *var = fn->params; var != param; var = var->next)
+    i++;
+  return count_params(fn) - 1 - i;
+}
+
+// Params are the tail of the list of locals, so this removes the
+// variable from the function altogether.
+static void unlink_param(Function *fn, Var *param) {
+  if (fn->params == param)
+    fn->params = param->next;
+  for (Var **p = &fn->locals; *p; p = &(*p)->next) {
+    if (*p == param) {
+      *p = param->next;
+      break;
+    }
+  }
+}
+
+static void remove_args(Function *fn, int idx) {
+  for (CallSite *cs = sites; cs; cs = cs->next) {
+    if (strcmp(cs->node->funcname, fn->name))
+      continue;
+    Node **p = arg_slot(cs->node, idx);
+    *p = (*p)->next;
+  }
+}
+
+// Removes a parameter and the corresponding argument of each call.
+static void remove_param(Function *fn, Var *param) {
+  remove_args(fn, param_index(fn, param));
+  unlink_param(fn, param);
+}
+
+static void replace_var(Node *node, Var *from, Var *to) {
+  if (!node)
+    return;
+
+  if (node->kind == ND_VAR && node->var == from)
+    node->var = to;
+
+  replace_var(node->lhs, from, to);
+  replace_var(node->rhs, from, to);
+  replace_var(node->cond, from, to);
+  replace_var(node->then, from, to);
+  replace_var(node->els, from, to);
+  replace_var(node->init, from, to);
+  replace_var(node->inc, from, to);
+  for (Node *n = node->body; n; n = n->next)
+    replace_var(n, from, to);
+  for (Node *n = node->args; n; n = n->next)
+    replace_var(n, from, to);
+}
+
+static bool uses_var(Node *node, Var *var) {
+  if (!node)
+    return false;
+  if (node->kind == ND_VAR && node->var == var)
+    return true;
+
+  if (uses_var(node->lhs, var) || uses_var(node->rhs, var) ||
+      uses_var(node->cond, var) || uses_var(node->then, var) ||
+      uses_var(node->els, var) || uses_var(node->init, var) ||
+      uses_var(node->inc, var))
+    return true;
+  for (Node *n = node->body; n; n = n->next)
+    if (uses_var(n, var))
+      return true;
+  for (Node *n = node->args; n; n = n->next)
+    if (uses_var(n, var))
+      return true;
+  return false;
+}
+
+static Node *new_node(NodeKind kind, Type *ty) {
+  Node *node = calloc(1, sizeof(Node));
+  node->kind = kind;
+  node->ty = ty;
+  return node;
+}
+
+static Node *new_var_node(Var *var) {
+  Node *node = new_node(ND_VAR, var->ty);
+  node->var = var;
+  return node;
+}
+
+static Var *new_local(Function *fn, char *name, Type *ty) {
+  Var *var = calloc(1, sizeof(Var));
+  var->name = name;
+  var->ty = ty;
+  var->is_local = true;
+  var->next = fn->locals;
+  fn->locals = var;
+  return var;
+}
+
+//
+// Interprocedural constant propagation
+//
+
+// Replaces a param with a local variable that is initialized to
+// a number. Calls to the function must not pass the argument.
+void bind_param(Function *fn, Var *param, int val) {
+  Var *var = new_local(fn, param->name, param->ty);
+  replace_var(fn->node, param, var);
+
+  Node *num = new_node(ND_NUM, ty_int);
+  num->val = val;
+  Node *assign = new_node(ND_ASSIGN, var->ty);
+  assign->lhs = new_var_node(var);
+  assign->rhs = num;
+  Node *stmt = new_node(ND_EXPR_STMT, NULL);
+  stmt->lhs = assign;
+  stmt->next = fn->node->body;
+  fn->node->body = stmt;
+
+  unlink_param(fn, param);
+}
+
+// Returns true and sets *val if every call passes the same number
+// as the idx-th argument of a function. Also returns false if the
+// function is never called.
+static bool const_arg(Function *fn, int idx, int *val) {
+  bool found = false;
+  for (CallSite *cs = sites; cs; cs = cs->next) {
+    if (strcmp(cs->node->funcname, fn->name))
+      continue;
+
+    Node *arg = *arg_slot(cs->node, idx);
+    if (arg->kind != ND_NUM || (found && arg->val != *val))
+      return false;
+    *val = arg->val;
+    found = true;
+  }
+  return found;
+}
+
+void propagate_interproc_constants(Program *prog) {
+  find_all_calls(prog);
+
+  for (Function *fn = prog->funcs; fn; fn = fn->next) {
+    if (!can_change_signature(fn))
+      continue;
+
+    for (Var *param = fn->params; param;) {
+      Var *next = param->next;
+      int val;
+      if (!const_arg(fn, param_index(fn, param), &val) || !use_fuel("ipcp", fn)) {
+        param = next;
+        continue;
+      }
+
+      remove_args(fn, param_index(fn, param));
+      bind_param(fn, param, val);
+      param = next;
+    }
+  }
+}
+
+//
+// Dead argument elimination
+//
+
+static void remove_return_values(Node *node) {
+  if (!node)
+    return;
+
+  if (node->kind == ND_RETURN && node->lhs) {
+    if (has_side_effects(node->lhs)) {
+      // `return expr;` becomes `{ expr; return; }`.
+      Node *stmt = new_node(ND_EXPR_STMT, NULL);
+      stmt->lhs = node->lhs;
+      stmt->next = new_node(ND_RETURN, NULL);
+      node->kind = ND_BLOCK;
+      node->lhs = NULL;
+      node->body = stmt;
+    } else {
+      node->lhs = NULL;
+    }
+    return;
+  }
+
+  remove_return_values(node->then);
+  remove_return_values(node->els);
+  remove_return_values(node->init);
+  remove_return_values(node->inc);
+  if (node->kind == ND_CASE)
+    remove_return_values(node->lhs);
+  for (Node *n = node->body; n; n = n->next)
+    remove_return_values(n);
+}
+
+static bool has_side_effect_args(Function *fn, int idx) {
+  for (CallSite *cs = sites; cs; cs = cs->next)
+    if (!strcmp(cs->node->funcname, fn->name) &&
+        has_side_effects(*arg_slot(cs->node, idx)))
+      return true;
+  return false;
+}
+
+void eliminate_dead_args(Program *prog) {
+  find_all_calls(prog);
+
+  for (Function *fn = prog->funcs; fn; fn = fn->next) {
+    if (!can_change_signature(fn))
+      continue;
+
+    for (Var *param = fn->params; param;) {
+      Var *next = param->next;
+      if (!uses_var(fn->node, param) &&
+          !has_side_effect_args(fn, param_index(fn, param)) &&
+          use_fuel("dae", fn))
+        remove_param(fn, param);
+      param = next;
+    }
+
+    bool used = false;
+    for (CallSite *cs = sites; cs; cs = cs->next)
+      if (!strcmp(cs->node->funcname, fn->name) && cs->used)
+        used = true;
+    if (!used && use_fuel("dae", fn))
+      remove_return_values(fn->node);
+  }
+}
+
+//
+// Pure and const functions
+//
+
+// Returns the local variable an lvalue is a part of, or NULL
+// if it may refer to memory outside of the function's frame.
+static Var *local_base(Node *node) {
+  Var *var = lvalue_base(node);
+  return (var && var->is_local) ? var : NULL;
+}
+
+static void check_body(Program *prog, Function *fn, Node *node,
+                       bool *is_pure, bool *is_const) {
+  if (!node)
+    return;
+
+  switch (node->kind) {
+    case ND_ASSIGN:
+      if (!local_base(node->lhs))
+        *is_pure = *is_const = false;
+      break;
+    case ND_VAR:
+    case ND_MEMBER:
+    case ND_DEREF:
+      // Arrays are not loaded.
+      if (node->ty->kind != TY_ARRAY && !local_base(node))
+        *is_const = false;
+      break;
+    case ND_FUNCALL: {
+      Function *callee = find_func(prog, node->funcname);
+      if (!callee || !callee->is_pure)
+        *is_pure = *is_const = false;
+      else if (!callee->is_const)
+        *is_const = false;
+      break;
+    }
+  }
+
+  check_body(prog, fn, node->lhs, is_pure, is_const);
+  check_body(prog, fn, node->rhs, is_pure, is_const);
+  check_body(prog, fn, node->cond, is_pure, is_const);
+  check_body(prog, fn, node->then, is_pure, is_const);
+  check_body(prog, fn, node->els, is_pure, is_const);
+  check_body(prog, fn, node->init, is_pure, is_const);
+  check_body(prog, fn, node->inc, is_pure, is_const);
+  for (Node *n = node->body; n; n = n->next)
+    check_body(prog, fn, n, is_pure, is_const);
+  for (Node *n = node->args; n; n = n->next)
+    check_body(prog, fn, n, is_pure, is_const);
+}
+
+// Starts by assuming that all functions are const and weakens the
+// assumption until nothing changes, so that recursive functions
+// can be pure or const too.
+void infer_pure_const(Program *prog) {
+  for (Function *fn = prog->funcs; fn; fn = fn->next)
+    fn->is_pure = fn->is_const = true;
+
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (Function *fn = prog->funcs; fn; fn = fn->next) {
+      bool is_pure = fn->is_pure;
+      bool is_const = fn->is_const;
+      check_body(prog, fn, fn->node, &is_pure, &is_const);
+      if (is_pure != fn->is_pure || is_const != fn->is_const) {
+        fn->is_pure = is_pure;
+        fn->is_const = is_const && is_pure;
+        changed = true;
+      }
+    }
+  }
+}
+
+//
+// Common subexpression elimination of calls
+//
+
+static Program *cur_prog;
+static Function *cur_fn;
+static int ntemps;
+
+// Returns true if an expression has no side effects other than
+// calling pure or const functions.
+static bool is_pure_expr(Node *node) {
+  if (!node)
+    return true;
+
+  switch (node->kind) {
+    case ND_ASSIGN:
+    case ND_STMT_EXPR:
+      return false;
+    case ND_FUNCALL: {
+      Function *fn = find_func(cur_prog, node->funcname);
+      if (!fn || !fn->is_pure)
+        return false;
+      for (Node *arg = node->args; arg; arg = arg->next)
+        if (!is_pure_expr(arg))
+          return false;
+      return true;
+    }
+  }
+  return is_pure_expr(node->lhs) && is_pure_expr(node->rhs);
+}
+
+static bool same_call(Node *a, Node *b) {
+  if (strcmp(a->funcname, b->funcname))
+    return false;
+
+  Node *x = a->args, *y = b->args;
+  for (; x && y; x = x->next, y = y->next)
+    if (has_side_effects(x) || !same_expr(x, y))
+      return false;
+  return !x && !y;
+}
+
+// Finds a call that appears twice in an expression. Operands that
+// are evaluated only conditionally are not searched, so that a
+// call is never made where it wasn't made before.
+static Node *find_dup(Node *node, Node **seen, int *nseen) {
+  if (!node)
+    return NULL;
+
+  if (node->kind == ND_FUNCALL) {
+    for (int i = 0; i < *nseen; i++)
+      if (seen[i] != node && same_call(seen[i], node))
+        return node;
+    if (*nseen < 16)
+      seen[(*nseen)++] = node;
+  }
+
+  Node *dup = find_dup(node->lhs, seen, nseen);
+  if (!dup && node->kind != ND_LOGAND && node->kind != ND_LOGOR)
+    dup = find_dup(node->rhs, seen, nseen);
+  return dup;
+}
+
+static void replace_calls(Node **slot, Node *call, Var *var) {
+  Node *node = *slot;
+  if (!node)
+    return;
+
+  if (node->kind == ND_FUNCALL && same_call(node, call)) {
+    Node *v = new_var_node(var);
+    v->next = node->next;
+    *slot = v;
+    return;
+  }
+
+  replace_calls(&node->lhs, call, var);
+  if (node->kind != ND_LOGAND && node->kind != ND_LOGOR)
+    replace_calls(&node->rhs, call, var);
+}
+
+// Rewrites `f(x) + f(x)` as `(tmp = f(x), tmp + tmp)`.
+static void cse_expr(Node **slot) {
+  if (!*slot || !is_pure_expr(*slot))
+    return;
+
+  for (;;) {
+    Node *seen[16];
+    int nseen = 0;
+    Node *dup = find_dup(*slot, seen, &nseen);
+    if (!dup || !use_fuel("call-cse", cur_fn))
+      return;
+
+    Node *call = calloc(1, sizeof(Node));
+    *call = *dup;
+    call->next = NULL;
+
+    Var *var = new_local(cur_fn, format(".cse.%d", ntemps++), call->ty);
+    replace_calls(slot, call, var);
+
+    Node *assign = new_node(ND_ASSIGN, var->ty);
+    assign->lhs = new_var_node(var);
+    assign->rhs = call;
+    Node *comma = new_node(ND_COMMA, (*slot)->ty);
+    comma->lhs = assign;
+    comma->rhs = *slot;
+    comma->next = (*slot)->next;
+    (*slot)->next = NULL;
+    *slot = comma;
+  }
+}
+
+static void cse_stmt(Node *node) {
+  if (!node)
+    return;
+
+  switch (node->kind) {
+    case ND_EXPR_STMT:
+      // The right-hand side of `x = expr` is evaluated first.
+      if (node->lhs->kind == ND_ASSIGN)
+        cse_expr(&node->lhs->rhs);
+      else
+        cse_expr(&node->lhs);
+      return;
+    case ND_RETURN:
+      cse_expr(&node->lhs);
+      return;
+    case ND_CASE:
+      cse_stmt(node->lhs);
+      return;
+  }
+
+  cse_expr(&node->cond);
+  cse_stmt(node->then);
+  cse_stmt(node->els);
+  cse_stmt(node->init);
+  cse_stmt(node->inc);
+  for (Node *n = node->body; n; n = n->next)
+    cse_stmt(n);
+}
+
+void eliminate_common_calls(Program *prog) {
+  cur_prog = prog;
+  for (Function *fn = prog->funcs; fn; fn = fn->next) {
+    cur_fn = fn;
+    cse_stmt(fn->node);
+  }
+}
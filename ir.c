@@ -0,0 +1,872 @@
+// Textual form of the intermediate representation.
+//
+// The IR of occ is the AST built by the parser. This file prints it
+// as S-expressions and reads it back, e.g.
+//
+//   (global g1 int)
+//   (func add2
+//     (locals (0 y int) (1 x int))
+//     (params 0 1)
+//     (body
+//       (block
+//         (return (add (var 1) (var 0))))))
+//
+// Local variables are referred to by their index in the function's
+// list of locals, and global variables by name. A block lists the
+// locals declared in it first, e.g. `(block (decl 1 0) ...)`; other
+// locals live as long as the function. A struct type is
+// written out in full the first time it appears, e.g.
+// `(struct 0 16 8 (next 0 (ptr (struct 0))) (val 8 int))`, and by
+// number after that. A node that appears more than once in the tree,
+// e.g. the lvalue of `x += 1`, is labeled `#1=(var 0)` where it
+// first appears and referred to as `#1#` after that. The initial value
+// of a global variable is followed by its relocations, e.g.
+// `(global p (ptr int) "\000..." (reloc 0 t 4))` for `int *p = &t[1];`.
+// Read-only variables are written as `(rodata ...)`. A function
+// returning a struct has its return type written after its name,
+// e.g. `(func f (returns (struct 0 ...)) ...)`, and a call to it the
+// local the struct is returned into, e.g. `(funcall f (into 2) ...)`.
+// Lines starting with `;` are comments. Node types are not written; they are
+// computed again when the IR is read.
+#include "occ.h"
+
+static char *node_names[] = {
+  [ND_ADD] = "add",       [ND_SUB] = "sub",         [ND_MUL] = "mul",
+  [ND_DIV] = "div",       [ND_EQ] = "eq",           [ND_NE] = "ne",
+  [ND_LAT] = "lat",       [ND_LET] = "let",         [ND_LAE] = "lae",
+  [ND_LEE] = "lee",       [ND_ASSIGN] = "assign",   [ND_COMMA] = "comma",
+  [ND_MEMBER] = "member", [ND_DEREF] = "deref",     [ND_ADDR] = "addr",
+  [ND_BITAND] = "bitand", [ND_BITNOT] = "bitnot",   [ND_LOGOR] = "logor",
+  [ND_LOGAND] = "logand", [ND_RETURN] = "return",   [ND_IF] = "if",
+  [ND_FOR] = "for",       [ND_WHILE] = "while",     [ND_SWITCH] = "switch",
+  [ND_CASE] = "case",     [ND_BLOCK] = "block",     [ND_BREAK] = "break",
+  [ND_CONTINUE] = "continue", [ND_FUNCALL] = "funcall",
+  [ND_EXPR_STMT] = "expr", [ND_STMT_EXPR] = "stmt-expr",
+  [ND_VAR] = "var",       [ND_NUM] = "num",
+};
+
+static FILE *out;
+static Var *cur_locals;
+static HashMap decls; // Block -> Decl list of the locals declared in it
+static Node *cur_switch;
+
+static Type **structs;
+static int nstructs;
+
+// Number of times each node appears in the function being
+// printed, and then its label if it appears more than once
+static HashMap refs;
+static int nlabels;
+
+static void print_type(Type *ty) {
+  switch (ty->kind) {
+    case TY_VOID:
+      fprintf(out, "void");
+      return;
+    case TY_BOOL:
+      fprintf(out, "_Bool");
+      return;
+    case TY_CHAR:
+      fprintf(out, "char");
+      return;
+    case TY_INT:
+      fprintf(out, "int");
+      return;
+    case TY_ENUM:
+      fprintf(out, "enum");
+      return;
+    case TY_PTR:
+      fprintf(out, "(ptr ");
+      print_type(ty->base);
+      fprintf(out, ")");
+      return;
+    case TY_ARRAY:
+      fprintf(out, "(array ");
+      print_type(ty->base);
+      fprintf(out, " %d)", ty->array_len);
+      return;
+    case TY_STRUCT:
+      for (int i = 0; i < nstructs; i++) {
+        if (structs[i] == ty) {
+          fprintf(out, "(struct %d)", i);
+          return;
+        }
+      }
+      structs = realloc(structs, sizeof(Type *) * (nstructs + 1));
+      structs[nstructs] = ty;
+      fprintf(out, "(struct %d %d %d", nstructs++, ty->size, ty->align);
+      for (Member *mem = ty->members; mem; mem = mem->next) {
+        fprintf(out, " (%.*s %d ", mem->name->len, mem->name->loc, mem->offset);
+        print_type(mem->ty);
+        fprintf(out, ")");
+      }
+      fprintf(out, ")");
+      return;
+    case TY_FUNC:
+      fprintf(out, "func");
+      return;
+  }
+}
+
+static void print_bytes(char *buf, int len) {
+  fprintf(out, "\"");
+  for (int i = 0; i < len; i++) {
+    unsigned char c = buf[i];
+    if (c == '"' || c == '\\')
+      fprintf(out, "\\%c", c);
+    else if (isprint(c))
+      fprintf(out, "%c", c);
+    else
+      fprintf(out, "\\%03o", c);
+  }
+  fprintf(out, "\"");
+}
+
+static int local_index(Var *var) {
+  int i = 0;
+  for (Var *v = cur_locals; v; v = v->next, i++)
+    if (v == var)
+      return i;
+  error("internal error: %s is not a local of the function", var->name);
+}
+
+typedef struct Decl Decl;
+struct Decl {
+  Decl *next;
+  int idx;
+};
+
+static void print_node(Node *node, int depth);
+
+static void print_list(Node *node, int depth) {
+  for (Node *n = node; n; n = n->next) {
+    fprintf(out, "\n%*s", depth * 2, "");
+    print_node(n, depth);
+  }
+}
+
+static void print_child(Node *node, int depth) {
+  fprintf(out, " ");
+  print_node(node, depth);
+}
+
+static void count_refs(Node *node) {
+  if (!node)
+    return;
+
+  intptr_t n = (intptr_t)hashmap_get(&refs, node);
+  hashmap_put(&refs, node, (void *)(n + 1));
+  if (n)
+    return;
+
+  count_refs(node->lhs);
+  count_refs(node->rhs);
+  count_refs(node->cond);
+  count_refs(node->then);
+  count_refs(node->els);
+  count_refs(node->init);
+  count_refs(node->inc);
+  for (Node *n = node->body; n; n = n->next)
+    count_refs(n);
+  for (Node *n = node->args; n; n = n->next)
+    count_refs(n);
+}
+
+static void print_node(Node *node, int depth) {
+  if (!node) {
+    fprintf(out, "nil");
+    return;
+  }
+
+  // Shared nodes are labeled with negative numbers in `refs`
+  // once they have been printed.
+  intptr_t n = (intptr_t)hashmap_get(&refs, node);
+  if (n < 0) {
+    fprintf(out, "#%d#", (int)-n);
+    return;
+  }
+  if (n > 1) {
+    hashmap_put(&refs, node, (void *)(intptr_t)-++nlabels);
+    fprintf(out, "#%d=", nlabels);
+  }
+
+  fprintf(out, "(%s", node_names[node->kind]);
+
+  switch (node->kind) {
+    case ND_NUM:
+      fprintf(out, " %d)", node->val);
+      return;
+    case ND_VAR:
+      if (node->var->is_local)
+        fprintf(out, " %d)", local_index(node->var));
+      else
+        fprintf(out, " %s)", node->var->name);
+      return;
+    case ND_MEMBER:
+      fprintf(out, " %.*s", node->member->name->len, node->member->name->loc);
+      print_child(node->lhs, depth);
+      fprintf(out, ")");
+      return;
+    case ND_FUNCALL:
+      fprintf(out, " %s", node->funcname);
+      if (node->var)
+        fprintf(out, " (into %d)", local_index(node->var));
+      for (Node *n = node->args; n; n = n->next)
+        print_child(n, depth);
+      fprintf(out, ")");
+      return;
+    case ND_BLOCK:
+    case ND_STMT_EXPR: {
+      Decl *d = hashmap_get(&decls, node);
+      if (d) {
+        fprintf(out, " (decl");
+        for (; d; d = d->next)
+          fprintf(out, " %d", d->idx);
+        fprintf(out, ")");
+      }
+      print_list(node->body, depth + 1);
+      fprintf(out, ")");
+      return;
+    }
+    case ND_IF:
+      print_child(node->cond, depth);
+      print_list(node->then, depth + 1);
+      if (node->els)
+        print_list(node->els, depth + 1);
+      fprintf(out, ")");
+      return;
+    case ND_FOR:
+      print_child(node->init, depth);
+      print_child(node->cond, depth);
+      print_child(node->inc, depth);
+      print_list(node->then, depth + 1);
+      fprintf(out, ")");
+      return;
+    case ND_WHILE:
+      print_child(node->cond, depth);
+      print_list(node->then, depth + 1);
+      fprintf(out, ")");
+      return;
+    case ND_SWITCH: {
+      Node *sw = cur_switch;
+      cur_switch = node;
+      print_child(node->cond, depth);
+      print_list(node->then, depth + 1);
+      fprintf(out, ")");
+      cur_switch = sw;
+      return;
+    }
+    case ND_CASE:
+      if (node == cur_switch->default_case)
+        fprintf(out, " default");
+      else
+        fprintf(out, " %d", node->val);
+      print_list(node->lhs, depth + 1);
+      fprintf(out, ")");
+      return;
+    case ND_BREAK:
+    case ND_CONTINUE:
+      fprintf(out, ")");
+      return;
+  }
+
+  if (node->lhs)
+    print_child(node->lhs, depth);
+  if (node->rhs)
+    print_child(node->rhs, depth);
+  fprintf(out, ")");
+}
+
+static void print_func(Function *fn) {
+  cur_locals = fn->locals;
+  hashmap_clear(&refs);
+  nlabels = 0;
+  for (Node *n = fn->node; n; n = n->next)
+    count_refs(n);
+
+  fprintf(out, "(func %s", fn->name);
+  if (fn->is_static)
+    fprintf(out, " static");
+  if (fn->is_const)
+    fprintf(out, " const");
+  else if (fn->is_pure)
+    fprintf(out, " pure");
+  if (fn->return_ty && fn->return_ty->kind == TY_STRUCT) {
+    fprintf(out, " (returns ");
+    print_type(fn->return_ty);
+    fprintf(out, ")");
+  }
+
+  fprintf(out, "\n  (locals");
+  int i = 0;
+  for (Var *var = fn->locals; var; var = var->next, i++) {
+    fprintf(out, "\n    (%d %s ", i, var->name);
+    print_type(var->ty);
+    fprintf(out, ")");
+  }
+  fprintf(out, ")");
+
+  // Locals with a scope are listed by the blocks declaring them,
+  // in the order of declaration.
+  hashmap_clear(&decls);
+  i = 0;
+  for (Var *var = fn->locals; var; var = var->next, i++) {
+    if (!var->scope)
+      continue;
+    Decl *d = calloc(1, sizeof(Decl));
+    d->idx = i;
+    d->next = hashmap_get(&decls, var->scope);
+    hashmap_put(&decls, var->scope, d);
+  }
+
+  fprintf(out, "\n  (params");
+  for (Var *var = fn->params; var; var = var->next)
+    fprintf(out, " %d", local_index(var));
+  fprintf(out, ")");
+
+  fprintf(out, "\n  (body");
+  print_list(fn->node, 2);
+  fprintf(out, "))\n");
+}
+
+// Prints a program in the textual IR format.
+void print_ir(Program *prog, FILE *fp) {
+  out = fp;
+  nstructs = 0;
+
+  for (Var *var = prog->globals; var; var = var->next) {
+    char *kind = var->is_string ? "string" : var->is_readonly ? "rodata" : "global";
+    fprintf(out, "(%s %s ", kind, var->name);
+    print_type(var->ty);
+    if (var->init_data) {
+      fprintf(out, " ");
+      print_bytes(var->init_data, var->ty->size);
+    }
+    for (Relocation *rel = var->rel; rel; rel = rel->next)
+      fprintf(out, " (reloc %d %s %ld)", rel->offset, rel->var->name, rel->addend);
+    fprintf(out, ")\n");
+  }
+
+  for (Function *fn = prog->funcs; fn; fn = fn->next)
+    print_func(fn);
+}
+
+//
+// Reader
+//
+
+static char *ir_path;
+static char *ir_input;
+static char *cur;
+static Var **locals_tab;
+static int nlocals;
+static Var *ir_globals;
+static HashMap labels;
+static HashMap reloc_names; // Relocation -> name of its variable
+
+static void ir_error(char *fmt, ...) {
+  int line = 1;
+  for (char *p = ir_input; p < cur; p++)
+    if (*p == '\n')
+      line++;
+
+  fprintf(stderr, "%s:%d: ", ir_path, line);
+  va_list ap;
+  va_start(ap, fmt);
+  vfprintf(stderr, fmt, ap);
+  va_end(ap);
+  fprintf(stderr, "\n");
+  exit(1);
+}
+
+static void skip_space(void) {
+  for (;;) {
+    if (isspace(*cur)) {
+      cur++;
+    } else if (*cur == ';') {
+      while (*cur && *cur != '\n')
+        cur++;
+    } else {
+      return;
+    }
+  }
+}
+
+static bool peek(char *s) {
+  skip_space();
+  return !strncmp(cur, s, strlen(s));
+}
+
+static void expect(char *s) {
+  if (!peek(s))
+    ir_error("expected '%s'", s);
+  cur += strlen(s);
+}
+
+static bool is_atom_char(char c) {
+  return c && !isspace(c) && c != '(' && c != ')' && c != '"' && c != ';';
+}
+
+static char *read_atom(void) {
+  skip_space();
+  char *start = cur;
+  while (is_atom_char(*cur))
+    cur++;
+  if (cur == start)
+    ir_error("expected an atom");
+  return strndup(start, cur - start);
+}
+
+// Consumes an atom if it is the given one.
+static bool consume_atom(char *s) {
+  skip_space();
+  int len = strlen(s);
+  if (strncmp(cur, s, len) || is_atom_char(cur[len]))
+    return false;
+  cur += len;
+  return true;
+}
+
+static int read_int(void) {
+  char *s = read_atom();
+  char *end;
+  long val = strtol(s, &end, 10);
+  if (*end)
+    ir_error("expected a number: %s", s);
+  return val;
+}
+
+static char *read_bytes(int *len) {
+  expect("\"");
+  char *buf;
+  size_t buflen;
+  FILE *fp = open_memstream(&buf, &buflen);
+
+  while (*cur != '"') {
+    if (!*cur)
+      ir_error("unterminated string");
+    if (*cur != '\\') {
+      fputc(*cur++, fp);
+      continue;
+    }
+    cur++;
+    if ('0' <= *cur && *cur <= '7') {
+      int c = 0;
+      for (int i = 0; i < 3 && '0' <= *cur && *cur <= '7'; i++)
+        c = c * 8 + *cur++ - '0';
+      fputc(c, fp);
+    } else {
+      fputc(*cur++, fp);
+    }
+  }
+  cur++;
+  fclose(fp);
+  *len = buflen;
+  return buf;
+}
+
+static Type *read_type(void) {
+  if (consume_atom("void"))
+    return ty_void;
+  if (consume_atom("_Bool"))
+    return ty_bool;
+  if (consume_atom("char"))
+    return ty_char;
+  if (consume_atom("int"))
+    return ty_int;
+  if (consume_atom("enum"))
+    return enum_type();
+  if (consume_atom("func"))
+    return func_type(ty_int);
+
+  expect("(");
+  if (consume_atom("ptr")) {
+    Type *ty = pointer_to(read_type());
+    expect(")");
+    return ty;
+  }
+
+  if (consume_atom("array")) {
+    Type *base = read_type();
+    Type *ty = array_of(base, read_int());
+    expect(")");
+    return ty;
+  }
+
+  if (!consume_atom("struct"))
+    ir_error("unknown type");
+
+  int idx = read_int();
+  if (peek(")")) {
+    expect(")");
+    if (idx < 0 || nstructs <= idx)
+      ir_error("undefined struct: %d", idx);
+    return structs[idx];
+  }
+  if (idx != nstructs)
+    ir_error("struct numbers must be consecutive: %d", idx);
+
+  // Registered before the members are read so that they can refer to it.
+  Type *ty = calloc(1, sizeof(Type));
+  ty->kind = TY_STRUCT;
+  structs = realloc(structs, sizeof(Type *) * (nstructs + 1));
+  structs[nstructs++] = ty;
+
+  ty->size = read_int();
+  ty->align = read_int();
+
+  Member head = {};
+  Member *m = &head;
+  while (!peek(")")) {
+    expect("(");
+    m = m->next = calloc(1, sizeof(Member));
+    char *name = read_atom();
+    m->name = calloc(1, sizeof(Token));
+    m->name->kind = TK_IDENT;
+    m->name->loc = name;
+    m->name->len = strlen(name);
+    m->offset = read_int();
+    m->ty = read_type();
+    expect(")");
+  }
+  expect(")");
+  ty->members = head.next;
+  return ty;
+}
+
+static Var *find_global(char *name) {
+  for (Var *var = ir_globals; var; var = var->next)
+    if (!strcmp(var->name, name))
+      return var;
+  return NULL;
+}
+
+static Node *read_node(void);
+
+// Reads nodes up to ")" as a list.
+static Node *read_list(void) {
+  Node head = {};
+  Node *n = &head;
+  while (!peek(")"))
+    n = n->next = read_node();
+  return head.next;
+}
+
+static Node *read_node_body(Node *node) {
+  char *kind = read_atom();
+  int k = 0;
+  while (k < sizeof(node_names) / sizeof(*node_names) &&
+         (!node_names[k] || strcmp(node_names[k], kind)))
+    k++;
+  if (k == sizeof(node_names) / sizeof(*node_names))
+    ir_error("unknown node: %s", kind);
+  node->kind = k;
+
+  switch (node->kind) {
+    case ND_NUM:
+      node->val = read_int();
+      break;
+    case ND_VAR: {
+      char *name = read_atom();
+      if (isdigit(*name)) {
+        int idx = atoi(name);
+        if (nlocals <= idx)
+          ir_error("undefined local: %d", idx);
+        node->var = locals_tab[idx];
+      } else {
+        node->var = find_global(name);
+        if (!node->var)
+          ir_error("undefined global: %s", name);
+      }
+      break;
+    }
+    case ND_MEMBER: {
+      char *name = read_atom();
+      node->lhs = read_node();
+      add_type(node->lhs);
+      if (node->lhs->ty->kind != TY_STRUCT)
+        ir_error("not a struct: %s", name);
+      for (Member *m = node->lhs->ty->members; m; m = m->next)
+        if (m->name->len == strlen(name) && !strncmp(m->name->loc, name, m->name->len))
+          node->member = m;
+      if (!node->member)
+        ir_error("no such member: %s", name);
+      break;
+    }
+    case ND_FUNCALL:
+      node->funcname = read_atom();
+      if (peek("(into")) {
+        expect("(");
+        consume_atom("into");
+        int idx = read_int();
+        if (nlocals <= idx)
+          ir_error("undefined local: %d", idx);
+        node->var = locals_tab[idx];
+        expect(")");
+      }
+      node->args = read_list();
+      break;
+    case ND_BLOCK:
+    case ND_STMT_EXPR:
+      if (peek("(decl")) {
+        expect("(");
+        consume_atom("decl");
+        while (!peek(")")) {
+          int idx = read_int();
+          if (nlocals <= idx)
+            ir_error("undefined local: %d", idx);
+          locals_tab[idx]->scope = node;
+        }
+        expect(")");
+      }
+      node->body = read_list();
+      break;
+    case ND_IF:
+      node->cond = read_node();
+      node->then = read_node();
+      if (!peek(")"))
+        node->els = read_node();
+      break;
+    case ND_FOR:
+      node->init = read_node();
+      node->cond = read_node();
+      node->inc = read_node();
+      node->then = read_node();
+      break;
+    case ND_WHILE:
+      node->cond = read_node();
+      node->then = read_node();
+      break;
+    case ND_SWITCH: {
+      Node *sw = cur_switch;
+      cur_switch = node;
+      node->cond = read_node();
+      node->then = read_node();
+      cur_switch = sw;
+      break;
+    }
+    case ND_CASE: {
+      if (!cur_switch)
+        ir_error("case outside of switch");
+      if (consume_atom("default")) {
+        cur_switch->default_case = node;
+      } else {
+        // Cases are listed in reverse order, as by the parser.
+        node->val = read_int();
+        node->case_next = cur_switch->case_next;
+        cur_switch->case_next = node;
+      }
+      node->lhs = read_node();
+      break;
+    }
+    case ND_BREAK:
+    case ND_CONTINUE:
+      break;
+    default:
+      if (!peek(")"))
+        node->lhs = read_node();
+      if (!peek(")"))
+        node->rhs = read_node();
+  }
+
+  expect(")");
+  return node;
+}
+
+static Node *read_node(void) {
+  if (consume_atom("nil"))
+    return NULL;
+
+  skip_space();
+  if (*cur == '#') {
+    cur++;
+    char *end;
+    intptr_t label = strtol(cur, &end, 10);
+    cur = end;
+
+    if (*cur == '#') {
+      cur++;
+      Node *node = hashmap_get(&labels, (void *)label);
+      if (!node)
+        ir_error("undefined label: %d", (int)label);
+      return node;
+    }
+
+    expect("=");
+    expect("(");
+    Node *node = calloc(1, sizeof(Node));
+    hashmap_put(&labels, (void *)label, node);
+    return read_node_body(node);
+  }
+
+  expect("(");
+  return read_node_body(calloc(1, sizeof(Node)));
+}
+
+static Function *read_func(void) {
+  Function *fn = calloc(1, sizeof(Function));
+  fn->name = read_atom();
+  if (consume_atom("static"))
+    fn->is_static = true;
+  if (consume_atom("const"))
+    fn->is_const = fn->is_pure = true;
+  else if (consume_atom("pure"))
+    fn->is_pure = true;
+
+  fn->return_ty = ty_int;
+  if (peek("(returns")) {
+    expect("(");
+    consume_atom("returns");
+    fn->return_ty = read_type();
+    expect(")");
+  }
+
+  expect("(");
+  if (!consume_atom("locals"))
+    ir_error("expected locals");
+  Var head = {};
+  Var *v = &head;
+  nlocals = 0;
+  while (!peek(")")) {
+    expect("(");
+    if (read_int() != nlocals)
+      ir_error("locals must be numbered consecutively");
+    v = v->next = calloc(1, sizeof(Var));
+    v->name = read_atom();
+    v->ty = read_type();
+    v->is_local = true;
+    expect(")");
+
+    locals_tab = realloc(locals_tab, sizeof(Var *) * (nlocals + 1));
+    locals_tab[nlocals++] = v;
+  }
+  expect(")");
+  fn->locals = head.next;
+
+  // Params are the last locals.
+  expect("(");
+  if (!consume_atom("params"))
+    ir_error("expected params");
+  int first = nlocals;
+  for (int i = 0; !peek(")"); i++) {
+    int idx = read_int();
+    if (i == 0)
+      first = idx;
+    if (idx != first + i)
+      ir_error("params must be the last locals");
+  }
+  expect(")");
+  if (first < nlocals)
+    fn->params = locals_tab[first];
+
+  expect("(");
+  if (!consume_atom("body"))
+    ir_error("expected body");
+  hashmap_clear(&labels);
+  cur_switch = NULL;
+  fn->node = read_list();
+  expect(")");
+  expect(")");
+
+  for (Node *n = fn->node; n; n = n->next)
+    add_type(n);
+  return fn;
+}
+
+static bool starts_with_bytes(char *path, char *s) {
+  FILE *fp = fopen(path, "r");
+  if (!fp)
+    return false;
+  char buf[16] = {};
+  fread(buf, 1, strlen(s), fp);
+  fclose(fp);
+  return !strcmp(buf, s);
+}
+
+static bool is_binary_ir(char *path) {
+  return starts_with_bytes(path, IR_BINARY_MAGIC);
+}
+
+// Reads a program in the textual or the binary IR format.
+Program *read_ir(char *path) {
+  if (is_binary_ir(path))
+    return read_ir_binary(path);
+
+  ir_path = path;
+  ir_input = cur = read_file(path);
+  nstructs = 0;
+  ir_globals = NULL;
+
+  Program *prog = calloc(1, sizeof(Program));
+  Var **gp = &prog->globals;
+  Function **fp = &prog->funcs;
+
+  for (;;) {
+    skip_space();
+    if (!*cur)
+      break;
+
+    expect("(");
+    if (consume_atom("func")) {
+      *fp = read_func();
+      fp = &(*fp)->next;
+      continue;
+    }
+
+    bool is_string = consume_atom("string");
+    bool is_readonly = !is_string && consume_atom("rodata");
+    if (!is_string && !is_readonly && !consume_atom("global"))
+      ir_error("expected a function or a global variable");
+
+    Var *var = calloc(1, sizeof(Var));
+    var->name = read_atom();
+    var->ty = read_type();
+    var->is_string = is_string;
+    var->is_readonly = is_readonly;
+    if (peek("\"")) {
+      int len;
+      var->init_data = read_bytes(&len);
+      if (len != var->ty->size)
+        ir_error("%s: wrong size of initializer", var->name);
+    }
+
+    // Relocations may refer to variables defined later, so they are
+    // resolved at the end.
+    Relocation head = {};
+    Relocation *rel = &head;
+    while (peek("(reloc")) {
+      expect("(reloc");
+      rel = rel->next = calloc(1, sizeof(Relocation));
+      rel->offset = read_int();
+      hashmap_put(&reloc_names, rel, read_atom());
+      rel->addend = read_int();
+      if (rel->offset < 0 || rel->offset + 8 > var->ty->size)
+        ir_error("%s: relocation out of range", var->name);
+      expect(")");
+    }
+    var->rel = head.next;
+    expect(")");
+
+    if (find_global(var->name))
+      ir_error("%s: defined twice", var->name);
+    *gp = var;
+    gp = &var->next;
+    ir_globals = prog->globals;
+  }
+
+  for (Var *var = prog->globals; var; var = var->next) {
+    for (Relocation *rel = var->rel; rel; rel = rel->next) {
+      char *name = hashmap_get(&reloc_names, rel);
+      rel->var = find_global(name);
+      if (!rel->var)
+        ir_error("%s: undefined variable %s", var->name, name);
+    }
+  }
+  hashmap_clear(&reloc_names);
+  return prog;
+}
+
+// Returns true if a file is IR written by occ rather than C.
+bool is_ir_file(char *path) {
+  return starts_with_bytes(path, IR_HEADER) || is_binary_ir(path);
+}
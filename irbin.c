@@ -0,0 +1,612 @@
+// Binary form of the intermediate representation.
+//
+// The same program as the textual form in a compact encoding, for IR
+// written by one run of occ and read by another, e.g. with -flto.
+// The file is mapped into memory and decoded in place; strings and
+// initializers are not copied out of it.
+//
+// Numbers are LEB128 varints. A file consists of
+//
+//   magic, string table, globals, relocations, functions
+//
+// Strings are stored once, NUL-terminated, and referred to by index.
+// Types are written as in the textual form: a struct is written out
+// the first time it appears and referred to by number after that.
+// Nodes are written in preorder as a tag, a bitmask of the children
+// that are present, the children, and then kind-specific fields. The
+// tag is 0 for a null node, 1 followed by a number for a node that
+// has been written before, and 2 + kind for a new node. Nodes are
+// numbered per function in the order they are written. The nodes of
+// a function are followed by the number + 1 of the block each local
+// is declared in, or 0 for locals of the whole function. The return
+// type of a function is only written if it is a struct, and a call
+// is followed by the number + 1 of the local the struct is returned
+// into, or 0. Relocations
+// come after all globals, as they may refer to later ones: for each
+// global, their number and then the offset, the global's index + 1
+// and the addend of each.
+#include "occ.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+enum {
+  T_VOID, T_BOOL, T_CHAR, T_INT, T_ENUM, T_FUNC, T_PTR, T_ARRAY,
+  T_STRUCT, T_STRUCT_REF,
+};
+
+enum { TAG_NULL, TAG_REF, TAG_NODE };
+
+// Children in the bitmask
+enum {
+  C_LHS = 1, C_RHS = 2, C_COND = 4, C_THEN = 8, C_ELS = 16,
+  C_INIT = 32, C_INC = 64, C_BODY = 128, C_ARGS = 256,
+};
+
+// Function flags
+enum { F_STATIC = 1, F_PURE = 2, F_CONST = 4, F_RETURNS_STRUCT = 8 };
+
+// Global variable flags
+enum { G_STRING = 1, G_INIT = 2, G_READONLY = 4 };
+
+static Type **structs;
+static int nstructs;
+
+// Writer state
+static FILE *out;
+static StringArray strings;
+static HashMap string_ids; // String -> index + 1
+static HashMap global_ids; // Var -> index + 1
+static HashMap node_ids;   // Node -> index + 1
+static int nnodes;
+static Var *cur_locals;
+static Node *cur_switch;
+
+static void put_uint(uint64_t val) {
+  do {
+    int byte = val & 0x7f;
+    val >>= 7;
+    fputc(val ? (byte | 0x80) : byte, out);
+  } while (val);
+}
+
+// Signed numbers are zigzag-encoded.
+static void put_int(int64_t val) {
+  put_uint(((uint64_t)val << 1) ^ (val >> 63));
+}
+
+static void put_string(char *s) {
+  intptr_t id = (intptr_t)hashmap_sget(&string_ids, s);
+  if (!id) {
+    strarray_push(&strings, s);
+    id = strings.len;
+    hashmap_sput(&string_ids, s, (void *)id);
+  }
+  put_uint(id - 1);
+}
+
+static void put_type(Type *ty) {
+  switch (ty->kind) {
+    case TY_VOID: put_uint(T_VOID); return;
+    case TY_BOOL: put_uint(T_BOOL); return;
+    case TY_CHAR: put_uint(T_CHAR); return;
+    case TY_INT: put_uint(T_INT); return;
+    case TY_ENUM: put_uint(T_ENUM); return;
+    case TY_FUNC: put_uint(T_FUNC); return;
+    case TY_PTR:
+      put_uint(T_PTR);
+      put_type(ty->base);
+      return;
+    case TY_ARRAY:
+      put_uint(T_ARRAY);
+      put_type(ty->base);
+      put_uint(ty->array_len);
+      return;
+    case TY_STRUCT: {
+      for (int i = 0; i < nstructs; i++) {
+        if (structs[i] == ty) {
+          put_uint(T_STRUCT_REF);
+          put_uint(i);
+          return;
+        }
+      }
+      structs = realloc(structs, sizeof(Type *) * (nstructs + 1));
+      structs[nstructs++] = ty;
+
+      int n = 0;
+      for (Member *m = ty->members; m; m = m->next)
+        n++;
+      put_uint(T_STRUCT);
+      put_uint(ty->size);
+      put_uint(ty->align);
+      put_uint(n);
+      for (Member *m = ty->members; m; m = m->next) {
+        put_string(strndup(m->name->loc, m->name->len));
+        put_uint(m->offset);
+        put_type(m->ty);
+      }
+      return;
+    }
+  }
+}
+
+static int var_index(Var *list, Var *var) {
+  int i = 0;
+  for (Var *v = list; v; v = v->next, i++)
+    if (v == var)
+      return i;
+  error("internal error: unknown variable %s", var->name);
+}
+
+static void put_node(Node *node);
+
+static void put_list(Node *node) {
+  int n = 0;
+  for (Node *c = node; c; c = c->next)
+    n++;
+  put_uint(n);
+  for (Node *c = node; c; c = c->next)
+    put_node(c);
+}
+
+static void put_node(Node *node) {
+  if (!node) {
+    put_uint(TAG_NULL);
+    return;
+  }
+
+  intptr_t id = (intptr_t)hashmap_get(&node_ids, node);
+  if (id) {
+    put_uint(TAG_REF);
+    put_uint(id - 1);
+    return;
+  }
+  hashmap_put(&node_ids, node, (void *)(intptr_t)++nnodes);
+
+  put_uint(TAG_NODE + node->kind);
+
+  int mask = (node->lhs ? C_LHS : 0) | (node->rhs ? C_RHS : 0) |
+             (node->cond ? C_COND : 0) | (node->then ? C_THEN : 0) |
+             (node->els ? C_ELS : 0) | (node->init ? C_INIT : 0) |
+             (node->inc ? C_INC : 0) | (node->body ? C_BODY : 0) |
+             (node->args ? C_ARGS : 0);
+  put_uint(mask);
+
+  Node *sw = cur_switch;
+  if (node->kind == ND_SWITCH)
+    cur_switch = node;
+
+  if (mask & C_LHS) put_node(node->lhs);
+  if (mask & C_RHS) put_node(node->rhs);
+  if (mask & C_COND) put_node(node->cond);
+  if (mask & C_THEN) put_node(node->then);
+  if (mask & C_ELS) put_node(node->els);
+  if (mask & C_INIT) put_node(node->init);
+  if (mask & C_INC) put_node(node->inc);
+  if (mask & C_BODY) put_list(node->body);
+  if (mask & C_ARGS) put_list(node->args);
+  cur_switch = sw;
+
+  switch (node->kind) {
+    case ND_NUM:
+      put_int(node->val);
+      return;
+    case ND_CASE:
+      put_uint(node == cur_switch->default_case);
+      put_int(node->val);
+      return;
+    case ND_VAR:
+      if (node->var->is_local)
+        put_int(var_index(cur_locals, node->var));
+      else
+        put_int(-(intptr_t)hashmap_get(&global_ids, node->var));
+      return;
+    case ND_MEMBER: {
+      int i = 0;
+      for (Member *m = node->lhs->ty->members; m != node->member; m = m->next)
+        i++;
+      put_uint(i);
+      return;
+    }
+    case ND_FUNCALL:
+      put_string(node->funcname);
+      put_uint(node->var ? var_index(cur_locals, node->var) + 1 : 0);
+      return;
+  }
+}
+
+static void put_func(Function *fn) {
+  cur_locals = fn->locals;
+  hashmap_clear(&node_ids);
+  nnodes = 0;
+
+  put_string(fn->name);
+  bool returns_struct = fn->return_ty && fn->return_ty->kind == TY_STRUCT;
+  put_uint((fn->is_static ? F_STATIC : 0) | (fn->is_pure ? F_PURE : 0) |
+           (fn->is_const ? F_CONST : 0) | (returns_struct ? F_RETURNS_STRUCT : 0));
+  if (returns_struct)
+    put_type(fn->return_ty);
+
+  int nlocals = 0;
+  for (Var *var = fn->locals; var; var = var->next)
+    nlocals++;
+  put_uint(nlocals);
+  for (Var *var = fn->locals; var; var = var->next) {
+    put_string(var->name);
+    put_type(var->ty);
+  }
+
+  // Params are the last locals.
+  put_uint(fn->params ? var_index(fn->locals, fn->params) : nlocals);
+  put_list(fn->node);
+
+  for (Var *var = fn->locals; var; var = var->next)
+    put_uint((intptr_t)hashmap_get(&node_ids, var->scope));
+}
+
+// Writes a program in the binary IR format.
+void write_ir_binary(Program *prog, FILE *fp) {
+  strings = (StringArray){};
+  hashmap_clear(&string_ids);
+  nstructs = 0;
+  hashmap_clear(&global_ids);
+
+  // The string table comes first but is known only after the rest
+  // has been encoded.
+  char *buf;
+  size_t buflen;
+  out = open_memstream(&buf, &buflen);
+
+  int nglobals = 0;
+  for (Var *var = prog->globals; var; var = var->next)
+    nglobals++;
+  put_uint(nglobals);
+  int i = 0;
+  for (Var *var = prog->globals; var; var = var->next) {
+    hashmap_put(&global_ids, var, (void *)(intptr_t)++i);
+    put_string(var->name);
+    put_uint((var->is_string ? G_STRING : 0) | (var->init_data ? G_INIT : 0) |
+             (var->is_readonly ? G_READONLY : 0));
+    put_type(var->ty);
+    if (var->init_data)
+      fwrite(var->init_data, 1, var->ty->size, out);
+  }
+
+  for (Var *var = prog->globals; var; var = var->next) {
+    int nrels = 0;
+    for (Relocation *rel = var->rel; rel; rel = rel->next)
+      nrels++;
+    put_uint(nrels);
+    for (Relocation *rel = var->rel; rel; rel = rel->next) {
+      put_uint(rel->offset);
+      put_uint((intptr_t)hashmap_get(&global_ids, rel->var));
+      put_int(rel->addend);
+    }
+  }
+
+  int nfuncs = 0;
+  for (Function *fn = prog->funcs; fn; fn = fn->next)
+    nfuncs++;
+  put_uint(nfuncs);
+  for (Function *fn = prog->funcs; fn; fn = fn->next)
+    put_func(fn);
+  fclose(out);
+
+  out = fp;
+  fwrite(IR_BINARY_MAGIC, 1, sizeof(IR_BINARY_MAGIC) - 1, out);
+  put_uint(strings.len);
+  for (int i = 0; i < strings.len; i++)
+    fwrite(strings.data[i], 1, strlen(strings.data[i]) + 1, out);
+  fwrite(buf, 1, buflen, out);
+  free(buf);
+}
+
+//
+// Reader
+//
+
+static char *ir_path;
+static unsigned char *cur;
+static unsigned char *end;
+static char **string_tab;
+static int nstrings;
+static Var **globals_tab;
+static int nglobals;
+static Var **locals_tab;
+static int nlocals;
+static Node **nodes_tab;
+
+static void bad_ir(void) {
+  error("%s: corrupt IR file", ir_path);
+}
+
+static uint64_t get_uint(void) {
+  uint64_t val = 0;
+  for (int shift = 0;; shift += 7) {
+    if (cur == end || shift > 63)
+      bad_ir();
+    int byte = *cur++;
+    val |= (uint64_t)(byte & 0x7f) << shift;
+    if (!(byte & 0x80))
+      return val;
+  }
+}
+
+static int64_t get_int(void) {
+  uint64_t val = get_uint();
+  return (val >> 1) ^ -(val & 1);
+}
+
+// Returns an index less than `n`.
+static int get_index(int n) {
+  uint64_t val = get_uint();
+  if (val >= n)
+    bad_ir();
+  return val;
+}
+
+static char *get_string(void) {
+  return string_tab[get_index(nstrings)];
+}
+
+static Type *get_type(void) {
+  switch (get_uint()) {
+    case T_VOID: return ty_void;
+    case T_BOOL: return ty_bool;
+    case T_CHAR: return ty_char;
+    case T_INT: return ty_int;
+    case T_ENUM: return enum_type();
+    case T_FUNC: return func_type(ty_int);
+    case T_PTR: return pointer_to(get_type());
+    case T_ARRAY: {
+      Type *base = get_type();
+      return array_of(base, get_uint());
+    }
+    case T_STRUCT_REF:
+      return structs[get_index(nstructs)];
+    case T_STRUCT: {
+      Type *ty = calloc(1, sizeof(Type));
+      ty->kind = TY_STRUCT;
+      structs = realloc(structs, sizeof(Type *) * (nstructs + 1));
+      structs[nstructs++] = ty;
+
+      ty->size = get_uint();
+      ty->align = get_uint();
+      int n = get_uint();
+      Member head = {};
+      Member *m = &head;
+      for (int i = 0; i < n; i++) {
+        m = m->next = calloc(1, sizeof(Member));
+        char *name = get_string();
+        m->name = calloc(1, sizeof(Token));
+        m->name->kind = TK_IDENT;
+        m->name->loc = name;
+        m->name->len = strlen(name);
+        m->offset = get_uint();
+        m->ty = get_type();
+      }
+      ty->members = head.next;
+      return ty;
+    }
+  }
+  bad_ir();
+  return NULL;
+}
+
+static Node *get_node(void);
+
+static Node *get_list(void) {
+  int n = get_uint();
+  Node head = {};
+  Node *node = &head;
+  for (int i = 0; i < n; i++)
+    node = node->next = get_node();
+  return head.next;
+}
+
+static Node *get_node(void) {
+  uint64_t tag = get_uint();
+  if (tag == TAG_NULL)
+    return NULL;
+  if (tag == TAG_REF)
+    return nodes_tab[get_index(nnodes)];
+  if (tag - TAG_NODE > ND_NUM)
+    bad_ir();
+
+  Node *node = calloc(1, sizeof(Node));
+  node->kind = tag - TAG_NODE;
+  nodes_tab = realloc(nodes_tab, sizeof(Node *) * (nnodes + 1));
+  nodes_tab[nnodes++] = node;
+
+  int mask = get_uint();
+
+  Node *sw = cur_switch;
+  if (node->kind == ND_SWITCH)
+    cur_switch = node;
+
+  if (mask & C_LHS) node->lhs = get_node();
+  if (mask & C_RHS) node->rhs = get_node();
+  if (mask & C_COND) node->cond = get_node();
+  if (mask & C_THEN) node->then = get_node();
+  if (mask & C_ELS) node->els = get_node();
+  if (mask & C_INIT) node->init = get_node();
+  if (mask & C_INC) node->inc = get_node();
+  if (mask & C_BODY) node->body = get_list();
+  if (mask & C_ARGS) node->args = get_list();
+  cur_switch = sw;
+
+  switch (node->kind) {
+    case ND_NUM:
+      node->val = get_int();
+      break;
+    case ND_CASE:
+      if (!cur_switch)
+        bad_ir();
+      if (get_uint()) {
+        cur_switch->default_case = node;
+      } else {
+        node->case_next = cur_switch->case_next;
+        cur_switch->case_next = node;
+      }
+      node->val = get_int();
+      break;
+    case ND_VAR: {
+      int64_t idx = get_int();
+      if (idx >= 0) {
+        if (idx >= nlocals)
+          bad_ir();
+        node->var = locals_tab[idx];
+      } else {
+        if (-idx > nglobals)
+          bad_ir();
+        node->var = globals_tab[-idx - 1];
+      }
+      break;
+    }
+    case ND_MEMBER: {
+      add_type(node->lhs);
+      if (!node->lhs || node->lhs->ty->kind != TY_STRUCT)
+        bad_ir();
+      int idx = get_uint();
+      Member *m = node->lhs->ty->members;
+      for (int i = 0; i < idx && m; i++)
+        m = m->next;
+      if (!m)
+        bad_ir();
+      node->member = m;
+      break;
+    }
+    case ND_FUNCALL: {
+      node->funcname = get_string();
+      int idx = get_index(nlocals + 1);
+      if (idx)
+        node->var = locals_tab[idx - 1];
+      break;
+    }
+  }
+  return node;
+}
+
+static Function *get_func(void) {
+  Function *fn = calloc(1, sizeof(Function));
+  fn->name = get_string();
+  int flags = get_uint();
+  fn->is_static = flags & F_STATIC;
+  fn->is_pure = flags & F_PURE;
+  fn->is_const = flags & F_CONST;
+  fn->return_ty = (flags & F_RETURNS_STRUCT) ? get_type() : ty_int;
+
+  nlocals = get_uint();
+  locals_tab = realloc(locals_tab, sizeof(Var *) * (nlocals + 1));
+  Var head = {};
+  Var *var = &head;
+  for (int i = 0; i < nlocals; i++) {
+    var = var->next = calloc(1, sizeof(Var));
+    var->name = get_string();
+    var->ty = get_type();
+    var->is_local = true;
+    locals_tab[i] = var;
+  }
+  fn->locals = head.next;
+
+  int first = get_index(nlocals + 1);
+  if (first < nlocals)
+    fn->params = locals_tab[first];
+
+  nnodes = 0;
+  cur_switch = NULL;
+  fn->node = get_list();
+  for (Node *n = fn->node; n; n = n->next)
+    add_type(n);
+
+  for (int i = 0; i < nlocals; i++) {
+    int id = get_index(nnodes + 1);
+    if (id)
+      locals_tab[i]->scope = nodes_tab[id - 1];
+  }
+  return fn;
+}
+
+// Reads a program in the binary IR format.
+Program *read_ir_binary(char *path) {
+  ir_path = path;
+
+  int fd = open(path, O_RDONLY);
+  if (fd == -1)
+    error("cannot open %s: %s", path, strerror(errno));
+  struct stat st;
+  if (fstat(fd, &st) == -1)
+    error("%s: %s", path, strerror(errno));
+  void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (map == MAP_FAILED)
+    error("cannot map %s: %s", path, strerror(errno));
+  close(fd);
+
+  cur = map;
+  end = cur + st.st_size;
+  int magic_len = sizeof(IR_BINARY_MAGIC) - 1;
+  if (st.st_size < magic_len || memcmp(cur, IR_BINARY_MAGIC, magic_len))
+    bad_ir();
+  cur += magic_len;
+
+  // Strings stay in the mapped file.
+  nstrings = get_uint();
+  string_tab = calloc(nstrings, sizeof(char *));
+  for (int i = 0; i < nstrings; i++) {
+    string_tab[i] = (char *)cur;
+    cur = memchr(cur, '\0', end - cur);
+    if (!cur)
+      bad_ir();
+    cur++;
+  }
+
+  nstructs = 0;
+  Program *prog = calloc(1, sizeof(Program));
+
+  nglobals = get_uint();
+  globals_tab = calloc(nglobals, sizeof(Var *));
+  Var **gp = &prog->globals;
+  for (int i = 0; i < nglobals; i++) {
+    Var *var = globals_tab[i] = calloc(1, sizeof(Var));
+    var->name = get_string();
+    int flags = get_uint();
+    var->is_string = flags & G_STRING;
+    var->is_readonly = flags & G_READONLY;
+    var->ty = get_type();
+    if (flags & G_INIT) {
+      if (end - cur < var->ty->size)
+        bad_ir();
+      var->init_data = (char *)cur;
+      cur += var->ty->size;
+    }
+    *gp = var;
+    gp = &var->next;
+  }
+
+  for (int i = 0; i < nglobals; i++) {
+    Var *var = globals_tab[i];
+    Relocation **rp = &var->rel;
+    for (int n = get_uint(); n > 0; n--) {
+      Relocation *rel = *rp = calloc(1, sizeof(Relocation));
+      rp = &rel->next;
+      rel->offset = get_uint();
+      int id = get_uint();
+      if (id < 1 || id > nglobals || !var->init_data || rel->offset + 8 > var->ty->size)
+        bad_ir();
+      rel->var = globals_tab[id - 1];
+      rel->addend = get_int();
+    }
+  }
+
+  int nfuncs = get_uint();
+  Function **fp = &prog->funcs;
+  for (int i = 0; i < nfuncs; i++) {
+    *fp = get_func();
+    fp = &(*fp)->next;
+  }
+
+  if (cur != end)
+    bad_ir();
+  return prog;
+}
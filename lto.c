@@ -0,0 +1,106 @@
+// Link-time optimization.
+//
+// With -flto, occ writes the IR of a translation unit instead of
+// assembly. Given several IR files, occ merges them into one program
+// before running the optimization passes, so that calls between
+// translation units can be inlined and optimized like any other call,
+// and emits the whole program as one assembly file.
+//
+// Static functions and global variables are private to the file
+// they are defined in. If another file defines the same name, they
+// are renamed. Non-static functions must be defined only once.
+#include "occ.h"
+
+static StringArray names;
+
+static bool is_taken(char *name) {
+  for (int i = 0; i < names.len; i++)
+    if (!strcmp(names.data[i], name))
+      return true;
+  return false;
+}
+
+static char *unique_name(char *name) {
+  char *s = name;
+  for (int i = 1; is_taken(s); i++)
+    s = format("%s.%d", name, i);
+  strarray_push(&names, s);
+  return s;
+}
+
+// Points calls to the static functions of a file to their new names.
+// `funcs` has the functions with their old names in `old_names`.
+static void rename_calls(Node *node, Function *funcs, char **old_names) {
+  if (!node)
+    return;
+
+  if (node->kind == ND_FUNCALL) {
+    int i = 0;
+    for (Function *fn = funcs; fn; fn = fn->next, i++) {
+      if (fn->is_static && !strcmp(node->funcname, old_names[i])) {
+        node->funcname = fn->name;
+        break;
+      }
+    }
+  }
+
+  rename_calls(node->lhs, funcs, old_names);
+  rename_calls(node->rhs, funcs, old_names);
+  rename_calls(node->cond, funcs, old_names);
+  rename_calls(node->then, funcs, old_names);
+  rename_calls(node->els, funcs, old_names);
+  rename_calls(node->init, funcs, old_names);
+  rename_calls(node->inc, funcs, old_names);
+  for (Node *n = node->body; n; n = n->next)
+    rename_calls(n, funcs, old_names);
+  for (Node *n = node->args; n; n = n->next)
+    rename_calls(n, funcs, old_names);
+}
+
+// Merges programs into one.
+Program *link_programs(Program **progs, int nprogs) {
+  names = (StringArray){};
+
+  for (int i = 0; i < nprogs; i++) {
+    for (Function *fn = progs[i]->funcs; fn; fn = fn->next) {
+      if (fn->is_static)
+        continue;
+      if (is_taken(fn->name))
+        error("multiple definition of %s", fn->name);
+      strarray_push(&names, fn->name);
+    }
+  }
+
+  Program *prog = calloc(1, sizeof(Program));
+  Var **gp = &prog->globals;
+  Function **fp = &prog->funcs;
+
+  for (int i = 0; i < nprogs; i++) {
+    for (Var *var = progs[i]->globals; var; var = var->next)
+      var->name = unique_name(var->name);
+
+    int nfuncs = 0;
+    for (Function *fn = progs[i]->funcs; fn; fn = fn->next)
+      nfuncs++;
+    char **old_names = calloc(nfuncs, sizeof(char *));
+
+    int j = 0;
+    for (Function *fn = progs[i]->funcs; fn; fn = fn->next, j++) {
+      old_names[j] = fn->name;
+      if (fn->is_static)
+        fn->name = unique_name(fn->name);
+    }
+
+    for (Function *fn = progs[i]->funcs; fn; fn = fn->next)
+      for (Node *n = fn->node; n; n = n->next)
+        rename_calls(n, progs[i]->funcs, old_names);
+
+    *gp = progs[i]->globals;
+    while (*gp)
+      gp = &(*gp)->next;
+    *fp = progs[i]->funcs;
+    while (*fp)
+      fp = &(*fp)->next;
+  }
+  return prog;
+}
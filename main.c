@@ -1,12 +1,344 @@
 #include "occ.h"
 
+bool opt_cost_report;
+char *opt_cost_report_file;
+bool opt_stack_usage;
+int opt_level;
+bool opt_size;
+bool opt_lto;
+char *opt_emit_ir; // "text" or "binary"
+StringArray opt_pass_list;
+long opt_fuel = -1;   // Unlimited unless given
+int opt_budget = 100; // Percentage of the per-pass complexity limits
+bool opt_budget_report;
+bool opt_time_report;
+bool opt_strict_aliasing = true;
+bool opt_specialize_all;
+bool opt_function_sections;
+bool opt_data_sections;
+bool opt_pie;
+int opt_stack_array_align = 16;
+int opt_icf = -1; // Enabled at -O2 unless given
+bool opt_icf_all;
+bool opt_icf_report;
+bool opt_outline_report;
+bool opt_string_pool_report;
+StringArray opt_enable_passes;
+StringArray opt_disable_passes;
+StringArray opt_print_before;
+StringArray opt_print_after;
+
+static StringArray input_paths;
+
+static void usage(int status) {
+  fprintf(stderr,
+          "occ [ -O0 | -O1 | -O2 | -Os ] [ -fenable-pass=<pass> ] [ -fdisable-pass=<pass> ]\n"
+          "    [ -print-before=<pass> ] [ -print-after=<pass> ] [ -ftime-report ]\n"
+          "    [ -f[no-]strict-aliasing ] [ -fspecialize-all ] [ -fcost-report[=<file>] ]\n"
+          "    [ -fstack-usage ] [ -ffunction-sections ] [ -fdata-sections ] [ -fPIE ]\n"
+          "    [ -fstack-array-align=<16|32|64> ]\n"
+          "    [ -f[no-]icf | -ficf=all ] [ -ficf-report ]\n"
+          "    [ -foutline-report ] [ -fstring-pool-report ] [ -flto ]\n"
+          "    [ -passes=<pass>,... ] [ -emit-ir[=binary] ]\n"
+          "    [ -fopt-fuel=<n> ] [ -fopt-budget=<percent> ] [ -fopt-budget-report ] <file>...\n");
+  exit(status);
+}
+
+// Parses the non-negative number after "-f<name>=".
+static long read_count(char *arg, char *name) {
+  char *end;
+  long val = strtol(arg, &end, 10);
+  if (!isdigit(*arg) || *end || val > INT_MAX)
+    error("-f%s: expected a non-negative number: %s", name, arg);
+  return val;
+}
+
+static void parse_args(int argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--help"))
+      usage(0);
+
+    if (!strcmp(argv[i], "-O0") || !strcmp(argv[i], "-O1") ||
+        !strcmp(argv[i], "-O2")) {
+      opt_level = argv[i][2] - '0';
+      opt_size = false;
+      continue;
+    }
+
+    // Optimize for size: -O2 without passes that make code larger,
+    // plus the machine outliner.
+    if (!strcmp(argv[i], "-Os")) {
+      opt_level = 2;
+      opt_size = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-O")) {
+      opt_level = 1;
+      opt_size = false;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-fenable-pass=", 14)) {
+      strarray_push(&opt_enable_passes, argv[i] + 14);
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-fdisable-pass=", 15)) {
+      strarray_push(&opt_disable_passes, argv[i] + 15);
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-print-before=", 14)) {
+      strarray_push(&opt_print_before, argv[i] + 14);
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-print-after=", 13)) {
+      strarray_push(&opt_print_after, argv[i] + 13);
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-flto")) {
+      opt_lto = true;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-passes=", 8)) {
+      char *s = strdup(argv[i] + 8);
+      for (char *p = strtok(s, ","); p; p = strtok(NULL, ","))
+        strarray_push(&opt_pass_list, p);
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-fopt-fuel=", 11)) {
+      opt_fuel = read_count(argv[i] + 11, "opt-fuel");
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-fopt-budget=", 13)) {
+      opt_budget = read_count(argv[i] + 13, "opt-budget");
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fopt-budget-report")) {
+      opt_budget_report = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-emit-ir")) {
+      opt_emit_ir = "text";
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-emit-ir=binary")) {
+      opt_emit_ir = "binary";
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-ftime-report")) {
+      opt_time_report = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fstrict-aliasing")) {
+      opt_strict_aliasing = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fno-strict-aliasing")) {
+      opt_strict_aliasing = false;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fspecialize-all")) {
+      opt_specialize_all = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-ffunction-sections")) {
+      opt_function_sections = true;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-fstack-array-align=", 20)) {
+      opt_stack_array_align = strtol(argv[i] + 20, NULL, 10);
+      if (opt_stack_array_align != 16 && opt_stack_array_align != 32 &&
+          opt_stack_array_align != 64)
+        error("-fstack-array-align: must be 16, 32 or 64");
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fdata-sections")) {
+      opt_data_sections = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fPIE") || !strcmp(argv[i], "-fpie")) {
+      opt_pie = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-ficf")) {
+      opt_icf = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-ficf=all")) {
+      opt_icf = true;
+      opt_icf_all = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fno-icf")) {
+      opt_icf = false;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-ficf-report")) {
+      opt_icf_report = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-foutline-report")) {
+      opt_outline_report = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fstring-pool-report")) {
+      opt_string_pool_report = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fcost-report")) {
+      opt_cost_report = true;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-fcost-report=", 14)) {
+      opt_cost_report = true;
+      opt_cost_report_file = argv[i] + 14;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fstack-usage")) {
+      opt_stack_usage = true;
+      continue;
+    }
+
+    if (argv[i][0] == '-' && argv[i][1] != '\0')
+      error("unknown argument: %s", argv[i]);
+
+    strarray_push(&input_paths, argv[i]);
+  }
+
+  if (input_paths.len == 0)
+    usage(1);
+
+  if (opt_icf == -1)
+    opt_icf = opt_level >= 2;
+}
+
+static FILE *open_file(char *path) {
+  if (!path)
+    return stderr;
+
+  FILE *out = fopen(path, "w");
+  if (!out)
+    error("cannot open output file: %s: %s", path, strerror(errno));
+  return out;
+}
+
+// Replaces the directory and extension of the input file name,
+// e.g. "tests/tests.c" with ".su" becomes "tests.su".
+static char *replace_extn(char *path, char *extn) {
+  if (!strcmp(path, "-"))
+    path = "stdin";
+
+  char *base = strrchr(path, '/');
+  base = base ? base + 1 : path;
+
+  char *dot = strrchr(base, '.');
+  int len = dot ? dot - base : strlen(base);
+  return format("%.*s%s", len, base, extn);
+}
+
 int main(int argc, char **argv) {
-  if (argc != 2)
-    error("%s: wrong number of arguments", argv[0]);
+  parse_args(argc, argv);
+
+  // Input files are C source files or IR written by -flto.
+  // They are linked into one program if there are more than one.
+  Program **progs = calloc(input_paths.len, sizeof(Program *));
+  for (int i = 0; i < input_paths.len; i++) {
+    char *path = input_paths.data[i];
+    if (is_ir_file(path)) {
+      timer_start("read IR");
+      progs[i] = read_ir(path);
+      timer_stop();
+      continue;
+    }
+
+    timer_start("tokenize");
+    Token *tok = tokenize_file(path);
+    timer_stop();
+
+    timer_start("parse");
+    progs[i] = parse(tok);
+    timer_stop();
+  }
+
+  Program *prog = progs[0];
+  if (input_paths.len > 1)
+    prog = link_programs(progs, input_paths.len);
+
+  // Optimization is deferred to the link.
+  if (opt_lto) {
+    write_ir_binary(prog, stdout);
+    return 0;
+  }
+
+  run_passes(prog);
 
-  Token *tok = tokenize_file(argv[1]);
-  Program *prog = parse(tok);
+  // Write IR instead of assembly, e.g. to test passes on IR inputs
+  // with -passes=.
+  if (opt_emit_ir) {
+    timer_start("write IR");
+    if (!strcmp(opt_emit_ir, "binary")) {
+      write_ir_binary(prog, stdout);
+    } else {
+      printf("%s", IR_HEADER);
+      print_ir(prog, stdout);
+    }
+    timer_stop();
+    if (opt_time_report)
+      print_time_report(stderr);
+    return 0;
+  }
+
+  timer_start("codegen");
   codegen(prog);
+  timer_stop();
+
+  // The reports describe the code as emitted, after identical code
+  // folding and outlining.
+  if (opt_cost_report)
+    cost_report(prog, open_file(opt_cost_report_file));
+
+  if (opt_stack_usage)
+    stack_usage(prog, input_paths.data[0],
+                open_file(replace_extn(input_paths.data[0], ".su")), stderr);
+
+  if (opt_icf_report)
+    print_icf_report(stderr);
+
+  if (opt_outline_report)
+    print_outline_report(stderr);
+
+  if (opt_string_pool_report)
+    print_string_pool_report(stderr);
+
+  if (opt_time_report)
+    print_time_report(stderr);
 
   return 0; 
 }
@@ -1,15 +1,53 @@
 #define _POSIX_C_SOURCE 200809L
 #include <ctype.h>
 #include <errno.h>
+#include <limits.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <assert.h>
 
 typedef struct Type Type;
 typedef struct Member Member;
+typedef struct Callee Callee;
+
+/*
+ * strings.c
+ */
+typedef struct {
+  char **data;
+  int capacity;
+  int len;
+} StringArray;
+
+void strarray_push(StringArray *arr, char *s);
+char *vformat(char *fmt, va_list ap);
+char *format(char *fmt, ...);
+
+/*
+ * hashmap.c
+ */
+typedef struct {
+  void *key;
+  void *val;
+} HashEntry;
+
+typedef struct {
+  HashEntry *buckets;
+  int capacity;
+  int used;
+  bool strings; // Keys are strings
+} HashMap;
+
+void *hashmap_get(HashMap *map, void *key);
+void hashmap_put(HashMap *map, void *key, void *val);
+void *hashmap_sget(HashMap *map, char *key);
+void hashmap_sput(HashMap *map, char *key, void *val);
+void hashmap_clear(HashMap *map);
 
 /*
  * tokenize.c
@@ -29,14 +67,16 @@ struct Token {
   Token *next;
 
   int val;   // For TK_NUM, number value
-  char *loc; // Token location
-  int len;   // Token length
+  char *loc;   // Token location
+  int len;     // Token length
+  int line_no; // Line number
 
   // String literal
   char *contents; // including terminating '\0'
   int cont_len;   // length
 };
 
+char *read_file(char *path);
 Token *tokenize_file(char *filename);
 
 void error(char *fmt, ...);
@@ -45,8 +85,22 @@ void error_at(char *loc, char *fmt, ...);
 /*
  * parse.c
  */
-// Local variable
+typedef struct Node Node;
+
 typedef struct Var Var;
+
+// Address of a global variable in the initial value of another, e.g.
+// `int *p = &t[1];` gives a relocation to t with addend 4 at offset 0
+// of p.
+typedef struct Relocation Relocation;
+struct Relocation {
+  Relocation *next;
+  int offset;
+  Var *var;
+  long addend;
+};
+
+// Local variable
 struct Var {
   Var *next;
   char *name;
@@ -55,9 +109,19 @@ struct Var {
 
   // Local variable
   int offset;
+  int id; // Index among variables tracked by dataflow analyses, or -1
+  bool is_addr_taken;
+  bool is_noalias; // A restrict param that always points where it did
+                   // on entry, give or take an offset
+  Node *scope; // Block the variable is declared in, or NULL if it
+               // lives as long as the function
 
   // Global variable
   char *init_data;
+  Relocation *rel; // Pointers in init_data, by increasing offset
+  bool is_string; // String literal
+  bool is_readonly; // Never written, e.g. the template of an initializer
+  bool is_live; // Referenced from a live function
 };
 
 typedef enum {
@@ -97,7 +161,6 @@ typedef enum {
 } NodeKind;
 
 // AST Node
-typedef struct Node Node;
 struct Node {
   NodeKind kind;
   Node *next;
@@ -118,7 +181,8 @@ struct Node {
   // Struct member access
   Member *member;
 
-  // Function call
+  // Function call. A call returning a struct has the local
+  // variable the struct is returned into in `var`.
   char *funcname;
   Node *args;
 
@@ -140,11 +204,36 @@ struct Function {
   Function *next;
   char *name;
   Var *params;
+  Type *return_ty;
   bool is_static;
+  int line_no;
 
   Node *node;
   Var *locals;
   int stack_size;
+  int frame_align;
+
+  // Call graph
+  Callee *callees;
+  bool is_recursive; // Part of a cycle in the call graph
+  bool is_live;      // Reachable from a non-static function
+
+  // Set by the pure-const pass
+  bool is_pure;  // Has no side effects
+  bool is_const; // Has no side effects and reads no memory but its frame
+
+  // Set by codegen
+  StringArray code; // Emitted assembly, one line per element
+  int nregs;        // Number of expression stack registers used
+  int clobbers;     // Caller-saved registers the function or its callees
+                    // may overwrite, as a bitmask of register indices
+
+  // Set by identical code folding
+  Function *folded_into; // Function with the same code, or NULL
+  bool is_thunk;         // Jumps to folded_into instead of aliasing it
+
+  // Created by the machine outliner; has code but no nodes
+  bool is_outlined;
 };
 
 typedef struct {
@@ -154,6 +243,9 @@ typedef struct {
 
 Program *parse(Token *tok);
 
+extern int npooled_strings;
+extern int pooled_string_bytes;
+
 /*
  * type.c
  */
@@ -173,6 +265,8 @@ struct Type {
   TypeKind kind;
   int size;  // sizeof() value
   int align; // alignment
+  bool is_const;
+  bool is_restrict;
 
   // Pointer or Array
   Type *base;
@@ -205,6 +299,7 @@ extern Type *ty_char;
 extern Type *ty_int;
 
 int align_to(int n, int align);
+Type *copy_type(Type *ty);
 Type *pointer_to(Type *base);
 Type *func_type(Type *return_ty);
 Type *array_of(Type *base, int len);
@@ -212,7 +307,258 @@ Type *enum_type();
 bool is_integer(Type *type);
 void add_type(Node *node);
 
+/*
+ * callgraph.c
+ */
+struct Callee {
+  Callee *next;
+  char *name;
+  Function *fn; // NULL if defined outside this translation unit
+  int ncalls;   // Number of call sites
+};
+
+Function *find_func(Program *prog, char *name);
+void build_callgraph(Program *prog);
+Function **bottom_up_order(Program *prog);
+
 /*
  * codegen.c
  */
 void codegen(Program *prog);
+void print_string_pool_report(FILE *out);
+
+/*
+ * frame.c
+ */
+int layout_frame(Function *fn);
+
+/*
+ * cost.c
+ */
+bool is_insn(char *line);
+int insn_size(char *line);
+void cost_report(Program *prog, FILE *out);
+
+/*
+ * ir.c
+ */
+// First line of textual IR files written by -emit-ir
+#define IR_HEADER ";; occ-ir 1\n"
+
+void print_ir(Program *prog, FILE *out);
+Program *read_ir(char *path);
+bool is_ir_file(char *path);
+
+/*
+ * irbin.c
+ */
+#define IR_BINARY_MAGIC "\177OCCIR4\n"
+
+void write_ir_binary(Program *prog, FILE *out);
+Program *read_ir_binary(char *path);
+
+/*
+ * pass.c
+ */
+void run_passes(Program *prog);
+void timer_start(char *name);
+void timer_stop(void);
+void print_time_report(FILE *out);
+
+/*
+ * budget.c
+ */
+typedef struct {
+  int blocks;
+  int insns;
+  int loop_depth;
+} Complexity;
+
+Complexity measure_function(Function *fn);
+bool within_budget(Function *fn, char *pass);
+bool use_fuel(char *pass, Function *fn);
+
+/*
+ * fold.c
+ */
+void fold_constants(Program *prog);
+
+/*
+ * dataflow.c
+ */
+typedef struct {
+  int nbits;
+  uint64_t *words;
+} BitSet;
+
+typedef struct BasicBlock BasicBlock;
+struct BasicBlock {
+  int id; // Index in reverse postorder
+  bool reachable;
+
+  // Statements and conditions evaluated in this block, in order.
+  // Each element points to where the node is stored in the AST.
+  Node ***insns;
+  int ninsns;
+
+  BasicBlock **succs;
+  int nsuccs;
+  BasicBlock **preds;
+  int npreds;
+};
+
+typedef struct {
+  BasicBlock **blocks; // Reachable blocks in reverse postorder, then the rest
+  int nblocks;
+  int nreachable;
+  BasicBlock *exit;
+} CFG;
+
+typedef struct {
+  bool forward;     // Forward or backward problem
+  bool may;         // Meet is union if true, intersection otherwise
+  int nbits;
+  BitSet **gen;     // Indexed by block id
+  BitSet **kill;
+  BitSet *boundary; // Value at the entry (forward) or exit (backward)
+
+  // Solution, indexed by block id
+  BitSet **in;
+  BitSet **out;
+} Dataflow;
+
+BitSet *new_bitset(int nbits);
+void bitset_set(BitSet *set, int i);
+void bitset_clear(BitSet *set, int i);
+bool bitset_test(BitSet *set, int i);
+void bitset_copy(BitSet *dst, BitSet *src);
+void bitset_union(BitSet *dst, BitSet *src);
+void bitset_diff(BitSet *dst, BitSet *src);
+void bitset_fill(BitSet *set);
+CFG *build_cfg(Function *fn);
+void solve_dataflow(CFG *cfg, Dataflow *df);
+int track_vars(Function *fn);
+Var *insn_def(Node *node);
+void insn_uses(Node *node, BitSet *set);
+bool has_side_effects(Node *node);
+Dataflow *liveness(CFG *cfg, int nvars);
+
+/*
+ * alias.c
+ */
+
+typedef enum {
+  NO_ALIAS,
+  MAY_ALIAS,
+  MUST_ALIAS,
+} AliasResult;
+
+void mark_address_taken(Function *fn);
+void mark_all_address_taken(Program *prog);
+Var *lvalue_base(Node *node);
+bool same_expr(Node *a, Node *b);
+AliasResult alias(Node *a, Node *b);
+bool call_may_modify(Node *node);
+
+/*
+ * sroa.c
+ */
+void scalar_replace_aggregates(Program *prog);
+
+/*
+ * forward.c
+ */
+void forward_stores(Program *prog);
+
+/*
+ * constprop.c
+ */
+void propagate_constants(Program *prog);
+
+/*
+ * dse.c
+ */
+void eliminate_dead_stores(Program *prog);
+
+/*
+ * ipo.c
+ */
+void propagate_interproc_constants(Program *prog);
+void eliminate_dead_args(Program *prog);
+void infer_pure_const(Program *prog);
+void eliminate_common_calls(Program *prog);
+void bind_param(Function *fn, Var *param, int val);
+
+/*
+ * clone.c
+ */
+Function *clone_function(Function *fn, char *name);
+
+/*
+ * inline.c
+ */
+void inline_functions(Program *prog);
+
+/*
+ * lto.c
+ */
+Program *link_programs(Program **progs, int nprogs);
+
+/*
+ * specialize.c
+ */
+void specialize_functions(Program *prog);
+
+/*
+ * globaldce.c
+ */
+void eliminate_dead_globals(Program *prog);
+
+/*
+ * icf.c
+ */
+void fold_identical_data(Program *prog);
+void fold_identical_code(Program *prog);
+void print_icf_report(FILE *out);
+
+/*
+ * outline.c
+ */
+void outline_functions(Program *prog);
+void print_outline_report(FILE *out);
+
+/*
+ * stackusage.c
+ */
+void stack_usage(Program *prog, char *filename, FILE *su, FILE *summary);
+
+/*
+ * main.c
+ */
+extern bool opt_cost_report;
+extern char *opt_cost_report_file;
+extern bool opt_stack_usage;
+extern int opt_level;
+extern bool opt_lto;
+extern char *opt_emit_ir;
+extern StringArray opt_pass_list;
+extern long opt_fuel;
+extern int opt_budget;
+extern bool opt_budget_report;
+extern bool opt_size;
+extern bool opt_time_report;
+extern bool opt_strict_aliasing;
+extern bool opt_specialize_all;
+extern bool opt_function_sections;
+extern bool opt_data_sections;
+extern bool opt_pie;
+extern int opt_stack_array_align;
+extern int opt_icf;
+extern bool opt_icf_all;
+extern bool opt_icf_report;
+extern bool opt_outline_report;
+extern bool opt_string_pool_report;
+extern StringArray opt_enable_passes;
+extern StringArray opt_disable_passes;
+extern StringArray opt_print_before;
+extern StringArray opt_print_after;
@@ -0,0 +1,327 @@
+// Machine outliner.
+//
+// Finds sequences of instructions that are repeated in the generated
+// code, within a function or across functions, and replaces them with
+// calls to a new function containing one copy of the sequence. This
+// makes the code smaller at the cost of a call and a return, so it is
+// only done with -Os.
+//
+// The code of all functions is concatenated into one string of
+// instruction numbers, with identical instructions getting the same
+// number, and repeats are found as intervals of the LCP array of its
+// suffix array. Labels and instructions that cannot be moved into
+// another function separate the string into pieces that are never
+// outlined together. Candidates are outlined greedily, the ones that
+// save the most bytes first.
+#include "occ.h"
+
+#define CALL_SIZE 5
+#define RET_SIZE 1
+
+typedef struct Candidate Candidate;
+struct Candidate {
+  int len;
+  int *starts;
+  int nstarts;
+  int benefit;
+};
+
+// The concatenated code. `str[i]` is the number of the instruction
+// at `lines[i]` of `funcs[i]`, or a unique negative number for one
+// that is never outlined.
+static int *str;
+static Function **funcs;
+static int *lines;
+static int *sizes;
+static int len;
+
+static int *sa;   // Suffix array
+static int *rank;
+static int *lcp;  // lcp[i] is the common prefix length of sa[i-1] and sa[i]
+
+static int nfuncs;
+
+static char *skip_space(char *p) {
+  while (*p == ' ')
+    p++;
+  return p;
+}
+
+static bool starts_with(char *p, char *s) {
+  return !strncmp(p, s, strlen(s));
+}
+
+// An instruction can be moved into a called function unless it
+// depends on the stack pointer, which the call changes, or on the
+// position of the code.
+static bool is_legal(char *line) {
+  char *p = skip_space(line);
+  if (starts_with(p, "push ") || starts_with(p, "pop ") ||
+      starts_with(p, "call ") || starts_with(p, "ret") || *p == 'j')
+    return false;
+  return !strstr(p, "rsp") && !strstr(p, ".L.return.");
+}
+
+static void append(Function *fn, int line, int val) {
+  static int cap;
+  if (len == cap) {
+    cap = cap ? cap * 2 : 1024;
+    str = realloc(str, sizeof(int) * cap);
+    funcs = realloc(funcs, sizeof(Function *) * cap);
+    lines = realloc(lines, sizeof(int) * cap);
+    sizes = realloc(sizes, sizeof(int) * cap);
+  }
+  str[len] = val;
+  funcs[len] = fn;
+  lines[len] = line;
+  sizes[len] = (line < 0) ? 0 : insn_size(fn->code.data[line]);
+  len++;
+}
+
+static void build_string(Program *prog) {
+  HashMap insns = {}; // Instruction -> its number + 1
+  int ninsns = 0;
+  int sep = -1;
+
+  for (Function *fn = prog->funcs; fn; fn = fn->next) {
+    if (fn->folded_into)
+      continue;
+
+    for (int i = 0; i < fn->code.len; i++) {
+      char *line = fn->code.data[i];
+      if (!is_insn(line) || !is_legal(line)) {
+        append(fn, i, sep--);
+        continue;
+      }
+
+      intptr_t j = (intptr_t)hashmap_sget(&insns, line);
+      if (!j) {
+        j = ++ninsns;
+        hashmap_sput(&insns, line, (void *)j);
+      }
+      append(fn, i, j - 1);
+    }
+    append(fn, -1, sep--);
+  }
+  hashmap_clear(&insns);
+}
+
+// Sorts suffixes by prefix doubling: suffixes are sorted by their
+// first k numbers, then by the first 2k, and so on.
+static int k;
+
+static int cmp_suffix(const void *a, const void *b) {
+  int x = *(int *)a;
+  int y = *(int *)b;
+  if (rank[x] != rank[y])
+    return (rank[x] < rank[y]) ? -1 : 1;
+  int rx = (x + k < len) ? rank[x + k] : INT_MIN;
+  int ry = (y + k < len) ? rank[y + k] : INT_MIN;
+  if (rx != ry)
+    return (rx < ry) ? -1 : 1;
+  return 0;
+}
+
+static void build_suffix_array(void) {
+  sa = calloc(len, sizeof(int));
+  rank = calloc(len, sizeof(int));
+  int *tmp = calloc(len, sizeof(int));
+
+  for (int i = 0; i < len; i++) {
+    sa[i] = i;
+    rank[i] = str[i];
+  }
+
+  for (k = 1;; k *= 2) {
+    qsort(sa, len, sizeof(int), cmp_suffix);
+    tmp[sa[0]] = 0;
+    for (int i = 1; i < len; i++)
+      tmp[sa[i]] = tmp[sa[i - 1]] + (cmp_suffix(&sa[i - 1], &sa[i]) < 0);
+    memcpy(rank, tmp, sizeof(int) * len);
+    if (rank[sa[len - 1]] == len - 1)
+      break;
+  }
+
+  // Kasai's algorithm. Separators are unique, so common prefixes
+  // never contain one.
+  lcp = calloc(len, sizeof(int));
+  int h = 0;
+  for (int i = 0; i < len; i++) {
+    if (rank[i] == 0) {
+      h = 0;
+      continue;
+    }
+    int j = sa[rank[i] - 1];
+    while (i + h < len && j + h < len && str[i + h] == str[j + h] && str[i + h] >= 0)
+      h++;
+    lcp[rank[i]] = h;
+    if (h)
+      h--;
+  }
+  free(tmp);
+}
+
+static int cmp_int(const void *a, const void *b) {
+  return *(int *)a - *(int *)b;
+}
+
+static int cmp_benefit(const void *a, const void *b) {
+  return ((Candidate *)b)->benefit - ((Candidate *)a)->benefit;
+}
+
+static Candidate *candidates;
+static int ncandidates;
+
+// Adds the sequence of length `n` starting at the suffixes
+// sa[lo..hi] as a candidate if outlining it saves space.
+static void add_candidate(int n, int lo, int hi) {
+  if (n < 2)
+    return;
+
+  int *starts = calloc(hi - lo + 1, sizeof(int));
+  for (int i = lo; i <= hi; i++)
+    starts[i - lo] = sa[i];
+  qsort(starts, hi - lo + 1, sizeof(int), cmp_int);
+
+  // Drop occurrences overlapping the previous one.
+  int nstarts = 0;
+  for (int i = 0; i <= hi - lo; i++)
+    if (nstarts == 0 || starts[nstarts - 1] + n <= starts[i])
+      starts[nstarts++] = starts[i];
+
+  int size = 0;
+  for (int i = 0; i < n; i++)
+    size += sizes[starts[0] + i];
+
+  int benefit = nstarts * size - nstarts * CALL_SIZE - size - RET_SIZE;
+  if (nstarts < 2 || benefit <= 0) {
+    free(starts);
+    return;
+  }
+
+  static int cap;
+  if (ncandidates == cap) {
+    cap = cap ? cap * 2 : 64;
+    candidates = realloc(candidates, sizeof(Candidate) * cap);
+  }
+  candidates[ncandidates++] = (Candidate){n, starts, nstarts, benefit};
+}
+
+// Enumerates the LCP intervals, the maximal ranges of suffixes
+// sharing a prefix, with a stack of open intervals.
+static void find_candidates(void) {
+  int *stack_len = calloc(len + 1, sizeof(int));
+  int *stack_lo = calloc(len + 1, sizeof(int));
+  int sp = 0;
+  stack_len[0] = 0;
+  stack_lo[0] = 0;
+
+  for (int i = 1; i <= len; i++) {
+    int h = (i < len) ? lcp[i] : 0;
+    int lo = i - 1;
+    while (h < stack_len[sp]) {
+      lo = stack_lo[sp];
+      add_candidate(stack_len[sp], lo, i - 1);
+      sp--;
+    }
+    if (h > stack_len[sp]) {
+      sp++;
+      stack_len[sp] = h;
+      stack_lo[sp] = lo;
+    }
+  }
+  free(stack_len);
+  free(stack_lo);
+}
+
+static Function *new_outlined(Candidate *c) {
+  Function *fn = calloc(1, sizeof(Function));
+  fn->name = format("outlined.%d", nfuncs++);
+  fn->is_static = true;
+  fn->is_outlined = true;
+
+  Function *src = funcs[c->starts[0]];
+  for (int i = 0; i < c->len; i++)
+    strarray_push(&fn->code, src->code.data[lines[c->starts[0] + i]]);
+  strarray_push(&fn->code, "  ret");
+  return fn;
+}
+
+static int saved;
+
+void print_outline_report(FILE *out) {
+  fprintf(out, "outliner: %d functions created, %d bytes of code saved\n", nfuncs, saved);
+}
+
+// Replaces repeated instruction sequences with calls. Must be called
+// after code has been generated for all functions.
+void outline_functions(Program *prog) {
+  len = 0;
+  ncandidates = 0;
+  build_string(prog);
+  if (len == 0)
+    return;
+
+  build_suffix_array();
+  find_candidates();
+  qsort(candidates, ncandidates, sizeof(Candidate), cmp_benefit);
+
+  // replaced[i] is the function replacing the sequence starting at
+  // position i, and covered[i] is set for the rest of the sequence.
+  Function **replaced = calloc(len, sizeof(Function *));
+  bool *covered = calloc(len, sizeof(bool));
+  Function head = {};
+  Function *cur = &head;
+
+  for (int i = 0; i < ncandidates; i++) {
+    Candidate *c = &candidates[i];
+
+    // Occurrences may overlap with sequences already outlined.
+    int n = 0;
+    for (int j = 0; j < c->nstarts; j++) {
+      bool free_ = true;
+      for (int l = 0; l < c->len; l++)
+        if (covered[c->starts[j] + l])
+          free_ = false;
+      if (free_)
+        c->starts[n++] = c->starts[j];
+    }
+    c->nstarts = n;
+
+    int size = 0;
+    for (int l = 0; l < c->len; l++)
+      size += sizes[c->starts[0] + l];
+    int benefit = n * size - n * CALL_SIZE - size - RET_SIZE;
+    if (n < 2 || benefit <= 0)
+      continue;
+
+    Function *fn = new_outlined(c);
+    cur = cur->next = fn;
+    saved += benefit;
+
+    for (int j = 0; j < n; j++) {
+      replaced[c->starts[j]] = fn;
+      for (int l = 0; l < c->len; l++)
+        covered[c->starts[j] + l] = true;
+    }
+  }
+
+  // Rewrite the functions.
+  for (int i = 0; i < len;) {
+    Function *fn = funcs[i];
+    StringArray code = {};
+    for (; i < len && funcs[i] == fn; i++) {
+      if (replaced[i])
+        strarray_push(&code, format("  call %s", replaced[i]->name));
+      else if (!covered[i] && lines[i] >= 0)
+        strarray_push(&code, fn->code.data[lines[i]]);
+    }
+    fn->code = code;
+  }
+
+  // Outlined functions are emitted after the others.
+  Function **p = &prog->funcs;
+  while (*p)
+    p = &(*p)->next;
+  *p = head.next;
+}
@@ -31,9 +31,27 @@ typedef struct {
   bool is_static;
 } VarAttr;
 
+// Scalar set by an initializer, at an offset of the variable
+typedef struct Init Init;
+struct Init {
+  Init *next;
+  int offset;
+  Type *ty;
+  Node *lvalue; // For local variables
+  Node *expr;   // NULL for an element without an initializer
+  bool is_const;
+};
+
+// Local variables up to this size are initialized one scalar at a
+// time; see lvar_initializer().
+#define SMALL_INIT_SIZE 64
+
 static Var *locals;
 static Var *globals;
 
+// Function name -> return type, for functions declared so far
+static HashMap return_types;
+
 // C has two block scope;
 // one is for variables/typedefs and
 // the other is for struct tags.
@@ -120,6 +138,17 @@ static Var *new_lvar(Type *ty) {
   return var;
 }
 
+static Var *new_temp(Type *ty) {
+  static int ntemps;
+  Var *var = calloc(1, sizeof(Var));
+  var->name = format(".ret.%d", ntemps++);
+  var->next = locals;
+  var->ty = ty;
+  var->is_local = true;
+  locals = var;
+  return var;
+}
+
 static Var *new_gvar(char *name, Type *ty) {
   Var *var = calloc(1, sizeof(Var));
   var->name = name;
@@ -132,6 +161,13 @@ static Var *new_gvar(char *name, Type *ty) {
   return var;
 }
 
+static char *new_gvar_name() {
+  static int cnt = 0;
+  char *buf = malloc(20);
+  sprintf(buf, ".L.data.%d", cnt++);
+  return buf;
+}
+
 static void push_tag_scope(Token *tag, Type *ty) {
   TagScope *sc = calloc(1, sizeof(TagScope));
   sc->next = tag_scope;
@@ -177,6 +213,7 @@ static Node *new_sub_node(Node *lhs, Node *rhs);
 
 static Program *program();
 static Var *global_var();
+static void gvar_initializer(Var *var);
 static Function *funcdef();
 static Type *typespec(VarAttr *attr);
 static Type *struct_decl();
@@ -184,9 +221,11 @@ static Type *enum_specifier();
 static Type *func_params(Type *ty);
 static Type *declarator(Type *type);
 static Type *type_suffix(Type *type);
-static Node *compound_stmt();
+static Node *compound_stmt(Node *scope);
 static Node *declaration();
 static Node *lvar_initializer();
+static Init *initializer(Type *ty, int offset, Node *lvalue, bool fill, Init *cur);
+static bool write_init(Init *init, char *buf, Relocation **rel);
 static Node *stmt();
 static Node *expr();
 static Node *assign();
@@ -204,20 +243,24 @@ static Node *primary();
 /*
  * Production rules:
  *   program = (funcdef | global_var)*
+ *   global_var = typespec declarator ("=" initializer)? ";"
+ *   initializer = "{" (initializer ("," initializer)* ","?)? "}"
+ *               | str
+ *               | assign
  *   funcdef = typespec func_name "(" func_params ")" "{" compound_stmt "}"
- *   typespec = "void" | "_Bool" | "char" | "int"
+ *   typespec = "const"* ("void" | "_Bool" | "char" | "int"
  *            | struct_decl | enum_specifier
- *            | ("typedef" typespec) | typedef-name
+ *            | ("typedef" typespec) | typedef-name)
  *   struct_decl = "struct" ident? ("{" struct_members "}")?
  *   enum_specifier = "enum" "{" enum_list "}"
  *   enum_list = ident ("," ident)*
  *   func_params = typespec declarator ("," typespec declarator)*
- *   declarator = "*"* ident type_suffix
+ *   declarator = "const"* ("*" ("const" | "restrict")*)* ident type_suffix
  *   type_suffix = "[" num "]" type_suffix
  *               | "(" func_params ")"
  *               | ε
  *   compound_stmt = (declaration | stmt)*
- *   declaration = typespec (declarator ("=" expr)?)? ";"
+ *   declaration = typespec (declarator ("=" (initializer | expr))?)? ";"
  *   stmt = "return" expr ";"
  *        | "if" "(" expr ")" stmt ("else" stmt)?
  *        | "switch" "(" expr ")" stmt
@@ -272,6 +315,9 @@ static Program *program() {
       continue;
     }
 
+    if (ty->kind == TY_FUNC)
+      hashmap_sput(&return_types, strndup(ty->name->loc, ty->name->len), ty->return_ty);
+
     // Function declaration
     if (ty->kind == TY_FUNC && consume(";"))
       continue;
@@ -288,31 +334,297 @@ static Program *program() {
     global_var();
   }
 
-  // Assign offsets to local variables.
-  for (Function *fn = head.next; fn; fn = fn->next) {
-    int offset = 32; // 32 for callee-saved registers
-    for (Var *var = fn->locals; var; var = var->next) {
-      offset += var->ty->size;
-      var->offset = offset;
-    }
-    fn->stack_size = align_to(offset, 16);
-  }
-
   Program *prog = calloc(1, sizeof(Program));
   prog->globals = globals;
   prog->funcs = head.next;
   return prog;
 }
 
-// global_var = typespec declarator ";"
+static Type *const_of(Type *ty) {
+  ty = copy_type(ty);
+  ty->is_const = true;
+  return ty;
+}
+
+// An array is const if its elements are.
+static bool is_const(Type *ty) {
+  if (ty->kind == TY_ARRAY)
+    return is_const(ty->base);
+  return ty->is_const;
+}
+
+// global_var = typespec declarator ("=" initializer)? ";"
 static Var *global_var() {
   Type *base_ty = typespec(NULL);
   Type *ty = declarator(base_ty);
   Var *var = new_gvar(strndup(ty->name->loc, ty->name->len), ty);
+  if (consume("=")) {
+    gvar_initializer(var);
+    // Nothing can write to a const variable, so it goes to .rodata,
+    // and the optimizer may read its value at compile time.
+    var->is_readonly = is_const(ty);
+  }
   skip(";");
   return var;
 }
 
+//
+// Initializers
+//
+// An initializer is read into the list of the scalars it sets, e.g.
+// `{{1, 2}, {3}}` of `int x[2][2]` into x[0][0] = 1, x[0][1] = 2 and
+// x[1][0] = 3, at offsets 0, 4 and 8. Elements and members without
+// an initializer are zero.
+//
+// Initializers of global variables are evaluated at compile time into
+// the bytes of the variable, and addresses of global variables into
+// relocations, so that no code runs to initialize them.
+//
+
+
+static bool not_const; // Set by eval() if an expression is not constant
+
+static long eval(Node *node, Var **label);
+
+// Evaluates the address of an lvalue, e.g. `t[2].x` is the address
+// of t plus an offset.
+static long eval_addr(Node *node, Var **label) {
+  switch (node->kind) {
+    case ND_VAR:
+      if (node->var->is_local)
+        break;
+      *label = node->var;
+      return 0;
+    case ND_DEREF:
+      return eval(node->lhs, label);
+    case ND_MEMBER:
+      return eval_addr(node->lhs, label) + node->member->offset;
+  }
+  not_const = true;
+  return 0;
+}
+
+// Evaluates an integer constant expression, or the address of a
+// global variable plus a constant if `label` is not NULL.
+static long eval(Node *node, Var **label) {
+  add_type(node);
+
+  switch (node->kind) {
+    case ND_ADD:
+      return eval(node->lhs, label) + eval(node->rhs, NULL);
+    case ND_SUB:
+      return eval(node->lhs, label) - eval(node->rhs, NULL);
+    case ND_MUL:
+      return eval(node->lhs, NULL) * eval(node->rhs, NULL);
+    case ND_DIV: {
+      long rhs = eval(node->rhs, NULL);
+      if (rhs == 0)
+        break;
+      return eval(node->lhs, NULL) / rhs;
+    }
+    case ND_BITAND:
+      return eval(node->lhs, NULL) & eval(node->rhs, NULL);
+    case ND_BITNOT:
+      return ~eval(node->lhs, NULL);
+    case ND_EQ:
+      return eval(node->lhs, NULL) == eval(node->rhs, NULL);
+    case ND_NE:
+      return eval(node->lhs, NULL) != eval(node->rhs, NULL);
+    case ND_LET:
+      return eval(node->lhs, NULL) < eval(node->rhs, NULL);
+    case ND_LAT:
+      return eval(node->lhs, NULL) > eval(node->rhs, NULL);
+    case ND_LEE:
+      return eval(node->lhs, NULL) <= eval(node->rhs, NULL);
+    case ND_LAE:
+      return eval(node->lhs, NULL) >= eval(node->rhs, NULL);
+    case ND_LOGAND:
+      return eval(node->lhs, NULL) && eval(node->rhs, NULL);
+    case ND_LOGOR:
+      return eval(node->lhs, NULL) || eval(node->rhs, NULL);
+    case ND_COMMA:
+      eval(node->lhs, NULL);
+      return eval(node->rhs, label);
+    case ND_ADDR:
+      if (label)
+        return eval_addr(node->lhs, label);
+      break;
+    case ND_VAR:
+    case ND_MEMBER:
+    case ND_DEREF:
+      // An array used as a value is the address of its first element.
+      if (label && node->ty->kind == TY_ARRAY)
+        return eval_addr(node, label);
+      break;
+    case ND_NUM:
+      return node->val;
+  }
+  not_const = true;
+  return 0;
+}
+
+// Evaluates the initializer of a scalar and writes it to `buf`. Returns
+// false if it is not a compile-time constant.
+static bool write_init(Init *init, char *buf, Relocation **rel) {
+  if (!init->expr)
+    return true;
+
+  not_const = false;
+  Var *label = NULL;
+  long val = eval(init->expr, (init->ty->kind == TY_PTR) ? &label : NULL);
+  if (not_const)
+    return false;
+
+  if (label) {
+    Relocation *r = calloc(1, sizeof(Relocation));
+    r->offset = init->offset;
+    r->var = label;
+    r->addend = val;
+    label->is_addr_taken = true;
+    *rel = (*rel)->next = r;
+    return true;
+  }
+
+  if (init->ty->kind == TY_BOOL)
+    val = !!val;
+  memcpy(buf + init->offset, &val, init->ty->size);
+  return true;
+}
+
+static Init *new_init(Init *cur, Type *ty, int offset, Node *lvalue, Node *expr) {
+  Init *init = calloc(1, sizeof(Init));
+  init->ty = ty;
+  init->offset = offset;
+  init->lvalue = lvalue;
+  init->expr = expr;
+  return cur->next = init;
+}
+
+static bool is_zero_buf(char *buf, int len) {
+  for (int i = 0; i < len; i++)
+    if (buf[i])
+      return false;
+  return true;
+}
+
+static Node *elem_lvalue(Node *lvalue, int i) {
+  if (!lvalue)
+    return NULL;
+  return new_unary_node(ND_DEREF, new_add_node(lvalue, new_num_node(i)));
+}
+
+static Node *member_lvalue(Node *lvalue, Member *mem) {
+  if (!lvalue)
+    return NULL;
+  Node *node = new_unary_node(ND_MEMBER, lvalue);
+  node->member = mem;
+  return node;
+}
+
+// Adds the scalars of an object without an initializer. They are
+// only listed if `fill` is true.
+static Init *zero_init(Type *ty, int offset, Node *lvalue, bool fill, Init *cur) {
+  if (!fill)
+    return cur;
+
+  if (ty->kind == TY_ARRAY) {
+    for (int i = 0; i < ty->array_len; i++)
+      cur = zero_init(ty->base, offset + ty->base->size * i, elem_lvalue(lvalue, i), fill, cur);
+    return cur;
+  }
+
+  if (ty->kind == TY_STRUCT) {
+    for (Member *mem = ty->members; mem; mem = mem->next)
+      cur = zero_init(mem->ty, offset + mem->offset, member_lvalue(lvalue, mem), fill, cur);
+    return cur;
+  }
+
+  return new_init(cur, ty, offset, lvalue, NULL);
+}
+
+// Consumes the "}" at the end of an initializer list, which may come
+// after a trailing ",".
+static bool consume_end() {
+  if (consume("}"))
+    return true;
+  if (equal(current_token, ",") && equal(current_token->next, "}")) {
+    current_token = current_token->next->next;
+    return true;
+  }
+  return false;
+}
+
+// initializer = "{" (initializer ("," initializer)* ","?)? "}"
+//             | str
+//             | assign
+//
+// Reads the initializer of an object at `offset` and adds its scalars
+// to the list after `cur`. Scalars without an initializer are listed
+// too if `fill` is true. Returns the last one.
+static Init *initializer(Type *ty, int offset, Node *lvalue, bool fill, Init *cur) {
+  if (ty->kind == TY_ARRAY && ty->base->kind == TY_CHAR &&
+      current_token->kind == TK_STR) {
+    // The terminating NUL is dropped if it does not fit.
+    Token *tok = current_token;
+    if (tok->cont_len - 1 > ty->size)
+      error_at(tok->loc, "initializer-string is too long");
+    for (int i = 0; i < ty->array_len; i++) {
+      if (i < tok->cont_len)
+        cur = new_init(cur, ty_char, offset + i, elem_lvalue(lvalue, i),
+                       new_num_node(tok->contents[i]));
+      else
+        cur = zero_init(ty_char, offset + i, elem_lvalue(lvalue, i), fill, cur);
+    }
+    current_token = tok->next;
+    return cur;
+  }
+
+  if (ty->kind == TY_ARRAY) {
+    skip("{");
+    int i = 0;
+    for (; !consume_end(); i++) {
+      if (i > 0)
+        skip(",");
+      if (i == ty->array_len)
+        error_at(current_token->loc, "excess elements in array initializer");
+      cur = initializer(ty->base, offset + ty->base->size * i, elem_lvalue(lvalue, i), fill, cur);
+    }
+    for (; i < ty->array_len; i++)
+      cur = zero_init(ty->base, offset + ty->base->size * i, elem_lvalue(lvalue, i), fill, cur);
+    return cur;
+  }
+
+  if (ty->kind == TY_STRUCT) {
+    skip("{");
+    Member *mem = ty->members;
+    for (; !consume_end(); mem = mem->next) {
+      if (mem != ty->members)
+        skip(",");
+      if (!mem)
+        error_at(current_token->loc, "excess elements in struct initializer");
+      cur = initializer(mem->ty, offset + mem->offset, member_lvalue(lvalue, mem), fill, cur);
+    }
+    for (; mem; mem = mem->next)
+      cur = zero_init(mem->ty, offset + mem->offset, member_lvalue(lvalue, mem), fill, cur);
+    return cur;
+  }
+
+  return new_init(cur, ty, offset, lvalue, assign());
+}
+
+static void gvar_initializer(Var *var) {
+  Init head = {};
+  initializer(var->ty, 0, NULL, false, &head);
+
+  Relocation rel = {};
+  Relocation *cur = &rel;
+  var->init_data = calloc(1, var->ty->size);
+  for (Init *init = head.next; init; init = init->next)
+    if (!write_init(init, var->init_data, &cur))
+      error_at(current_token->loc, "initializer element is not a compile-time constant");
+  var->rel = rel.next;
+}
+
 // func_params = typespec declarator ("," typespec declarator)*
 static Type *func_params(Type *ty) {
   Type head = {};
@@ -337,6 +649,9 @@ static Type *func_params(Type *ty) {
 //          | ("typedef" typespec) | ("static" typespec)
 //          | typedef-name
 static Type *typespec(VarAttr *attr) {
+  if (consume("const"))
+    return const_of(typespec(attr));
+
   if (consume("void"))
     return ty_void;
 
@@ -477,10 +792,25 @@ static Type *enum_specifier() {
   return ty;
 }
 
-// declarator = "*"* ident type_suffix
+// declarator = "const"* ("*" ("const" | "restrict")*)* ident type_suffix
+//
+// A "const" before the first "*" qualifies the base type, as in
+// `int const x`, and one after a "*" the pointer, as in `int *const p`.
 static Type *declarator(Type *ty) {
-  while (consume("*"))
+  while (consume("const"))
+    ty = const_of(ty);
+
+  while (consume("*")) {
     ty = pointer_to(ty);
+    for (;;) {
+      if (consume("const"))
+        ty->is_const = true;
+      else if (consume("restrict"))
+        ty->is_restrict = true;
+      else
+        break;
+    }
+  }
 
   if (current_token->kind != TK_IDENT)
     error_at(current_token->loc, "expected a variable name");
@@ -516,7 +846,7 @@ static Type *type_suffix(Type *ty) {
   return ty;
 }
 
-// declaration = typespec (declarator ("=" expr)?)? ";"
+// declaration = typespec (declarator ("=" (initializer | expr))?)? ";"
 static Node *declaration() {
   VarAttr attr = {};
   Type *base_ty = typespec(&attr);
@@ -548,55 +878,67 @@ static Node *declaration() {
   return node;
 }
 
-static Node *array_initializer(Node *var_node) {
-  if (var_node->var->ty->kind != TY_ARRAY)
-    error_at(current_token->loc, "an array initializer for non array type variable");
-
-  skip("{");
-
-  Node head = {};
-  Node *cur = &head;
-  int i = 0;
-  while (!equal(current_token, "}")) {
-    if (i != 0)
-      skip(",");
-
-    // Build nodes representing `*(a + 2) = assign`.
-    Node *deref_node = new_unary_node(
-      ND_DEREF,
-      new_add_node(var_node, new_num_node(i))
-    );
-    Node *assign_node = new_binary_node(ND_ASSIGN, deref_node, assign());
-    cur = cur->next = new_unary_node(ND_EXPR_STMT, assign_node);
-    i++;
-  }
-
-  if (var_node->var->ty->array_len != i)
-    error_at(current_token->loc, "wrong number of array length");
-
-  skip("}");
-  return head.next;
-}
-
-// A variable definition with an initializer is a shorthand notation
-// for a variable definition followed by assignments. This function
-// generates assignment expressions for an initializer. For example,
-// `int x[2][2] = {{6, 7}, {8, 9}}` is converted to the following
-// expressions:
+// A local variable with an initializer is initialized by assignments
+// to its scalars, e.g. `int x[2][2] = {{6, 7}, {8}}` by
 //
 //   x[0][0] = 6;
 //   x[0][1] = 7;
 //   x[1][0] = 8;
-//   x[1][1] = 9;
+//   x[1][1] = 0;
+//
+// which scalar replacement of aggregates can turn into separate
+// variables. Larger variables are first initialized as a whole, by
+// copying a read-only template with the constant scalars or by
+// zeroing the variable, and only the other scalars are assigned.
 static Node *lvar_initializer(Var *var) {
   Node *var_node = new_node(ND_VAR);
   var_node->var = var;
 
-  if (equal(current_token, "{"))
-    return array_initializer(var_node);
+  bool is_string = var->ty->kind == TY_ARRAY && var->ty->base->kind == TY_CHAR &&
+                   current_token->kind == TK_STR;
+  if (!equal(current_token, "{") && !is_string) {
+    Node *assign_node = new_binary_node(ND_ASSIGN, var_node, expr());
+    return new_unary_node(ND_EXPR_STMT, assign_node);
+  }
+
+  bool small = var->ty->size <= SMALL_INIT_SIZE;
+  Init init_head = {};
+  initializer(var->ty, 0, var_node, small, &init_head);
 
-  Node *assign_node = new_binary_node(ND_ASSIGN, var_node, expr());
-  return new_unary_node(ND_EXPR_STMT, assign_node);
+  Node head = {};
+  Node *cur = &head;
+
+  if (!small) {
+    char *buf = calloc(1, var->ty->size);
+    Relocation rel = {};
+    Relocation *r = &rel;
+    for (Init *init = init_head.next; init; init = init->next)
+      init->is_const = write_init(init, buf, &r);
+
+    Node *rhs;
+    if (!rel.next && is_zero_buf(buf, var->ty->size)) {
+      // The number 0 assigned to an aggregate zeroes it.
+      rhs = new_num_node(0);
+      free(buf);
+    } else {
+      Var *tmpl = new_gvar(new_gvar_name(), var->ty);
+      tmpl->init_data = buf;
+      tmpl->rel = rel.next;
+      tmpl->is_readonly = true;
+      rhs = new_node(ND_VAR);
+      rhs->var = tmpl;
+    }
+    cur = cur->next = new_unary_node(ND_EXPR_STMT, new_binary_node(ND_ASSIGN, var_node, rhs));
+  }
+
+  for (Init *init = init_head.next; init; init = init->next) {
+    if (init->is_const)
+      continue;
+    Node *expr = init->expr ? init->expr : new_num_node(0);
+    Node *assign_node = new_binary_node(ND_ASSIGN, init->lvalue, expr);
+    cur = cur->next = new_unary_node(ND_EXPR_STMT, assign_node);
+  }
+  return head.next;
 }
 
 static void enter_scope() {
@@ -614,7 +956,8 @@ static void leave_scope() {
 }
 
 static bool is_typename(Token *tok) {
-  static char *kw[] = {"void", "_Bool", "char", "int", "struct", "typedef", "enum", "static"};
+  static char *kw[] = {"void", "_Bool", "char", "int", "struct", "typedef", "enum", "static",
+                       "const"};
 
   for (int i = 0; i < sizeof(kw) / sizeof(*kw); i++)
     if (equal(tok, kw[i]))
@@ -624,9 +967,13 @@ static bool is_typename(Token *tok) {
 }
 
 // compound_stmt = (declaration | stmt)*
-static Node *compound_stmt() {
+//
+// `scope` is the node of the block, which becomes the scope of the
+// local variables declared in it.
+static Node *compound_stmt(Node *scope) {
   Node head = {};
   Node *cur = &head;
+  Var *outer = locals;
 
   enter_scope();
 
@@ -640,6 +987,11 @@ static Node *compound_stmt() {
 
   leave_scope();
 
+  // Variables of inner blocks already have a scope.
+  for (Var *var = locals; var != outer; var = var->next)
+    if (!var->scope)
+      var->scope = scope;
+
   return head.next;
 }
 
@@ -652,7 +1004,9 @@ static Function *funcdef() {
   Type *base_ty = typespec(&attr);
 
   fn->name = strndup(current_token->loc, current_token->len);
+  fn->return_ty = base_ty;
   fn->is_static = attr.is_static;
+  fn->line_no = current_token->line_no;
   current_token = current_token->next;
 
   enter_scope();
@@ -666,7 +1020,7 @@ static Function *funcdef() {
   // Body
   skip("{");
   Node *block_node = new_node(ND_BLOCK);
-  block_node->body = compound_stmt();
+  block_node->body = compound_stmt(block_node);
   fn->node = block_node;
   fn->locals = locals;
   skip("}");
@@ -804,7 +1158,7 @@ static Node *stmt() {
 
   if (consume("{")) {
     Node *node = new_node(ND_BLOCK);
-    node->body = compound_stmt();
+    node->body = compound_stmt(node);
     skip("}");
     return node;
   }
@@ -824,11 +1178,30 @@ static Node *expr() {
   return node;
 }
 
+// Returns true if an lvalue may not be assigned to. A member of a
+// const struct is const too.
+static bool is_const_lvalue(Node *node) {
+  add_type(node);
+  if (node->ty->is_const)
+    return true;
+  return node->kind == ND_MEMBER && is_const_lvalue(node->lhs);
+}
+
+static void check_assignable(Node *node, Token *tok) {
+  if (is_const_lvalue(node))
+    error_at(tok->loc, "cannot assign to a const variable");
+}
+
 // assign = logor (assign_op assign)?
 // assign_op = "=" | "+=" | "-=" | "*=" | "/="
 static Node *assign() {
   Node *node = logor();
 
+  Token *tok = current_token;
+  if (equal(tok, "=") || equal(tok, "+=") || equal(tok, "-=") ||
+      equal(tok, "*=") || equal(tok, "/="))
+    check_assignable(node, tok);
+
   if (consume("="))
     node = new_binary_node(ND_ASSIGN, node, assign());
   else if (consume("+="))
@@ -1031,8 +1404,11 @@ static Node *unary() {
   if (consume("~"))
     return new_unary_node(ND_BITNOT, unary());
 
-  if (consume("++")) {
+  if (equal(current_token, "++")) {
+    Token *tok = current_token;
+    current_token = current_token->next;
     Node *node = unary();
+    check_assignable(node, tok);
     return new_binary_node(
       ND_ASSIGN,
       node,
@@ -1040,8 +1416,11 @@ static Node *unary() {
     );
   }
 
-  if (consume("--")) {
+  if (equal(current_token, "--")) {
+    Token *tok = current_token;
+    current_token = current_token->next;
     Node *node = unary();
+    check_assignable(node, tok);
     return new_binary_node(
       ND_ASSIGN,
       node,
@@ -1148,6 +1527,9 @@ static Node *postfix() {
     current_token = current_token->next;
   }
 
+  if (equal(current_token, "++") || equal(current_token, "--"))
+    check_assignable(node, current_token);
+
   if (consume("++"))
     node = new_inc(node);
 
@@ -1170,17 +1552,30 @@ static Node *func_args() {
   return head.next;
 }
 
-static char *new_gvar_name() {
-  static int cnt = 0;
-  char *buf = malloc(20);
-  sprintf(buf, ".L.data.%d", cnt++);
-  return buf;
-}
+// String literals by contents. Literals must not be modified, so
+// identical ones share a variable.
+static HashMap string_literals;
+int npooled_strings;
+int pooled_string_bytes;
 
 static Var *new_string_literal(Token *tok) {
+  // Contents with a NUL before the end can't be used as a key.
+  bool poolable = !memchr(tok->contents, 0, tok->cont_len - 1);
+  if (poolable) {
+    Var *var = hashmap_sget(&string_literals, tok->contents);
+    if (var) {
+      npooled_strings++;
+      pooled_string_bytes += tok->cont_len;
+      return var;
+    }
+  }
+
   Type *ty = array_of(ty_char, tok->cont_len);
   Var *var = new_gvar(new_gvar_name(), ty);
   var->init_data = tok->contents;
+  var->is_string = true;
+  if (poolable)
+    hashmap_sput(&string_literals, tok->contents, var);
   return var;
 }
 
@@ -1194,9 +1589,22 @@ static Node *primary() {
   if (equal(current_token, "(") && equal(current_token->next, "{")) {
     current_token = current_token->next->next;
     Node *node = new_node(ND_STMT_EXPR);
-    node->body = compound_stmt();
+    node->body = compound_stmt(node);
     skip("}");
     skip(")");
+
+    // A struct value is the address of the struct, and the locals of
+    // the block end with it, so the value is copied into a temporary
+    // of the enclosing block.
+    Node *last = node->body;
+    while (last && last->next)
+      last = last->next;
+    if (last && last->kind == ND_EXPR_STMT && last->lhs->ty->kind == TY_STRUCT) {
+      Node *var = new_node(ND_VAR);
+      var->var = new_temp(last->lhs->ty);
+      last->lhs = new_binary_node(ND_ASSIGN, var, last->lhs);
+      add_type(last->lhs);
+    }
     return node;
   }
 
@@ -1217,6 +1625,11 @@ static Node *primary() {
       Node *args = func_args();
       funcall_node->args = args;
 
+      // A struct is returned into a temporary of the caller.
+      Type *ty = hashmap_sget(&return_types, funcall_node->funcname);
+      if (ty && ty->kind == TY_STRUCT)
+        funcall_node->var = new_temp(ty);
+
       skip(")");
       return funcall_node;
     }
@@ -1256,6 +1669,8 @@ static Node *primary() {
 
 Program *parse(Token *tok) {
   current_token = tok;
+  hashmap_clear(&string_literals);
+  hashmap_clear(&return_types);
   Program *prog = program();
 
   if (current_token->kind != TK_EOF)
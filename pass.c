@@ -0,0 +1,156 @@
+// Pass manager.
+//
+// Optimization passes transform the IR of a whole program between
+// parsing and codegen. They run in the order of the table below,
+// and the optimization level decides which of them are run.
+// Individual passes can be turned on or off with -fenable-pass=
+// and -fdisable-pass=, or -passes= can give the exact list of passes
+// to run, e.g. to test or time a pass on its own.
+#include "occ.h"
+
+typedef struct {
+  char *name;
+  int level; // Lowest optimization level that runs this pass
+  void (*run)(Program *prog);
+} Pass;
+
+static Pass passes[] = {
+  {"inline", 2, inline_functions},
+  {"specialize", 2, specialize_functions},
+  {"ipcp", 2, propagate_interproc_constants},
+  {"sroa", 2, scalar_replace_aggregates},
+  {"constprop", 2, propagate_constants},
+  {"fold", 1, fold_constants},
+  {"forward", 2, forward_stores},
+  {"dse", 2, eliminate_dead_stores},
+  {"dae", 2, eliminate_dead_args},
+  {"pure-const", 2, infer_pure_const},
+  {"call-cse", 2, eliminate_common_calls},
+  {"globaldce", 1, eliminate_dead_globals},
+};
+
+#define NPASSES (sizeof(passes) / sizeof(*passes))
+
+static bool contains(StringArray *arr, char *s) {
+  for (int i = 0; i < arr->len; i++)
+    if (!strcmp(arr->data[i], s) || !strcmp(arr->data[i], "all"))
+      return true;
+  return false;
+}
+
+static void check_pass_names(StringArray *arr, char *option) {
+  for (int i = 0; i < arr->len; i++) {
+    if (!strcmp(arr->data[i], "all"))
+      continue;
+
+    bool found = false;
+    for (int j = 0; j < NPASSES; j++)
+      if (!strcmp(arr->data[i], passes[j].name))
+        found = true;
+    if (!found)
+      error("%s: unknown pass: %s", option, arr->data[i]);
+  }
+}
+
+static bool is_enabled(Pass *pass) {
+  if (contains(&opt_disable_passes, pass->name))
+    return false;
+  if (contains(&opt_enable_passes, pass->name))
+    return true;
+  return pass->level <= opt_level;
+}
+
+static void dump_ir(Program *prog, char *when, char *name) {
+  fprintf(stderr, "*** IR dump %s %s ***\n", when, name);
+  print_ir(prog, stderr);
+}
+
+static void run_pass(Program *prog, Pass *pass) {
+  if (contains(&opt_print_before, pass->name))
+    dump_ir(prog, "before", pass->name);
+
+  timer_start(format("pass: %s", pass->name));
+  pass->run(prog);
+  timer_stop();
+
+  if (contains(&opt_print_after, pass->name))
+    dump_ir(prog, "after", pass->name);
+}
+
+void run_passes(Program *prog) {
+  check_pass_names(&opt_enable_passes, "-fenable-pass");
+  check_pass_names(&opt_disable_passes, "-fdisable-pass");
+  check_pass_names(&opt_print_before, "-print-before");
+  check_pass_names(&opt_print_after, "-print-after");
+  check_pass_names(&opt_pass_list, "-passes");
+
+  if (opt_pass_list.len) {
+    for (int i = 0; i < opt_pass_list.len; i++)
+      for (int j = 0; j < NPASSES; j++)
+        if (!strcmp(opt_pass_list.data[i], passes[j].name))
+          run_pass(prog, &passes[j]);
+    return;
+  }
+
+  for (int i = 0; i < NPASSES; i++)
+    if (is_enabled(&passes[i]))
+      run_pass(prog, &passes[i]);
+}
+
+//
+// Time report
+//
+
+typedef struct Timer Timer;
+struct Timer {
+  Timer *next;
+  char *name;
+  double secs;
+};
+
+static Timer *timers;
+static Timer *current_timer;
+static struct timespec start_time;
+
+static double elapsed(struct timespec *since) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (now.tv_sec - since->tv_sec) + (now.tv_nsec - since->tv_nsec) / 1e9;
+}
+
+// Starts measuring the time of a phase. Time spent in phases
+// with the same name is added up.
+void timer_start(char *name) {
+  Timer *t = timers;
+  while (t && strcmp(t->name, name))
+    t = t->next;
+
+  if (!t) {
+    t = calloc(1, sizeof(Timer));
+    t->name = name;
+    Timer **p = &timers;
+    while (*p)
+      p = &(*p)->next;
+    *p = t;
+  }
+
+  current_timer = t;
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+}
+
+void timer_stop(void) {
+  current_timer->secs += elapsed(&start_time);
+  current_timer = NULL;
+}
+
+void print_time_report(FILE *out) {
+  double total = 0;
+  for (Timer *t = timers; t; t = t->next)
+    total += t->secs;
+
+  fprintf(out, "time report:\n");
+  for (Timer *t = timers; t; t = t->next)
+    fprintf(out, "  %-24s %10.6f s (%5.1f%%)\n", t->name, t->secs,
+            total > 0 ? t->secs * 100 / total : 0);
+  fprintf(out, "  %-24s %10.6f s\n", "total", total);
+}
@@ -0,0 +1,250 @@
+// Function specialization.
+//
+// Creates copies of a function for call sites that pass numbers,
+// e.g. mode flags, with the numbers bound to the parameters. Later
+// passes then fold them into the copy. Unlike ipcp, this works if
+// different call sites pass different numbers.
+//
+// Without profile data, a call site is considered hot if it is in
+// a loop. A copy is made if the benefit, estimated from how often
+// the constant parameters are used and how deep in loops the call
+// is, outweighs the size of the function. The total size of copies
+// is capped at a percentage of the size of the program.
+//
+// Only static functions are specialized unless -fspecialize-all is
+// given; the original of a non-static function is kept for callers
+// in other translation units.
+#include "occ.h"
+
+// Total size of copies relative to the program, in percent
+#define GROWTH_LIMIT 30
+#define MAX_COPIES_PER_FUNC 4
+
+typedef struct Site Site;
+struct Site {
+  Site *next;
+  Node *call;
+  int loop_depth;
+};
+
+// A copy of `orig` with the arguments in `is_const` bound to `vals`
+typedef struct Spec Spec;
+struct Spec {
+  Spec *next;
+  Function *orig;
+  bool *is_const;
+  int *vals;
+  Function *copy;
+};
+
+static Site *sites;
+static Spec *specs;
+static int nspecs;
+
+static void find_sites(Node *node, int depth) {
+  if (!node)
+    return;
+
+  if (node->kind == ND_FUNCALL) {
+    Site *s = sites;
+    while (s && s->call != node)
+      s = s->next;
+    if (!s) {
+      s = calloc(1, sizeof(Site));
+      s->call = node;
+      s->loop_depth = depth;
+      s->next = sites;
+      sites = s;
+    }
+  }
+
+  int d = (node->kind == ND_FOR || node->kind == ND_WHILE) ? depth + 1 : depth;
+  find_sites(node->lhs, depth);
+  find_sites(node->rhs, depth);
+  find_sites(node->cond, d);
+  find_sites(node->then, d);
+  find_sites(node->els, depth);
+  find_sites(node->init, depth);
+  find_sites(node->inc, d);
+  for (Node *n = node->body; n; n = n->next)
+    find_sites(n, depth);
+  for (Node *n = node->args; n; n = n->next)
+    find_sites(n, depth);
+}
+
+static int count_nodes(Node *node) {
+  if (!node)
+    return 0;
+
+  int n = 1 + count_nodes(node->lhs) + count_nodes(node->rhs) +
+          count_nodes(node->cond) + count_nodes(node->then) +
+          count_nodes(node->els) + count_nodes(node->init) +
+          count_nodes(node->inc);
+  for (Node *c = node->body; c; c = c->next)
+    n += count_nodes(c);
+  for (Node *c = node->args; c; c = c->next)
+    n += count_nodes(c);
+  return n;
+}
+
+// Estimates how much knowing the value of a variable simplifies
+// a statement. A use in a condition may remove a branch.
+static int count_uses(Node *node, Var *var, bool in_cond) {
+  if (!node)
+    return 0;
+  if (node->kind == ND_VAR && node->var == var)
+    return in_cond ? 4 : 1;
+
+  bool is_cond = node->kind == ND_LOGAND || node->kind == ND_LOGOR;
+  int n = count_uses(node->lhs, var, in_cond || is_cond) +
+          count_uses(node->rhs, var, in_cond || is_cond) +
+          count_uses(node->cond, var, true) +
+          count_uses(node->then, var, false) +
+          count_uses(node->els, var, false) +
+          count_uses(node->init, var, false) +
+          count_uses(node->inc, var, false);
+  for (Node *c = node->body; c; c = c->next)
+    n += count_uses(c, var, false);
+  for (Node *c = node->args; c; c = c->next)
+    n += count_uses(c, var, in_cond);
+  return n;
+}
+
+static int count_params(Function *fn) {
+  int n = 0;
+  for (Var *var = fn->params; var; var = var->next)
+    n++;
+  return n;
+}
+
+// Returns the param an argument is passed in. Params are
+// listed in the reverse order of arguments.
+static Var *nth_param(Function *fn, int idx) {
+  Var *var = fn->params;
+  for (int i = count_params(fn) - 1; i > idx; i--)
+    var = var->next;
+  return var;
+}
+
+static Spec *find_spec(Function *fn, bool *is_const, int *vals, int nargs) {
+  for (Spec *s = specs; s; s = s->next) {
+    if (s->orig != fn)
+      continue;
+
+    bool same = true;
+    for (int i = 0; i < nargs; i++)
+      if (s->is_const[i] != is_const[i] || (is_const[i] && s->vals[i] != vals[i]))
+        same = false;
+    if (same)
+      return s;
+  }
+  return NULL;
+}
+
+static Spec *new_spec(Function *fn, bool *is_const, int *vals, int nargs) {
+  Spec *s = calloc(1, sizeof(Spec));
+  s->orig = fn;
+  s->is_const = is_const;
+  s->vals = vals;
+  s->copy = clone_function(fn, format("%s.spec.%d", fn->name, nspecs++));
+  s->next = specs;
+  specs = s;
+
+  // Bind the numbers to the params of the copy. The params must
+  // be looked up before any of them is removed.
+  Var **params = calloc(nargs, sizeof(Var *));
+  for (int i = 0; i < nargs; i++)
+    params[i] = nth_param(s->copy, i);
+  for (int i = 0; i < nargs; i++)
+    if (is_const[i])
+      bind_param(s->copy, params[i], vals[i]);
+
+  s->copy->next = fn->next;
+  fn->next = s->copy;
+  return s;
+}
+
+static void specialize_site(Program *prog, Site *site, int *budget) {
+  Node *call = site->call;
+  Function *fn = find_func(prog, call->funcname);
+  if (!fn || (!fn->is_static && !opt_specialize_all))
+    return;
+
+  int nargs = count_params(fn);
+  int i = 0;
+  for (Node *arg = call->args; arg; arg = arg->next)
+    i++;
+  if (i != nargs || nargs == 0)
+    return;
+
+  bool *is_const = calloc(nargs, sizeof(bool));
+  int *vals = calloc(nargs, sizeof(int));
+  int benefit = 0;
+  i = 0;
+  for (Node *arg = call->args; arg; arg = arg->next, i++) {
+    if (arg->kind != ND_NUM)
+      continue;
+    is_const[i] = true;
+    vals[i] = arg->val;
+    benefit += count_uses(fn->node, nth_param(fn, i), false);
+  }
+  if (benefit == 0)
+    return;
+
+  Spec *s = find_spec(fn, is_const, vals, nargs);
+  if (!s) {
+    int ncopies = 0;
+    for (Spec *t = specs; t; t = t->next)
+      if (t->orig == fn)
+        ncopies++;
+
+    // Each level of loop nesting counts as 8 calls.
+    int size = count_nodes(fn->node);
+    int freq = 1 << (3 * (site->loop_depth < 3 ? site->loop_depth : 3));
+    if (benefit * freq * 4 < size || size > *budget || ncopies == MAX_COPIES_PER_FUNC ||
+        !use_fuel("specialize", fn))
+      return;
+
+    *budget -= size;
+    s = new_spec(fn, is_const, vals, nargs);
+  } else if (!use_fuel("specialize", fn)) {
+    return;
+  }
+
+  // Call the copy without the bound arguments.
+  call->funcname = s->copy->name;
+  Node **p = &call->args;
+  for (i = 0; i < nargs; i++) {
+    if (is_const[i])
+      *p = (*p)->next;
+    else
+      p = &(*p)->next;
+  }
+}
+
+void specialize_functions(Program *prog) {
+  sites = NULL;
+  specs = NULL;
+
+  // Copies make the program larger.
+  if (opt_size)
+    return;
+
+  int size = 0;
+  for (Function *fn = prog->funcs; fn; fn = fn->next) {
+    find_sites(fn->node, 0);
+    size += count_nodes(fn->node);
+  }
+
+  int max_depth = 0;
+  for (Site *s = sites; s; s = s->next)
+    if (max_depth < s->loop_depth)
+      max_depth = s->loop_depth;
+
+  // Visit the hottest call sites first.
+  int budget = size * GROWTH_LIMIT / 100;
+  for (int depth = max_depth; depth >= 0; depth--)
+    for (Site *s = sites; s; s = s->next)
+      if (s->loop_depth == depth)
+        specialize_site(prog, s, &budget);
+}
@@ -0,0 +1,246 @@
+// Scalar replacement of aggregates.
+//
+// Splits a local struct or small array into independent scalar
+// variables, one for each field or element accessed, if the
+// aggregate is only ever accessed one scalar at a time through
+// constant offsets and its address never escapes. For example,
+//
+//   struct { int a; int b; } x; x.a = 1; x.b = 2; return x.a + x.b;
+//
+// becomes
+//
+//   int x.0; int x.4; x.0 = 1; x.4 = 2; return x.0 + x.4;
+//
+// The new variables can then be tracked by dataflow analyses.
+#include "occ.h"
+
+// Aggregates larger than this are left alone.
+#define MAX_SIZE 64
+
+typedef struct Part Part;
+struct Part {
+  Part *next;
+  int offset;
+  Type *ty;
+  Var *var; // Scalar replacing this part
+};
+
+typedef struct Candidate Candidate;
+struct Candidate {
+  Candidate *next;
+  Var *var;
+  Part *parts;
+  bool rejected;
+};
+
+static Candidate *candidates;
+
+static bool is_scalar(Type *ty) {
+  return is_integer(ty) || ty->kind == TY_PTR;
+}
+
+static Candidate *find_candidate(Var *var) {
+  for (Candidate *c = candidates; c; c = c->next)
+    if (c->var == var)
+      return c;
+  return NULL;
+}
+
+// Evaluates a constant offset, e.g. `2 * 4` of `a[2]`.
+static bool eval_offset(Node *node, int *val) {
+  int a, b;
+  switch (node->kind) {
+    case ND_NUM:
+      *val = node->val;
+      return true;
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+      if (!eval_offset(node->lhs, &a) || !eval_offset(node->rhs, &b))
+        return false;
+      *val = (node->kind == ND_ADD) ? a + b : (node->kind == ND_SUB) ? a - b : a * b;
+      return true;
+  }
+  return false;
+}
+
+// Returns the variable an lvalue or array is a part of if it is
+// at a constant offset, e.g. `x` and 12 for `x.a[2]`.
+static Var *get_part(Node *node, int *offset) {
+  switch (node->kind) {
+    case ND_VAR:
+      *offset = 0;
+      return node->var->is_local ? node->var : NULL;
+    case ND_MEMBER: {
+      Var *var = get_part(node->lhs, offset);
+      *offset += node->member->offset;
+      return var;
+    }
+    case ND_DEREF: {
+      Node *addr = node->lhs;
+      int off = 0;
+      if ((addr->kind == ND_ADD || addr->kind == ND_SUB) &&
+          addr->lhs->ty->kind == TY_ARRAY) {
+        if (!eval_offset(addr->rhs, &off))
+          return NULL;
+        if (addr->kind == ND_SUB)
+          off = -off;
+        addr = addr->lhs;
+      }
+      if (addr->ty->kind != TY_ARRAY)
+        return NULL;
+
+      Var *var = get_part(addr, offset);
+      *offset += off;
+      return var;
+    }
+  }
+  return NULL;
+}
+
+static void add_part(Candidate *c, int offset, Type *ty) {
+  if (offset < 0 || c->var->ty->size < offset + ty->size) {
+    c->rejected = true;
+    return;
+  }
+
+  for (Part *p = c->parts; p; p = p->next) {
+    if (p->offset == offset && p->ty->size == ty->size && p->ty->kind == ty->kind)
+      return;
+    if (offset < p->offset + p->ty->size && p->offset < offset + ty->size) {
+      c->rejected = true;
+      return;
+    }
+  }
+
+  Part *p = calloc(1, sizeof(Part));
+  p->offset = offset;
+  p->ty = ty;
+  p->next = c->parts;
+  c->parts = p;
+}
+
+static Part *find_part(Candidate *c, int offset) {
+  for (Part *p = c->parts; p; p = p->next)
+    if (p->offset == offset)
+      return p;
+  return NULL;
+}
+
+// Finds the accesses to candidates in a statement or an
+// expression if `replace` is false, and replaces them with
+// the scalars if it is true.
+static void visit(Node **slot, bool replace) {
+  Node *node = *slot;
+  if (!node)
+    return;
+
+  if ((node->kind == ND_MEMBER || node->kind == ND_DEREF) && is_scalar(node->ty)) {
+    int offset;
+    Var *var = get_part(node, &offset);
+    Candidate *c = var ? find_candidate(var) : NULL;
+    if (c) {
+      if (!replace) {
+        add_part(c, offset, node->ty);
+        return;
+      }
+      if (!c->rejected) {
+        Node *n = calloc(1, sizeof(Node));
+        n->kind = ND_VAR;
+        n->var = find_part(c, offset)->var;
+        n->ty = n->var->ty;
+        n->next = node->next;
+        *slot = n;
+        return;
+      }
+    }
+  }
+
+  // Any other use of an aggregate, e.g. copying it as a whole.
+  if (node->kind == ND_VAR && !replace) {
+    Candidate *c = find_candidate(node->var);
+    if (c)
+      c->rejected = true;
+    return;
+  }
+
+  // A struct returned by a call is written as a whole.
+  if (node->kind == ND_FUNCALL && node->var && !replace) {
+    Candidate *c = find_candidate(node->var);
+    if (c)
+      c->rejected = true;
+  }
+
+  visit(&node->lhs, replace);
+  visit(&node->rhs, replace);
+  visit(&node->cond, replace);
+  visit(&node->then, replace);
+  visit(&node->els, replace);
+  visit(&node->init, replace);
+  visit(&node->inc, replace);
+  for (Node **p = &node->body; *p; p = &(*p)->next)
+    visit(p, replace);
+  for (Node **p = &node->args; *p; p = &(*p)->next)
+    visit(p, replace);
+}
+
+static bool is_param(Function *fn, Var *var) {
+  for (Var *param = fn->params; param; param = param->next)
+    if (param == var)
+      return true;
+  return false;
+}
+
+static void split(Function *fn) {
+  mark_address_taken(fn);
+
+  // A struct param is passed as a whole, so it is not split.
+  candidates = NULL;
+  for (Var *var = fn->locals; var; var = var->next) {
+    TypeKind k = var->ty->kind;
+    if ((k == TY_STRUCT || k == TY_ARRAY) && !var->is_addr_taken &&
+        var->ty->size <= MAX_SIZE && !is_param(fn, var)) {
+      Candidate *c = calloc(1, sizeof(Candidate));
+      c->var = var;
+      c->next = candidates;
+      candidates = c;
+    }
+  }
+  if (!candidates)
+    return;
+
+  for (Node **p = &fn->node; *p; p = &(*p)->next)
+    visit(p, false);
+
+  // Replace each aggregate with its parts in the list of locals.
+  for (Var **p = &fn->locals; *p;) {
+    Candidate *c = find_candidate(*p);
+    if (c && !c->rejected && !use_fuel("sroa", fn))
+      c->rejected = true;
+    if (!c || c->rejected) {
+      p = &(*p)->next;
+      continue;
+    }
+
+    Var *next = (*p)->next;
+    for (Part *part = c->parts; part; part = part->next) {
+      Var *var = calloc(1, sizeof(Var));
+      var->name = format("%s.%d", c->var->name, part->offset);
+      var->ty = part->ty;
+      var->is_local = true;
+      var->scope = c->var->scope;
+      part->var = var;
+      *p = var;
+      p = &var->next;
+    }
+    *p = next;
+  }
+
+  for (Node **p = &fn->node; *p; p = &(*p)->next)
+    visit(p, true);
+}
+
+void scalar_replace_aggregates(Program *prog) {
+  for (Function *fn = prog->funcs; fn; fn = fn->next)
+    split(fn);
+}
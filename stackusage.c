@@ -0,0 +1,173 @@
+// Static stack usage analysis.
+//
+// The frame size of each function is taken from the generated code,
+// and the worst-case stack depth of each entry point is computed by
+// walking the call graph. Calls to functions defined outside of
+// this translation unit are not accounted for, and recursion makes
+// the depth unbounded.
+#include "occ.h"
+
+#define UNBOUNDED -1
+
+typedef struct {
+  Function *fn;
+  int frame;
+  int depth;           // Worst-case depth, or UNBOUNDED
+  bool visited;
+  bool external;       // Reaches a function outside this translation unit
+  Function *recursive; // Recursive function that makes the depth unbounded
+} Usage;
+
+static Usage *usages;
+static int nusages;
+
+static Usage *get_usage(Function *fn) {
+  for (int i = 0; i < nusages; i++)
+    if (usages[i].fn == fn)
+      return &usages[i];
+  return NULL;
+}
+
+// Returns the number of bytes a function adds to the stack: the
+// return address pushed by the caller, and the maximum of what the
+// function pushes (rbp, registers saved around calls) and allocates
+// by moving rsp (the fixed frame, padding around calls).
+static int frame_size(Program *prog, Function *fn) {
+  int depth = 0;
+  int max = 0;
+
+  for (int i = 0; i < fn->code.len; i++) {
+    char *line = fn->code.data[i];
+    if (!is_insn(line))
+      continue;
+
+    while (*line == ' ')
+      line++;
+    int n;
+    if (!strncmp(line, "push ", 5))
+      depth += 8;
+    else if (!strncmp(line, "pop ", 4))
+      depth -= 8;
+    else if (sscanf(line, "sub rsp, %d", &n) == 1)
+      depth += n;
+    else if (sscanf(line, "add rsp, %d", &n) == 1)
+      depth -= n;
+    else if (sscanf(line, "and rsp, -%d", &n) == 1)
+      depth += n - 8; // rsp is 8 bytes off alignment at entry
+
+    if (max < depth)
+      max = depth;
+
+    // Outlined functions are not in the call graph. They use
+    // no stack but the return address.
+    if (!strncmp(line, "call ", 5)) {
+      Function *callee = find_func(prog, line + 5);
+      if (callee && callee->is_outlined && max < depth + 8)
+        max = depth + 8;
+    }
+  }
+  return 8 + max;
+}
+
+static void compute_depth(Usage *u) {
+  if (u->visited)
+    return;
+  u->visited = true;
+
+  if (u->fn->is_recursive) {
+    u->depth = UNBOUNDED;
+    u->recursive = u->fn;
+    return;
+  }
+
+  int max = 0;
+  for (Callee *c = u->fn->callees; c; c = c->next) {
+    if (!c->fn) {
+      u->external = true;
+      continue;
+    }
+
+    Usage *callee = get_usage(c->fn);
+    compute_depth(callee);
+    if (callee->external)
+      u->external = true;
+
+    if (callee->depth == UNBOUNDED) {
+      u->depth = UNBOUNDED;
+      u->recursive = callee->recursive;
+      return;
+    }
+    if (max < callee->depth)
+      max = callee->depth;
+  }
+  u->depth = u->frame + max;
+}
+
+static void find_external_callees(Function *fn, StringArray *names) {
+  for (Callee *c = fn->callees; c; c = c->next) {
+    if (c->fn) {
+      find_external_callees(c->fn, names);
+      continue;
+    }
+
+    bool found = false;
+    for (int i = 0; i < names->len; i++)
+      if (!strcmp(names->data[i], c->name))
+        found = true;
+    if (!found)
+      strarray_push(names, c->name);
+  }
+}
+
+// Writes the frame size of each function to `su` in the format of
+// GCC's -fstack-usage, and the worst-case stack depth of each
+// entry point to `summary`.
+void stack_usage(Program *prog, char *filename, FILE *su, FILE *summary) {
+  build_callgraph(prog);
+
+  nusages = 0;
+  for (Function *fn = prog->funcs; fn; fn = fn->next)
+    nusages++;
+  usages = calloc(nusages, sizeof(Usage));
+
+  // A function folded into another one runs the code of the other
+  // one, either under the same address or after a jump.
+  int i = 0;
+  for (Function *fn = prog->funcs; fn; fn = fn->next, i++) {
+    Function *body = fn;
+    while (body->folded_into)
+      body = body->folded_into;
+    usages[i].fn = fn;
+    usages[i].frame = frame_size(prog, body);
+    fprintf(su, "%s:%d:%s\t%d\tstatic\n",
+            filename, fn->line_no, fn->name, usages[i].frame);
+  }
+
+  fprintf(summary, "%s: worst-case stack depth\n", filename);
+
+  for (i = 0; i < nusages; i++) {
+    Usage *u = &usages[i];
+    compute_depth(u);
+
+    // Only functions visible from other translation units are entry points.
+    if (u->fn->is_static)
+      continue;
+
+    if (u->depth == UNBOUNDED) {
+      fprintf(summary, "  %s: unbounded (recursion in %s)\n",
+              u->fn->name, u->recursive->name);
+      continue;
+    }
+
+    fprintf(summary, "  %s: %d bytes", u->fn->name, u->depth);
+    if (u->external) {
+      StringArray names = {};
+      find_external_callees(u->fn, &names);
+      fprintf(summary, " + external calls (");
+      for (int j = 0; j < names.len; j++)
+        fprintf(summary, "%s%s", j ? ", " : "", names.data[j]);
+      fprintf(summary, ")");
+    }
+    fprintf(summary, "\n");
+  }
+}
@@ -0,0 +1,36 @@
+#include "occ.h"
+
+void strarray_push(StringArray *arr, char *s) {
+  if (!arr->data) {
+    arr->data = calloc(8, sizeof(char *));
+    arr->capacity = 8;
+  }
+
+  if (arr->capacity == arr->len) {
+    arr->data = realloc(arr->data, sizeof(char *) * arr->capacity * 2);
+    arr->capacity *= 2;
+    for (int i = arr->len; i < arr->capacity; i++)
+      arr->data[i] = NULL;
+  }
+
+  arr->data[arr->len++] = s;
+}
+
+// Takes a printf-style format string and returns a formatted string.
+char *vformat(char *fmt, va_list ap) {
+  char *buf;
+  size_t buflen;
+  FILE *out = open_memstream(&buf, &buflen);
+
+  vfprintf(out, fmt, ap);
+  fclose(out);
+  return buf;
+}
+
+char *format(char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  char *buf = vformat(fmt, ap);
+  va_end(ap);
+  return buf;
+}
@@ -0,0 +1,16 @@
+// Linked with lto-b.c by -flto. Both files have a global named
+// `counter` and a static function named `helper`.
+int counter;
+
+static int helper(int x) {
+  counter = counter + x;
+  return counter * 2;
+}
+
+int from_b(int n);
+
+int main() {
+  int a = helper(3);
+  int b = from_b(4);
+  return a + b + counter;
+}
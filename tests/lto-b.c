@@ -0,0 +1,11 @@
+// Linked with lto-a.c by -flto.
+int counter = 10;
+
+static int helper(int x) {
+  counter = counter + x;
+  return counter;
+}
+
+int from_b(int n) {
+  return helper(n) + counter;
+}
@@ -7,8 +7,22 @@ int exit();
 
 int g1;
 int g2[4];
+int g3[4] = {1, 2, 3};
+int *g4 = &g3[1];
+char *g5 = "abc" + 1;
+char g6[4] = "xyz";
 
 typedef int MyInt;
+typedef struct { char c; int *p; } InitStruct;
+InitStruct g7[2] = {{'a', g3}, {'b', &g3[2]},};
+
+const int ctab[4] = {10, 20, 30};
+typedef struct { int w; char tag; } ConstCfg;
+const ConstCfg ccfg = {640, 'x'};
+const char *cmsg = "hi";
+char *const cptr = g6;
+const int cdup1[4] = {3, 1, 4, 1};
+const int cdup2[4] = {3, 1, 4, 1};
 
 int assert(int expected, int actual, char *code) {
   if (expected == actual) {
@@ -51,6 +65,145 @@ int fib(int x) {
   return fib(x-1) + fib(x-2);
 }
 
+int store_twice(int *p, int *q) {
+  *p = 1;
+  *q = 2;
+  return *p;
+}
+
+int store_fields(int *p) {
+  int a[2];
+  a[0] = 3;
+  a[1] = 4;
+  p[1] = 5;
+  return a[0] * 10 + a[1];
+}
+
+static int static_scale(int x, int k, int unused) {
+  return x * k;
+}
+
+static int static_op(int mode, int a, int b) {
+  if (mode == 0)
+    return a + b;
+  if (mode == 1)
+    return a - b;
+  return a * b;
+}
+
+static int sum_to(int n) {
+  int s = 0;
+  for (int i = 1; i <= n; i++)
+    s = s + i;
+  return s;
+}
+
+static int triangle(int n) {
+  int s = 0;
+  for (int i = 1; i <= n; i++)
+    s = s + i;
+  return s;
+}
+
+int aligned_locals() {
+  char c; int x; char d; int a[5]; char e;
+  c=1; d=2; e=3; x=4; a[4]=5;
+  return is_aligned(&x, 4) && is_aligned(a, 16) && c+d+e+x+a[4] == 15;
+}
+
+int sibling_blocks(int c) {
+  int r=0;
+  if (c) { int a[8]; a[7]=3; r=a[7]; } else { int b[8]; b[0]=4; r=b[0]; }
+  { int d[4]; d[0]=r; r=d[0]+1; }
+  return r;
+}
+
+int pooled_strings() {
+  char *a = "pool"; char *b = "spool"; char *c = "pool";
+  return (a == c) + (b[1] == 'p') + (a[4] == 0) + (b[4] == 'l');
+}
+
+typedef struct { char a; char b; char c; } Small;
+typedef struct { int x[10]; } Big;
+Big c_make_big(int n);
+
+Small make_small(int a) {
+  Small s; s.a = a; s.b = a + 1; s.c = a + 2;
+  return s;
+}
+
+// Too large to be inlined, so that both arguments are live at once
+int diff_small(Small a, Small b) {
+  int d = b.a - a.a;
+  d = d * 10 + b.b - a.b - 1;
+  d = d * 10 + b.c - a.c;
+  if (a.a > b.a || a.b > b.b || a.c > b.c)
+    return -d;
+  return d * 10 + a.b;
+}
+
+// make_small() is inlined here, unlike in main().
+int diff_made(int x, int y) {
+  return diff_small(make_small(x), make_small(y));
+}
+
+int sum_small(Small s) {
+  return s.a + s.b + s.c;
+}
+
+Big make_big(int n) {
+  Big b; int *p = b.x;
+  for (int i = 0; i < 10; i++) p[i] = n + i;
+  return b;
+}
+
+int sum_big(Small s, Big b, int k) {
+  int *p = b.x; int t = s.c + k;
+  for (int i = 0; i < 10; i++) t = t + p[i];
+  return t;
+}
+
+int const_index(int i) {
+  return ctab[i];
+}
+
+int cdup_sum(int i) {
+  return cdup1[i] * 10 + cdup2[i];
+}
+
+int restrict_store(int *restrict a, int *restrict b) {
+  *a = 1;
+  *b = 2;
+  return *a;
+}
+
+int restrict_sum(int *restrict dst, int *restrict src, int n) {
+  int i;
+  for (i = 0; i < n; i++)
+    *dst++ = *src++ * 2;
+  return dst[-1] + src[-1];
+}
+
+int set_through(int *restrict p) {
+  *p = 3;
+  return 0;
+}
+
+// Realigns its frame with -fstack-array-align=32 or more, and only
+// uses r10, so callers may keep values in r11 across calls to it. The
+// early return keeps it from being inlined.
+int realigned_callee(int n) {
+  char a[128];
+  if (n)
+    return 0;
+  return 5;
+}
+
+// Never called, so global DCE removes it.
+static int unused_static(int x) {
+  return x + 1;
+}
+
 static int static_fn() {
   return 3;
 }
@@ -331,11 +484,76 @@ int main() {
   assert(1, ({ int x[3]={1,2,3}; x[0]; }), "({ int x[3]={1,2,3}; x[0]; })");
   assert(2, ({ int x[3]={1,2,3}; x[1]; }), "({ int x[3]={1,2,3}; x[1]; })");
   assert(3, ({ int x[3]={1,2,3}; x[2]; }), "({ int x[3]={1,2,3}; x[2]; })");
+  assert(0, ({ int x[3]={1}; x[2]; }), "({ int x[3]={1}; x[2]; })");
+  assert(0, ({ int x[40]={1,2}; x[39]; }), "({ int x[40]={1,2}; x[39]; })");
+  assert(2, ({ int x[40]={1,2}; x[1]; }), "({ int x[40]={1,2}; x[1]; })");
+  assert(7, ({ int y=7; int x[40]={1,y}; x[1]; }), "({ int y=7; int x[40]={1,y}; x[1]; })");
+  assert(0, ({ int x[40]={}; x[20]; }), "({ int x[40]={}; x[20]; })");
+  assert(98, ({ char x[20]="abc"; x[1]; }), "({ char x[20]=\"abc\"; x[1]; })");
+  assert(0, ({ char x[80]="abc"; x[79]; }), "({ char x[80]=\"abc\"; x[79]; })");
+  assert(3, ({ InitStruct x[8]={{'a', g3}, {'b', g4}}; *x[0].p + *x[1].p + x[2].c; }), "({ InitStruct x[8]={{'a', g3}, {'b', g4}}; *x[0].p + *x[1].p + x[2].c; })");
 
   assert(3, (1,2,3), "(1,2,3)");
   assert(5, ({ int i=2; int j=3; (i=5,j)=6; i; }), "({ int i=2; int j=3; (i=5,j)=6; i; })");
   assert(6, ({ int i=2; int j=3; (i=5,j)=6; j; }), "({ int i=2; int j=3; (i=5,j)=6; j; })");
 
+  assert(2, ({ int x; store_twice(&x, &x); }), "({ int x; store_twice(&x, &x); })");
+  assert(1, ({ int x; int y; store_twice(&x, &y); }), "({ int x; int y; store_twice(&x, &y); })");
+  assert(34, ({ int x[2]; store_fields(x); }), "({ int x[2]; store_fields(x); })");
+
+  assert(21, static_scale(7, 3, 0), "static_scale(7, 3, 0)");
+  assert(12, static_scale(4, 3, 1), "static_scale(4, 3, 1)");
+  assert(42, ({ int x=7; static_scale(x, 3, 0) + static_scale(x, 3, 0); }), "({ int x=7; static_scale(x, 3, 0) + static_scale(x, 3, 0); })");
+
+  assert(30, ({ int i; int s=0; for (i=0; i<5; i++) s=static_op(0, s, i); static_op(2, s, 3); }), "({ int i; int s=0; for (i=0; i<5; i++) s=static_op(0, s, i); static_op(2, s, 3); })");
+  assert(7, ({ int i; int s=10; for (i=0; i<3; i++) s=static_op(1, s, 1); s; }), "({ int i; int s=10; for (i=0; i<3; i++) s=static_op(1, s, 1); s; })");
+  assert(55, sum_to(10), "sum_to(10)");
+  assert(15, sum_to(5), "sum_to(5)");
+  assert(21, triangle(6), "triangle(6)");
+  assert(28, triangle(7), "triangle(7)");
+  assert(1, aligned_locals(), "aligned_locals()");
+  assert(4, sibling_blocks(1), "sibling_blocks(1)");
+  assert(5, sibling_blocks(0), "sibling_blocks(0)");
+  assert(4, pooled_strings(), "pooled_strings()");
+  assert(3, g3[2], "g3[2]");
+  assert(0, g3[3], "g3[3]");
+  assert(2, *g4, "*g4");
+  assert(99, g5[1], "g5[1]");
+  assert(121, g6[1], "g6[1]");
+  assert(98, g7[1].c, "g7[1].c");
+  assert(3, *g7[1].p, "*g7[1].p");
+  assert(1, *g7[0].p, "*g7[0].p");
+
+  assert(6, ({ Small x; Small y; x.a=1; x.b=2; x.c=3; y=x; y.a+y.b+y.c; }), "({ Small x; Small y; x.a=1; x.b=2; x.c=3; y=x; y.a+y.b+y.c; })");
+  assert(6, ({ Small x; Small y; Small z; x=make_small(4); z=y=x; z.c; }), "({ Small x; Small y; Small z; x=make_small(4); z=y=x; z.c; })");
+  assert(6, sum_small(make_small(1)), "sum_small(make_small(1))");
+  assert(3, make_small(1).c, "make_small(1).c");
+  assert(12, ({ Big b; int *p; b=make_big(3); p=b.x; p[9]; }), "({ Big b; int *p; b=make_big(3); p=b.x; p[9]; })");
+  assert(148, sum_big(make_small(1), make_big(0), 100), "sum_big(make_small(1), make_big(0), 100)");
+  assert(60, c_sum_structs(make_small(1), make_big(1), 2), "c_sum_structs(make_small(1), make_big(1), 2)");
+  assert(18, ({ Big b; int *p; b=c_make_big(2); p=b.x; p[9]; }), "({ Big b; int *p; b=c_make_big(2); p=b.x; p[9]; })");
+  assert(3262, diff_small(({ Small s; s.a=1; s.b=2; s.c=3; s; }), ({ Small t; t.a=4; t.b=5; t.c=9; t; })), "diff_small(({ Small s; s.a=1; s.b=2; s.c=3; s; }), ({ Small t; t.a=4; t.b=5; t.c=9; t; }))");
+  assert(4342, diff_made(1, 5), "diff_made(1, 5)");
+
+  assert(30, ctab[2], "ctab[2]");
+  assert(0, ctab[3], "ctab[3]");
+  assert(20, const_index(1), "const_index(1)");
+  assert(640, ccfg.w, "ccfg.w");
+  assert(120, ccfg.tag, "ccfg.tag");
+  assert(105, cmsg[1], "cmsg[1]");
+  assert(122, cptr[2], "cptr[2]");
+  assert(10, ({ const int x=5; int const y=2; x*y; }), "({ const int x=5; int const y=2; x*y; })");
+  assert(30, ({ const int *p=ctab; p[1]+*ctab; }), "({ const int *p=ctab; p[1]+*ctab; })");
+  assert(16, sizeof(ctab), "sizeof(ctab)");
+
+  assert(1, ({ int x; int y; restrict_store(&x, &y); }), "({ int x; int y; restrict_store(&x, &y); })");
+  assert(12, ({ int a[3]; int b[3]; b[0]=1; b[1]=2; b[2]=4; restrict_sum(a, b, 3); }), "({ int a[3]; int b[3]; b[0]=1; b[1]=2; b[2]=4; restrict_sum(a, b, 3); })");
+  assert(3, ({ int x=1; set_through(&x); x; }), "({ int x=1; set_through(&x); x; })");
+
+  assert(125, ({ int x=100; int y=20; x + (y + realigned_callee(0)); }), "({ int x=100; int y=20; x + (y + realigned_callee(0)); })");
+  assert(44, cdup_sum(2), "cdup_sum(2)");
+  assert(1, cdup2[3], "cdup2[3]");
+
   printf("OK\n");
   return 0;
 }
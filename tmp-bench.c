@@ -0,0 +1,5203 @@
+int bench(int a) {
+  int v0 = 0;
+  int v1 = 1;
+  int v2 = 2;
+  int v3 = 3;
+  int v4 = 4;
+  int v5 = 5;
+  int v6 = 6;
+  int v7 = 7;
+  int v8 = 8;
+  int v9 = 9;
+  int v10 = 10;
+  int v11 = 11;
+  int v12 = 12;
+  int v13 = 13;
+  int v14 = 14;
+  int v15 = 15;
+  int v16 = 16;
+  int v17 = 17;
+  int v18 = 18;
+  int v19 = 19;
+  int v20 = 20;
+  int v21 = 21;
+  int v22 = 22;
+  int v23 = 23;
+  int v24 = 24;
+  int v25 = 25;
+  int v26 = 26;
+  int v27 = 27;
+  int v28 = 28;
+  int v29 = 29;
+  int v30 = 30;
+  int v31 = 31;
+  int v32 = 32;
+  int v33 = 33;
+  int v34 = 34;
+  int v35 = 35;
+  int v36 = 36;
+  int v37 = 37;
+  int v38 = 38;
+  int v39 = 39;
+  int v40 = 40;
+  int v41 = 41;
+  int v42 = 42;
+  int v43 = 43;
+  int v44 = 44;
+  int v45 = 45;
+  int v46 = 46;
+  int v47 = 47;
+  int v48 = 48;
+  int v49 = 49;
+  int v50 = 50;
+  int v51 = 51;
+  int v52 = 52;
+  int v53 = 53;
+  int v54 = 54;
+  int v55 = 55;
+  int v56 = 56;
+  int v57 = 57;
+  int v58 = 58;
+  int v59 = 59;
+  int v60 = 60;
+  int v61 = 61;
+  int v62 = 62;
+  int v63 = 63;
+  int v64 = 64;
+  int v65 = 65;
+  int v66 = 66;
+  int v67 = 67;
+  int v68 = 68;
+  int v69 = 69;
+  int v70 = 70;
+  int v71 = 71;
+  int v72 = 72;
+  int v73 = 73;
+  int v74 = 74;
+  int v75 = 75;
+  int v76 = 76;
+  int v77 = 77;
+  int v78 = 78;
+  int v79 = 79;
+  int v80 = 80;
+  int v81 = 81;
+  int v82 = 82;
+  int v83 = 83;
+  int v84 = 84;
+  int v85 = 85;
+  int v86 = 86;
+  int v87 = 87;
+  int v88 = 88;
+  int v89 = 89;
+  int v90 = 90;
+  int v91 = 91;
+  int v92 = 92;
+  int v93 = 93;
+  int v94 = 94;
+  int v95 = 95;
+  int v96 = 96;
+  int v97 = 97;
+  int v98 = 98;
+  int v99 = 99;
+  int v100 = 100;
+  int v101 = 101;
+  int v102 = 102;
+  int v103 = 103;
+  int v104 = 104;
+  int v105 = 105;
+  int v106 = 106;
+  int v107 = 107;
+  int v108 = 108;
+  int v109 = 109;
+  int v110 = 110;
+  int v111 = 111;
+  int v112 = 112;
+  int v113 = 113;
+  int v114 = 114;
+  int v115 = 115;
+  int v116 = 116;
+  int v117 = 117;
+  int v118 = 118;
+  int v119 = 119;
+  int v120 = 120;
+  int v121 = 121;
+  int v122 = 122;
+  int v123 = 123;
+  int v124 = 124;
+  int v125 = 125;
+  int v126 = 126;
+  int v127 = 127;
+  int v128 = 128;
+  int v129 = 129;
+  int v130 = 130;
+  int v131 = 131;
+  int v132 = 132;
+  int v133 = 133;
+  int v134 = 134;
+  int v135 = 135;
+  int v136 = 136;
+  int v137 = 137;
+  int v138 = 138;
+  int v139 = 139;
+  int v140 = 140;
+  int v141 = 141;
+  int v142 = 142;
+  int v143 = 143;
+  int v144 = 144;
+  int v145 = 145;
+  int v146 = 146;
+  int v147 = 147;
+  int v148 = 148;
+  int v149 = 149;
+  int v150 = 150;
+  int v151 = 151;
+  int v152 = 152;
+  int v153 = 153;
+  int v154 = 154;
+  int v155 = 155;
+  int v156 = 156;
+  int v157 = 157;
+  int v158 = 158;
+  int v159 = 159;
+  int v160 = 160;
+  int v161 = 161;
+  int v162 = 162;
+  int v163 = 163;
+  int v164 = 164;
+  int v165 = 165;
+  int v166 = 166;
+  int v167 = 167;
+  int v168 = 168;
+  int v169 = 169;
+  int v170 = 170;
+  int v171 = 171;
+  int v172 = 172;
+  int v173 = 173;
+  int v174 = 174;
+  int v175 = 175;
+  int v176 = 176;
+  int v177 = 177;
+  int v178 = 178;
+  int v179 = 179;
+  int v180 = 180;
+  int v181 = 181;
+  int v182 = 182;
+  int v183 = 183;
+  int v184 = 184;
+  int v185 = 185;
+  int v186 = 186;
+  int v187 = 187;
+  int v188 = 188;
+  int v189 = 189;
+  int v190 = 190;
+  int v191 = 191;
+  int v192 = 192;
+  int v193 = 193;
+  int v194 = 194;
+  int v195 = 195;
+  int v196 = 196;
+  int v197 = 197;
+  int v198 = 198;
+  int v199 = 199;
+  if (a > 0) v0 = v7 + a; else v3 = 0;
+  if (a > 1) v1 = v8 + a; else v4 = 1;
+  if (a > 2) v2 = v9 + a; else v5 = 2;
+  if (a > 3) v3 = v10 + a; else v6 = 3;
+  if (a > 4) v4 = v11 + a; else v7 = 4;
+  if (a > 5) v5 = v12 + a; else v8 = 5;
+  if (a > 6) v6 = v13 + a; else v9 = 6;
+  if (a > 7) v7 = v14 + a; else v10 = 7;
+  if (a > 8) v8 = v15 + a; else v11 = 8;
+  if (a > 9) v9 = v16 + a; else v12 = 9;
+  if (a > 10) v10 = v17 + a; else v13 = 10;
+  if (a > 11) v11 = v18 + a; else v14 = 11;
+  if (a > 12) v12 = v19 + a; else v15 = 12;
+  if (a > 13) v13 = v20 + a; else v16 = 13;
+  if (a > 14) v14 = v21 + a; else v17 = 14;
+  if (a > 15) v15 = v22 + a; else v18 = 15;
+  if (a > 16) v16 = v23 + a; else v19 = 16;
+  if (a > 17) v17 = v24 + a; else v20 = 17;
+  if (a > 18) v18 = v25 + a; else v21 = 18;
+  if (a > 19) v19 = v26 + a; else v22 = 19;
+  if (a > 20) v20 = v27 + a; else v23 = 20;
+  if (a > 21) v21 = v28 + a; else v24 = 21;
+  if (a > 22) v22 = v29 + a; else v25 = 22;
+  if (a > 23) v23 = v30 + a; else v26 = 23;
+  if (a > 24) v24 = v31 + a; else v27 = 24;
+  if (a > 25) v25 = v32 + a; else v28 = 25;
+  if (a > 26) v26 = v33 + a; else v29 = 26;
+  if (a > 27) v27 = v34 + a; else v30 = 27;
+  if (a > 28) v28 = v35 + a; else v31 = 28;
+  if (a > 29) v29 = v36 + a; else v32 = 29;
+  if (a > 30) v30 = v37 + a; else v33 = 30;
+  if (a > 31) v31 = v38 + a; else v34 = 31;
+  if (a > 32) v32 = v39 + a; else v35 = 32;
+  if (a > 33) v33 = v40 + a; else v36 = 33;
+  if (a > 34) v34 = v41 + a; else v37 = 34;
+  if (a > 35) v35 = v42 + a; else v38 = 35;
+  if (a > 36) v36 = v43 + a; else v39 = 36;
+  if (a > 37) v37 = v44 + a; else v40 = 37;
+  if (a > 38) v38 = v45 + a; else v41 = 38;
+  if (a > 39) v39 = v46 + a; else v42 = 39;
+  if (a > 40) v40 = v47 + a; else v43 = 40;
+  if (a > 41) v41 = v48 + a; else v44 = 41;
+  if (a > 42) v42 = v49 + a; else v45 = 42;
+  if (a > 43) v43 = v50 + a; else v46 = 43;
+  if (a > 44) v44 = v51 + a; else v47 = 44;
+  if (a > 45) v45 = v52 + a; else v48 = 45;
+  if (a > 46) v46 = v53 + a; else v49 = 46;
+  if (a > 47) v47 = v54 + a; else v50 = 47;
+  if (a > 48) v48 = v55 + a; else v51 = 48;
+  if (a > 49) v49 = v56 + a; else v52 = 49;
+  if (a > 50) v50 = v57 + a; else v53 = 50;
+  if (a > 51) v51 = v58 + a; else v54 = 51;
+  if (a > 52) v52 = v59 + a; else v55 = 52;
+  if (a > 53) v53 = v60 + a; else v56 = 53;
+  if (a > 54) v54 = v61 + a; else v57 = 54;
+  if (a > 55) v55 = v62 + a; else v58 = 55;
+  if (a > 56) v56 = v63 + a; else v59 = 56;
+  if (a > 57) v57 = v64 + a; else v60 = 57;
+  if (a > 58) v58 = v65 + a; else v61 = 58;
+  if (a > 59) v59 = v66 + a; else v62 = 59;
+  if (a > 60) v60 = v67 + a; else v63 = 60;
+  if (a > 61) v61 = v68 + a; else v64 = 61;
+  if (a > 62) v62 = v69 + a; else v65 = 62;
+  if (a > 63) v63 = v70 + a; else v66 = 63;
+  if (a > 64) v64 = v71 + a; else v67 = 64;
+  if (a > 65) v65 = v72 + a; else v68 = 65;
+  if (a > 66) v66 = v73 + a; else v69 = 66;
+  if (a > 67) v67 = v74 + a; else v70 = 67;
+  if (a > 68) v68 = v75 + a; else v71 = 68;
+  if (a > 69) v69 = v76 + a; else v72 = 69;
+  if (a > 70) v70 = v77 + a; else v73 = 70;
+  if (a > 71) v71 = v78 + a; else v74 = 71;
+  if (a > 72) v72 = v79 + a; else v75 = 72;
+  if (a > 73) v73 = v80 + a; else v76 = 73;
+  if (a > 74) v74 = v81 + a; else v77 = 74;
+  if (a > 75) v75 = v82 + a; else v78 = 75;
+  if (a > 76) v76 = v83 + a; else v79 = 76;
+  if (a > 77) v77 = v84 + a; else v80 = 77;
+  if (a > 78) v78 = v85 + a; else v81 = 78;
+  if (a > 79) v79 = v86 + a; else v82 = 79;
+  if (a > 80) v80 = v87 + a; else v83 = 80;
+  if (a > 81) v81 = v88 + a; else v84 = 81;
+  if (a > 82) v82 = v89 + a; else v85 = 82;
+  if (a > 83) v83 = v90 + a; else v86 = 83;
+  if (a > 84) v84 = v91 + a; else v87 = 84;
+  if (a > 85) v85 = v92 + a; else v88 = 85;
+  if (a > 86) v86 = v93 + a; else v89 = 86;
+  if (a > 87) v87 = v94 + a; else v90 = 87;
+  if (a > 88) v88 = v95 + a; else v91 = 88;
+  if (a > 89) v89 = v96 + a; else v92 = 89;
+  if (a > 90) v90 = v97 + a; else v93 = 90;
+  if (a > 91) v91 = v98 + a; else v94 = 91;
+  if (a > 92) v92 = v99 + a; else v95 = 92;
+  if (a > 93) v93 = v100 + a; else v96 = 93;
+  if (a > 94) v94 = v101 + a; else v97 = 94;
+  if (a > 95) v95 = v102 + a; else v98 = 95;
+  if (a > 96) v96 = v103 + a; else v99 = 96;
+  if (a > 97) v97 = v104 + a; else v100 = 97;
+  if (a > 98) v98 = v105 + a; else v101 = 98;
+  if (a > 99) v99 = v106 + a; else v102 = 99;
+  if (a > 100) v100 = v107 + a; else v103 = 100;
+  if (a > 101) v101 = v108 + a; else v104 = 101;
+  if (a > 102) v102 = v109 + a; else v105 = 102;
+  if (a > 103) v103 = v110 + a; else v106 = 103;
+  if (a > 104) v104 = v111 + a; else v107 = 104;
+  if (a > 105) v105 = v112 + a; else v108 = 105;
+  if (a > 106) v106 = v113 + a; else v109 = 106;
+  if (a > 107) v107 = v114 + a; else v110 = 107;
+  if (a > 108) v108 = v115 + a; else v111 = 108;
+  if (a > 109) v109 = v116 + a; else v112 = 109;
+  if (a > 110) v110 = v117 + a; else v113 = 110;
+  if (a > 111) v111 = v118 + a; else v114 = 111;
+  if (a > 112) v112 = v119 + a; else v115 = 112;
+  if (a > 113) v113 = v120 + a; else v116 = 113;
+  if (a > 114) v114 = v121 + a; else v117 = 114;
+  if (a > 115) v115 = v122 + a; else v118 = 115;
+  if (a > 116) v116 = v123 + a; else v119 = 116;
+  if (a > 117) v117 = v124 + a; else v120 = 117;
+  if (a > 118) v118 = v125 + a; else v121 = 118;
+  if (a > 119) v119 = v126 + a; else v122 = 119;
+  if (a > 120) v120 = v127 + a; else v123 = 120;
+  if (a > 121) v121 = v128 + a; else v124 = 121;
+  if (a > 122) v122 = v129 + a; else v125 = 122;
+  if (a > 123) v123 = v130 + a; else v126 = 123;
+  if (a > 124) v124 = v131 + a; else v127 = 124;
+  if (a > 125) v125 = v132 + a; else v128 = 125;
+  if (a > 126) v126 = v133 + a; else v129 = 126;
+  if (a > 127) v127 = v134 + a; else v130 = 127;
+  if (a > 128) v128 = v135 + a; else v131 = 128;
+  if (a > 129) v129 = v136 + a; else v132 = 129;
+  if (a > 130) v130 = v137 + a; else v133 = 130;
+  if (a > 131) v131 = v138 + a; else v134 = 131;
+  if (a > 132) v132 = v139 + a; else v135 = 132;
+  if (a > 133) v133 = v140 + a; else v136 = 133;
+  if (a > 134) v134 = v141 + a; else v137 = 134;
+  if (a > 135) v135 = v142 + a; else v138 = 135;
+  if (a > 136) v136 = v143 + a; else v139 = 136;
+  if (a > 137) v137 = v144 + a; else v140 = 137;
+  if (a > 138) v138 = v145 + a; else v141 = 138;
+  if (a > 139) v139 = v146 + a; else v142 = 139;
+  if (a > 140) v140 = v147 + a; else v143 = 140;
+  if (a > 141) v141 = v148 + a; else v144 = 141;
+  if (a > 142) v142 = v149 + a; else v145 = 142;
+  if (a > 143) v143 = v150 + a; else v146 = 143;
+  if (a > 144) v144 = v151 + a; else v147 = 144;
+  if (a > 145) v145 = v152 + a; else v148 = 145;
+  if (a > 146) v146 = v153 + a; else v149 = 146;
+  if (a > 147) v147 = v154 + a; else v150 = 147;
+  if (a > 148) v148 = v155 + a; else v151 = 148;
+  if (a > 149) v149 = v156 + a; else v152 = 149;
+  if (a > 150) v150 = v157 + a; else v153 = 150;
+  if (a > 151) v151 = v158 + a; else v154 = 151;
+  if (a > 152) v152 = v159 + a; else v155 = 152;
+  if (a > 153) v153 = v160 + a; else v156 = 153;
+  if (a > 154) v154 = v161 + a; else v157 = 154;
+  if (a > 155) v155 = v162 + a; else v158 = 155;
+  if (a > 156) v156 = v163 + a; else v159 = 156;
+  if (a > 157) v157 = v164 + a; else v160 = 157;
+  if (a > 158) v158 = v165 + a; else v161 = 158;
+  if (a > 159) v159 = v166 + a; else v162 = 159;
+  if (a > 160) v160 = v167 + a; else v163 = 160;
+  if (a > 161) v161 = v168 + a; else v164 = 161;
+  if (a > 162) v162 = v169 + a; else v165 = 162;
+  if (a > 163) v163 = v170 + a; else v166 = 163;
+  if (a > 164) v164 = v171 + a; else v167 = 164;
+  if (a > 165) v165 = v172 + a; else v168 = 165;
+  if (a > 166) v166 = v173 + a; else v169 = 166;
+  if (a > 167) v167 = v174 + a; else v170 = 167;
+  if (a > 168) v168 = v175 + a; else v171 = 168;
+  if (a > 169) v169 = v176 + a; else v172 = 169;
+  if (a > 170) v170 = v177 + a; else v173 = 170;
+  if (a > 171) v171 = v178 + a; else v174 = 171;
+  if (a > 172) v172 = v179 + a; else v175 = 172;
+  if (a > 173) v173 = v180 + a; else v176 = 173;
+  if (a > 174) v174 = v181 + a; else v177 = 174;
+  if (a > 175) v175 = v182 + a; else v178 = 175;
+  if (a > 176) v176 = v183 + a; else v179 = 176;
+  if (a > 177) v177 = v184 + a; else v180 = 177;
+  if (a > 178) v178 = v185 + a; else v181 = 178;
+  if (a > 179) v179 = v186 + a; else v182 = 179;
+  if (a > 180) v180 = v187 + a; else v183 = 180;
+  if (a > 181) v181 = v188 + a; else v184 = 181;
+  if (a > 182) v182 = v189 + a; else v185 = 182;
+  if (a > 183) v183 = v190 + a; else v186 = 183;
+  if (a > 184) v184 = v191 + a; else v187 = 184;
+  if (a > 185) v185 = v192 + a; else v188 = 185;
+  if (a > 186) v186 = v193 + a; else v189 = 186;
+  if (a > 187) v187 = v194 + a; else v190 = 187;
+  if (a > 188) v188 = v195 + a; else v191 = 188;
+  if (a > 189) v189 = v196 + a; else v192 = 189;
+  if (a > 190) v190 = v197 + a; else v193 = 190;
+  if (a > 191) v191 = v198 + a; else v194 = 191;
+  if (a > 192) v192 = v199 + a; else v195 = 192;
+  if (a > 193) v193 = v0 + a; else v196 = 193;
+  if (a > 194) v194 = v1 + a; else v197 = 194;
+  if (a > 195) v195 = v2 + a; else v198 = 195;
+  if (a > 196) v196 = v3 + a; else v199 = 196;
+  if (a > 197) v197 = v4 + a; else v0 = 197;
+  if (a > 198) v198 = v5 + a; else v1 = 198;
+  if (a > 199) v199 = v6 + a; else v2 = 199;
+  if (a > 200) v0 = v7 + a; else v3 = 200;
+  if (a > 201) v1 = v8 + a; else v4 = 201;
+  if (a > 202) v2 = v9 + a; else v5 = 202;
+  if (a > 203) v3 = v10 + a; else v6 = 203;
+  if (a > 204) v4 = v11 + a; else v7 = 204;
+  if (a > 205) v5 = v12 + a; else v8 = 205;
+  if (a > 206) v6 = v13 + a; else v9 = 206;
+  if (a > 207) v7 = v14 + a; else v10 = 207;
+  if (a > 208) v8 = v15 + a; else v11 = 208;
+  if (a > 209) v9 = v16 + a; else v12 = 209;
+  if (a > 210) v10 = v17 + a; else v13 = 210;
+  if (a > 211) v11 = v18 + a; else v14 = 211;
+  if (a > 212) v12 = v19 + a; else v15 = 212;
+  if (a > 213) v13 = v20 + a; else v16 = 213;
+  if (a > 214) v14 = v21 + a; else v17 = 214;
+  if (a > 215) v15 = v22 + a; else v18 = 215;
+  if (a > 216) v16 = v23 + a; else v19 = 216;
+  if (a > 217) v17 = v24 + a; else v20 = 217;
+  if (a > 218) v18 = v25 + a; else v21 = 218;
+  if (a > 219) v19 = v26 + a; else v22 = 219;
+  if (a > 220) v20 = v27 + a; else v23 = 220;
+  if (a > 221) v21 = v28 + a; else v24 = 221;
+  if (a > 222) v22 = v29 + a; else v25 = 222;
+  if (a > 223) v23 = v30 + a; else v26 = 223;
+  if (a > 224) v24 = v31 + a; else v27 = 224;
+  if (a > 225) v25 = v32 + a; else v28 = 225;
+  if (a > 226) v26 = v33 + a; else v29 = 226;
+  if (a > 227) v27 = v34 + a; else v30 = 227;
+  if (a > 228) v28 = v35 + a; else v31 = 228;
+  if (a > 229) v29 = v36 + a; else v32 = 229;
+  if (a > 230) v30 = v37 + a; else v33 = 230;
+  if (a > 231) v31 = v38 + a; else v34 = 231;
+  if (a > 232) v32 = v39 + a; else v35 = 232;
+  if (a > 233) v33 = v40 + a; else v36 = 233;
+  if (a > 234) v34 = v41 + a; else v37 = 234;
+  if (a > 235) v35 = v42 + a; else v38 = 235;
+  if (a > 236) v36 = v43 + a; else v39 = 236;
+  if (a > 237) v37 = v44 + a; else v40 = 237;
+  if (a > 238) v38 = v45 + a; else v41 = 238;
+  if (a > 239) v39 = v46 + a; else v42 = 239;
+  if (a > 240) v40 = v47 + a; else v43 = 240;
+  if (a > 241) v41 = v48 + a; else v44 = 241;
+  if (a > 242) v42 = v49 + a; else v45 = 242;
+  if (a > 243) v43 = v50 + a; else v46 = 243;
+  if (a > 244) v44 = v51 + a; else v47 = 244;
+  if (a > 245) v45 = v52 + a; else v48 = 245;
+  if (a > 246) v46 = v53 + a; else v49 = 246;
+  if (a > 247) v47 = v54 + a; else v50 = 247;
+  if (a > 248) v48 = v55 + a; else v51 = 248;
+  if (a > 249) v49 = v56 + a; else v52 = 249;
+  if (a > 250) v50 = v57 + a; else v53 = 250;
+  if (a > 251) v51 = v58 + a; else v54 = 251;
+  if (a > 252) v52 = v59 + a; else v55 = 252;
+  if (a > 253) v53 = v60 + a; else v56 = 253;
+  if (a > 254) v54 = v61 + a; else v57 = 254;
+  if (a > 255) v55 = v62 + a; else v58 = 255;
+  if (a > 256) v56 = v63 + a; else v59 = 256;
+  if (a > 257) v57 = v64 + a; else v60 = 257;
+  if (a > 258) v58 = v65 + a; else v61 = 258;
+  if (a > 259) v59 = v66 + a; else v62 = 259;
+  if (a > 260) v60 = v67 + a; else v63 = 260;
+  if (a > 261) v61 = v68 + a; else v64 = 261;
+  if (a > 262) v62 = v69 + a; else v65 = 262;
+  if (a > 263) v63 = v70 + a; else v66 = 263;
+  if (a > 264) v64 = v71 + a; else v67 = 264;
+  if (a > 265) v65 = v72 + a; else v68 = 265;
+  if (a > 266) v66 = v73 + a; else v69 = 266;
+  if (a > 267) v67 = v74 + a; else v70 = 267;
+  if (a > 268) v68 = v75 + a; else v71 = 268;
+  if (a > 269) v69 = v76 + a; else v72 = 269;
+  if (a > 270) v70 = v77 + a; else v73 = 270;
+  if (a > 271) v71 = v78 + a; else v74 = 271;
+  if (a > 272) v72 = v79 + a; else v75 = 272;
+  if (a > 273) v73 = v80 + a; else v76 = 273;
+  if (a > 274) v74 = v81 + a; else v77 = 274;
+  if (a > 275) v75 = v82 + a; else v78 = 275;
+  if (a > 276) v76 = v83 + a; else v79 = 276;
+  if (a > 277) v77 = v84 + a; else v80 = 277;
+  if (a > 278) v78 = v85 + a; else v81 = 278;
+  if (a > 279) v79 = v86 + a; else v82 = 279;
+  if (a > 280) v80 = v87 + a; else v83 = 280;
+  if (a > 281) v81 = v88 + a; else v84 = 281;
+  if (a > 282) v82 = v89 + a; else v85 = 282;
+  if (a > 283) v83 = v90 + a; else v86 = 283;
+  if (a > 284) v84 = v91 + a; else v87 = 284;
+  if (a > 285) v85 = v92 + a; else v88 = 285;
+  if (a > 286) v86 = v93 + a; else v89 = 286;
+  if (a > 287) v87 = v94 + a; else v90 = 287;
+  if (a > 288) v88 = v95 + a; else v91 = 288;
+  if (a > 289) v89 = v96 + a; else v92 = 289;
+  if (a > 290) v90 = v97 + a; else v93 = 290;
+  if (a > 291) v91 = v98 + a; else v94 = 291;
+  if (a > 292) v92 = v99 + a; else v95 = 292;
+  if (a > 293) v93 = v100 + a; else v96 = 293;
+  if (a > 294) v94 = v101 + a; else v97 = 294;
+  if (a > 295) v95 = v102 + a; else v98 = 295;
+  if (a > 296) v96 = v103 + a; else v99 = 296;
+  if (a > 297) v97 = v104 + a; else v100 = 297;
+  if (a > 298) v98 = v105 + a; else v101 = 298;
+  if (a > 299) v99 = v106 + a; else v102 = 299;
+  if (a > 300) v100 = v107 + a; else v103 = 300;
+  if (a > 301) v101 = v108 + a; else v104 = 301;
+  if (a > 302) v102 = v109 + a; else v105 = 302;
+  if (a > 303) v103 = v110 + a; else v106 = 303;
+  if (a > 304) v104 = v111 + a; else v107 = 304;
+  if (a > 305) v105 = v112 + a; else v108 = 305;
+  if (a > 306) v106 = v113 + a; else v109 = 306;
+  if (a > 307) v107 = v114 + a; else v110 = 307;
+  if (a > 308) v108 = v115 + a; else v111 = 308;
+  if (a > 309) v109 = v116 + a; else v112 = 309;
+  if (a > 310) v110 = v117 + a; else v113 = 310;
+  if (a > 311) v111 = v118 + a; else v114 = 311;
+  if (a > 312) v112 = v119 + a; else v115 = 312;
+  if (a > 313) v113 = v120 + a; else v116 = 313;
+  if (a > 314) v114 = v121 + a; else v117 = 314;
+  if (a > 315) v115 = v122 + a; else v118 = 315;
+  if (a > 316) v116 = v123 + a; else v119 = 316;
+  if (a > 317) v117 = v124 + a; else v120 = 317;
+  if (a > 318) v118 = v125 + a; else v121 = 318;
+  if (a > 319) v119 = v126 + a; else v122 = 319;
+  if (a > 320) v120 = v127 + a; else v123 = 320;
+  if (a > 321) v121 = v128 + a; else v124 = 321;
+  if (a > 322) v122 = v129 + a; else v125 = 322;
+  if (a > 323) v123 = v130 + a; else v126 = 323;
+  if (a > 324) v124 = v131 + a; else v127 = 324;
+  if (a > 325) v125 = v132 + a; else v128 = 325;
+  if (a > 326) v126 = v133 + a; else v129 = 326;
+  if (a > 327) v127 = v134 + a; else v130 = 327;
+  if (a > 328) v128 = v135 + a; else v131 = 328;
+  if (a > 329) v129 = v136 + a; else v132 = 329;
+  if (a > 330) v130 = v137 + a; else v133 = 330;
+  if (a > 331) v131 = v138 + a; else v134 = 331;
+  if (a > 332) v132 = v139 + a; else v135 = 332;
+  if (a > 333) v133 = v140 + a; else v136 = 333;
+  if (a > 334) v134 = v141 + a; else v137 = 334;
+  if (a > 335) v135 = v142 + a; else v138 = 335;
+  if (a > 336) v136 = v143 + a; else v139 = 336;
+  if (a > 337) v137 = v144 + a; else v140 = 337;
+  if (a > 338) v138 = v145 + a; else v141 = 338;
+  if (a > 339) v139 = v146 + a; else v142 = 339;
+  if (a > 340) v140 = v147 + a; else v143 = 340;
+  if (a > 341) v141 = v148 + a; else v144 = 341;
+  if (a > 342) v142 = v149 + a; else v145 = 342;
+  if (a > 343) v143 = v150 + a; else v146 = 343;
+  if (a > 344) v144 = v151 + a; else v147 = 344;
+  if (a > 345) v145 = v152 + a; else v148 = 345;
+  if (a > 346) v146 = v153 + a; else v149 = 346;
+  if (a > 347) v147 = v154 + a; else v150 = 347;
+  if (a > 348) v148 = v155 + a; else v151 = 348;
+  if (a > 349) v149 = v156 + a; else v152 = 349;
+  if (a > 350) v150 = v157 + a; else v153 = 350;
+  if (a > 351) v151 = v158 + a; else v154 = 351;
+  if (a > 352) v152 = v159 + a; else v155 = 352;
+  if (a > 353) v153 = v160 + a; else v156 = 353;
+  if (a > 354) v154 = v161 + a; else v157 = 354;
+  if (a > 355) v155 = v162 + a; else v158 = 355;
+  if (a > 356) v156 = v163 + a; else v159 = 356;
+  if (a > 357) v157 = v164 + a; else v160 = 357;
+  if (a > 358) v158 = v165 + a; else v161 = 358;
+  if (a > 359) v159 = v166 + a; else v162 = 359;
+  if (a > 360) v160 = v167 + a; else v163 = 360;
+  if (a > 361) v161 = v168 + a; else v164 = 361;
+  if (a > 362) v162 = v169 + a; else v165 = 362;
+  if (a > 363) v163 = v170 + a; else v166 = 363;
+  if (a > 364) v164 = v171 + a; else v167 = 364;
+  if (a > 365) v165 = v172 + a; else v168 = 365;
+  if (a > 366) v166 = v173 + a; else v169 = 366;
+  if (a > 367) v167 = v174 + a; else v170 = 367;
+  if (a > 368) v168 = v175 + a; else v171 = 368;
+  if (a > 369) v169 = v176 + a; else v172 = 369;
+  if (a > 370) v170 = v177 + a; else v173 = 370;
+  if (a > 371) v171 = v178 + a; else v174 = 371;
+  if (a > 372) v172 = v179 + a; else v175 = 372;
+  if (a > 373) v173 = v180 + a; else v176 = 373;
+  if (a > 374) v174 = v181 + a; else v177 = 374;
+  if (a > 375) v175 = v182 + a; else v178 = 375;
+  if (a > 376) v176 = v183 + a; else v179 = 376;
+  if (a > 377) v177 = v184 + a; else v180 = 377;
+  if (a > 378) v178 = v185 + a; else v181 = 378;
+  if (a > 379) v179 = v186 + a; else v182 = 379;
+  if (a > 380) v180 = v187 + a; else v183 = 380;
+  if (a > 381) v181 = v188 + a; else v184 = 381;
+  if (a > 382) v182 = v189 + a; else v185 = 382;
+  if (a > 383) v183 = v190 + a; else v186 = 383;
+  if (a > 384) v184 = v191 + a; else v187 = 384;
+  if (a > 385) v185 = v192 + a; else v188 = 385;
+  if (a > 386) v186 = v193 + a; else v189 = 386;
+  if (a > 387) v187 = v194 + a; else v190 = 387;
+  if (a > 388) v188 = v195 + a; else v191 = 388;
+  if (a > 389) v189 = v196 + a; else v192 = 389;
+  if (a > 390) v190 = v197 + a; else v193 = 390;
+  if (a > 391) v191 = v198 + a; else v194 = 391;
+  if (a > 392) v192 = v199 + a; else v195 = 392;
+  if (a > 393) v193 = v0 + a; else v196 = 393;
+  if (a > 394) v194 = v1 + a; else v197 = 394;
+  if (a > 395) v195 = v2 + a; else v198 = 395;
+  if (a > 396) v196 = v3 + a; else v199 = 396;
+  if (a > 397) v197 = v4 + a; else v0 = 397;
+  if (a > 398) v198 = v5 + a; else v1 = 398;
+  if (a > 399) v199 = v6 + a; else v2 = 399;
+  if (a > 400) v0 = v7 + a; else v3 = 400;
+  if (a > 401) v1 = v8 + a; else v4 = 401;
+  if (a > 402) v2 = v9 + a; else v5 = 402;
+  if (a > 403) v3 = v10 + a; else v6 = 403;
+  if (a > 404) v4 = v11 + a; else v7 = 404;
+  if (a > 405) v5 = v12 + a; else v8 = 405;
+  if (a > 406) v6 = v13 + a; else v9 = 406;
+  if (a > 407) v7 = v14 + a; else v10 = 407;
+  if (a > 408) v8 = v15 + a; else v11 = 408;
+  if (a > 409) v9 = v16 + a; else v12 = 409;
+  if (a > 410) v10 = v17 + a; else v13 = 410;
+  if (a > 411) v11 = v18 + a; else v14 = 411;
+  if (a > 412) v12 = v19 + a; else v15 = 412;
+  if (a > 413) v13 = v20 + a; else v16 = 413;
+  if (a > 414) v14 = v21 + a; else v17 = 414;
+  if (a > 415) v15 = v22 + a; else v18 = 415;
+  if (a > 416) v16 = v23 + a; else v19 = 416;
+  if (a > 417) v17 = v24 + a; else v20 = 417;
+  if (a > 418) v18 = v25 + a; else v21 = 418;
+  if (a > 419) v19 = v26 + a; else v22 = 419;
+  if (a > 420) v20 = v27 + a; else v23 = 420;
+  if (a > 421) v21 = v28 + a; else v24 = 421;
+  if (a > 422) v22 = v29 + a; else v25 = 422;
+  if (a > 423) v23 = v30 + a; else v26 = 423;
+  if (a > 424) v24 = v31 + a; else v27 = 424;
+  if (a > 425) v25 = v32 + a; else v28 = 425;
+  if (a > 426) v26 = v33 + a; else v29 = 426;
+  if (a > 427) v27 = v34 + a; else v30 = 427;
+  if (a > 428) v28 = v35 + a; else v31 = 428;
+  if (a > 429) v29 = v36 + a; else v32 = 429;
+  if (a > 430) v30 = v37 + a; else v33 = 430;
+  if (a > 431) v31 = v38 + a; else v34 = 431;
+  if (a > 432) v32 = v39 + a; else v35 = 432;
+  if (a > 433) v33 = v40 + a; else v36 = 433;
+  if (a > 434) v34 = v41 + a; else v37 = 434;
+  if (a > 435) v35 = v42 + a; else v38 = 435;
+  if (a > 436) v36 = v43 + a; else v39 = 436;
+  if (a > 437) v37 = v44 + a; else v40 = 437;
+  if (a > 438) v38 = v45 + a; else v41 = 438;
+  if (a > 439) v39 = v46 + a; else v42 = 439;
+  if (a > 440) v40 = v47 + a; else v43 = 440;
+  if (a > 441) v41 = v48 + a; else v44 = 441;
+  if (a > 442) v42 = v49 + a; else v45 = 442;
+  if (a > 443) v43 = v50 + a; else v46 = 443;
+  if (a > 444) v44 = v51 + a; else v47 = 444;
+  if (a > 445) v45 = v52 + a; else v48 = 445;
+  if (a > 446) v46 = v53 + a; else v49 = 446;
+  if (a > 447) v47 = v54 + a; else v50 = 447;
+  if (a > 448) v48 = v55 + a; else v51 = 448;
+  if (a > 449) v49 = v56 + a; else v52 = 449;
+  if (a > 450) v50 = v57 + a; else v53 = 450;
+  if (a > 451) v51 = v58 + a; else v54 = 451;
+  if (a > 452) v52 = v59 + a; else v55 = 452;
+  if (a > 453) v53 = v60 + a; else v56 = 453;
+  if (a > 454) v54 = v61 + a; else v57 = 454;
+  if (a > 455) v55 = v62 + a; else v58 = 455;
+  if (a > 456) v56 = v63 + a; else v59 = 456;
+  if (a > 457) v57 = v64 + a; else v60 = 457;
+  if (a > 458) v58 = v65 + a; else v61 = 458;
+  if (a > 459) v59 = v66 + a; else v62 = 459;
+  if (a > 460) v60 = v67 + a; else v63 = 460;
+  if (a > 461) v61 = v68 + a; else v64 = 461;
+  if (a > 462) v62 = v69 + a; else v65 = 462;
+  if (a > 463) v63 = v70 + a; else v66 = 463;
+  if (a > 464) v64 = v71 + a; else v67 = 464;
+  if (a > 465) v65 = v72 + a; else v68 = 465;
+  if (a > 466) v66 = v73 + a; else v69 = 466;
+  if (a > 467) v67 = v74 + a; else v70 = 467;
+  if (a > 468) v68 = v75 + a; else v71 = 468;
+  if (a > 469) v69 = v76 + a; else v72 = 469;
+  if (a > 470) v70 = v77 + a; else v73 = 470;
+  if (a > 471) v71 = v78 + a; else v74 = 471;
+  if (a > 472) v72 = v79 + a; else v75 = 472;
+  if (a > 473) v73 = v80 + a; else v76 = 473;
+  if (a > 474) v74 = v81 + a; else v77 = 474;
+  if (a > 475) v75 = v82 + a; else v78 = 475;
+  if (a > 476) v76 = v83 + a; else v79 = 476;
+  if (a > 477) v77 = v84 + a; else v80 = 477;
+  if (a > 478) v78 = v85 + a; else v81 = 478;
+  if (a > 479) v79 = v86 + a; else v82 = 479;
+  if (a > 480) v80 = v87 + a; else v83 = 480;
+  if (a > 481) v81 = v88 + a; else v84 = 481;
+  if (a > 482) v82 = v89 + a; else v85 = 482;
+  if (a > 483) v83 = v90 + a; else v86 = 483;
+  if (a > 484) v84 = v91 + a; else v87 = 484;
+  if (a > 485) v85 = v92 + a; else v88 = 485;
+  if (a > 486) v86 = v93 + a; else v89 = 486;
+  if (a > 487) v87 = v94 + a; else v90 = 487;
+  if (a > 488) v88 = v95 + a; else v91 = 488;
+  if (a > 489) v89 = v96 + a; else v92 = 489;
+  if (a > 490) v90 = v97 + a; else v93 = 490;
+  if (a > 491) v91 = v98 + a; else v94 = 491;
+  if (a > 492) v92 = v99 + a; else v95 = 492;
+  if (a > 493) v93 = v100 + a; else v96 = 493;
+  if (a > 494) v94 = v101 + a; else v97 = 494;
+  if (a > 495) v95 = v102 + a; else v98 = 495;
+  if (a > 496) v96 = v103 + a; else v99 = 496;
+  if (a > 497) v97 = v104 + a; else v100 = 497;
+  if (a > 498) v98 = v105 + a; else v101 = 498;
+  if (a > 499) v99 = v106 + a; else v102 = 499;
+  if (a > 500) v100 = v107 + a; else v103 = 500;
+  if (a > 501) v101 = v108 + a; else v104 = 501;
+  if (a > 502) v102 = v109 + a; else v105 = 502;
+  if (a > 503) v103 = v110 + a; else v106 = 503;
+  if (a > 504) v104 = v111 + a; else v107 = 504;
+  if (a > 505) v105 = v112 + a; else v108 = 505;
+  if (a > 506) v106 = v113 + a; else v109 = 506;
+  if (a > 507) v107 = v114 + a; else v110 = 507;
+  if (a > 508) v108 = v115 + a; else v111 = 508;
+  if (a > 509) v109 = v116 + a; else v112 = 509;
+  if (a > 510) v110 = v117 + a; else v113 = 510;
+  if (a > 511) v111 = v118 + a; else v114 = 511;
+  if (a > 512) v112 = v119 + a; else v115 = 512;
+  if (a > 513) v113 = v120 + a; else v116 = 513;
+  if (a > 514) v114 = v121 + a; else v117 = 514;
+  if (a > 515) v115 = v122 + a; else v118 = 515;
+  if (a > 516) v116 = v123 + a; else v119 = 516;
+  if (a > 517) v117 = v124 + a; else v120 = 517;
+  if (a > 518) v118 = v125 + a; else v121 = 518;
+  if (a > 519) v119 = v126 + a; else v122 = 519;
+  if (a > 520) v120 = v127 + a; else v123 = 520;
+  if (a > 521) v121 = v128 + a; else v124 = 521;
+  if (a > 522) v122 = v129 + a; else v125 = 522;
+  if (a > 523) v123 = v130 + a; else v126 = 523;
+  if (a > 524) v124 = v131 + a; else v127 = 524;
+  if (a > 525) v125 = v132 + a; else v128 = 525;
+  if (a > 526) v126 = v133 + a; else v129 = 526;
+  if (a > 527) v127 = v134 + a; else v130 = 527;
+  if (a > 528) v128 = v135 + a; else v131 = 528;
+  if (a > 529) v129 = v136 + a; else v132 = 529;
+  if (a > 530) v130 = v137 + a; else v133 = 530;
+  if (a > 531) v131 = v138 + a; else v134 = 531;
+  if (a > 532) v132 = v139 + a; else v135 = 532;
+  if (a > 533) v133 = v140 + a; else v136 = 533;
+  if (a > 534) v134 = v141 + a; else v137 = 534;
+  if (a > 535) v135 = v142 + a; else v138 = 535;
+  if (a > 536) v136 = v143 + a; else v139 = 536;
+  if (a > 537) v137 = v144 + a; else v140 = 537;
+  if (a > 538) v138 = v145 + a; else v141 = 538;
+  if (a > 539) v139 = v146 + a; else v142 = 539;
+  if (a > 540) v140 = v147 + a; else v143 = 540;
+  if (a > 541) v141 = v148 + a; else v144 = 541;
+  if (a > 542) v142 = v149 + a; else v145 = 542;
+  if (a > 543) v143 = v150 + a; else v146 = 543;
+  if (a > 544) v144 = v151 + a; else v147 = 544;
+  if (a > 545) v145 = v152 + a; else v148 = 545;
+  if (a > 546) v146 = v153 + a; else v149 = 546;
+  if (a > 547) v147 = v154 + a; else v150 = 547;
+  if (a > 548) v148 = v155 + a; else v151 = 548;
+  if (a > 549) v149 = v156 + a; else v152 = 549;
+  if (a > 550) v150 = v157 + a; else v153 = 550;
+  if (a > 551) v151 = v158 + a; else v154 = 551;
+  if (a > 552) v152 = v159 + a; else v155 = 552;
+  if (a > 553) v153 = v160 + a; else v156 = 553;
+  if (a > 554) v154 = v161 + a; else v157 = 554;
+  if (a > 555) v155 = v162 + a; else v158 = 555;
+  if (a > 556) v156 = v163 + a; else v159 = 556;
+  if (a > 557) v157 = v164 + a; else v160 = 557;
+  if (a > 558) v158 = v165 + a; else v161 = 558;
+  if (a > 559) v159 = v166 + a; else v162 = 559;
+  if (a > 560) v160 = v167 + a; else v163 = 560;
+  if (a > 561) v161 = v168 + a; else v164 = 561;
+  if (a > 562) v162 = v169 + a; else v165 = 562;
+  if (a > 563) v163 = v170 + a; else v166 = 563;
+  if (a > 564) v164 = v171 + a; else v167 = 564;
+  if (a > 565) v165 = v172 + a; else v168 = 565;
+  if (a > 566) v166 = v173 + a; else v169 = 566;
+  if (a > 567) v167 = v174 + a; else v170 = 567;
+  if (a > 568) v168 = v175 + a; else v171 = 568;
+  if (a > 569) v169 = v176 + a; else v172 = 569;
+  if (a > 570) v170 = v177 + a; else v173 = 570;
+  if (a > 571) v171 = v178 + a; else v174 = 571;
+  if (a > 572) v172 = v179 + a; else v175 = 572;
+  if (a > 573) v173 = v180 + a; else v176 = 573;
+  if (a > 574) v174 = v181 + a; else v177 = 574;
+  if (a > 575) v175 = v182 + a; else v178 = 575;
+  if (a > 576) v176 = v183 + a; else v179 = 576;
+  if (a > 577) v177 = v184 + a; else v180 = 577;
+  if (a > 578) v178 = v185 + a; else v181 = 578;
+  if (a > 579) v179 = v186 + a; else v182 = 579;
+  if (a > 580) v180 = v187 + a; else v183 = 580;
+  if (a > 581) v181 = v188 + a; else v184 = 581;
+  if (a > 582) v182 = v189 + a; else v185 = 582;
+  if (a > 583) v183 = v190 + a; else v186 = 583;
+  if (a > 584) v184 = v191 + a; else v187 = 584;
+  if (a > 585) v185 = v192 + a; else v188 = 585;
+  if (a > 586) v186 = v193 + a; else v189 = 586;
+  if (a > 587) v187 = v194 + a; else v190 = 587;
+  if (a > 588) v188 = v195 + a; else v191 = 588;
+  if (a > 589) v189 = v196 + a; else v192 = 589;
+  if (a > 590) v190 = v197 + a; else v193 = 590;
+  if (a > 591) v191 = v198 + a; else v194 = 591;
+  if (a > 592) v192 = v199 + a; else v195 = 592;
+  if (a > 593) v193 = v0 + a; else v196 = 593;
+  if (a > 594) v194 = v1 + a; else v197 = 594;
+  if (a > 595) v195 = v2 + a; else v198 = 595;
+  if (a > 596) v196 = v3 + a; else v199 = 596;
+  if (a > 597) v197 = v4 + a; else v0 = 597;
+  if (a > 598) v198 = v5 + a; else v1 = 598;
+  if (a > 599) v199 = v6 + a; else v2 = 599;
+  if (a > 600) v0 = v7 + a; else v3 = 600;
+  if (a > 601) v1 = v8 + a; else v4 = 601;
+  if (a > 602) v2 = v9 + a; else v5 = 602;
+  if (a > 603) v3 = v10 + a; else v6 = 603;
+  if (a > 604) v4 = v11 + a; else v7 = 604;
+  if (a > 605) v5 = v12 + a; else v8 = 605;
+  if (a > 606) v6 = v13 + a; else v9 = 606;
+  if (a > 607) v7 = v14 + a; else v10 = 607;
+  if (a > 608) v8 = v15 + a; else v11 = 608;
+  if (a > 609) v9 = v16 + a; else v12 = 609;
+  if (a > 610) v10 = v17 + a; else v13 = 610;
+  if (a > 611) v11 = v18 + a; else v14 = 611;
+  if (a > 612) v12 = v19 + a; else v15 = 612;
+  if (a > 613) v13 = v20 + a; else v16 = 613;
+  if (a > 614) v14 = v21 + a; else v17 = 614;
+  if (a > 615) v15 = v22 + a; else v18 = 615;
+  if (a > 616) v16 = v23 + a; else v19 = 616;
+  if (a > 617) v17 = v24 + a; else v20 = 617;
+  if (a > 618) v18 = v25 + a; else v21 = 618;
+  if (a > 619) v19 = v26 + a; else v22 = 619;
+  if (a > 620) v20 = v27 + a; else v23 = 620;
+  if (a > 621) v21 = v28 + a; else v24 = 621;
+  if (a > 622) v22 = v29 + a; else v25 = 622;
+  if (a > 623) v23 = v30 + a; else v26 = 623;
+  if (a > 624) v24 = v31 + a; else v27 = 624;
+  if (a > 625) v25 = v32 + a; else v28 = 625;
+  if (a > 626) v26 = v33 + a; else v29 = 626;
+  if (a > 627) v27 = v34 + a; else v30 = 627;
+  if (a > 628) v28 = v35 + a; else v31 = 628;
+  if (a > 629) v29 = v36 + a; else v32 = 629;
+  if (a > 630) v30 = v37 + a; else v33 = 630;
+  if (a > 631) v31 = v38 + a; else v34 = 631;
+  if (a > 632) v32 = v39 + a; else v35 = 632;
+  if (a > 633) v33 = v40 + a; else v36 = 633;
+  if (a > 634) v34 = v41 + a; else v37 = 634;
+  if (a > 635) v35 = v42 + a; else v38 = 635;
+  if (a > 636) v36 = v43 + a; else v39 = 636;
+  if (a > 637) v37 = v44 + a; else v40 = 637;
+  if (a > 638) v38 = v45 + a; else v41 = 638;
+  if (a > 639) v39 = v46 + a; else v42 = 639;
+  if (a > 640) v40 = v47 + a; else v43 = 640;
+  if (a > 641) v41 = v48 + a; else v44 = 641;
+  if (a > 642) v42 = v49 + a; else v45 = 642;
+  if (a > 643) v43 = v50 + a; else v46 = 643;
+  if (a > 644) v44 = v51 + a; else v47 = 644;
+  if (a > 645) v45 = v52 + a; else v48 = 645;
+  if (a > 646) v46 = v53 + a; else v49 = 646;
+  if (a > 647) v47 = v54 + a; else v50 = 647;
+  if (a > 648) v48 = v55 + a; else v51 = 648;
+  if (a > 649) v49 = v56 + a; else v52 = 649;
+  if (a > 650) v50 = v57 + a; else v53 = 650;
+  if (a > 651) v51 = v58 + a; else v54 = 651;
+  if (a > 652) v52 = v59 + a; else v55 = 652;
+  if (a > 653) v53 = v60 + a; else v56 = 653;
+  if (a > 654) v54 = v61 + a; else v57 = 654;
+  if (a > 655) v55 = v62 + a; else v58 = 655;
+  if (a > 656) v56 = v63 + a; else v59 = 656;
+  if (a > 657) v57 = v64 + a; else v60 = 657;
+  if (a > 658) v58 = v65 + a; else v61 = 658;
+  if (a > 659) v59 = v66 + a; else v62 = 659;
+  if (a > 660) v60 = v67 + a; else v63 = 660;
+  if (a > 661) v61 = v68 + a; else v64 = 661;
+  if (a > 662) v62 = v69 + a; else v65 = 662;
+  if (a > 663) v63 = v70 + a; else v66 = 663;
+  if (a > 664) v64 = v71 + a; else v67 = 664;
+  if (a > 665) v65 = v72 + a; else v68 = 665;
+  if (a > 666) v66 = v73 + a; else v69 = 666;
+  if (a > 667) v67 = v74 + a; else v70 = 667;
+  if (a > 668) v68 = v75 + a; else v71 = 668;
+  if (a > 669) v69 = v76 + a; else v72 = 669;
+  if (a > 670) v70 = v77 + a; else v73 = 670;
+  if (a > 671) v71 = v78 + a; else v74 = 671;
+  if (a > 672) v72 = v79 + a; else v75 = 672;
+  if (a > 673) v73 = v80 + a; else v76 = 673;
+  if (a > 674) v74 = v81 + a; else v77 = 674;
+  if (a > 675) v75 = v82 + a; else v78 = 675;
+  if (a > 676) v76 = v83 + a; else v79 = 676;
+  if (a > 677) v77 = v84 + a; else v80 = 677;
+  if (a > 678) v78 = v85 + a; else v81 = 678;
+  if (a > 679) v79 = v86 + a; else v82 = 679;
+  if (a > 680) v80 = v87 + a; else v83 = 680;
+  if (a > 681) v81 = v88 + a; else v84 = 681;
+  if (a > 682) v82 = v89 + a; else v85 = 682;
+  if (a > 683) v83 = v90 + a; else v86 = 683;
+  if (a > 684) v84 = v91 + a; else v87 = 684;
+  if (a > 685) v85 = v92 + a; else v88 = 685;
+  if (a > 686) v86 = v93 + a; else v89 = 686;
+  if (a > 687) v87 = v94 + a; else v90 = 687;
+  if (a > 688) v88 = v95 + a; else v91 = 688;
+  if (a > 689) v89 = v96 + a; else v92 = 689;
+  if (a > 690) v90 = v97 + a; else v93 = 690;
+  if (a > 691) v91 = v98 + a; else v94 = 691;
+  if (a > 692) v92 = v99 + a; else v95 = 692;
+  if (a > 693) v93 = v100 + a; else v96 = 693;
+  if (a > 694) v94 = v101 + a; else v97 = 694;
+  if (a > 695) v95 = v102 + a; else v98 = 695;
+  if (a > 696) v96 = v103 + a; else v99 = 696;
+  if (a > 697) v97 = v104 + a; else v100 = 697;
+  if (a > 698) v98 = v105 + a; else v101 = 698;
+  if (a > 699) v99 = v106 + a; else v102 = 699;
+  if (a > 700) v100 = v107 + a; else v103 = 700;
+  if (a > 701) v101 = v108 + a; else v104 = 701;
+  if (a > 702) v102 = v109 + a; else v105 = 702;
+  if (a > 703) v103 = v110 + a; else v106 = 703;
+  if (a > 704) v104 = v111 + a; else v107 = 704;
+  if (a > 705) v105 = v112 + a; else v108 = 705;
+  if (a > 706) v106 = v113 + a; else v109 = 706;
+  if (a > 707) v107 = v114 + a; else v110 = 707;
+  if (a > 708) v108 = v115 + a; else v111 = 708;
+  if (a > 709) v109 = v116 + a; else v112 = 709;
+  if (a > 710) v110 = v117 + a; else v113 = 710;
+  if (a > 711) v111 = v118 + a; else v114 = 711;
+  if (a > 712) v112 = v119 + a; else v115 = 712;
+  if (a > 713) v113 = v120 + a; else v116 = 713;
+  if (a > 714) v114 = v121 + a; else v117 = 714;
+  if (a > 715) v115 = v122 + a; else v118 = 715;
+  if (a > 716) v116 = v123 + a; else v119 = 716;
+  if (a > 717) v117 = v124 + a; else v120 = 717;
+  if (a > 718) v118 = v125 + a; else v121 = 718;
+  if (a > 719) v119 = v126 + a; else v122 = 719;
+  if (a > 720) v120 = v127 + a; else v123 = 720;
+  if (a > 721) v121 = v128 + a; else v124 = 721;
+  if (a > 722) v122 = v129 + a; else v125 = 722;
+  if (a > 723) v123 = v130 + a; else v126 = 723;
+  if (a > 724) v124 = v131 + a; else v127 = 724;
+  if (a > 725) v125 = v132 + a; else v128 = 725;
+  if (a > 726) v126 = v133 + a; else v129 = 726;
+  if (a > 727) v127 = v134 + a; else v130 = 727;
+  if (a > 728) v128 = v135 + a; else v131 = 728;
+  if (a > 729) v129 = v136 + a; else v132 = 729;
+  if (a > 730) v130 = v137 + a; else v133 = 730;
+  if (a > 731) v131 = v138 + a; else v134 = 731;
+  if (a > 732) v132 = v139 + a; else v135 = 732;
+  if (a > 733) v133 = v140 + a; else v136 = 733;
+  if (a > 734) v134 = v141 + a; else v137 = 734;
+  if (a > 735) v135 = v142 + a; else v138 = 735;
+  if (a > 736) v136 = v143 + a; else v139 = 736;
+  if (a > 737) v137 = v144 + a; else v140 = 737;
+  if (a > 738) v138 = v145 + a; else v141 = 738;
+  if (a > 739) v139 = v146 + a; else v142 = 739;
+  if (a > 740) v140 = v147 + a; else v143 = 740;
+  if (a > 741) v141 = v148 + a; else v144 = 741;
+  if (a > 742) v142 = v149 + a; else v145 = 742;
+  if (a > 743) v143 = v150 + a; else v146 = 743;
+  if (a > 744) v144 = v151 + a; else v147 = 744;
+  if (a > 745) v145 = v152 + a; else v148 = 745;
+  if (a > 746) v146 = v153 + a; else v149 = 746;
+  if (a > 747) v147 = v154 + a; else v150 = 747;
+  if (a > 748) v148 = v155 + a; else v151 = 748;
+  if (a > 749) v149 = v156 + a; else v152 = 749;
+  if (a > 750) v150 = v157 + a; else v153 = 750;
+  if (a > 751) v151 = v158 + a; else v154 = 751;
+  if (a > 752) v152 = v159 + a; else v155 = 752;
+  if (a > 753) v153 = v160 + a; else v156 = 753;
+  if (a > 754) v154 = v161 + a; else v157 = 754;
+  if (a > 755) v155 = v162 + a; else v158 = 755;
+  if (a > 756) v156 = v163 + a; else v159 = 756;
+  if (a > 757) v157 = v164 + a; else v160 = 757;
+  if (a > 758) v158 = v165 + a; else v161 = 758;
+  if (a > 759) v159 = v166 + a; else v162 = 759;
+  if (a > 760) v160 = v167 + a; else v163 = 760;
+  if (a > 761) v161 = v168 + a; else v164 = 761;
+  if (a > 762) v162 = v169 + a; else v165 = 762;
+  if (a > 763) v163 = v170 + a; else v166 = 763;
+  if (a > 764) v164 = v171 + a; else v167 = 764;
+  if (a > 765) v165 = v172 + a; else v168 = 765;
+  if (a > 766) v166 = v173 + a; else v169 = 766;
+  if (a > 767) v167 = v174 + a; else v170 = 767;
+  if (a > 768) v168 = v175 + a; else v171 = 768;
+  if (a > 769) v169 = v176 + a; else v172 = 769;
+  if (a > 770) v170 = v177 + a; else v173 = 770;
+  if (a > 771) v171 = v178 + a; else v174 = 771;
+  if (a > 772) v172 = v179 + a; else v175 = 772;
+  if (a > 773) v173 = v180 + a; else v176 = 773;
+  if (a > 774) v174 = v181 + a; else v177 = 774;
+  if (a > 775) v175 = v182 + a; else v178 = 775;
+  if (a > 776) v176 = v183 + a; else v179 = 776;
+  if (a > 777) v177 = v184 + a; else v180 = 777;
+  if (a > 778) v178 = v185 + a; else v181 = 778;
+  if (a > 779) v179 = v186 + a; else v182 = 779;
+  if (a > 780) v180 = v187 + a; else v183 = 780;
+  if (a > 781) v181 = v188 + a; else v184 = 781;
+  if (a > 782) v182 = v189 + a; else v185 = 782;
+  if (a > 783) v183 = v190 + a; else v186 = 783;
+  if (a > 784) v184 = v191 + a; else v187 = 784;
+  if (a > 785) v185 = v192 + a; else v188 = 785;
+  if (a > 786) v186 = v193 + a; else v189 = 786;
+  if (a > 787) v187 = v194 + a; else v190 = 787;
+  if (a > 788) v188 = v195 + a; else v191 = 788;
+  if (a > 789) v189 = v196 + a; else v192 = 789;
+  if (a > 790) v190 = v197 + a; else v193 = 790;
+  if (a > 791) v191 = v198 + a; else v194 = 791;
+  if (a > 792) v192 = v199 + a; else v195 = 792;
+  if (a > 793) v193 = v0 + a; else v196 = 793;
+  if (a > 794) v194 = v1 + a; else v197 = 794;
+  if (a > 795) v195 = v2 + a; else v198 = 795;
+  if (a > 796) v196 = v3 + a; else v199 = 796;
+  if (a > 797) v197 = v4 + a; else v0 = 797;
+  if (a > 798) v198 = v5 + a; else v1 = 798;
+  if (a > 799) v199 = v6 + a; else v2 = 799;
+  if (a > 800) v0 = v7 + a; else v3 = 800;
+  if (a > 801) v1 = v8 + a; else v4 = 801;
+  if (a > 802) v2 = v9 + a; else v5 = 802;
+  if (a > 803) v3 = v10 + a; else v6 = 803;
+  if (a > 804) v4 = v11 + a; else v7 = 804;
+  if (a > 805) v5 = v12 + a; else v8 = 805;
+  if (a > 806) v6 = v13 + a; else v9 = 806;
+  if (a > 807) v7 = v14 + a; else v10 = 807;
+  if (a > 808) v8 = v15 + a; else v11 = 808;
+  if (a > 809) v9 = v16 + a; else v12 = 809;
+  if (a > 810) v10 = v17 + a; else v13 = 810;
+  if (a > 811) v11 = v18 + a; else v14 = 811;
+  if (a > 812) v12 = v19 + a; else v15 = 812;
+  if (a > 813) v13 = v20 + a; else v16 = 813;
+  if (a > 814) v14 = v21 + a; else v17 = 814;
+  if (a > 815) v15 = v22 + a; else v18 = 815;
+  if (a > 816) v16 = v23 + a; else v19 = 816;
+  if (a > 817) v17 = v24 + a; else v20 = 817;
+  if (a > 818) v18 = v25 + a; else v21 = 818;
+  if (a > 819) v19 = v26 + a; else v22 = 819;
+  if (a > 820) v20 = v27 + a; else v23 = 820;
+  if (a > 821) v21 = v28 + a; else v24 = 821;
+  if (a > 822) v22 = v29 + a; else v25 = 822;
+  if (a > 823) v23 = v30 + a; else v26 = 823;
+  if (a > 824) v24 = v31 + a; else v27 = 824;
+  if (a > 825) v25 = v32 + a; else v28 = 825;
+  if (a > 826) v26 = v33 + a; else v29 = 826;
+  if (a > 827) v27 = v34 + a; else v30 = 827;
+  if (a > 828) v28 = v35 + a; else v31 = 828;
+  if (a > 829) v29 = v36 + a; else v32 = 829;
+  if (a > 830) v30 = v37 + a; else v33 = 830;
+  if (a > 831) v31 = v38 + a; else v34 = 831;
+  if (a > 832) v32 = v39 + a; else v35 = 832;
+  if (a > 833) v33 = v40 + a; else v36 = 833;
+  if (a > 834) v34 = v41 + a; else v37 = 834;
+  if (a > 835) v35 = v42 + a; else v38 = 835;
+  if (a > 836) v36 = v43 + a; else v39 = 836;
+  if (a > 837) v37 = v44 + a; else v40 = 837;
+  if (a > 838) v38 = v45 + a; else v41 = 838;
+  if (a > 839) v39 = v46 + a; else v42 = 839;
+  if (a > 840) v40 = v47 + a; else v43 = 840;
+  if (a > 841) v41 = v48 + a; else v44 = 841;
+  if (a > 842) v42 = v49 + a; else v45 = 842;
+  if (a > 843) v43 = v50 + a; else v46 = 843;
+  if (a > 844) v44 = v51 + a; else v47 = 844;
+  if (a > 845) v45 = v52 + a; else v48 = 845;
+  if (a > 846) v46 = v53 + a; else v49 = 846;
+  if (a > 847) v47 = v54 + a; else v50 = 847;
+  if (a > 848) v48 = v55 + a; else v51 = 848;
+  if (a > 849) v49 = v56 + a; else v52 = 849;
+  if (a > 850) v50 = v57 + a; else v53 = 850;
+  if (a > 851) v51 = v58 + a; else v54 = 851;
+  if (a > 852) v52 = v59 + a; else v55 = 852;
+  if (a > 853) v53 = v60 + a; else v56 = 853;
+  if (a > 854) v54 = v61 + a; else v57 = 854;
+  if (a > 855) v55 = v62 + a; else v58 = 855;
+  if (a > 856) v56 = v63 + a; else v59 = 856;
+  if (a > 857) v57 = v64 + a; else v60 = 857;
+  if (a > 858) v58 = v65 + a; else v61 = 858;
+  if (a > 859) v59 = v66 + a; else v62 = 859;
+  if (a > 860) v60 = v67 + a; else v63 = 860;
+  if (a > 861) v61 = v68 + a; else v64 = 861;
+  if (a > 862) v62 = v69 + a; else v65 = 862;
+  if (a > 863) v63 = v70 + a; else v66 = 863;
+  if (a > 864) v64 = v71 + a; else v67 = 864;
+  if (a > 865) v65 = v72 + a; else v68 = 865;
+  if (a > 866) v66 = v73 + a; else v69 = 866;
+  if (a > 867) v67 = v74 + a; else v70 = 867;
+  if (a > 868) v68 = v75 + a; else v71 = 868;
+  if (a > 869) v69 = v76 + a; else v72 = 869;
+  if (a > 870) v70 = v77 + a; else v73 = 870;
+  if (a > 871) v71 = v78 + a; else v74 = 871;
+  if (a > 872) v72 = v79 + a; else v75 = 872;
+  if (a > 873) v73 = v80 + a; else v76 = 873;
+  if (a > 874) v74 = v81 + a; else v77 = 874;
+  if (a > 875) v75 = v82 + a; else v78 = 875;
+  if (a > 876) v76 = v83 + a; else v79 = 876;
+  if (a > 877) v77 = v84 + a; else v80 = 877;
+  if (a > 878) v78 = v85 + a; else v81 = 878;
+  if (a > 879) v79 = v86 + a; else v82 = 879;
+  if (a > 880) v80 = v87 + a; else v83 = 880;
+  if (a > 881) v81 = v88 + a; else v84 = 881;
+  if (a > 882) v82 = v89 + a; else v85 = 882;
+  if (a > 883) v83 = v90 + a; else v86 = 883;
+  if (a > 884) v84 = v91 + a; else v87 = 884;
+  if (a > 885) v85 = v92 + a; else v88 = 885;
+  if (a > 886) v86 = v93 + a; else v89 = 886;
+  if (a > 887) v87 = v94 + a; else v90 = 887;
+  if (a > 888) v88 = v95 + a; else v91 = 888;
+  if (a > 889) v89 = v96 + a; else v92 = 889;
+  if (a > 890) v90 = v97 + a; else v93 = 890;
+  if (a > 891) v91 = v98 + a; else v94 = 891;
+  if (a > 892) v92 = v99 + a; else v95 = 892;
+  if (a > 893) v93 = v100 + a; else v96 = 893;
+  if (a > 894) v94 = v101 + a; else v97 = 894;
+  if (a > 895) v95 = v102 + a; else v98 = 895;
+  if (a > 896) v96 = v103 + a; else v99 = 896;
+  if (a > 897) v97 = v104 + a; else v100 = 897;
+  if (a > 898) v98 = v105 + a; else v101 = 898;
+  if (a > 899) v99 = v106 + a; else v102 = 899;
+  if (a > 900) v100 = v107 + a; else v103 = 900;
+  if (a > 901) v101 = v108 + a; else v104 = 901;
+  if (a > 902) v102 = v109 + a; else v105 = 902;
+  if (a > 903) v103 = v110 + a; else v106 = 903;
+  if (a > 904) v104 = v111 + a; else v107 = 904;
+  if (a > 905) v105 = v112 + a; else v108 = 905;
+  if (a > 906) v106 = v113 + a; else v109 = 906;
+  if (a > 907) v107 = v114 + a; else v110 = 907;
+  if (a > 908) v108 = v115 + a; else v111 = 908;
+  if (a > 909) v109 = v116 + a; else v112 = 909;
+  if (a > 910) v110 = v117 + a; else v113 = 910;
+  if (a > 911) v111 = v118 + a; else v114 = 911;
+  if (a > 912) v112 = v119 + a; else v115 = 912;
+  if (a > 913) v113 = v120 + a; else v116 = 913;
+  if (a > 914) v114 = v121 + a; else v117 = 914;
+  if (a > 915) v115 = v122 + a; else v118 = 915;
+  if (a > 916) v116 = v123 + a; else v119 = 916;
+  if (a > 917) v117 = v124 + a; else v120 = 917;
+  if (a > 918) v118 = v125 + a; else v121 = 918;
+  if (a > 919) v119 = v126 + a; else v122 = 919;
+  if (a > 920) v120 = v127 + a; else v123 = 920;
+  if (a > 921) v121 = v128 + a; else v124 = 921;
+  if (a > 922) v122 = v129 + a; else v125 = 922;
+  if (a > 923) v123 = v130 + a; else v126 = 923;
+  if (a > 924) v124 = v131 + a; else v127 = 924;
+  if (a > 925) v125 = v132 + a; else v128 = 925;
+  if (a > 926) v126 = v133 + a; else v129 = 926;
+  if (a > 927) v127 = v134 + a; else v130 = 927;
+  if (a > 928) v128 = v135 + a; else v131 = 928;
+  if (a > 929) v129 = v136 + a; else v132 = 929;
+  if (a > 930) v130 = v137 + a; else v133 = 930;
+  if (a > 931) v131 = v138 + a; else v134 = 931;
+  if (a > 932) v132 = v139 + a; else v135 = 932;
+  if (a > 933) v133 = v140 + a; else v136 = 933;
+  if (a > 934) v134 = v141 + a; else v137 = 934;
+  if (a > 935) v135 = v142 + a; else v138 = 935;
+  if (a > 936) v136 = v143 + a; else v139 = 936;
+  if (a > 937) v137 = v144 + a; else v140 = 937;
+  if (a > 938) v138 = v145 + a; else v141 = 938;
+  if (a > 939) v139 = v146 + a; else v142 = 939;
+  if (a > 940) v140 = v147 + a; else v143 = 940;
+  if (a > 941) v141 = v148 + a; else v144 = 941;
+  if (a > 942) v142 = v149 + a; else v145 = 942;
+  if (a > 943) v143 = v150 + a; else v146 = 943;
+  if (a > 944) v144 = v151 + a; else v147 = 944;
+  if (a > 945) v145 = v152 + a; else v148 = 945;
+  if (a > 946) v146 = v153 + a; else v149 = 946;
+  if (a > 947) v147 = v154 + a; else v150 = 947;
+  if (a > 948) v148 = v155 + a; else v151 = 948;
+  if (a > 949) v149 = v156 + a; else v152 = 949;
+  if (a > 950) v150 = v157 + a; else v153 = 950;
+  if (a > 951) v151 = v158 + a; else v154 = 951;
+  if (a > 952) v152 = v159 + a; else v155 = 952;
+  if (a > 953) v153 = v160 + a; else v156 = 953;
+  if (a > 954) v154 = v161 + a; else v157 = 954;
+  if (a > 955) v155 = v162 + a; else v158 = 955;
+  if (a > 956) v156 = v163 + a; else v159 = 956;
+  if (a > 957) v157 = v164 + a; else v160 = 957;
+  if (a > 958) v158 = v165 + a; else v161 = 958;
+  if (a > 959) v159 = v166 + a; else v162 = 959;
+  if (a > 960) v160 = v167 + a; else v163 = 960;
+  if (a > 961) v161 = v168 + a; else v164 = 961;
+  if (a > 962) v162 = v169 + a; else v165 = 962;
+  if (a > 963) v163 = v170 + a; else v166 = 963;
+  if (a > 964) v164 = v171 + a; else v167 = 964;
+  if (a > 965) v165 = v172 + a; else v168 = 965;
+  if (a > 966) v166 = v173 + a; else v169 = 966;
+  if (a > 967) v167 = v174 + a; else v170 = 967;
+  if (a > 968) v168 = v175 + a; else v171 = 968;
+  if (a > 969) v169 = v176 + a; else v172 = 969;
+  if (a > 970) v170 = v177 + a; else v173 = 970;
+  if (a > 971) v171 = v178 + a; else v174 = 971;
+  if (a > 972) v172 = v179 + a; else v175 = 972;
+  if (a > 973) v173 = v180 + a; else v176 = 973;
+  if (a > 974) v174 = v181 + a; else v177 = 974;
+  if (a > 975) v175 = v182 + a; else v178 = 975;
+  if (a > 976) v176 = v183 + a; else v179 = 976;
+  if (a > 977) v177 = v184 + a; else v180 = 977;
+  if (a > 978) v178 = v185 + a; else v181 = 978;
+  if (a > 979) v179 = v186 + a; else v182 = 979;
+  if (a > 980) v180 = v187 + a; else v183 = 980;
+  if (a > 981) v181 = v188 + a; else v184 = 981;
+  if (a > 982) v182 = v189 + a; else v185 = 982;
+  if (a > 983) v183 = v190 + a; else v186 = 983;
+  if (a > 984) v184 = v191 + a; else v187 = 984;
+  if (a > 985) v185 = v192 + a; else v188 = 985;
+  if (a > 986) v186 = v193 + a; else v189 = 986;
+  if (a > 987) v187 = v194 + a; else v190 = 987;
+  if (a > 988) v188 = v195 + a; else v191 = 988;
+  if (a > 989) v189 = v196 + a; else v192 = 989;
+  if (a > 990) v190 = v197 + a; else v193 = 990;
+  if (a > 991) v191 = v198 + a; else v194 = 991;
+  if (a > 992) v192 = v199 + a; else v195 = 992;
+  if (a > 993) v193 = v0 + a; else v196 = 993;
+  if (a > 994) v194 = v1 + a; else v197 = 994;
+  if (a > 995) v195 = v2 + a; else v198 = 995;
+  if (a > 996) v196 = v3 + a; else v199 = 996;
+  if (a > 997) v197 = v4 + a; else v0 = 997;
+  if (a > 998) v198 = v5 + a; else v1 = 998;
+  if (a > 999) v199 = v6 + a; else v2 = 999;
+  if (a > 1000) v0 = v7 + a; else v3 = 1000;
+  if (a > 1001) v1 = v8 + a; else v4 = 1001;
+  if (a > 1002) v2 = v9 + a; else v5 = 1002;
+  if (a > 1003) v3 = v10 + a; else v6 = 1003;
+  if (a > 1004) v4 = v11 + a; else v7 = 1004;
+  if (a > 1005) v5 = v12 + a; else v8 = 1005;
+  if (a > 1006) v6 = v13 + a; else v9 = 1006;
+  if (a > 1007) v7 = v14 + a; else v10 = 1007;
+  if (a > 1008) v8 = v15 + a; else v11 = 1008;
+  if (a > 1009) v9 = v16 + a; else v12 = 1009;
+  if (a > 1010) v10 = v17 + a; else v13 = 1010;
+  if (a > 1011) v11 = v18 + a; else v14 = 1011;
+  if (a > 1012) v12 = v19 + a; else v15 = 1012;
+  if (a > 1013) v13 = v20 + a; else v16 = 1013;
+  if (a > 1014) v14 = v21 + a; else v17 = 1014;
+  if (a > 1015) v15 = v22 + a; else v18 = 1015;
+  if (a > 1016) v16 = v23 + a; else v19 = 1016;
+  if (a > 1017) v17 = v24 + a; else v20 = 1017;
+  if (a > 1018) v18 = v25 + a; else v21 = 1018;
+  if (a > 1019) v19 = v26 + a; else v22 = 1019;
+  if (a > 1020) v20 = v27 + a; else v23 = 1020;
+  if (a > 1021) v21 = v28 + a; else v24 = 1021;
+  if (a > 1022) v22 = v29 + a; else v25 = 1022;
+  if (a > 1023) v23 = v30 + a; else v26 = 1023;
+  if (a > 1024) v24 = v31 + a; else v27 = 1024;
+  if (a > 1025) v25 = v32 + a; else v28 = 1025;
+  if (a > 1026) v26 = v33 + a; else v29 = 1026;
+  if (a > 1027) v27 = v34 + a; else v30 = 1027;
+  if (a > 1028) v28 = v35 + a; else v31 = 1028;
+  if (a > 1029) v29 = v36 + a; else v32 = 1029;
+  if (a > 1030) v30 = v37 + a; else v33 = 1030;
+  if (a > 1031) v31 = v38 + a; else v34 = 1031;
+  if (a > 1032) v32 = v39 + a; else v35 = 1032;
+  if (a > 1033) v33 = v40 + a; else v36 = 1033;
+  if (a > 1034) v34 = v41 + a; else v37 = 1034;
+  if (a > 1035) v35 = v42 + a; else v38 = 1035;
+  if (a > 1036) v36 = v43 + a; else v39 = 1036;
+  if (a > 1037) v37 = v44 + a; else v40 = 1037;
+  if (a > 1038) v38 = v45 + a; else v41 = 1038;
+  if (a > 1039) v39 = v46 + a; else v42 = 1039;
+  if (a > 1040) v40 = v47 + a; else v43 = 1040;
+  if (a > 1041) v41 = v48 + a; else v44 = 1041;
+  if (a > 1042) v42 = v49 + a; else v45 = 1042;
+  if (a > 1043) v43 = v50 + a; else v46 = 1043;
+  if (a > 1044) v44 = v51 + a; else v47 = 1044;
+  if (a > 1045) v45 = v52 + a; else v48 = 1045;
+  if (a > 1046) v46 = v53 + a; else v49 = 1046;
+  if (a > 1047) v47 = v54 + a; else v50 = 1047;
+  if (a > 1048) v48 = v55 + a; else v51 = 1048;
+  if (a > 1049) v49 = v56 + a; else v52 = 1049;
+  if (a > 1050) v50 = v57 + a; else v53 = 1050;
+  if (a > 1051) v51 = v58 + a; else v54 = 1051;
+  if (a > 1052) v52 = v59 + a; else v55 = 1052;
+  if (a > 1053) v53 = v60 + a; else v56 = 1053;
+  if (a > 1054) v54 = v61 + a; else v57 = 1054;
+  if (a > 1055) v55 = v62 + a; else v58 = 1055;
+  if (a > 1056) v56 = v63 + a; else v59 = 1056;
+  if (a > 1057) v57 = v64 + a; else v60 = 1057;
+  if (a > 1058) v58 = v65 + a; else v61 = 1058;
+  if (a > 1059) v59 = v66 + a; else v62 = 1059;
+  if (a > 1060) v60 = v67 + a; else v63 = 1060;
+  if (a > 1061) v61 = v68 + a; else v64 = 1061;
+  if (a > 1062) v62 = v69 + a; else v65 = 1062;
+  if (a > 1063) v63 = v70 + a; else v66 = 1063;
+  if (a > 1064) v64 = v71 + a; else v67 = 1064;
+  if (a > 1065) v65 = v72 + a; else v68 = 1065;
+  if (a > 1066) v66 = v73 + a; else v69 = 1066;
+  if (a > 1067) v67 = v74 + a; else v70 = 1067;
+  if (a > 1068) v68 = v75 + a; else v71 = 1068;
+  if (a > 1069) v69 = v76 + a; else v72 = 1069;
+  if (a > 1070) v70 = v77 + a; else v73 = 1070;
+  if (a > 1071) v71 = v78 + a; else v74 = 1071;
+  if (a > 1072) v72 = v79 + a; else v75 = 1072;
+  if (a > 1073) v73 = v80 + a; else v76 = 1073;
+  if (a > 1074) v74 = v81 + a; else v77 = 1074;
+  if (a > 1075) v75 = v82 + a; else v78 = 1075;
+  if (a > 1076) v76 = v83 + a; else v79 = 1076;
+  if (a > 1077) v77 = v84 + a; else v80 = 1077;
+  if (a > 1078) v78 = v85 + a; else v81 = 1078;
+  if (a > 1079) v79 = v86 + a; else v82 = 1079;
+  if (a > 1080) v80 = v87 + a; else v83 = 1080;
+  if (a > 1081) v81 = v88 + a; else v84 = 1081;
+  if (a > 1082) v82 = v89 + a; else v85 = 1082;
+  if (a > 1083) v83 = v90 + a; else v86 = 1083;
+  if (a > 1084) v84 = v91 + a; else v87 = 1084;
+  if (a > 1085) v85 = v92 + a; else v88 = 1085;
+  if (a > 1086) v86 = v93 + a; else v89 = 1086;
+  if (a > 1087) v87 = v94 + a; else v90 = 1087;
+  if (a > 1088) v88 = v95 + a; else v91 = 1088;
+  if (a > 1089) v89 = v96 + a; else v92 = 1089;
+  if (a > 1090) v90 = v97 + a; else v93 = 1090;
+  if (a > 1091) v91 = v98 + a; else v94 = 1091;
+  if (a > 1092) v92 = v99 + a; else v95 = 1092;
+  if (a > 1093) v93 = v100 + a; else v96 = 1093;
+  if (a > 1094) v94 = v101 + a; else v97 = 1094;
+  if (a > 1095) v95 = v102 + a; else v98 = 1095;
+  if (a > 1096) v96 = v103 + a; else v99 = 1096;
+  if (a > 1097) v97 = v104 + a; else v100 = 1097;
+  if (a > 1098) v98 = v105 + a; else v101 = 1098;
+  if (a > 1099) v99 = v106 + a; else v102 = 1099;
+  if (a > 1100) v100 = v107 + a; else v103 = 1100;
+  if (a > 1101) v101 = v108 + a; else v104 = 1101;
+  if (a > 1102) v102 = v109 + a; else v105 = 1102;
+  if (a > 1103) v103 = v110 + a; else v106 = 1103;
+  if (a > 1104) v104 = v111 + a; else v107 = 1104;
+  if (a > 1105) v105 = v112 + a; else v108 = 1105;
+  if (a > 1106) v106 = v113 + a; else v109 = 1106;
+  if (a > 1107) v107 = v114 + a; else v110 = 1107;
+  if (a > 1108) v108 = v115 + a; else v111 = 1108;
+  if (a > 1109) v109 = v116 + a; else v112 = 1109;
+  if (a > 1110) v110 = v117 + a; else v113 = 1110;
+  if (a > 1111) v111 = v118 + a; else v114 = 1111;
+  if (a > 1112) v112 = v119 + a; else v115 = 1112;
+  if (a > 1113) v113 = v120 + a; else v116 = 1113;
+  if (a > 1114) v114 = v121 + a; else v117 = 1114;
+  if (a > 1115) v115 = v122 + a; else v118 = 1115;
+  if (a > 1116) v116 = v123 + a; else v119 = 1116;
+  if (a > 1117) v117 = v124 + a; else v120 = 1117;
+  if (a > 1118) v118 = v125 + a; else v121 = 1118;
+  if (a > 1119) v119 = v126 + a; else v122 = 1119;
+  if (a > 1120) v120 = v127 + a; else v123 = 1120;
+  if (a > 1121) v121 = v128 + a; else v124 = 1121;
+  if (a > 1122) v122 = v129 + a; else v125 = 1122;
+  if (a > 1123) v123 = v130 + a; else v126 = 1123;
+  if (a > 1124) v124 = v131 + a; else v127 = 1124;
+  if (a > 1125) v125 = v132 + a; else v128 = 1125;
+  if (a > 1126) v126 = v133 + a; else v129 = 1126;
+  if (a > 1127) v127 = v134 + a; else v130 = 1127;
+  if (a > 1128) v128 = v135 + a; else v131 = 1128;
+  if (a > 1129) v129 = v136 + a; else v132 = 1129;
+  if (a > 1130) v130 = v137 + a; else v133 = 1130;
+  if (a > 1131) v131 = v138 + a; else v134 = 1131;
+  if (a > 1132) v132 = v139 + a; else v135 = 1132;
+  if (a > 1133) v133 = v140 + a; else v136 = 1133;
+  if (a > 1134) v134 = v141 + a; else v137 = 1134;
+  if (a > 1135) v135 = v142 + a; else v138 = 1135;
+  if (a > 1136) v136 = v143 + a; else v139 = 1136;
+  if (a > 1137) v137 = v144 + a; else v140 = 1137;
+  if (a > 1138) v138 = v145 + a; else v141 = 1138;
+  if (a > 1139) v139 = v146 + a; else v142 = 1139;
+  if (a > 1140) v140 = v147 + a; else v143 = 1140;
+  if (a > 1141) v141 = v148 + a; else v144 = 1141;
+  if (a > 1142) v142 = v149 + a; else v145 = 1142;
+  if (a > 1143) v143 = v150 + a; else v146 = 1143;
+  if (a > 1144) v144 = v151 + a; else v147 = 1144;
+  if (a > 1145) v145 = v152 + a; else v148 = 1145;
+  if (a > 1146) v146 = v153 + a; else v149 = 1146;
+  if (a > 1147) v147 = v154 + a; else v150 = 1147;
+  if (a > 1148) v148 = v155 + a; else v151 = 1148;
+  if (a > 1149) v149 = v156 + a; else v152 = 1149;
+  if (a > 1150) v150 = v157 + a; else v153 = 1150;
+  if (a > 1151) v151 = v158 + a; else v154 = 1151;
+  if (a > 1152) v152 = v159 + a; else v155 = 1152;
+  if (a > 1153) v153 = v160 + a; else v156 = 1153;
+  if (a > 1154) v154 = v161 + a; else v157 = 1154;
+  if (a > 1155) v155 = v162 + a; else v158 = 1155;
+  if (a > 1156) v156 = v163 + a; else v159 = 1156;
+  if (a > 1157) v157 = v164 + a; else v160 = 1157;
+  if (a > 1158) v158 = v165 + a; else v161 = 1158;
+  if (a > 1159) v159 = v166 + a; else v162 = 1159;
+  if (a > 1160) v160 = v167 + a; else v163 = 1160;
+  if (a > 1161) v161 = v168 + a; else v164 = 1161;
+  if (a > 1162) v162 = v169 + a; else v165 = 1162;
+  if (a > 1163) v163 = v170 + a; else v166 = 1163;
+  if (a > 1164) v164 = v171 + a; else v167 = 1164;
+  if (a > 1165) v165 = v172 + a; else v168 = 1165;
+  if (a > 1166) v166 = v173 + a; else v169 = 1166;
+  if (a > 1167) v167 = v174 + a; else v170 = 1167;
+  if (a > 1168) v168 = v175 + a; else v171 = 1168;
+  if (a > 1169) v169 = v176 + a; else v172 = 1169;
+  if (a > 1170) v170 = v177 + a; else v173 = 1170;
+  if (a > 1171) v171 = v178 + a; else v174 = 1171;
+  if (a > 1172) v172 = v179 + a; else v175 = 1172;
+  if (a > 1173) v173 = v180 + a; else v176 = 1173;
+  if (a > 1174) v174 = v181 + a; else v177 = 1174;
+  if (a > 1175) v175 = v182 + a; else v178 = 1175;
+  if (a > 1176) v176 = v183 + a; else v179 = 1176;
+  if (a > 1177) v177 = v184 + a; else v180 = 1177;
+  if (a > 1178) v178 = v185 + a; else v181 = 1178;
+  if (a > 1179) v179 = v186 + a; else v182 = 1179;
+  if (a > 1180) v180 = v187 + a; else v183 = 1180;
+  if (a > 1181) v181 = v188 + a; else v184 = 1181;
+  if (a > 1182) v182 = v189 + a; else v185 = 1182;
+  if (a > 1183) v183 = v190 + a; else v186 = 1183;
+  if (a > 1184) v184 = v191 + a; else v187 = 1184;
+  if (a > 1185) v185 = v192 + a; else v188 = 1185;
+  if (a > 1186) v186 = v193 + a; else v189 = 1186;
+  if (a > 1187) v187 = v194 + a; else v190 = 1187;
+  if (a > 1188) v188 = v195 + a; else v191 = 1188;
+  if (a > 1189) v189 = v196 + a; else v192 = 1189;
+  if (a > 1190) v190 = v197 + a; else v193 = 1190;
+  if (a > 1191) v191 = v198 + a; else v194 = 1191;
+  if (a > 1192) v192 = v199 + a; else v195 = 1192;
+  if (a > 1193) v193 = v0 + a; else v196 = 1193;
+  if (a > 1194) v194 = v1 + a; else v197 = 1194;
+  if (a > 1195) v195 = v2 + a; else v198 = 1195;
+  if (a > 1196) v196 = v3 + a; else v199 = 1196;
+  if (a > 1197) v197 = v4 + a; else v0 = 1197;
+  if (a > 1198) v198 = v5 + a; else v1 = 1198;
+  if (a > 1199) v199 = v6 + a; else v2 = 1199;
+  if (a > 1200) v0 = v7 + a; else v3 = 1200;
+  if (a > 1201) v1 = v8 + a; else v4 = 1201;
+  if (a > 1202) v2 = v9 + a; else v5 = 1202;
+  if (a > 1203) v3 = v10 + a; else v6 = 1203;
+  if (a > 1204) v4 = v11 + a; else v7 = 1204;
+  if (a > 1205) v5 = v12 + a; else v8 = 1205;
+  if (a > 1206) v6 = v13 + a; else v9 = 1206;
+  if (a > 1207) v7 = v14 + a; else v10 = 1207;
+  if (a > 1208) v8 = v15 + a; else v11 = 1208;
+  if (a > 1209) v9 = v16 + a; else v12 = 1209;
+  if (a > 1210) v10 = v17 + a; else v13 = 1210;
+  if (a > 1211) v11 = v18 + a; else v14 = 1211;
+  if (a > 1212) v12 = v19 + a; else v15 = 1212;
+  if (a > 1213) v13 = v20 + a; else v16 = 1213;
+  if (a > 1214) v14 = v21 + a; else v17 = 1214;
+  if (a > 1215) v15 = v22 + a; else v18 = 1215;
+  if (a > 1216) v16 = v23 + a; else v19 = 1216;
+  if (a > 1217) v17 = v24 + a; else v20 = 1217;
+  if (a > 1218) v18 = v25 + a; else v21 = 1218;
+  if (a > 1219) v19 = v26 + a; else v22 = 1219;
+  if (a > 1220) v20 = v27 + a; else v23 = 1220;
+  if (a > 1221) v21 = v28 + a; else v24 = 1221;
+  if (a > 1222) v22 = v29 + a; else v25 = 1222;
+  if (a > 1223) v23 = v30 + a; else v26 = 1223;
+  if (a > 1224) v24 = v31 + a; else v27 = 1224;
+  if (a > 1225) v25 = v32 + a; else v28 = 1225;
+  if (a > 1226) v26 = v33 + a; else v29 = 1226;
+  if (a > 1227) v27 = v34 + a; else v30 = 1227;
+  if (a > 1228) v28 = v35 + a; else v31 = 1228;
+  if (a > 1229) v29 = v36 + a; else v32 = 1229;
+  if (a > 1230) v30 = v37 + a; else v33 = 1230;
+  if (a > 1231) v31 = v38 + a; else v34 = 1231;
+  if (a > 1232) v32 = v39 + a; else v35 = 1232;
+  if (a > 1233) v33 = v40 + a; else v36 = 1233;
+  if (a > 1234) v34 = v41 + a; else v37 = 1234;
+  if (a > 1235) v35 = v42 + a; else v38 = 1235;
+  if (a > 1236) v36 = v43 + a; else v39 = 1236;
+  if (a > 1237) v37 = v44 + a; else v40 = 1237;
+  if (a > 1238) v38 = v45 + a; else v41 = 1238;
+  if (a > 1239) v39 = v46 + a; else v42 = 1239;
+  if (a > 1240) v40 = v47 + a; else v43 = 1240;
+  if (a > 1241) v41 = v48 + a; else v44 = 1241;
+  if (a > 1242) v42 = v49 + a; else v45 = 1242;
+  if (a > 1243) v43 = v50 + a; else v46 = 1243;
+  if (a > 1244) v44 = v51 + a; else v47 = 1244;
+  if (a > 1245) v45 = v52 + a; else v48 = 1245;
+  if (a > 1246) v46 = v53 + a; else v49 = 1246;
+  if (a > 1247) v47 = v54 + a; else v50 = 1247;
+  if (a > 1248) v48 = v55 + a; else v51 = 1248;
+  if (a > 1249) v49 = v56 + a; else v52 = 1249;
+  if (a > 1250) v50 = v57 + a; else v53 = 1250;
+  if (a > 1251) v51 = v58 + a; else v54 = 1251;
+  if (a > 1252) v52 = v59 + a; else v55 = 1252;
+  if (a > 1253) v53 = v60 + a; else v56 = 1253;
+  if (a > 1254) v54 = v61 + a; else v57 = 1254;
+  if (a > 1255) v55 = v62 + a; else v58 = 1255;
+  if (a > 1256) v56 = v63 + a; else v59 = 1256;
+  if (a > 1257) v57 = v64 + a; else v60 = 1257;
+  if (a > 1258) v58 = v65 + a; else v61 = 1258;
+  if (a > 1259) v59 = v66 + a; else v62 = 1259;
+  if (a > 1260) v60 = v67 + a; else v63 = 1260;
+  if (a > 1261) v61 = v68 + a; else v64 = 1261;
+  if (a > 1262) v62 = v69 + a; else v65 = 1262;
+  if (a > 1263) v63 = v70 + a; else v66 = 1263;
+  if (a > 1264) v64 = v71 + a; else v67 = 1264;
+  if (a > 1265) v65 = v72 + a; else v68 = 1265;
+  if (a > 1266) v66 = v73 + a; else v69 = 1266;
+  if (a > 1267) v67 = v74 + a; else v70 = 1267;
+  if (a > 1268) v68 = v75 + a; else v71 = 1268;
+  if (a > 1269) v69 = v76 + a; else v72 = 1269;
+  if (a > 1270) v70 = v77 + a; else v73 = 1270;
+  if (a > 1271) v71 = v78 + a; else v74 = 1271;
+  if (a > 1272) v72 = v79 + a; else v75 = 1272;
+  if (a > 1273) v73 = v80 + a; else v76 = 1273;
+  if (a > 1274) v74 = v81 + a; else v77 = 1274;
+  if (a > 1275) v75 = v82 + a; else v78 = 1275;
+  if (a > 1276) v76 = v83 + a; else v79 = 1276;
+  if (a > 1277) v77 = v84 + a; else v80 = 1277;
+  if (a > 1278) v78 = v85 + a; else v81 = 1278;
+  if (a > 1279) v79 = v86 + a; else v82 = 1279;
+  if (a > 1280) v80 = v87 + a; else v83 = 1280;
+  if (a > 1281) v81 = v88 + a; else v84 = 1281;
+  if (a > 1282) v82 = v89 + a; else v85 = 1282;
+  if (a > 1283) v83 = v90 + a; else v86 = 1283;
+  if (a > 1284) v84 = v91 + a; else v87 = 1284;
+  if (a > 1285) v85 = v92 + a; else v88 = 1285;
+  if (a > 1286) v86 = v93 + a; else v89 = 1286;
+  if (a > 1287) v87 = v94 + a; else v90 = 1287;
+  if (a > 1288) v88 = v95 + a; else v91 = 1288;
+  if (a > 1289) v89 = v96 + a; else v92 = 1289;
+  if (a > 1290) v90 = v97 + a; else v93 = 1290;
+  if (a > 1291) v91 = v98 + a; else v94 = 1291;
+  if (a > 1292) v92 = v99 + a; else v95 = 1292;
+  if (a > 1293) v93 = v100 + a; else v96 = 1293;
+  if (a > 1294) v94 = v101 + a; else v97 = 1294;
+  if (a > 1295) v95 = v102 + a; else v98 = 1295;
+  if (a > 1296) v96 = v103 + a; else v99 = 1296;
+  if (a > 1297) v97 = v104 + a; else v100 = 1297;
+  if (a > 1298) v98 = v105 + a; else v101 = 1298;
+  if (a > 1299) v99 = v106 + a; else v102 = 1299;
+  if (a > 1300) v100 = v107 + a; else v103 = 1300;
+  if (a > 1301) v101 = v108 + a; else v104 = 1301;
+  if (a > 1302) v102 = v109 + a; else v105 = 1302;
+  if (a > 1303) v103 = v110 + a; else v106 = 1303;
+  if (a > 1304) v104 = v111 + a; else v107 = 1304;
+  if (a > 1305) v105 = v112 + a; else v108 = 1305;
+  if (a > 1306) v106 = v113 + a; else v109 = 1306;
+  if (a > 1307) v107 = v114 + a; else v110 = 1307;
+  if (a > 1308) v108 = v115 + a; else v111 = 1308;
+  if (a > 1309) v109 = v116 + a; else v112 = 1309;
+  if (a > 1310) v110 = v117 + a; else v113 = 1310;
+  if (a > 1311) v111 = v118 + a; else v114 = 1311;
+  if (a > 1312) v112 = v119 + a; else v115 = 1312;
+  if (a > 1313) v113 = v120 + a; else v116 = 1313;
+  if (a > 1314) v114 = v121 + a; else v117 = 1314;
+  if (a > 1315) v115 = v122 + a; else v118 = 1315;
+  if (a > 1316) v116 = v123 + a; else v119 = 1316;
+  if (a > 1317) v117 = v124 + a; else v120 = 1317;
+  if (a > 1318) v118 = v125 + a; else v121 = 1318;
+  if (a > 1319) v119 = v126 + a; else v122 = 1319;
+  if (a > 1320) v120 = v127 + a; else v123 = 1320;
+  if (a > 1321) v121 = v128 + a; else v124 = 1321;
+  if (a > 1322) v122 = v129 + a; else v125 = 1322;
+  if (a > 1323) v123 = v130 + a; else v126 = 1323;
+  if (a > 1324) v124 = v131 + a; else v127 = 1324;
+  if (a > 1325) v125 = v132 + a; else v128 = 1325;
+  if (a > 1326) v126 = v133 + a; else v129 = 1326;
+  if (a > 1327) v127 = v134 + a; else v130 = 1327;
+  if (a > 1328) v128 = v135 + a; else v131 = 1328;
+  if (a > 1329) v129 = v136 + a; else v132 = 1329;
+  if (a > 1330) v130 = v137 + a; else v133 = 1330;
+  if (a > 1331) v131 = v138 + a; else v134 = 1331;
+  if (a > 1332) v132 = v139 + a; else v135 = 1332;
+  if (a > 1333) v133 = v140 + a; else v136 = 1333;
+  if (a > 1334) v134 = v141 + a; else v137 = 1334;
+  if (a > 1335) v135 = v142 + a; else v138 = 1335;
+  if (a > 1336) v136 = v143 + a; else v139 = 1336;
+  if (a > 1337) v137 = v144 + a; else v140 = 1337;
+  if (a > 1338) v138 = v145 + a; else v141 = 1338;
+  if (a > 1339) v139 = v146 + a; else v142 = 1339;
+  if (a > 1340) v140 = v147 + a; else v143 = 1340;
+  if (a > 1341) v141 = v148 + a; else v144 = 1341;
+  if (a > 1342) v142 = v149 + a; else v145 = 1342;
+  if (a > 1343) v143 = v150 + a; else v146 = 1343;
+  if (a > 1344) v144 = v151 + a; else v147 = 1344;
+  if (a > 1345) v145 = v152 + a; else v148 = 1345;
+  if (a > 1346) v146 = v153 + a; else v149 = 1346;
+  if (a > 1347) v147 = v154 + a; else v150 = 1347;
+  if (a > 1348) v148 = v155 + a; else v151 = 1348;
+  if (a > 1349) v149 = v156 + a; else v152 = 1349;
+  if (a > 1350) v150 = v157 + a; else v153 = 1350;
+  if (a > 1351) v151 = v158 + a; else v154 = 1351;
+  if (a > 1352) v152 = v159 + a; else v155 = 1352;
+  if (a > 1353) v153 = v160 + a; else v156 = 1353;
+  if (a > 1354) v154 = v161 + a; else v157 = 1354;
+  if (a > 1355) v155 = v162 + a; else v158 = 1355;
+  if (a > 1356) v156 = v163 + a; else v159 = 1356;
+  if (a > 1357) v157 = v164 + a; else v160 = 1357;
+  if (a > 1358) v158 = v165 + a; else v161 = 1358;
+  if (a > 1359) v159 = v166 + a; else v162 = 1359;
+  if (a > 1360) v160 = v167 + a; else v163 = 1360;
+  if (a > 1361) v161 = v168 + a; else v164 = 1361;
+  if (a > 1362) v162 = v169 + a; else v165 = 1362;
+  if (a > 1363) v163 = v170 + a; else v166 = 1363;
+  if (a > 1364) v164 = v171 + a; else v167 = 1364;
+  if (a > 1365) v165 = v172 + a; else v168 = 1365;
+  if (a > 1366) v166 = v173 + a; else v169 = 1366;
+  if (a > 1367) v167 = v174 + a; else v170 = 1367;
+  if (a > 1368) v168 = v175 + a; else v171 = 1368;
+  if (a > 1369) v169 = v176 + a; else v172 = 1369;
+  if (a > 1370) v170 = v177 + a; else v173 = 1370;
+  if (a > 1371) v171 = v178 + a; else v174 = 1371;
+  if (a > 1372) v172 = v179 + a; else v175 = 1372;
+  if (a > 1373) v173 = v180 + a; else v176 = 1373;
+  if (a > 1374) v174 = v181 + a; else v177 = 1374;
+  if (a > 1375) v175 = v182 + a; else v178 = 1375;
+  if (a > 1376) v176 = v183 + a; else v179 = 1376;
+  if (a > 1377) v177 = v184 + a; else v180 = 1377;
+  if (a > 1378) v178 = v185 + a; else v181 = 1378;
+  if (a > 1379) v179 = v186 + a; else v182 = 1379;
+  if (a > 1380) v180 = v187 + a; else v183 = 1380;
+  if (a > 1381) v181 = v188 + a; else v184 = 1381;
+  if (a > 1382) v182 = v189 + a; else v185 = 1382;
+  if (a > 1383) v183 = v190 + a; else v186 = 1383;
+  if (a > 1384) v184 = v191 + a; else v187 = 1384;
+  if (a > 1385) v185 = v192 + a; else v188 = 1385;
+  if (a > 1386) v186 = v193 + a; else v189 = 1386;
+  if (a > 1387) v187 = v194 + a; else v190 = 1387;
+  if (a > 1388) v188 = v195 + a; else v191 = 1388;
+  if (a > 1389) v189 = v196 + a; else v192 = 1389;
+  if (a > 1390) v190 = v197 + a; else v193 = 1390;
+  if (a > 1391) v191 = v198 + a; else v194 = 1391;
+  if (a > 1392) v192 = v199 + a; else v195 = 1392;
+  if (a > 1393) v193 = v0 + a; else v196 = 1393;
+  if (a > 1394) v194 = v1 + a; else v197 = 1394;
+  if (a > 1395) v195 = v2 + a; else v198 = 1395;
+  if (a > 1396) v196 = v3 + a; else v199 = 1396;
+  if (a > 1397) v197 = v4 + a; else v0 = 1397;
+  if (a > 1398) v198 = v5 + a; else v1 = 1398;
+  if (a > 1399) v199 = v6 + a; else v2 = 1399;
+  if (a > 1400) v0 = v7 + a; else v3 = 1400;
+  if (a > 1401) v1 = v8 + a; else v4 = 1401;
+  if (a > 1402) v2 = v9 + a; else v5 = 1402;
+  if (a > 1403) v3 = v10 + a; else v6 = 1403;
+  if (a > 1404) v4 = v11 + a; else v7 = 1404;
+  if (a > 1405) v5 = v12 + a; else v8 = 1405;
+  if (a > 1406) v6 = v13 + a; else v9 = 1406;
+  if (a > 1407) v7 = v14 + a; else v10 = 1407;
+  if (a > 1408) v8 = v15 + a; else v11 = 1408;
+  if (a > 1409) v9 = v16 + a; else v12 = 1409;
+  if (a > 1410) v10 = v17 + a; else v13 = 1410;
+  if (a > 1411) v11 = v18 + a; else v14 = 1411;
+  if (a > 1412) v12 = v19 + a; else v15 = 1412;
+  if (a > 1413) v13 = v20 + a; else v16 = 1413;
+  if (a > 1414) v14 = v21 + a; else v17 = 1414;
+  if (a > 1415) v15 = v22 + a; else v18 = 1415;
+  if (a > 1416) v16 = v23 + a; else v19 = 1416;
+  if (a > 1417) v17 = v24 + a; else v20 = 1417;
+  if (a > 1418) v18 = v25 + a; else v21 = 1418;
+  if (a > 1419) v19 = v26 + a; else v22 = 1419;
+  if (a > 1420) v20 = v27 + a; else v23 = 1420;
+  if (a > 1421) v21 = v28 + a; else v24 = 1421;
+  if (a > 1422) v22 = v29 + a; else v25 = 1422;
+  if (a > 1423) v23 = v30 + a; else v26 = 1423;
+  if (a > 1424) v24 = v31 + a; else v27 = 1424;
+  if (a > 1425) v25 = v32 + a; else v28 = 1425;
+  if (a > 1426) v26 = v33 + a; else v29 = 1426;
+  if (a > 1427) v27 = v34 + a; else v30 = 1427;
+  if (a > 1428) v28 = v35 + a; else v31 = 1428;
+  if (a > 1429) v29 = v36 + a; else v32 = 1429;
+  if (a > 1430) v30 = v37 + a; else v33 = 1430;
+  if (a > 1431) v31 = v38 + a; else v34 = 1431;
+  if (a > 1432) v32 = v39 + a; else v35 = 1432;
+  if (a > 1433) v33 = v40 + a; else v36 = 1433;
+  if (a > 1434) v34 = v41 + a; else v37 = 1434;
+  if (a > 1435) v35 = v42 + a; else v38 = 1435;
+  if (a > 1436) v36 = v43 + a; else v39 = 1436;
+  if (a > 1437) v37 = v44 + a; else v40 = 1437;
+  if (a > 1438) v38 = v45 + a; else v41 = 1438;
+  if (a > 1439) v39 = v46 + a; else v42 = 1439;
+  if (a > 1440) v40 = v47 + a; else v43 = 1440;
+  if (a > 1441) v41 = v48 + a; else v44 = 1441;
+  if (a > 1442) v42 = v49 + a; else v45 = 1442;
+  if (a > 1443) v43 = v50 + a; else v46 = 1443;
+  if (a > 1444) v44 = v51 + a; else v47 = 1444;
+  if (a > 1445) v45 = v52 + a; else v48 = 1445;
+  if (a > 1446) v46 = v53 + a; else v49 = 1446;
+  if (a > 1447) v47 = v54 + a; else v50 = 1447;
+  if (a > 1448) v48 = v55 + a; else v51 = 1448;
+  if (a > 1449) v49 = v56 + a; else v52 = 1449;
+  if (a > 1450) v50 = v57 + a; else v53 = 1450;
+  if (a > 1451) v51 = v58 + a; else v54 = 1451;
+  if (a > 1452) v52 = v59 + a; else v55 = 1452;
+  if (a > 1453) v53 = v60 + a; else v56 = 1453;
+  if (a > 1454) v54 = v61 + a; else v57 = 1454;
+  if (a > 1455) v55 = v62 + a; else v58 = 1455;
+  if (a > 1456) v56 = v63 + a; else v59 = 1456;
+  if (a > 1457) v57 = v64 + a; else v60 = 1457;
+  if (a > 1458) v58 = v65 + a; else v61 = 1458;
+  if (a > 1459) v59 = v66 + a; else v62 = 1459;
+  if (a > 1460) v60 = v67 + a; else v63 = 1460;
+  if (a > 1461) v61 = v68 + a; else v64 = 1461;
+  if (a > 1462) v62 = v69 + a; else v65 = 1462;
+  if (a > 1463) v63 = v70 + a; else v66 = 1463;
+  if (a > 1464) v64 = v71 + a; else v67 = 1464;
+  if (a > 1465) v65 = v72 + a; else v68 = 1465;
+  if (a > 1466) v66 = v73 + a; else v69 = 1466;
+  if (a > 1467) v67 = v74 + a; else v70 = 1467;
+  if (a > 1468) v68 = v75 + a; else v71 = 1468;
+  if (a > 1469) v69 = v76 + a; else v72 = 1469;
+  if (a > 1470) v70 = v77 + a; else v73 = 1470;
+  if (a > 1471) v71 = v78 + a; else v74 = 1471;
+  if (a > 1472) v72 = v79 + a; else v75 = 1472;
+  if (a > 1473) v73 = v80 + a; else v76 = 1473;
+  if (a > 1474) v74 = v81 + a; else v77 = 1474;
+  if (a > 1475) v75 = v82 + a; else v78 = 1475;
+  if (a > 1476) v76 = v83 + a; else v79 = 1476;
+  if (a > 1477) v77 = v84 + a; else v80 = 1477;
+  if (a > 1478) v78 = v85 + a; else v81 = 1478;
+  if (a > 1479) v79 = v86 + a; else v82 = 1479;
+  if (a > 1480) v80 = v87 + a; else v83 = 1480;
+  if (a > 1481) v81 = v88 + a; else v84 = 1481;
+  if (a > 1482) v82 = v89 + a; else v85 = 1482;
+  if (a > 1483) v83 = v90 + a; else v86 = 1483;
+  if (a > 1484) v84 = v91 + a; else v87 = 1484;
+  if (a > 1485) v85 = v92 + a; else v88 = 1485;
+  if (a > 1486) v86 = v93 + a; else v89 = 1486;
+  if (a > 1487) v87 = v94 + a; else v90 = 1487;
+  if (a > 1488) v88 = v95 + a; else v91 = 1488;
+  if (a > 1489) v89 = v96 + a; else v92 = 1489;
+  if (a > 1490) v90 = v97 + a; else v93 = 1490;
+  if (a > 1491) v91 = v98 + a; else v94 = 1491;
+  if (a > 1492) v92 = v99 + a; else v95 = 1492;
+  if (a > 1493) v93 = v100 + a; else v96 = 1493;
+  if (a > 1494) v94 = v101 + a; else v97 = 1494;
+  if (a > 1495) v95 = v102 + a; else v98 = 1495;
+  if (a > 1496) v96 = v103 + a; else v99 = 1496;
+  if (a > 1497) v97 = v104 + a; else v100 = 1497;
+  if (a > 1498) v98 = v105 + a; else v101 = 1498;
+  if (a > 1499) v99 = v106 + a; else v102 = 1499;
+  if (a > 1500) v100 = v107 + a; else v103 = 1500;
+  if (a > 1501) v101 = v108 + a; else v104 = 1501;
+  if (a > 1502) v102 = v109 + a; else v105 = 1502;
+  if (a > 1503) v103 = v110 + a; else v106 = 1503;
+  if (a > 1504) v104 = v111 + a; else v107 = 1504;
+  if (a > 1505) v105 = v112 + a; else v108 = 1505;
+  if (a > 1506) v106 = v113 + a; else v109 = 1506;
+  if (a > 1507) v107 = v114 + a; else v110 = 1507;
+  if (a > 1508) v108 = v115 + a; else v111 = 1508;
+  if (a > 1509) v109 = v116 + a; else v112 = 1509;
+  if (a > 1510) v110 = v117 + a; else v113 = 1510;
+  if (a > 1511) v111 = v118 + a; else v114 = 1511;
+  if (a > 1512) v112 = v119 + a; else v115 = 1512;
+  if (a > 1513) v113 = v120 + a; else v116 = 1513;
+  if (a > 1514) v114 = v121 + a; else v117 = 1514;
+  if (a > 1515) v115 = v122 + a; else v118 = 1515;
+  if (a > 1516) v116 = v123 + a; else v119 = 1516;
+  if (a > 1517) v117 = v124 + a; else v120 = 1517;
+  if (a > 1518) v118 = v125 + a; else v121 = 1518;
+  if (a > 1519) v119 = v126 + a; else v122 = 1519;
+  if (a > 1520) v120 = v127 + a; else v123 = 1520;
+  if (a > 1521) v121 = v128 + a; else v124 = 1521;
+  if (a > 1522) v122 = v129 + a; else v125 = 1522;
+  if (a > 1523) v123 = v130 + a; else v126 = 1523;
+  if (a > 1524) v124 = v131 + a; else v127 = 1524;
+  if (a > 1525) v125 = v132 + a; else v128 = 1525;
+  if (a > 1526) v126 = v133 + a; else v129 = 1526;
+  if (a > 1527) v127 = v134 + a; else v130 = 1527;
+  if (a > 1528) v128 = v135 + a; else v131 = 1528;
+  if (a > 1529) v129 = v136 + a; else v132 = 1529;
+  if (a > 1530) v130 = v137 + a; else v133 = 1530;
+  if (a > 1531) v131 = v138 + a; else v134 = 1531;
+  if (a > 1532) v132 = v139 + a; else v135 = 1532;
+  if (a > 1533) v133 = v140 + a; else v136 = 1533;
+  if (a > 1534) v134 = v141 + a; else v137 = 1534;
+  if (a > 1535) v135 = v142 + a; else v138 = 1535;
+  if (a > 1536) v136 = v143 + a; else v139 = 1536;
+  if (a > 1537) v137 = v144 + a; else v140 = 1537;
+  if (a > 1538) v138 = v145 + a; else v141 = 1538;
+  if (a > 1539) v139 = v146 + a; else v142 = 1539;
+  if (a > 1540) v140 = v147 + a; else v143 = 1540;
+  if (a > 1541) v141 = v148 + a; else v144 = 1541;
+  if (a > 1542) v142 = v149 + a; else v145 = 1542;
+  if (a > 1543) v143 = v150 + a; else v146 = 1543;
+  if (a > 1544) v144 = v151 + a; else v147 = 1544;
+  if (a > 1545) v145 = v152 + a; else v148 = 1545;
+  if (a > 1546) v146 = v153 + a; else v149 = 1546;
+  if (a > 1547) v147 = v154 + a; else v150 = 1547;
+  if (a > 1548) v148 = v155 + a; else v151 = 1548;
+  if (a > 1549) v149 = v156 + a; else v152 = 1549;
+  if (a > 1550) v150 = v157 + a; else v153 = 1550;
+  if (a > 1551) v151 = v158 + a; else v154 = 1551;
+  if (a > 1552) v152 = v159 + a; else v155 = 1552;
+  if (a > 1553) v153 = v160 + a; else v156 = 1553;
+  if (a > 1554) v154 = v161 + a; else v157 = 1554;
+  if (a > 1555) v155 = v162 + a; else v158 = 1555;
+  if (a > 1556) v156 = v163 + a; else v159 = 1556;
+  if (a > 1557) v157 = v164 + a; else v160 = 1557;
+  if (a > 1558) v158 = v165 + a; else v161 = 1558;
+  if (a > 1559) v159 = v166 + a; else v162 = 1559;
+  if (a > 1560) v160 = v167 + a; else v163 = 1560;
+  if (a > 1561) v161 = v168 + a; else v164 = 1561;
+  if (a > 1562) v162 = v169 + a; else v165 = 1562;
+  if (a > 1563) v163 = v170 + a; else v166 = 1563;
+  if (a > 1564) v164 = v171 + a; else v167 = 1564;
+  if (a > 1565) v165 = v172 + a; else v168 = 1565;
+  if (a > 1566) v166 = v173 + a; else v169 = 1566;
+  if (a > 1567) v167 = v174 + a; else v170 = 1567;
+  if (a > 1568) v168 = v175 + a; else v171 = 1568;
+  if (a > 1569) v169 = v176 + a; else v172 = 1569;
+  if (a > 1570) v170 = v177 + a; else v173 = 1570;
+  if (a > 1571) v171 = v178 + a; else v174 = 1571;
+  if (a > 1572) v172 = v179 + a; else v175 = 1572;
+  if (a > 1573) v173 = v180 + a; else v176 = 1573;
+  if (a > 1574) v174 = v181 + a; else v177 = 1574;
+  if (a > 1575) v175 = v182 + a; else v178 = 1575;
+  if (a > 1576) v176 = v183 + a; else v179 = 1576;
+  if (a > 1577) v177 = v184 + a; else v180 = 1577;
+  if (a > 1578) v178 = v185 + a; else v181 = 1578;
+  if (a > 1579) v179 = v186 + a; else v182 = 1579;
+  if (a > 1580) v180 = v187 + a; else v183 = 1580;
+  if (a > 1581) v181 = v188 + a; else v184 = 1581;
+  if (a > 1582) v182 = v189 + a; else v185 = 1582;
+  if (a > 1583) v183 = v190 + a; else v186 = 1583;
+  if (a > 1584) v184 = v191 + a; else v187 = 1584;
+  if (a > 1585) v185 = v192 + a; else v188 = 1585;
+  if (a > 1586) v186 = v193 + a; else v189 = 1586;
+  if (a > 1587) v187 = v194 + a; else v190 = 1587;
+  if (a > 1588) v188 = v195 + a; else v191 = 1588;
+  if (a > 1589) v189 = v196 + a; else v192 = 1589;
+  if (a > 1590) v190 = v197 + a; else v193 = 1590;
+  if (a > 1591) v191 = v198 + a; else v194 = 1591;
+  if (a > 1592) v192 = v199 + a; else v195 = 1592;
+  if (a > 1593) v193 = v0 + a; else v196 = 1593;
+  if (a > 1594) v194 = v1 + a; else v197 = 1594;
+  if (a > 1595) v195 = v2 + a; else v198 = 1595;
+  if (a > 1596) v196 = v3 + a; else v199 = 1596;
+  if (a > 1597) v197 = v4 + a; else v0 = 1597;
+  if (a > 1598) v198 = v5 + a; else v1 = 1598;
+  if (a > 1599) v199 = v6 + a; else v2 = 1599;
+  if (a > 1600) v0 = v7 + a; else v3 = 1600;
+  if (a > 1601) v1 = v8 + a; else v4 = 1601;
+  if (a > 1602) v2 = v9 + a; else v5 = 1602;
+  if (a > 1603) v3 = v10 + a; else v6 = 1603;
+  if (a > 1604) v4 = v11 + a; else v7 = 1604;
+  if (a > 1605) v5 = v12 + a; else v8 = 1605;
+  if (a > 1606) v6 = v13 + a; else v9 = 1606;
+  if (a > 1607) v7 = v14 + a; else v10 = 1607;
+  if (a > 1608) v8 = v15 + a; else v11 = 1608;
+  if (a > 1609) v9 = v16 + a; else v12 = 1609;
+  if (a > 1610) v10 = v17 + a; else v13 = 1610;
+  if (a > 1611) v11 = v18 + a; else v14 = 1611;
+  if (a > 1612) v12 = v19 + a; else v15 = 1612;
+  if (a > 1613) v13 = v20 + a; else v16 = 1613;
+  if (a > 1614) v14 = v21 + a; else v17 = 1614;
+  if (a > 1615) v15 = v22 + a; else v18 = 1615;
+  if (a > 1616) v16 = v23 + a; else v19 = 1616;
+  if (a > 1617) v17 = v24 + a; else v20 = 1617;
+  if (a > 1618) v18 = v25 + a; else v21 = 1618;
+  if (a > 1619) v19 = v26 + a; else v22 = 1619;
+  if (a > 1620) v20 = v27 + a; else v23 = 1620;
+  if (a > 1621) v21 = v28 + a; else v24 = 1621;
+  if (a > 1622) v22 = v29 + a; else v25 = 1622;
+  if (a > 1623) v23 = v30 + a; else v26 = 1623;
+  if (a > 1624) v24 = v31 + a; else v27 = 1624;
+  if (a > 1625) v25 = v32 + a; else v28 = 1625;
+  if (a > 1626) v26 = v33 + a; else v29 = 1626;
+  if (a > 1627) v27 = v34 + a; else v30 = 1627;
+  if (a > 1628) v28 = v35 + a; else v31 = 1628;
+  if (a > 1629) v29 = v36 + a; else v32 = 1629;
+  if (a > 1630) v30 = v37 + a; else v33 = 1630;
+  if (a > 1631) v31 = v38 + a; else v34 = 1631;
+  if (a > 1632) v32 = v39 + a; else v35 = 1632;
+  if (a > 1633) v33 = v40 + a; else v36 = 1633;
+  if (a > 1634) v34 = v41 + a; else v37 = 1634;
+  if (a > 1635) v35 = v42 + a; else v38 = 1635;
+  if (a > 1636) v36 = v43 + a; else v39 = 1636;
+  if (a > 1637) v37 = v44 + a; else v40 = 1637;
+  if (a > 1638) v38 = v45 + a; else v41 = 1638;
+  if (a > 1639) v39 = v46 + a; else v42 = 1639;
+  if (a > 1640) v40 = v47 + a; else v43 = 1640;
+  if (a > 1641) v41 = v48 + a; else v44 = 1641;
+  if (a > 1642) v42 = v49 + a; else v45 = 1642;
+  if (a > 1643) v43 = v50 + a; else v46 = 1643;
+  if (a > 1644) v44 = v51 + a; else v47 = 1644;
+  if (a > 1645) v45 = v52 + a; else v48 = 1645;
+  if (a > 1646) v46 = v53 + a; else v49 = 1646;
+  if (a > 1647) v47 = v54 + a; else v50 = 1647;
+  if (a > 1648) v48 = v55 + a; else v51 = 1648;
+  if (a > 1649) v49 = v56 + a; else v52 = 1649;
+  if (a > 1650) v50 = v57 + a; else v53 = 1650;
+  if (a > 1651) v51 = v58 + a; else v54 = 1651;
+  if (a > 1652) v52 = v59 + a; else v55 = 1652;
+  if (a > 1653) v53 = v60 + a; else v56 = 1653;
+  if (a > 1654) v54 = v61 + a; else v57 = 1654;
+  if (a > 1655) v55 = v62 + a; else v58 = 1655;
+  if (a > 1656) v56 = v63 + a; else v59 = 1656;
+  if (a > 1657) v57 = v64 + a; else v60 = 1657;
+  if (a > 1658) v58 = v65 + a; else v61 = 1658;
+  if (a > 1659) v59 = v66 + a; else v62 = 1659;
+  if (a > 1660) v60 = v67 + a; else v63 = 1660;
+  if (a > 1661) v61 = v68 + a; else v64 = 1661;
+  if (a > 1662) v62 = v69 + a; else v65 = 1662;
+  if (a > 1663) v63 = v70 + a; else v66 = 1663;
+  if (a > 1664) v64 = v71 + a; else v67 = 1664;
+  if (a > 1665) v65 = v72 + a; else v68 = 1665;
+  if (a > 1666) v66 = v73 + a; else v69 = 1666;
+  if (a > 1667) v67 = v74 + a; else v70 = 1667;
+  if (a > 1668) v68 = v75 + a; else v71 = 1668;
+  if (a > 1669) v69 = v76 + a; else v72 = 1669;
+  if (a > 1670) v70 = v77 + a; else v73 = 1670;
+  if (a > 1671) v71 = v78 + a; else v74 = 1671;
+  if (a > 1672) v72 = v79 + a; else v75 = 1672;
+  if (a > 1673) v73 = v80 + a; else v76 = 1673;
+  if (a > 1674) v74 = v81 + a; else v77 = 1674;
+  if (a > 1675) v75 = v82 + a; else v78 = 1675;
+  if (a > 1676) v76 = v83 + a; else v79 = 1676;
+  if (a > 1677) v77 = v84 + a; else v80 = 1677;
+  if (a > 1678) v78 = v85 + a; else v81 = 1678;
+  if (a > 1679) v79 = v86 + a; else v82 = 1679;
+  if (a > 1680) v80 = v87 + a; else v83 = 1680;
+  if (a > 1681) v81 = v88 + a; else v84 = 1681;
+  if (a > 1682) v82 = v89 + a; else v85 = 1682;
+  if (a > 1683) v83 = v90 + a; else v86 = 1683;
+  if (a > 1684) v84 = v91 + a; else v87 = 1684;
+  if (a > 1685) v85 = v92 + a; else v88 = 1685;
+  if (a > 1686) v86 = v93 + a; else v89 = 1686;
+  if (a > 1687) v87 = v94 + a; else v90 = 1687;
+  if (a > 1688) v88 = v95 + a; else v91 = 1688;
+  if (a > 1689) v89 = v96 + a; else v92 = 1689;
+  if (a > 1690) v90 = v97 + a; else v93 = 1690;
+  if (a > 1691) v91 = v98 + a; else v94 = 1691;
+  if (a > 1692) v92 = v99 + a; else v95 = 1692;
+  if (a > 1693) v93 = v100 + a; else v96 = 1693;
+  if (a > 1694) v94 = v101 + a; else v97 = 1694;
+  if (a > 1695) v95 = v102 + a; else v98 = 1695;
+  if (a > 1696) v96 = v103 + a; else v99 = 1696;
+  if (a > 1697) v97 = v104 + a; else v100 = 1697;
+  if (a > 1698) v98 = v105 + a; else v101 = 1698;
+  if (a > 1699) v99 = v106 + a; else v102 = 1699;
+  if (a > 1700) v100 = v107 + a; else v103 = 1700;
+  if (a > 1701) v101 = v108 + a; else v104 = 1701;
+  if (a > 1702) v102 = v109 + a; else v105 = 1702;
+  if (a > 1703) v103 = v110 + a; else v106 = 1703;
+  if (a > 1704) v104 = v111 + a; else v107 = 1704;
+  if (a > 1705) v105 = v112 + a; else v108 = 1705;
+  if (a > 1706) v106 = v113 + a; else v109 = 1706;
+  if (a > 1707) v107 = v114 + a; else v110 = 1707;
+  if (a > 1708) v108 = v115 + a; else v111 = 1708;
+  if (a > 1709) v109 = v116 + a; else v112 = 1709;
+  if (a > 1710) v110 = v117 + a; else v113 = 1710;
+  if (a > 1711) v111 = v118 + a; else v114 = 1711;
+  if (a > 1712) v112 = v119 + a; else v115 = 1712;
+  if (a > 1713) v113 = v120 + a; else v116 = 1713;
+  if (a > 1714) v114 = v121 + a; else v117 = 1714;
+  if (a > 1715) v115 = v122 + a; else v118 = 1715;
+  if (a > 1716) v116 = v123 + a; else v119 = 1716;
+  if (a > 1717) v117 = v124 + a; else v120 = 1717;
+  if (a > 1718) v118 = v125 + a; else v121 = 1718;
+  if (a > 1719) v119 = v126 + a; else v122 = 1719;
+  if (a > 1720) v120 = v127 + a; else v123 = 1720;
+  if (a > 1721) v121 = v128 + a; else v124 = 1721;
+  if (a > 1722) v122 = v129 + a; else v125 = 1722;
+  if (a > 1723) v123 = v130 + a; else v126 = 1723;
+  if (a > 1724) v124 = v131 + a; else v127 = 1724;
+  if (a > 1725) v125 = v132 + a; else v128 = 1725;
+  if (a > 1726) v126 = v133 + a; else v129 = 1726;
+  if (a > 1727) v127 = v134 + a; else v130 = 1727;
+  if (a > 1728) v128 = v135 + a; else v131 = 1728;
+  if (a > 1729) v129 = v136 + a; else v132 = 1729;
+  if (a > 1730) v130 = v137 + a; else v133 = 1730;
+  if (a > 1731) v131 = v138 + a; else v134 = 1731;
+  if (a > 1732) v132 = v139 + a; else v135 = 1732;
+  if (a > 1733) v133 = v140 + a; else v136 = 1733;
+  if (a > 1734) v134 = v141 + a; else v137 = 1734;
+  if (a > 1735) v135 = v142 + a; else v138 = 1735;
+  if (a > 1736) v136 = v143 + a; else v139 = 1736;
+  if (a > 1737) v137 = v144 + a; else v140 = 1737;
+  if (a > 1738) v138 = v145 + a; else v141 = 1738;
+  if (a > 1739) v139 = v146 + a; else v142 = 1739;
+  if (a > 1740) v140 = v147 + a; else v143 = 1740;
+  if (a > 1741) v141 = v148 + a; else v144 = 1741;
+  if (a > 1742) v142 = v149 + a; else v145 = 1742;
+  if (a > 1743) v143 = v150 + a; else v146 = 1743;
+  if (a > 1744) v144 = v151 + a; else v147 = 1744;
+  if (a > 1745) v145 = v152 + a; else v148 = 1745;
+  if (a > 1746) v146 = v153 + a; else v149 = 1746;
+  if (a > 1747) v147 = v154 + a; else v150 = 1747;
+  if (a > 1748) v148 = v155 + a; else v151 = 1748;
+  if (a > 1749) v149 = v156 + a; else v152 = 1749;
+  if (a > 1750) v150 = v157 + a; else v153 = 1750;
+  if (a > 1751) v151 = v158 + a; else v154 = 1751;
+  if (a > 1752) v152 = v159 + a; else v155 = 1752;
+  if (a > 1753) v153 = v160 + a; else v156 = 1753;
+  if (a > 1754) v154 = v161 + a; else v157 = 1754;
+  if (a > 1755) v155 = v162 + a; else v158 = 1755;
+  if (a > 1756) v156 = v163 + a; else v159 = 1756;
+  if (a > 1757) v157 = v164 + a; else v160 = 1757;
+  if (a > 1758) v158 = v165 + a; else v161 = 1758;
+  if (a > 1759) v159 = v166 + a; else v162 = 1759;
+  if (a > 1760) v160 = v167 + a; else v163 = 1760;
+  if (a > 1761) v161 = v168 + a; else v164 = 1761;
+  if (a > 1762) v162 = v169 + a; else v165 = 1762;
+  if (a > 1763) v163 = v170 + a; else v166 = 1763;
+  if (a > 1764) v164 = v171 + a; else v167 = 1764;
+  if (a > 1765) v165 = v172 + a; else v168 = 1765;
+  if (a > 1766) v166 = v173 + a; else v169 = 1766;
+  if (a > 1767) v167 = v174 + a; else v170 = 1767;
+  if (a > 1768) v168 = v175 + a; else v171 = 1768;
+  if (a > 1769) v169 = v176 + a; else v172 = 1769;
+  if (a > 1770) v170 = v177 + a; else v173 = 1770;
+  if (a > 1771) v171 = v178 + a; else v174 = 1771;
+  if (a > 1772) v172 = v179 + a; else v175 = 1772;
+  if (a > 1773) v173 = v180 + a; else v176 = 1773;
+  if (a > 1774) v174 = v181 + a; else v177 = 1774;
+  if (a > 1775) v175 = v182 + a; else v178 = 1775;
+  if (a > 1776) v176 = v183 + a; else v179 = 1776;
+  if (a > 1777) v177 = v184 + a; else v180 = 1777;
+  if (a > 1778) v178 = v185 + a; else v181 = 1778;
+  if (a > 1779) v179 = v186 + a; else v182 = 1779;
+  if (a > 1780) v180 = v187 + a; else v183 = 1780;
+  if (a > 1781) v181 = v188 + a; else v184 = 1781;
+  if (a > 1782) v182 = v189 + a; else v185 = 1782;
+  if (a > 1783) v183 = v190 + a; else v186 = 1783;
+  if (a > 1784) v184 = v191 + a; else v187 = 1784;
+  if (a > 1785) v185 = v192 + a; else v188 = 1785;
+  if (a > 1786) v186 = v193 + a; else v189 = 1786;
+  if (a > 1787) v187 = v194 + a; else v190 = 1787;
+  if (a > 1788) v188 = v195 + a; else v191 = 1788;
+  if (a > 1789) v189 = v196 + a; else v192 = 1789;
+  if (a > 1790) v190 = v197 + a; else v193 = 1790;
+  if (a > 1791) v191 = v198 + a; else v194 = 1791;
+  if (a > 1792) v192 = v199 + a; else v195 = 1792;
+  if (a > 1793) v193 = v0 + a; else v196 = 1793;
+  if (a > 1794) v194 = v1 + a; else v197 = 1794;
+  if (a > 1795) v195 = v2 + a; else v198 = 1795;
+  if (a > 1796) v196 = v3 + a; else v199 = 1796;
+  if (a > 1797) v197 = v4 + a; else v0 = 1797;
+  if (a > 1798) v198 = v5 + a; else v1 = 1798;
+  if (a > 1799) v199 = v6 + a; else v2 = 1799;
+  if (a > 1800) v0 = v7 + a; else v3 = 1800;
+  if (a > 1801) v1 = v8 + a; else v4 = 1801;
+  if (a > 1802) v2 = v9 + a; else v5 = 1802;
+  if (a > 1803) v3 = v10 + a; else v6 = 1803;
+  if (a > 1804) v4 = v11 + a; else v7 = 1804;
+  if (a > 1805) v5 = v12 + a; else v8 = 1805;
+  if (a > 1806) v6 = v13 + a; else v9 = 1806;
+  if (a > 1807) v7 = v14 + a; else v10 = 1807;
+  if (a > 1808) v8 = v15 + a; else v11 = 1808;
+  if (a > 1809) v9 = v16 + a; else v12 = 1809;
+  if (a > 1810) v10 = v17 + a; else v13 = 1810;
+  if (a > 1811) v11 = v18 + a; else v14 = 1811;
+  if (a > 1812) v12 = v19 + a; else v15 = 1812;
+  if (a > 1813) v13 = v20 + a; else v16 = 1813;
+  if (a > 1814) v14 = v21 + a; else v17 = 1814;
+  if (a > 1815) v15 = v22 + a; else v18 = 1815;
+  if (a > 1816) v16 = v23 + a; else v19 = 1816;
+  if (a > 1817) v17 = v24 + a; else v20 = 1817;
+  if (a > 1818) v18 = v25 + a; else v21 = 1818;
+  if (a > 1819) v19 = v26 + a; else v22 = 1819;
+  if (a > 1820) v20 = v27 + a; else v23 = 1820;
+  if (a > 1821) v21 = v28 + a; else v24 = 1821;
+  if (a > 1822) v22 = v29 + a; else v25 = 1822;
+  if (a > 1823) v23 = v30 + a; else v26 = 1823;
+  if (a > 1824) v24 = v31 + a; else v27 = 1824;
+  if (a > 1825) v25 = v32 + a; else v28 = 1825;
+  if (a > 1826) v26 = v33 + a; else v29 = 1826;
+  if (a > 1827) v27 = v34 + a; else v30 = 1827;
+  if (a > 1828) v28 = v35 + a; else v31 = 1828;
+  if (a > 1829) v29 = v36 + a; else v32 = 1829;
+  if (a > 1830) v30 = v37 + a; else v33 = 1830;
+  if (a > 1831) v31 = v38 + a; else v34 = 1831;
+  if (a > 1832) v32 = v39 + a; else v35 = 1832;
+  if (a > 1833) v33 = v40 + a; else v36 = 1833;
+  if (a > 1834) v34 = v41 + a; else v37 = 1834;
+  if (a > 1835) v35 = v42 + a; else v38 = 1835;
+  if (a > 1836) v36 = v43 + a; else v39 = 1836;
+  if (a > 1837) v37 = v44 + a; else v40 = 1837;
+  if (a > 1838) v38 = v45 + a; else v41 = 1838;
+  if (a > 1839) v39 = v46 + a; else v42 = 1839;
+  if (a > 1840) v40 = v47 + a; else v43 = 1840;
+  if (a > 1841) v41 = v48 + a; else v44 = 1841;
+  if (a > 1842) v42 = v49 + a; else v45 = 1842;
+  if (a > 1843) v43 = v50 + a; else v46 = 1843;
+  if (a > 1844) v44 = v51 + a; else v47 = 1844;
+  if (a > 1845) v45 = v52 + a; else v48 = 1845;
+  if (a > 1846) v46 = v53 + a; else v49 = 1846;
+  if (a > 1847) v47 = v54 + a; else v50 = 1847;
+  if (a > 1848) v48 = v55 + a; else v51 = 1848;
+  if (a > 1849) v49 = v56 + a; else v52 = 1849;
+  if (a > 1850) v50 = v57 + a; else v53 = 1850;
+  if (a > 1851) v51 = v58 + a; else v54 = 1851;
+  if (a > 1852) v52 = v59 + a; else v55 = 1852;
+  if (a > 1853) v53 = v60 + a; else v56 = 1853;
+  if (a > 1854) v54 = v61 + a; else v57 = 1854;
+  if (a > 1855) v55 = v62 + a; else v58 = 1855;
+  if (a > 1856) v56 = v63 + a; else v59 = 1856;
+  if (a > 1857) v57 = v64 + a; else v60 = 1857;
+  if (a > 1858) v58 = v65 + a; else v61 = 1858;
+  if (a > 1859) v59 = v66 + a; else v62 = 1859;
+  if (a > 1860) v60 = v67 + a; else v63 = 1860;
+  if (a > 1861) v61 = v68 + a; else v64 = 1861;
+  if (a > 1862) v62 = v69 + a; else v65 = 1862;
+  if (a > 1863) v63 = v70 + a; else v66 = 1863;
+  if (a > 1864) v64 = v71 + a; else v67 = 1864;
+  if (a > 1865) v65 = v72 + a; else v68 = 1865;
+  if (a > 1866) v66 = v73 + a; else v69 = 1866;
+  if (a > 1867) v67 = v74 + a; else v70 = 1867;
+  if (a > 1868) v68 = v75 + a; else v71 = 1868;
+  if (a > 1869) v69 = v76 + a; else v72 = 1869;
+  if (a > 1870) v70 = v77 + a; else v73 = 1870;
+  if (a > 1871) v71 = v78 + a; else v74 = 1871;
+  if (a > 1872) v72 = v79 + a; else v75 = 1872;
+  if (a > 1873) v73 = v80 + a; else v76 = 1873;
+  if (a > 1874) v74 = v81 + a; else v77 = 1874;
+  if (a > 1875) v75 = v82 + a; else v78 = 1875;
+  if (a > 1876) v76 = v83 + a; else v79 = 1876;
+  if (a > 1877) v77 = v84 + a; else v80 = 1877;
+  if (a > 1878) v78 = v85 + a; else v81 = 1878;
+  if (a > 1879) v79 = v86 + a; else v82 = 1879;
+  if (a > 1880) v80 = v87 + a; else v83 = 1880;
+  if (a > 1881) v81 = v88 + a; else v84 = 1881;
+  if (a > 1882) v82 = v89 + a; else v85 = 1882;
+  if (a > 1883) v83 = v90 + a; else v86 = 1883;
+  if (a > 1884) v84 = v91 + a; else v87 = 1884;
+  if (a > 1885) v85 = v92 + a; else v88 = 1885;
+  if (a > 1886) v86 = v93 + a; else v89 = 1886;
+  if (a > 1887) v87 = v94 + a; else v90 = 1887;
+  if (a > 1888) v88 = v95 + a; else v91 = 1888;
+  if (a > 1889) v89 = v96 + a; else v92 = 1889;
+  if (a > 1890) v90 = v97 + a; else v93 = 1890;
+  if (a > 1891) v91 = v98 + a; else v94 = 1891;
+  if (a > 1892) v92 = v99 + a; else v95 = 1892;
+  if (a > 1893) v93 = v100 + a; else v96 = 1893;
+  if (a > 1894) v94 = v101 + a; else v97 = 1894;
+  if (a > 1895) v95 = v102 + a; else v98 = 1895;
+  if (a > 1896) v96 = v103 + a; else v99 = 1896;
+  if (a > 1897) v97 = v104 + a; else v100 = 1897;
+  if (a > 1898) v98 = v105 + a; else v101 = 1898;
+  if (a > 1899) v99 = v106 + a; else v102 = 1899;
+  if (a > 1900) v100 = v107 + a; else v103 = 1900;
+  if (a > 1901) v101 = v108 + a; else v104 = 1901;
+  if (a > 1902) v102 = v109 + a; else v105 = 1902;
+  if (a > 1903) v103 = v110 + a; else v106 = 1903;
+  if (a > 1904) v104 = v111 + a; else v107 = 1904;
+  if (a > 1905) v105 = v112 + a; else v108 = 1905;
+  if (a > 1906) v106 = v113 + a; else v109 = 1906;
+  if (a > 1907) v107 = v114 + a; else v110 = 1907;
+  if (a > 1908) v108 = v115 + a; else v111 = 1908;
+  if (a > 1909) v109 = v116 + a; else v112 = 1909;
+  if (a > 1910) v110 = v117 + a; else v113 = 1910;
+  if (a > 1911) v111 = v118 + a; else v114 = 1911;
+  if (a > 1912) v112 = v119 + a; else v115 = 1912;
+  if (a > 1913) v113 = v120 + a; else v116 = 1913;
+  if (a > 1914) v114 = v121 + a; else v117 = 1914;
+  if (a > 1915) v115 = v122 + a; else v118 = 1915;
+  if (a > 1916) v116 = v123 + a; else v119 = 1916;
+  if (a > 1917) v117 = v124 + a; else v120 = 1917;
+  if (a > 1918) v118 = v125 + a; else v121 = 1918;
+  if (a > 1919) v119 = v126 + a; else v122 = 1919;
+  if (a > 1920) v120 = v127 + a; else v123 = 1920;
+  if (a > 1921) v121 = v128 + a; else v124 = 1921;
+  if (a > 1922) v122 = v129 + a; else v125 = 1922;
+  if (a > 1923) v123 = v130 + a; else v126 = 1923;
+  if (a > 1924) v124 = v131 + a; else v127 = 1924;
+  if (a > 1925) v125 = v132 + a; else v128 = 1925;
+  if (a > 1926) v126 = v133 + a; else v129 = 1926;
+  if (a > 1927) v127 = v134 + a; else v130 = 1927;
+  if (a > 1928) v128 = v135 + a; else v131 = 1928;
+  if (a > 1929) v129 = v136 + a; else v132 = 1929;
+  if (a > 1930) v130 = v137 + a; else v133 = 1930;
+  if (a > 1931) v131 = v138 + a; else v134 = 1931;
+  if (a > 1932) v132 = v139 + a; else v135 = 1932;
+  if (a > 1933) v133 = v140 + a; else v136 = 1933;
+  if (a > 1934) v134 = v141 + a; else v137 = 1934;
+  if (a > 1935) v135 = v142 + a; else v138 = 1935;
+  if (a > 1936) v136 = v143 + a; else v139 = 1936;
+  if (a > 1937) v137 = v144 + a; else v140 = 1937;
+  if (a > 1938) v138 = v145 + a; else v141 = 1938;
+  if (a > 1939) v139 = v146 + a; else v142 = 1939;
+  if (a > 1940) v140 = v147 + a; else v143 = 1940;
+  if (a > 1941) v141 = v148 + a; else v144 = 1941;
+  if (a > 1942) v142 = v149 + a; else v145 = 1942;
+  if (a > 1943) v143 = v150 + a; else v146 = 1943;
+  if (a > 1944) v144 = v151 + a; else v147 = 1944;
+  if (a > 1945) v145 = v152 + a; else v148 = 1945;
+  if (a > 1946) v146 = v153 + a; else v149 = 1946;
+  if (a > 1947) v147 = v154 + a; else v150 = 1947;
+  if (a > 1948) v148 = v155 + a; else v151 = 1948;
+  if (a > 1949) v149 = v156 + a; else v152 = 1949;
+  if (a > 1950) v150 = v157 + a; else v153 = 1950;
+  if (a > 1951) v151 = v158 + a; else v154 = 1951;
+  if (a > 1952) v152 = v159 + a; else v155 = 1952;
+  if (a > 1953) v153 = v160 + a; else v156 = 1953;
+  if (a > 1954) v154 = v161 + a; else v157 = 1954;
+  if (a > 1955) v155 = v162 + a; else v158 = 1955;
+  if (a > 1956) v156 = v163 + a; else v159 = 1956;
+  if (a > 1957) v157 = v164 + a; else v160 = 1957;
+  if (a > 1958) v158 = v165 + a; else v161 = 1958;
+  if (a > 1959) v159 = v166 + a; else v162 = 1959;
+  if (a > 1960) v160 = v167 + a; else v163 = 1960;
+  if (a > 1961) v161 = v168 + a; else v164 = 1961;
+  if (a > 1962) v162 = v169 + a; else v165 = 1962;
+  if (a > 1963) v163 = v170 + a; else v166 = 1963;
+  if (a > 1964) v164 = v171 + a; else v167 = 1964;
+  if (a > 1965) v165 = v172 + a; else v168 = 1965;
+  if (a > 1966) v166 = v173 + a; else v169 = 1966;
+  if (a > 1967) v167 = v174 + a; else v170 = 1967;
+  if (a > 1968) v168 = v175 + a; else v171 = 1968;
+  if (a > 1969) v169 = v176 + a; else v172 = 1969;
+  if (a > 1970) v170 = v177 + a; else v173 = 1970;
+  if (a > 1971) v171 = v178 + a; else v174 = 1971;
+  if (a > 1972) v172 = v179 + a; else v175 = 1972;
+  if (a > 1973) v173 = v180 + a; else v176 = 1973;
+  if (a > 1974) v174 = v181 + a; else v177 = 1974;
+  if (a > 1975) v175 = v182 + a; else v178 = 1975;
+  if (a > 1976) v176 = v183 + a; else v179 = 1976;
+  if (a > 1977) v177 = v184 + a; else v180 = 1977;
+  if (a > 1978) v178 = v185 + a; else v181 = 1978;
+  if (a > 1979) v179 = v186 + a; else v182 = 1979;
+  if (a > 1980) v180 = v187 + a; else v183 = 1980;
+  if (a > 1981) v181 = v188 + a; else v184 = 1981;
+  if (a > 1982) v182 = v189 + a; else v185 = 1982;
+  if (a > 1983) v183 = v190 + a; else v186 = 1983;
+  if (a > 1984) v184 = v191 + a; else v187 = 1984;
+  if (a > 1985) v185 = v192 + a; else v188 = 1985;
+  if (a > 1986) v186 = v193 + a; else v189 = 1986;
+  if (a > 1987) v187 = v194 + a; else v190 = 1987;
+  if (a > 1988) v188 = v195 + a; else v191 = 1988;
+  if (a > 1989) v189 = v196 + a; else v192 = 1989;
+  if (a > 1990) v190 = v197 + a; else v193 = 1990;
+  if (a > 1991) v191 = v198 + a; else v194 = 1991;
+  if (a > 1992) v192 = v199 + a; else v195 = 1992;
+  if (a > 1993) v193 = v0 + a; else v196 = 1993;
+  if (a > 1994) v194 = v1 + a; else v197 = 1994;
+  if (a > 1995) v195 = v2 + a; else v198 = 1995;
+  if (a > 1996) v196 = v3 + a; else v199 = 1996;
+  if (a > 1997) v197 = v4 + a; else v0 = 1997;
+  if (a > 1998) v198 = v5 + a; else v1 = 1998;
+  if (a > 1999) v199 = v6 + a; else v2 = 1999;
+  if (a > 2000) v0 = v7 + a; else v3 = 2000;
+  if (a > 2001) v1 = v8 + a; else v4 = 2001;
+  if (a > 2002) v2 = v9 + a; else v5 = 2002;
+  if (a > 2003) v3 = v10 + a; else v6 = 2003;
+  if (a > 2004) v4 = v11 + a; else v7 = 2004;
+  if (a > 2005) v5 = v12 + a; else v8 = 2005;
+  if (a > 2006) v6 = v13 + a; else v9 = 2006;
+  if (a > 2007) v7 = v14 + a; else v10 = 2007;
+  if (a > 2008) v8 = v15 + a; else v11 = 2008;
+  if (a > 2009) v9 = v16 + a; else v12 = 2009;
+  if (a > 2010) v10 = v17 + a; else v13 = 2010;
+  if (a > 2011) v11 = v18 + a; else v14 = 2011;
+  if (a > 2012) v12 = v19 + a; else v15 = 2012;
+  if (a > 2013) v13 = v20 + a; else v16 = 2013;
+  if (a > 2014) v14 = v21 + a; else v17 = 2014;
+  if (a > 2015) v15 = v22 + a; else v18 = 2015;
+  if (a > 2016) v16 = v23 + a; else v19 = 2016;
+  if (a > 2017) v17 = v24 + a; else v20 = 2017;
+  if (a > 2018) v18 = v25 + a; else v21 = 2018;
+  if (a > 2019) v19 = v26 + a; else v22 = 2019;
+  if (a > 2020) v20 = v27 + a; else v23 = 2020;
+  if (a > 2021) v21 = v28 + a; else v24 = 2021;
+  if (a > 2022) v22 = v29 + a; else v25 = 2022;
+  if (a > 2023) v23 = v30 + a; else v26 = 2023;
+  if (a > 2024) v24 = v31 + a; else v27 = 2024;
+  if (a > 2025) v25 = v32 + a; else v28 = 2025;
+  if (a > 2026) v26 = v33 + a; else v29 = 2026;
+  if (a > 2027) v27 = v34 + a; else v30 = 2027;
+  if (a > 2028) v28 = v35 + a; else v31 = 2028;
+  if (a > 2029) v29 = v36 + a; else v32 = 2029;
+  if (a > 2030) v30 = v37 + a; else v33 = 2030;
+  if (a > 2031) v31 = v38 + a; else v34 = 2031;
+  if (a > 2032) v32 = v39 + a; else v35 = 2032;
+  if (a > 2033) v33 = v40 + a; else v36 = 2033;
+  if (a > 2034) v34 = v41 + a; else v37 = 2034;
+  if (a > 2035) v35 = v42 + a; else v38 = 2035;
+  if (a > 2036) v36 = v43 + a; else v39 = 2036;
+  if (a > 2037) v37 = v44 + a; else v40 = 2037;
+  if (a > 2038) v38 = v45 + a; else v41 = 2038;
+  if (a > 2039) v39 = v46 + a; else v42 = 2039;
+  if (a > 2040) v40 = v47 + a; else v43 = 2040;
+  if (a > 2041) v41 = v48 + a; else v44 = 2041;
+  if (a > 2042) v42 = v49 + a; else v45 = 2042;
+  if (a > 2043) v43 = v50 + a; else v46 = 2043;
+  if (a > 2044) v44 = v51 + a; else v47 = 2044;
+  if (a > 2045) v45 = v52 + a; else v48 = 2045;
+  if (a > 2046) v46 = v53 + a; else v49 = 2046;
+  if (a > 2047) v47 = v54 + a; else v50 = 2047;
+  if (a > 2048) v48 = v55 + a; else v51 = 2048;
+  if (a > 2049) v49 = v56 + a; else v52 = 2049;
+  if (a > 2050) v50 = v57 + a; else v53 = 2050;
+  if (a > 2051) v51 = v58 + a; else v54 = 2051;
+  if (a > 2052) v52 = v59 + a; else v55 = 2052;
+  if (a > 2053) v53 = v60 + a; else v56 = 2053;
+  if (a > 2054) v54 = v61 + a; else v57 = 2054;
+  if (a > 2055) v55 = v62 + a; else v58 = 2055;
+  if (a > 2056) v56 = v63 + a; else v59 = 2056;
+  if (a > 2057) v57 = v64 + a; else v60 = 2057;
+  if (a > 2058) v58 = v65 + a; else v61 = 2058;
+  if (a > 2059) v59 = v66 + a; else v62 = 2059;
+  if (a > 2060) v60 = v67 + a; else v63 = 2060;
+  if (a > 2061) v61 = v68 + a; else v64 = 2061;
+  if (a > 2062) v62 = v69 + a; else v65 = 2062;
+  if (a > 2063) v63 = v70 + a; else v66 = 2063;
+  if (a > 2064) v64 = v71 + a; else v67 = 2064;
+  if (a > 2065) v65 = v72 + a; else v68 = 2065;
+  if (a > 2066) v66 = v73 + a; else v69 = 2066;
+  if (a > 2067) v67 = v74 + a; else v70 = 2067;
+  if (a > 2068) v68 = v75 + a; else v71 = 2068;
+  if (a > 2069) v69 = v76 + a; else v72 = 2069;
+  if (a > 2070) v70 = v77 + a; else v73 = 2070;
+  if (a > 2071) v71 = v78 + a; else v74 = 2071;
+  if (a > 2072) v72 = v79 + a; else v75 = 2072;
+  if (a > 2073) v73 = v80 + a; else v76 = 2073;
+  if (a > 2074) v74 = v81 + a; else v77 = 2074;
+  if (a > 2075) v75 = v82 + a; else v78 = 2075;
+  if (a > 2076) v76 = v83 + a; else v79 = 2076;
+  if (a > 2077) v77 = v84 + a; else v80 = 2077;
+  if (a > 2078) v78 = v85 + a; else v81 = 2078;
+  if (a > 2079) v79 = v86 + a; else v82 = 2079;
+  if (a > 2080) v80 = v87 + a; else v83 = 2080;
+  if (a > 2081) v81 = v88 + a; else v84 = 2081;
+  if (a > 2082) v82 = v89 + a; else v85 = 2082;
+  if (a > 2083) v83 = v90 + a; else v86 = 2083;
+  if (a > 2084) v84 = v91 + a; else v87 = 2084;
+  if (a > 2085) v85 = v92 + a; else v88 = 2085;
+  if (a > 2086) v86 = v93 + a; else v89 = 2086;
+  if (a > 2087) v87 = v94 + a; else v90 = 2087;
+  if (a > 2088) v88 = v95 + a; else v91 = 2088;
+  if (a > 2089) v89 = v96 + a; else v92 = 2089;
+  if (a > 2090) v90 = v97 + a; else v93 = 2090;
+  if (a > 2091) v91 = v98 + a; else v94 = 2091;
+  if (a > 2092) v92 = v99 + a; else v95 = 2092;
+  if (a > 2093) v93 = v100 + a; else v96 = 2093;
+  if (a > 2094) v94 = v101 + a; else v97 = 2094;
+  if (a > 2095) v95 = v102 + a; else v98 = 2095;
+  if (a > 2096) v96 = v103 + a; else v99 = 2096;
+  if (a > 2097) v97 = v104 + a; else v100 = 2097;
+  if (a > 2098) v98 = v105 + a; else v101 = 2098;
+  if (a > 2099) v99 = v106 + a; else v102 = 2099;
+  if (a > 2100) v100 = v107 + a; else v103 = 2100;
+  if (a > 2101) v101 = v108 + a; else v104 = 2101;
+  if (a > 2102) v102 = v109 + a; else v105 = 2102;
+  if (a > 2103) v103 = v110 + a; else v106 = 2103;
+  if (a > 2104) v104 = v111 + a; else v107 = 2104;
+  if (a > 2105) v105 = v112 + a; else v108 = 2105;
+  if (a > 2106) v106 = v113 + a; else v109 = 2106;
+  if (a > 2107) v107 = v114 + a; else v110 = 2107;
+  if (a > 2108) v108 = v115 + a; else v111 = 2108;
+  if (a > 2109) v109 = v116 + a; else v112 = 2109;
+  if (a > 2110) v110 = v117 + a; else v113 = 2110;
+  if (a > 2111) v111 = v118 + a; else v114 = 2111;
+  if (a > 2112) v112 = v119 + a; else v115 = 2112;
+  if (a > 2113) v113 = v120 + a; else v116 = 2113;
+  if (a > 2114) v114 = v121 + a; else v117 = 2114;
+  if (a > 2115) v115 = v122 + a; else v118 = 2115;
+  if (a > 2116) v116 = v123 + a; else v119 = 2116;
+  if (a > 2117) v117 = v124 + a; else v120 = 2117;
+  if (a > 2118) v118 = v125 + a; else v121 = 2118;
+  if (a > 2119) v119 = v126 + a; else v122 = 2119;
+  if (a > 2120) v120 = v127 + a; else v123 = 2120;
+  if (a > 2121) v121 = v128 + a; else v124 = 2121;
+  if (a > 2122) v122 = v129 + a; else v125 = 2122;
+  if (a > 2123) v123 = v130 + a; else v126 = 2123;
+  if (a > 2124) v124 = v131 + a; else v127 = 2124;
+  if (a > 2125) v125 = v132 + a; else v128 = 2125;
+  if (a > 2126) v126 = v133 + a; else v129 = 2126;
+  if (a > 2127) v127 = v134 + a; else v130 = 2127;
+  if (a > 2128) v128 = v135 + a; else v131 = 2128;
+  if (a > 2129) v129 = v136 + a; else v132 = 2129;
+  if (a > 2130) v130 = v137 + a; else v133 = 2130;
+  if (a > 2131) v131 = v138 + a; else v134 = 2131;
+  if (a > 2132) v132 = v139 + a; else v135 = 2132;
+  if (a > 2133) v133 = v140 + a; else v136 = 2133;
+  if (a > 2134) v134 = v141 + a; else v137 = 2134;
+  if (a > 2135) v135 = v142 + a; else v138 = 2135;
+  if (a > 2136) v136 = v143 + a; else v139 = 2136;
+  if (a > 2137) v137 = v144 + a; else v140 = 2137;
+  if (a > 2138) v138 = v145 + a; else v141 = 2138;
+  if (a > 2139) v139 = v146 + a; else v142 = 2139;
+  if (a > 2140) v140 = v147 + a; else v143 = 2140;
+  if (a > 2141) v141 = v148 + a; else v144 = 2141;
+  if (a > 2142) v142 = v149 + a; else v145 = 2142;
+  if (a > 2143) v143 = v150 + a; else v146 = 2143;
+  if (a > 2144) v144 = v151 + a; else v147 = 2144;
+  if (a > 2145) v145 = v152 + a; else v148 = 2145;
+  if (a > 2146) v146 = v153 + a; else v149 = 2146;
+  if (a > 2147) v147 = v154 + a; else v150 = 2147;
+  if (a > 2148) v148 = v155 + a; else v151 = 2148;
+  if (a > 2149) v149 = v156 + a; else v152 = 2149;
+  if (a > 2150) v150 = v157 + a; else v153 = 2150;
+  if (a > 2151) v151 = v158 + a; else v154 = 2151;
+  if (a > 2152) v152 = v159 + a; else v155 = 2152;
+  if (a > 2153) v153 = v160 + a; else v156 = 2153;
+  if (a > 2154) v154 = v161 + a; else v157 = 2154;
+  if (a > 2155) v155 = v162 + a; else v158 = 2155;
+  if (a > 2156) v156 = v163 + a; else v159 = 2156;
+  if (a > 2157) v157 = v164 + a; else v160 = 2157;
+  if (a > 2158) v158 = v165 + a; else v161 = 2158;
+  if (a > 2159) v159 = v166 + a; else v162 = 2159;
+  if (a > 2160) v160 = v167 + a; else v163 = 2160;
+  if (a > 2161) v161 = v168 + a; else v164 = 2161;
+  if (a > 2162) v162 = v169 + a; else v165 = 2162;
+  if (a > 2163) v163 = v170 + a; else v166 = 2163;
+  if (a > 2164) v164 = v171 + a; else v167 = 2164;
+  if (a > 2165) v165 = v172 + a; else v168 = 2165;
+  if (a > 2166) v166 = v173 + a; else v169 = 2166;
+  if (a > 2167) v167 = v174 + a; else v170 = 2167;
+  if (a > 2168) v168 = v175 + a; else v171 = 2168;
+  if (a > 2169) v169 = v176 + a; else v172 = 2169;
+  if (a > 2170) v170 = v177 + a; else v173 = 2170;
+  if (a > 2171) v171 = v178 + a; else v174 = 2171;
+  if (a > 2172) v172 = v179 + a; else v175 = 2172;
+  if (a > 2173) v173 = v180 + a; else v176 = 2173;
+  if (a > 2174) v174 = v181 + a; else v177 = 2174;
+  if (a > 2175) v175 = v182 + a; else v178 = 2175;
+  if (a > 2176) v176 = v183 + a; else v179 = 2176;
+  if (a > 2177) v177 = v184 + a; else v180 = 2177;
+  if (a > 2178) v178 = v185 + a; else v181 = 2178;
+  if (a > 2179) v179 = v186 + a; else v182 = 2179;
+  if (a > 2180) v180 = v187 + a; else v183 = 2180;
+  if (a > 2181) v181 = v188 + a; else v184 = 2181;
+  if (a > 2182) v182 = v189 + a; else v185 = 2182;
+  if (a > 2183) v183 = v190 + a; else v186 = 2183;
+  if (a > 2184) v184 = v191 + a; else v187 = 2184;
+  if (a > 2185) v185 = v192 + a; else v188 = 2185;
+  if (a > 2186) v186 = v193 + a; else v189 = 2186;
+  if (a > 2187) v187 = v194 + a; else v190 = 2187;
+  if (a > 2188) v188 = v195 + a; else v191 = 2188;
+  if (a > 2189) v189 = v196 + a; else v192 = 2189;
+  if (a > 2190) v190 = v197 + a; else v193 = 2190;
+  if (a > 2191) v191 = v198 + a; else v194 = 2191;
+  if (a > 2192) v192 = v199 + a; else v195 = 2192;
+  if (a > 2193) v193 = v0 + a; else v196 = 2193;
+  if (a > 2194) v194 = v1 + a; else v197 = 2194;
+  if (a > 2195) v195 = v2 + a; else v198 = 2195;
+  if (a > 2196) v196 = v3 + a; else v199 = 2196;
+  if (a > 2197) v197 = v4 + a; else v0 = 2197;
+  if (a > 2198) v198 = v5 + a; else v1 = 2198;
+  if (a > 2199) v199 = v6 + a; else v2 = 2199;
+  if (a > 2200) v0 = v7 + a; else v3 = 2200;
+  if (a > 2201) v1 = v8 + a; else v4 = 2201;
+  if (a > 2202) v2 = v9 + a; else v5 = 2202;
+  if (a > 2203) v3 = v10 + a; else v6 = 2203;
+  if (a > 2204) v4 = v11 + a; else v7 = 2204;
+  if (a > 2205) v5 = v12 + a; else v8 = 2205;
+  if (a > 2206) v6 = v13 + a; else v9 = 2206;
+  if (a > 2207) v7 = v14 + a; else v10 = 2207;
+  if (a > 2208) v8 = v15 + a; else v11 = 2208;
+  if (a > 2209) v9 = v16 + a; else v12 = 2209;
+  if (a > 2210) v10 = v17 + a; else v13 = 2210;
+  if (a > 2211) v11 = v18 + a; else v14 = 2211;
+  if (a > 2212) v12 = v19 + a; else v15 = 2212;
+  if (a > 2213) v13 = v20 + a; else v16 = 2213;
+  if (a > 2214) v14 = v21 + a; else v17 = 2214;
+  if (a > 2215) v15 = v22 + a; else v18 = 2215;
+  if (a > 2216) v16 = v23 + a; else v19 = 2216;
+  if (a > 2217) v17 = v24 + a; else v20 = 2217;
+  if (a > 2218) v18 = v25 + a; else v21 = 2218;
+  if (a > 2219) v19 = v26 + a; else v22 = 2219;
+  if (a > 2220) v20 = v27 + a; else v23 = 2220;
+  if (a > 2221) v21 = v28 + a; else v24 = 2221;
+  if (a > 2222) v22 = v29 + a; else v25 = 2222;
+  if (a > 2223) v23 = v30 + a; else v26 = 2223;
+  if (a > 2224) v24 = v31 + a; else v27 = 2224;
+  if (a > 2225) v25 = v32 + a; else v28 = 2225;
+  if (a > 2226) v26 = v33 + a; else v29 = 2226;
+  if (a > 2227) v27 = v34 + a; else v30 = 2227;
+  if (a > 2228) v28 = v35 + a; else v31 = 2228;
+  if (a > 2229) v29 = v36 + a; else v32 = 2229;
+  if (a > 2230) v30 = v37 + a; else v33 = 2230;
+  if (a > 2231) v31 = v38 + a; else v34 = 2231;
+  if (a > 2232) v32 = v39 + a; else v35 = 2232;
+  if (a > 2233) v33 = v40 + a; else v36 = 2233;
+  if (a > 2234) v34 = v41 + a; else v37 = 2234;
+  if (a > 2235) v35 = v42 + a; else v38 = 2235;
+  if (a > 2236) v36 = v43 + a; else v39 = 2236;
+  if (a > 2237) v37 = v44 + a; else v40 = 2237;
+  if (a > 2238) v38 = v45 + a; else v41 = 2238;
+  if (a > 2239) v39 = v46 + a; else v42 = 2239;
+  if (a > 2240) v40 = v47 + a; else v43 = 2240;
+  if (a > 2241) v41 = v48 + a; else v44 = 2241;
+  if (a > 2242) v42 = v49 + a; else v45 = 2242;
+  if (a > 2243) v43 = v50 + a; else v46 = 2243;
+  if (a > 2244) v44 = v51 + a; else v47 = 2244;
+  if (a > 2245) v45 = v52 + a; else v48 = 2245;
+  if (a > 2246) v46 = v53 + a; else v49 = 2246;
+  if (a > 2247) v47 = v54 + a; else v50 = 2247;
+  if (a > 2248) v48 = v55 + a; else v51 = 2248;
+  if (a > 2249) v49 = v56 + a; else v52 = 2249;
+  if (a > 2250) v50 = v57 + a; else v53 = 2250;
+  if (a > 2251) v51 = v58 + a; else v54 = 2251;
+  if (a > 2252) v52 = v59 + a; else v55 = 2252;
+  if (a > 2253) v53 = v60 + a; else v56 = 2253;
+  if (a > 2254) v54 = v61 + a; else v57 = 2254;
+  if (a > 2255) v55 = v62 + a; else v58 = 2255;
+  if (a > 2256) v56 = v63 + a; else v59 = 2256;
+  if (a > 2257) v57 = v64 + a; else v60 = 2257;
+  if (a > 2258) v58 = v65 + a; else v61 = 2258;
+  if (a > 2259) v59 = v66 + a; else v62 = 2259;
+  if (a > 2260) v60 = v67 + a; else v63 = 2260;
+  if (a > 2261) v61 = v68 + a; else v64 = 2261;
+  if (a > 2262) v62 = v69 + a; else v65 = 2262;
+  if (a > 2263) v63 = v70 + a; else v66 = 2263;
+  if (a > 2264) v64 = v71 + a; else v67 = 2264;
+  if (a > 2265) v65 = v72 + a; else v68 = 2265;
+  if (a > 2266) v66 = v73 + a; else v69 = 2266;
+  if (a > 2267) v67 = v74 + a; else v70 = 2267;
+  if (a > 2268) v68 = v75 + a; else v71 = 2268;
+  if (a > 2269) v69 = v76 + a; else v72 = 2269;
+  if (a > 2270) v70 = v77 + a; else v73 = 2270;
+  if (a > 2271) v71 = v78 + a; else v74 = 2271;
+  if (a > 2272) v72 = v79 + a; else v75 = 2272;
+  if (a > 2273) v73 = v80 + a; else v76 = 2273;
+  if (a > 2274) v74 = v81 + a; else v77 = 2274;
+  if (a > 2275) v75 = v82 + a; else v78 = 2275;
+  if (a > 2276) v76 = v83 + a; else v79 = 2276;
+  if (a > 2277) v77 = v84 + a; else v80 = 2277;
+  if (a > 2278) v78 = v85 + a; else v81 = 2278;
+  if (a > 2279) v79 = v86 + a; else v82 = 2279;
+  if (a > 2280) v80 = v87 + a; else v83 = 2280;
+  if (a > 2281) v81 = v88 + a; else v84 = 2281;
+  if (a > 2282) v82 = v89 + a; else v85 = 2282;
+  if (a > 2283) v83 = v90 + a; else v86 = 2283;
+  if (a > 2284) v84 = v91 + a; else v87 = 2284;
+  if (a > 2285) v85 = v92 + a; else v88 = 2285;
+  if (a > 2286) v86 = v93 + a; else v89 = 2286;
+  if (a > 2287) v87 = v94 + a; else v90 = 2287;
+  if (a > 2288) v88 = v95 + a; else v91 = 2288;
+  if (a > 2289) v89 = v96 + a; else v92 = 2289;
+  if (a > 2290) v90 = v97 + a; else v93 = 2290;
+  if (a > 2291) v91 = v98 + a; else v94 = 2291;
+  if (a > 2292) v92 = v99 + a; else v95 = 2292;
+  if (a > 2293) v93 = v100 + a; else v96 = 2293;
+  if (a > 2294) v94 = v101 + a; else v97 = 2294;
+  if (a > 2295) v95 = v102 + a; else v98 = 2295;
+  if (a > 2296) v96 = v103 + a; else v99 = 2296;
+  if (a > 2297) v97 = v104 + a; else v100 = 2297;
+  if (a > 2298) v98 = v105 + a; else v101 = 2298;
+  if (a > 2299) v99 = v106 + a; else v102 = 2299;
+  if (a > 2300) v100 = v107 + a; else v103 = 2300;
+  if (a > 2301) v101 = v108 + a; else v104 = 2301;
+  if (a > 2302) v102 = v109 + a; else v105 = 2302;
+  if (a > 2303) v103 = v110 + a; else v106 = 2303;
+  if (a > 2304) v104 = v111 + a; else v107 = 2304;
+  if (a > 2305) v105 = v112 + a; else v108 = 2305;
+  if (a > 2306) v106 = v113 + a; else v109 = 2306;
+  if (a > 2307) v107 = v114 + a; else v110 = 2307;
+  if (a > 2308) v108 = v115 + a; else v111 = 2308;
+  if (a > 2309) v109 = v116 + a; else v112 = 2309;
+  if (a > 2310) v110 = v117 + a; else v113 = 2310;
+  if (a > 2311) v111 = v118 + a; else v114 = 2311;
+  if (a > 2312) v112 = v119 + a; else v115 = 2312;
+  if (a > 2313) v113 = v120 + a; else v116 = 2313;
+  if (a > 2314) v114 = v121 + a; else v117 = 2314;
+  if (a > 2315) v115 = v122 + a; else v118 = 2315;
+  if (a > 2316) v116 = v123 + a; else v119 = 2316;
+  if (a > 2317) v117 = v124 + a; else v120 = 2317;
+  if (a > 2318) v118 = v125 + a; else v121 = 2318;
+  if (a > 2319) v119 = v126 + a; else v122 = 2319;
+  if (a > 2320) v120 = v127 + a; else v123 = 2320;
+  if (a > 2321) v121 = v128 + a; else v124 = 2321;
+  if (a > 2322) v122 = v129 + a; else v125 = 2322;
+  if (a > 2323) v123 = v130 + a; else v126 = 2323;
+  if (a > 2324) v124 = v131 + a; else v127 = 2324;
+  if (a > 2325) v125 = v132 + a; else v128 = 2325;
+  if (a > 2326) v126 = v133 + a; else v129 = 2326;
+  if (a > 2327) v127 = v134 + a; else v130 = 2327;
+  if (a > 2328) v128 = v135 + a; else v131 = 2328;
+  if (a > 2329) v129 = v136 + a; else v132 = 2329;
+  if (a > 2330) v130 = v137 + a; else v133 = 2330;
+  if (a > 2331) v131 = v138 + a; else v134 = 2331;
+  if (a > 2332) v132 = v139 + a; else v135 = 2332;
+  if (a > 2333) v133 = v140 + a; else v136 = 2333;
+  if (a > 2334) v134 = v141 + a; else v137 = 2334;
+  if (a > 2335) v135 = v142 + a; else v138 = 2335;
+  if (a > 2336) v136 = v143 + a; else v139 = 2336;
+  if (a > 2337) v137 = v144 + a; else v140 = 2337;
+  if (a > 2338) v138 = v145 + a; else v141 = 2338;
+  if (a > 2339) v139 = v146 + a; else v142 = 2339;
+  if (a > 2340) v140 = v147 + a; else v143 = 2340;
+  if (a > 2341) v141 = v148 + a; else v144 = 2341;
+  if (a > 2342) v142 = v149 + a; else v145 = 2342;
+  if (a > 2343) v143 = v150 + a; else v146 = 2343;
+  if (a > 2344) v144 = v151 + a; else v147 = 2344;
+  if (a > 2345) v145 = v152 + a; else v148 = 2345;
+  if (a > 2346) v146 = v153 + a; else v149 = 2346;
+  if (a > 2347) v147 = v154 + a; else v150 = 2347;
+  if (a > 2348) v148 = v155 + a; else v151 = 2348;
+  if (a > 2349) v149 = v156 + a; else v152 = 2349;
+  if (a > 2350) v150 = v157 + a; else v153 = 2350;
+  if (a > 2351) v151 = v158 + a; else v154 = 2351;
+  if (a > 2352) v152 = v159 + a; else v155 = 2352;
+  if (a > 2353) v153 = v160 + a; else v156 = 2353;
+  if (a > 2354) v154 = v161 + a; else v157 = 2354;
+  if (a > 2355) v155 = v162 + a; else v158 = 2355;
+  if (a > 2356) v156 = v163 + a; else v159 = 2356;
+  if (a > 2357) v157 = v164 + a; else v160 = 2357;
+  if (a > 2358) v158 = v165 + a; else v161 = 2358;
+  if (a > 2359) v159 = v166 + a; else v162 = 2359;
+  if (a > 2360) v160 = v167 + a; else v163 = 2360;
+  if (a > 2361) v161 = v168 + a; else v164 = 2361;
+  if (a > 2362) v162 = v169 + a; else v165 = 2362;
+  if (a > 2363) v163 = v170 + a; else v166 = 2363;
+  if (a > 2364) v164 = v171 + a; else v167 = 2364;
+  if (a > 2365) v165 = v172 + a; else v168 = 2365;
+  if (a > 2366) v166 = v173 + a; else v169 = 2366;
+  if (a > 2367) v167 = v174 + a; else v170 = 2367;
+  if (a > 2368) v168 = v175 + a; else v171 = 2368;
+  if (a > 2369) v169 = v176 + a; else v172 = 2369;
+  if (a > 2370) v170 = v177 + a; else v173 = 2370;
+  if (a > 2371) v171 = v178 + a; else v174 = 2371;
+  if (a > 2372) v172 = v179 + a; else v175 = 2372;
+  if (a > 2373) v173 = v180 + a; else v176 = 2373;
+  if (a > 2374) v174 = v181 + a; else v177 = 2374;
+  if (a > 2375) v175 = v182 + a; else v178 = 2375;
+  if (a > 2376) v176 = v183 + a; else v179 = 2376;
+  if (a > 2377) v177 = v184 + a; else v180 = 2377;
+  if (a > 2378) v178 = v185 + a; else v181 = 2378;
+  if (a > 2379) v179 = v186 + a; else v182 = 2379;
+  if (a > 2380) v180 = v187 + a; else v183 = 2380;
+  if (a > 2381) v181 = v188 + a; else v184 = 2381;
+  if (a > 2382) v182 = v189 + a; else v185 = 2382;
+  if (a > 2383) v183 = v190 + a; else v186 = 2383;
+  if (a > 2384) v184 = v191 + a; else v187 = 2384;
+  if (a > 2385) v185 = v192 + a; else v188 = 2385;
+  if (a > 2386) v186 = v193 + a; else v189 = 2386;
+  if (a > 2387) v187 = v194 + a; else v190 = 2387;
+  if (a > 2388) v188 = v195 + a; else v191 = 2388;
+  if (a > 2389) v189 = v196 + a; else v192 = 2389;
+  if (a > 2390) v190 = v197 + a; else v193 = 2390;
+  if (a > 2391) v191 = v198 + a; else v194 = 2391;
+  if (a > 2392) v192 = v199 + a; else v195 = 2392;
+  if (a > 2393) v193 = v0 + a; else v196 = 2393;
+  if (a > 2394) v194 = v1 + a; else v197 = 2394;
+  if (a > 2395) v195 = v2 + a; else v198 = 2395;
+  if (a > 2396) v196 = v3 + a; else v199 = 2396;
+  if (a > 2397) v197 = v4 + a; else v0 = 2397;
+  if (a > 2398) v198 = v5 + a; else v1 = 2398;
+  if (a > 2399) v199 = v6 + a; else v2 = 2399;
+  if (a > 2400) v0 = v7 + a; else v3 = 2400;
+  if (a > 2401) v1 = v8 + a; else v4 = 2401;
+  if (a > 2402) v2 = v9 + a; else v5 = 2402;
+  if (a > 2403) v3 = v10 + a; else v6 = 2403;
+  if (a > 2404) v4 = v11 + a; else v7 = 2404;
+  if (a > 2405) v5 = v12 + a; else v8 = 2405;
+  if (a > 2406) v6 = v13 + a; else v9 = 2406;
+  if (a > 2407) v7 = v14 + a; else v10 = 2407;
+  if (a > 2408) v8 = v15 + a; else v11 = 2408;
+  if (a > 2409) v9 = v16 + a; else v12 = 2409;
+  if (a > 2410) v10 = v17 + a; else v13 = 2410;
+  if (a > 2411) v11 = v18 + a; else v14 = 2411;
+  if (a > 2412) v12 = v19 + a; else v15 = 2412;
+  if (a > 2413) v13 = v20 + a; else v16 = 2413;
+  if (a > 2414) v14 = v21 + a; else v17 = 2414;
+  if (a > 2415) v15 = v22 + a; else v18 = 2415;
+  if (a > 2416) v16 = v23 + a; else v19 = 2416;
+  if (a > 2417) v17 = v24 + a; else v20 = 2417;
+  if (a > 2418) v18 = v25 + a; else v21 = 2418;
+  if (a > 2419) v19 = v26 + a; else v22 = 2419;
+  if (a > 2420) v20 = v27 + a; else v23 = 2420;
+  if (a > 2421) v21 = v28 + a; else v24 = 2421;
+  if (a > 2422) v22 = v29 + a; else v25 = 2422;
+  if (a > 2423) v23 = v30 + a; else v26 = 2423;
+  if (a > 2424) v24 = v31 + a; else v27 = 2424;
+  if (a > 2425) v25 = v32 + a; else v28 = 2425;
+  if (a > 2426) v26 = v33 + a; else v29 = 2426;
+  if (a > 2427) v27 = v34 + a; else v30 = 2427;
+  if (a > 2428) v28 = v35 + a; else v31 = 2428;
+  if (a > 2429) v29 = v36 + a; else v32 = 2429;
+  if (a > 2430) v30 = v37 + a; else v33 = 2430;
+  if (a > 2431) v31 = v38 + a; else v34 = 2431;
+  if (a > 2432) v32 = v39 + a; else v35 = 2432;
+  if (a > 2433) v33 = v40 + a; else v36 = 2433;
+  if (a > 2434) v34 = v41 + a; else v37 = 2434;
+  if (a > 2435) v35 = v42 + a; else v38 = 2435;
+  if (a > 2436) v36 = v43 + a; else v39 = 2436;
+  if (a > 2437) v37 = v44 + a; else v40 = 2437;
+  if (a > 2438) v38 = v45 + a; else v41 = 2438;
+  if (a > 2439) v39 = v46 + a; else v42 = 2439;
+  if (a > 2440) v40 = v47 + a; else v43 = 2440;
+  if (a > 2441) v41 = v48 + a; else v44 = 2441;
+  if (a > 2442) v42 = v49 + a; else v45 = 2442;
+  if (a > 2443) v43 = v50 + a; else v46 = 2443;
+  if (a > 2444) v44 = v51 + a; else v47 = 2444;
+  if (a > 2445) v45 = v52 + a; else v48 = 2445;
+  if (a > 2446) v46 = v53 + a; else v49 = 2446;
+  if (a > 2447) v47 = v54 + a; else v50 = 2447;
+  if (a > 2448) v48 = v55 + a; else v51 = 2448;
+  if (a > 2449) v49 = v56 + a; else v52 = 2449;
+  if (a > 2450) v50 = v57 + a; else v53 = 2450;
+  if (a > 2451) v51 = v58 + a; else v54 = 2451;
+  if (a > 2452) v52 = v59 + a; else v55 = 2452;
+  if (a > 2453) v53 = v60 + a; else v56 = 2453;
+  if (a > 2454) v54 = v61 + a; else v57 = 2454;
+  if (a > 2455) v55 = v62 + a; else v58 = 2455;
+  if (a > 2456) v56 = v63 + a; else v59 = 2456;
+  if (a > 2457) v57 = v64 + a; else v60 = 2457;
+  if (a > 2458) v58 = v65 + a; else v61 = 2458;
+  if (a > 2459) v59 = v66 + a; else v62 = 2459;
+  if (a > 2460) v60 = v67 + a; else v63 = 2460;
+  if (a > 2461) v61 = v68 + a; else v64 = 2461;
+  if (a > 2462) v62 = v69 + a; else v65 = 2462;
+  if (a > 2463) v63 = v70 + a; else v66 = 2463;
+  if (a > 2464) v64 = v71 + a; else v67 = 2464;
+  if (a > 2465) v65 = v72 + a; else v68 = 2465;
+  if (a > 2466) v66 = v73 + a; else v69 = 2466;
+  if (a > 2467) v67 = v74 + a; else v70 = 2467;
+  if (a > 2468) v68 = v75 + a; else v71 = 2468;
+  if (a > 2469) v69 = v76 + a; else v72 = 2469;
+  if (a > 2470) v70 = v77 + a; else v73 = 2470;
+  if (a > 2471) v71 = v78 + a; else v74 = 2471;
+  if (a > 2472) v72 = v79 + a; else v75 = 2472;
+  if (a > 2473) v73 = v80 + a; else v76 = 2473;
+  if (a > 2474) v74 = v81 + a; else v77 = 2474;
+  if (a > 2475) v75 = v82 + a; else v78 = 2475;
+  if (a > 2476) v76 = v83 + a; else v79 = 2476;
+  if (a > 2477) v77 = v84 + a; else v80 = 2477;
+  if (a > 2478) v78 = v85 + a; else v81 = 2478;
+  if (a > 2479) v79 = v86 + a; else v82 = 2479;
+  if (a > 2480) v80 = v87 + a; else v83 = 2480;
+  if (a > 2481) v81 = v88 + a; else v84 = 2481;
+  if (a > 2482) v82 = v89 + a; else v85 = 2482;
+  if (a > 2483) v83 = v90 + a; else v86 = 2483;
+  if (a > 2484) v84 = v91 + a; else v87 = 2484;
+  if (a > 2485) v85 = v92 + a; else v88 = 2485;
+  if (a > 2486) v86 = v93 + a; else v89 = 2486;
+  if (a > 2487) v87 = v94 + a; else v90 = 2487;
+  if (a > 2488) v88 = v95 + a; else v91 = 2488;
+  if (a > 2489) v89 = v96 + a; else v92 = 2489;
+  if (a > 2490) v90 = v97 + a; else v93 = 2490;
+  if (a > 2491) v91 = v98 + a; else v94 = 2491;
+  if (a > 2492) v92 = v99 + a; else v95 = 2492;
+  if (a > 2493) v93 = v100 + a; else v96 = 2493;
+  if (a > 2494) v94 = v101 + a; else v97 = 2494;
+  if (a > 2495) v95 = v102 + a; else v98 = 2495;
+  if (a > 2496) v96 = v103 + a; else v99 = 2496;
+  if (a > 2497) v97 = v104 + a; else v100 = 2497;
+  if (a > 2498) v98 = v105 + a; else v101 = 2498;
+  if (a > 2499) v99 = v106 + a; else v102 = 2499;
+  if (a > 2500) v100 = v107 + a; else v103 = 2500;
+  if (a > 2501) v101 = v108 + a; else v104 = 2501;
+  if (a > 2502) v102 = v109 + a; else v105 = 2502;
+  if (a > 2503) v103 = v110 + a; else v106 = 2503;
+  if (a > 2504) v104 = v111 + a; else v107 = 2504;
+  if (a > 2505) v105 = v112 + a; else v108 = 2505;
+  if (a > 2506) v106 = v113 + a; else v109 = 2506;
+  if (a > 2507) v107 = v114 + a; else v110 = 2507;
+  if (a > 2508) v108 = v115 + a; else v111 = 2508;
+  if (a > 2509) v109 = v116 + a; else v112 = 2509;
+  if (a > 2510) v110 = v117 + a; else v113 = 2510;
+  if (a > 2511) v111 = v118 + a; else v114 = 2511;
+  if (a > 2512) v112 = v119 + a; else v115 = 2512;
+  if (a > 2513) v113 = v120 + a; else v116 = 2513;
+  if (a > 2514) v114 = v121 + a; else v117 = 2514;
+  if (a > 2515) v115 = v122 + a; else v118 = 2515;
+  if (a > 2516) v116 = v123 + a; else v119 = 2516;
+  if (a > 2517) v117 = v124 + a; else v120 = 2517;
+  if (a > 2518) v118 = v125 + a; else v121 = 2518;
+  if (a > 2519) v119 = v126 + a; else v122 = 2519;
+  if (a > 2520) v120 = v127 + a; else v123 = 2520;
+  if (a > 2521) v121 = v128 + a; else v124 = 2521;
+  if (a > 2522) v122 = v129 + a; else v125 = 2522;
+  if (a > 2523) v123 = v130 + a; else v126 = 2523;
+  if (a > 2524) v124 = v131 + a; else v127 = 2524;
+  if (a > 2525) v125 = v132 + a; else v128 = 2525;
+  if (a > 2526) v126 = v133 + a; else v129 = 2526;
+  if (a > 2527) v127 = v134 + a; else v130 = 2527;
+  if (a > 2528) v128 = v135 + a; else v131 = 2528;
+  if (a > 2529) v129 = v136 + a; else v132 = 2529;
+  if (a > 2530) v130 = v137 + a; else v133 = 2530;
+  if (a > 2531) v131 = v138 + a; else v134 = 2531;
+  if (a > 2532) v132 = v139 + a; else v135 = 2532;
+  if (a > 2533) v133 = v140 + a; else v136 = 2533;
+  if (a > 2534) v134 = v141 + a; else v137 = 2534;
+  if (a > 2535) v135 = v142 + a; else v138 = 2535;
+  if (a > 2536) v136 = v143 + a; else v139 = 2536;
+  if (a > 2537) v137 = v144 + a; else v140 = 2537;
+  if (a > 2538) v138 = v145 + a; else v141 = 2538;
+  if (a > 2539) v139 = v146 + a; else v142 = 2539;
+  if (a > 2540) v140 = v147 + a; else v143 = 2540;
+  if (a > 2541) v141 = v148 + a; else v144 = 2541;
+  if (a > 2542) v142 = v149 + a; else v145 = 2542;
+  if (a > 2543) v143 = v150 + a; else v146 = 2543;
+  if (a > 2544) v144 = v151 + a; else v147 = 2544;
+  if (a > 2545) v145 = v152 + a; else v148 = 2545;
+  if (a > 2546) v146 = v153 + a; else v149 = 2546;
+  if (a > 2547) v147 = v154 + a; else v150 = 2547;
+  if (a > 2548) v148 = v155 + a; else v151 = 2548;
+  if (a > 2549) v149 = v156 + a; else v152 = 2549;
+  if (a > 2550) v150 = v157 + a; else v153 = 2550;
+  if (a > 2551) v151 = v158 + a; else v154 = 2551;
+  if (a > 2552) v152 = v159 + a; else v155 = 2552;
+  if (a > 2553) v153 = v160 + a; else v156 = 2553;
+  if (a > 2554) v154 = v161 + a; else v157 = 2554;
+  if (a > 2555) v155 = v162 + a; else v158 = 2555;
+  if (a > 2556) v156 = v163 + a; else v159 = 2556;
+  if (a > 2557) v157 = v164 + a; else v160 = 2557;
+  if (a > 2558) v158 = v165 + a; else v161 = 2558;
+  if (a > 2559) v159 = v166 + a; else v162 = 2559;
+  if (a > 2560) v160 = v167 + a; else v163 = 2560;
+  if (a > 2561) v161 = v168 + a; else v164 = 2561;
+  if (a > 2562) v162 = v169 + a; else v165 = 2562;
+  if (a > 2563) v163 = v170 + a; else v166 = 2563;
+  if (a > 2564) v164 = v171 + a; else v167 = 2564;
+  if (a > 2565) v165 = v172 + a; else v168 = 2565;
+  if (a > 2566) v166 = v173 + a; else v169 = 2566;
+  if (a > 2567) v167 = v174 + a; else v170 = 2567;
+  if (a > 2568) v168 = v175 + a; else v171 = 2568;
+  if (a > 2569) v169 = v176 + a; else v172 = 2569;
+  if (a > 2570) v170 = v177 + a; else v173 = 2570;
+  if (a > 2571) v171 = v178 + a; else v174 = 2571;
+  if (a > 2572) v172 = v179 + a; else v175 = 2572;
+  if (a > 2573) v173 = v180 + a; else v176 = 2573;
+  if (a > 2574) v174 = v181 + a; else v177 = 2574;
+  if (a > 2575) v175 = v182 + a; else v178 = 2575;
+  if (a > 2576) v176 = v183 + a; else v179 = 2576;
+  if (a > 2577) v177 = v184 + a; else v180 = 2577;
+  if (a > 2578) v178 = v185 + a; else v181 = 2578;
+  if (a > 2579) v179 = v186 + a; else v182 = 2579;
+  if (a > 2580) v180 = v187 + a; else v183 = 2580;
+  if (a > 2581) v181 = v188 + a; else v184 = 2581;
+  if (a > 2582) v182 = v189 + a; else v185 = 2582;
+  if (a > 2583) v183 = v190 + a; else v186 = 2583;
+  if (a > 2584) v184 = v191 + a; else v187 = 2584;
+  if (a > 2585) v185 = v192 + a; else v188 = 2585;
+  if (a > 2586) v186 = v193 + a; else v189 = 2586;
+  if (a > 2587) v187 = v194 + a; else v190 = 2587;
+  if (a > 2588) v188 = v195 + a; else v191 = 2588;
+  if (a > 2589) v189 = v196 + a; else v192 = 2589;
+  if (a > 2590) v190 = v197 + a; else v193 = 2590;
+  if (a > 2591) v191 = v198 + a; else v194 = 2591;
+  if (a > 2592) v192 = v199 + a; else v195 = 2592;
+  if (a > 2593) v193 = v0 + a; else v196 = 2593;
+  if (a > 2594) v194 = v1 + a; else v197 = 2594;
+  if (a > 2595) v195 = v2 + a; else v198 = 2595;
+  if (a > 2596) v196 = v3 + a; else v199 = 2596;
+  if (a > 2597) v197 = v4 + a; else v0 = 2597;
+  if (a > 2598) v198 = v5 + a; else v1 = 2598;
+  if (a > 2599) v199 = v6 + a; else v2 = 2599;
+  if (a > 2600) v0 = v7 + a; else v3 = 2600;
+  if (a > 2601) v1 = v8 + a; else v4 = 2601;
+  if (a > 2602) v2 = v9 + a; else v5 = 2602;
+  if (a > 2603) v3 = v10 + a; else v6 = 2603;
+  if (a > 2604) v4 = v11 + a; else v7 = 2604;
+  if (a > 2605) v5 = v12 + a; else v8 = 2605;
+  if (a > 2606) v6 = v13 + a; else v9 = 2606;
+  if (a > 2607) v7 = v14 + a; else v10 = 2607;
+  if (a > 2608) v8 = v15 + a; else v11 = 2608;
+  if (a > 2609) v9 = v16 + a; else v12 = 2609;
+  if (a > 2610) v10 = v17 + a; else v13 = 2610;
+  if (a > 2611) v11 = v18 + a; else v14 = 2611;
+  if (a > 2612) v12 = v19 + a; else v15 = 2612;
+  if (a > 2613) v13 = v20 + a; else v16 = 2613;
+  if (a > 2614) v14 = v21 + a; else v17 = 2614;
+  if (a > 2615) v15 = v22 + a; else v18 = 2615;
+  if (a > 2616) v16 = v23 + a; else v19 = 2616;
+  if (a > 2617) v17 = v24 + a; else v20 = 2617;
+  if (a > 2618) v18 = v25 + a; else v21 = 2618;
+  if (a > 2619) v19 = v26 + a; else v22 = 2619;
+  if (a > 2620) v20 = v27 + a; else v23 = 2620;
+  if (a > 2621) v21 = v28 + a; else v24 = 2621;
+  if (a > 2622) v22 = v29 + a; else v25 = 2622;
+  if (a > 2623) v23 = v30 + a; else v26 = 2623;
+  if (a > 2624) v24 = v31 + a; else v27 = 2624;
+  if (a > 2625) v25 = v32 + a; else v28 = 2625;
+  if (a > 2626) v26 = v33 + a; else v29 = 2626;
+  if (a > 2627) v27 = v34 + a; else v30 = 2627;
+  if (a > 2628) v28 = v35 + a; else v31 = 2628;
+  if (a > 2629) v29 = v36 + a; else v32 = 2629;
+  if (a > 2630) v30 = v37 + a; else v33 = 2630;
+  if (a > 2631) v31 = v38 + a; else v34 = 2631;
+  if (a > 2632) v32 = v39 + a; else v35 = 2632;
+  if (a > 2633) v33 = v40 + a; else v36 = 2633;
+  if (a > 2634) v34 = v41 + a; else v37 = 2634;
+  if (a > 2635) v35 = v42 + a; else v38 = 2635;
+  if (a > 2636) v36 = v43 + a; else v39 = 2636;
+  if (a > 2637) v37 = v44 + a; else v40 = 2637;
+  if (a > 2638) v38 = v45 + a; else v41 = 2638;
+  if (a > 2639) v39 = v46 + a; else v42 = 2639;
+  if (a > 2640) v40 = v47 + a; else v43 = 2640;
+  if (a > 2641) v41 = v48 + a; else v44 = 2641;
+  if (a > 2642) v42 = v49 + a; else v45 = 2642;
+  if (a > 2643) v43 = v50 + a; else v46 = 2643;
+  if (a > 2644) v44 = v51 + a; else v47 = 2644;
+  if (a > 2645) v45 = v52 + a; else v48 = 2645;
+  if (a > 2646) v46 = v53 + a; else v49 = 2646;
+  if (a > 2647) v47 = v54 + a; else v50 = 2647;
+  if (a > 2648) v48 = v55 + a; else v51 = 2648;
+  if (a > 2649) v49 = v56 + a; else v52 = 2649;
+  if (a > 2650) v50 = v57 + a; else v53 = 2650;
+  if (a > 2651) v51 = v58 + a; else v54 = 2651;
+  if (a > 2652) v52 = v59 + a; else v55 = 2652;
+  if (a > 2653) v53 = v60 + a; else v56 = 2653;
+  if (a > 2654) v54 = v61 + a; else v57 = 2654;
+  if (a > 2655) v55 = v62 + a; else v58 = 2655;
+  if (a > 2656) v56 = v63 + a; else v59 = 2656;
+  if (a > 2657) v57 = v64 + a; else v60 = 2657;
+  if (a > 2658) v58 = v65 + a; else v61 = 2658;
+  if (a > 2659) v59 = v66 + a; else v62 = 2659;
+  if (a > 2660) v60 = v67 + a; else v63 = 2660;
+  if (a > 2661) v61 = v68 + a; else v64 = 2661;
+  if (a > 2662) v62 = v69 + a; else v65 = 2662;
+  if (a > 2663) v63 = v70 + a; else v66 = 2663;
+  if (a > 2664) v64 = v71 + a; else v67 = 2664;
+  if (a > 2665) v65 = v72 + a; else v68 = 2665;
+  if (a > 2666) v66 = v73 + a; else v69 = 2666;
+  if (a > 2667) v67 = v74 + a; else v70 = 2667;
+  if (a > 2668) v68 = v75 + a; else v71 = 2668;
+  if (a > 2669) v69 = v76 + a; else v72 = 2669;
+  if (a > 2670) v70 = v77 + a; else v73 = 2670;
+  if (a > 2671) v71 = v78 + a; else v74 = 2671;
+  if (a > 2672) v72 = v79 + a; else v75 = 2672;
+  if (a > 2673) v73 = v80 + a; else v76 = 2673;
+  if (a > 2674) v74 = v81 + a; else v77 = 2674;
+  if (a > 2675) v75 = v82 + a; else v78 = 2675;
+  if (a > 2676) v76 = v83 + a; else v79 = 2676;
+  if (a > 2677) v77 = v84 + a; else v80 = 2677;
+  if (a > 2678) v78 = v85 + a; else v81 = 2678;
+  if (a > 2679) v79 = v86 + a; else v82 = 2679;
+  if (a > 2680) v80 = v87 + a; else v83 = 2680;
+  if (a > 2681) v81 = v88 + a; else v84 = 2681;
+  if (a > 2682) v82 = v89 + a; else v85 = 2682;
+  if (a > 2683) v83 = v90 + a; else v86 = 2683;
+  if (a > 2684) v84 = v91 + a; else v87 = 2684;
+  if (a > 2685) v85 = v92 + a; else v88 = 2685;
+  if (a > 2686) v86 = v93 + a; else v89 = 2686;
+  if (a > 2687) v87 = v94 + a; else v90 = 2687;
+  if (a > 2688) v88 = v95 + a; else v91 = 2688;
+  if (a > 2689) v89 = v96 + a; else v92 = 2689;
+  if (a > 2690) v90 = v97 + a; else v93 = 2690;
+  if (a > 2691) v91 = v98 + a; else v94 = 2691;
+  if (a > 2692) v92 = v99 + a; else v95 = 2692;
+  if (a > 2693) v93 = v100 + a; else v96 = 2693;
+  if (a > 2694) v94 = v101 + a; else v97 = 2694;
+  if (a > 2695) v95 = v102 + a; else v98 = 2695;
+  if (a > 2696) v96 = v103 + a; else v99 = 2696;
+  if (a > 2697) v97 = v104 + a; else v100 = 2697;
+  if (a > 2698) v98 = v105 + a; else v101 = 2698;
+  if (a > 2699) v99 = v106 + a; else v102 = 2699;
+  if (a > 2700) v100 = v107 + a; else v103 = 2700;
+  if (a > 2701) v101 = v108 + a; else v104 = 2701;
+  if (a > 2702) v102 = v109 + a; else v105 = 2702;
+  if (a > 2703) v103 = v110 + a; else v106 = 2703;
+  if (a > 2704) v104 = v111 + a; else v107 = 2704;
+  if (a > 2705) v105 = v112 + a; else v108 = 2705;
+  if (a > 2706) v106 = v113 + a; else v109 = 2706;
+  if (a > 2707) v107 = v114 + a; else v110 = 2707;
+  if (a > 2708) v108 = v115 + a; else v111 = 2708;
+  if (a > 2709) v109 = v116 + a; else v112 = 2709;
+  if (a > 2710) v110 = v117 + a; else v113 = 2710;
+  if (a > 2711) v111 = v118 + a; else v114 = 2711;
+  if (a > 2712) v112 = v119 + a; else v115 = 2712;
+  if (a > 2713) v113 = v120 + a; else v116 = 2713;
+  if (a > 2714) v114 = v121 + a; else v117 = 2714;
+  if (a > 2715) v115 = v122 + a; else v118 = 2715;
+  if (a > 2716) v116 = v123 + a; else v119 = 2716;
+  if (a > 2717) v117 = v124 + a; else v120 = 2717;
+  if (a > 2718) v118 = v125 + a; else v121 = 2718;
+  if (a > 2719) v119 = v126 + a; else v122 = 2719;
+  if (a > 2720) v120 = v127 + a; else v123 = 2720;
+  if (a > 2721) v121 = v128 + a; else v124 = 2721;
+  if (a > 2722) v122 = v129 + a; else v125 = 2722;
+  if (a > 2723) v123 = v130 + a; else v126 = 2723;
+  if (a > 2724) v124 = v131 + a; else v127 = 2724;
+  if (a > 2725) v125 = v132 + a; else v128 = 2725;
+  if (a > 2726) v126 = v133 + a; else v129 = 2726;
+  if (a > 2727) v127 = v134 + a; else v130 = 2727;
+  if (a > 2728) v128 = v135 + a; else v131 = 2728;
+  if (a > 2729) v129 = v136 + a; else v132 = 2729;
+  if (a > 2730) v130 = v137 + a; else v133 = 2730;
+  if (a > 2731) v131 = v138 + a; else v134 = 2731;
+  if (a > 2732) v132 = v139 + a; else v135 = 2732;
+  if (a > 2733) v133 = v140 + a; else v136 = 2733;
+  if (a > 2734) v134 = v141 + a; else v137 = 2734;
+  if (a > 2735) v135 = v142 + a; else v138 = 2735;
+  if (a > 2736) v136 = v143 + a; else v139 = 2736;
+  if (a > 2737) v137 = v144 + a; else v140 = 2737;
+  if (a > 2738) v138 = v145 + a; else v141 = 2738;
+  if (a > 2739) v139 = v146 + a; else v142 = 2739;
+  if (a > 2740) v140 = v147 + a; else v143 = 2740;
+  if (a > 2741) v141 = v148 + a; else v144 = 2741;
+  if (a > 2742) v142 = v149 + a; else v145 = 2742;
+  if (a > 2743) v143 = v150 + a; else v146 = 2743;
+  if (a > 2744) v144 = v151 + a; else v147 = 2744;
+  if (a > 2745) v145 = v152 + a; else v148 = 2745;
+  if (a > 2746) v146 = v153 + a; else v149 = 2746;
+  if (a > 2747) v147 = v154 + a; else v150 = 2747;
+  if (a > 2748) v148 = v155 + a; else v151 = 2748;
+  if (a > 2749) v149 = v156 + a; else v152 = 2749;
+  if (a > 2750) v150 = v157 + a; else v153 = 2750;
+  if (a > 2751) v151 = v158 + a; else v154 = 2751;
+  if (a > 2752) v152 = v159 + a; else v155 = 2752;
+  if (a > 2753) v153 = v160 + a; else v156 = 2753;
+  if (a > 2754) v154 = v161 + a; else v157 = 2754;
+  if (a > 2755) v155 = v162 + a; else v158 = 2755;
+  if (a > 2756) v156 = v163 + a; else v159 = 2756;
+  if (a > 2757) v157 = v164 + a; else v160 = 2757;
+  if (a > 2758) v158 = v165 + a; else v161 = 2758;
+  if (a > 2759) v159 = v166 + a; else v162 = 2759;
+  if (a > 2760) v160 = v167 + a; else v163 = 2760;
+  if (a > 2761) v161 = v168 + a; else v164 = 2761;
+  if (a > 2762) v162 = v169 + a; else v165 = 2762;
+  if (a > 2763) v163 = v170 + a; else v166 = 2763;
+  if (a > 2764) v164 = v171 + a; else v167 = 2764;
+  if (a > 2765) v165 = v172 + a; else v168 = 2765;
+  if (a > 2766) v166 = v173 + a; else v169 = 2766;
+  if (a > 2767) v167 = v174 + a; else v170 = 2767;
+  if (a > 2768) v168 = v175 + a; else v171 = 2768;
+  if (a > 2769) v169 = v176 + a; else v172 = 2769;
+  if (a > 2770) v170 = v177 + a; else v173 = 2770;
+  if (a > 2771) v171 = v178 + a; else v174 = 2771;
+  if (a > 2772) v172 = v179 + a; else v175 = 2772;
+  if (a > 2773) v173 = v180 + a; else v176 = 2773;
+  if (a > 2774) v174 = v181 + a; else v177 = 2774;
+  if (a > 2775) v175 = v182 + a; else v178 = 2775;
+  if (a > 2776) v176 = v183 + a; else v179 = 2776;
+  if (a > 2777) v177 = v184 + a; else v180 = 2777;
+  if (a > 2778) v178 = v185 + a; else v181 = 2778;
+  if (a > 2779) v179 = v186 + a; else v182 = 2779;
+  if (a > 2780) v180 = v187 + a; else v183 = 2780;
+  if (a > 2781) v181 = v188 + a; else v184 = 2781;
+  if (a > 2782) v182 = v189 + a; else v185 = 2782;
+  if (a > 2783) v183 = v190 + a; else v186 = 2783;
+  if (a > 2784) v184 = v191 + a; else v187 = 2784;
+  if (a > 2785) v185 = v192 + a; else v188 = 2785;
+  if (a > 2786) v186 = v193 + a; else v189 = 2786;
+  if (a > 2787) v187 = v194 + a; else v190 = 2787;
+  if (a > 2788) v188 = v195 + a; else v191 = 2788;
+  if (a > 2789) v189 = v196 + a; else v192 = 2789;
+  if (a > 2790) v190 = v197 + a; else v193 = 2790;
+  if (a > 2791) v191 = v198 + a; else v194 = 2791;
+  if (a > 2792) v192 = v199 + a; else v195 = 2792;
+  if (a > 2793) v193 = v0 + a; else v196 = 2793;
+  if (a > 2794) v194 = v1 + a; else v197 = 2794;
+  if (a > 2795) v195 = v2 + a; else v198 = 2795;
+  if (a > 2796) v196 = v3 + a; else v199 = 2796;
+  if (a > 2797) v197 = v4 + a; else v0 = 2797;
+  if (a > 2798) v198 = v5 + a; else v1 = 2798;
+  if (a > 2799) v199 = v6 + a; else v2 = 2799;
+  if (a > 2800) v0 = v7 + a; else v3 = 2800;
+  if (a > 2801) v1 = v8 + a; else v4 = 2801;
+  if (a > 2802) v2 = v9 + a; else v5 = 2802;
+  if (a > 2803) v3 = v10 + a; else v6 = 2803;
+  if (a > 2804) v4 = v11 + a; else v7 = 2804;
+  if (a > 2805) v5 = v12 + a; else v8 = 2805;
+  if (a > 2806) v6 = v13 + a; else v9 = 2806;
+  if (a > 2807) v7 = v14 + a; else v10 = 2807;
+  if (a > 2808) v8 = v15 + a; else v11 = 2808;
+  if (a > 2809) v9 = v16 + a; else v12 = 2809;
+  if (a > 2810) v10 = v17 + a; else v13 = 2810;
+  if (a > 2811) v11 = v18 + a; else v14 = 2811;
+  if (a > 2812) v12 = v19 + a; else v15 = 2812;
+  if (a > 2813) v13 = v20 + a; else v16 = 2813;
+  if (a > 2814) v14 = v21 + a; else v17 = 2814;
+  if (a > 2815) v15 = v22 + a; else v18 = 2815;
+  if (a > 2816) v16 = v23 + a; else v19 = 2816;
+  if (a > 2817) v17 = v24 + a; else v20 = 2817;
+  if (a > 2818) v18 = v25 + a; else v21 = 2818;
+  if (a > 2819) v19 = v26 + a; else v22 = 2819;
+  if (a > 2820) v20 = v27 + a; else v23 = 2820;
+  if (a > 2821) v21 = v28 + a; else v24 = 2821;
+  if (a > 2822) v22 = v29 + a; else v25 = 2822;
+  if (a > 2823) v23 = v30 + a; else v26 = 2823;
+  if (a > 2824) v24 = v31 + a; else v27 = 2824;
+  if (a > 2825) v25 = v32 + a; else v28 = 2825;
+  if (a > 2826) v26 = v33 + a; else v29 = 2826;
+  if (a > 2827) v27 = v34 + a; else v30 = 2827;
+  if (a > 2828) v28 = v35 + a; else v31 = 2828;
+  if (a > 2829) v29 = v36 + a; else v32 = 2829;
+  if (a > 2830) v30 = v37 + a; else v33 = 2830;
+  if (a > 2831) v31 = v38 + a; else v34 = 2831;
+  if (a > 2832) v32 = v39 + a; else v35 = 2832;
+  if (a > 2833) v33 = v40 + a; else v36 = 2833;
+  if (a > 2834) v34 = v41 + a; else v37 = 2834;
+  if (a > 2835) v35 = v42 + a; else v38 = 2835;
+  if (a > 2836) v36 = v43 + a; else v39 = 2836;
+  if (a > 2837) v37 = v44 + a; else v40 = 2837;
+  if (a > 2838) v38 = v45 + a; else v41 = 2838;
+  if (a > 2839) v39 = v46 + a; else v42 = 2839;
+  if (a > 2840) v40 = v47 + a; else v43 = 2840;
+  if (a > 2841) v41 = v48 + a; else v44 = 2841;
+  if (a > 2842) v42 = v49 + a; else v45 = 2842;
+  if (a > 2843) v43 = v50 + a; else v46 = 2843;
+  if (a > 2844) v44 = v51 + a; else v47 = 2844;
+  if (a > 2845) v45 = v52 + a; else v48 = 2845;
+  if (a > 2846) v46 = v53 + a; else v49 = 2846;
+  if (a > 2847) v47 = v54 + a; else v50 = 2847;
+  if (a > 2848) v48 = v55 + a; else v51 = 2848;
+  if (a > 2849) v49 = v56 + a; else v52 = 2849;
+  if (a > 2850) v50 = v57 + a; else v53 = 2850;
+  if (a > 2851) v51 = v58 + a; else v54 = 2851;
+  if (a > 2852) v52 = v59 + a; else v55 = 2852;
+  if (a > 2853) v53 = v60 + a; else v56 = 2853;
+  if (a > 2854) v54 = v61 + a; else v57 = 2854;
+  if (a > 2855) v55 = v62 + a; else v58 = 2855;
+  if (a > 2856) v56 = v63 + a; else v59 = 2856;
+  if (a > 2857) v57 = v64 + a; else v60 = 2857;
+  if (a > 2858) v58 = v65 + a; else v61 = 2858;
+  if (a > 2859) v59 = v66 + a; else v62 = 2859;
+  if (a > 2860) v60 = v67 + a; else v63 = 2860;
+  if (a > 2861) v61 = v68 + a; else v64 = 2861;
+  if (a > 2862) v62 = v69 + a; else v65 = 2862;
+  if (a > 2863) v63 = v70 + a; else v66 = 2863;
+  if (a > 2864) v64 = v71 + a; else v67 = 2864;
+  if (a > 2865) v65 = v72 + a; else v68 = 2865;
+  if (a > 2866) v66 = v73 + a; else v69 = 2866;
+  if (a > 2867) v67 = v74 + a; else v70 = 2867;
+  if (a > 2868) v68 = v75 + a; else v71 = 2868;
+  if (a > 2869) v69 = v76 + a; else v72 = 2869;
+  if (a > 2870) v70 = v77 + a; else v73 = 2870;
+  if (a > 2871) v71 = v78 + a; else v74 = 2871;
+  if (a > 2872) v72 = v79 + a; else v75 = 2872;
+  if (a > 2873) v73 = v80 + a; else v76 = 2873;
+  if (a > 2874) v74 = v81 + a; else v77 = 2874;
+  if (a > 2875) v75 = v82 + a; else v78 = 2875;
+  if (a > 2876) v76 = v83 + a; else v79 = 2876;
+  if (a > 2877) v77 = v84 + a; else v80 = 2877;
+  if (a > 2878) v78 = v85 + a; else v81 = 2878;
+  if (a > 2879) v79 = v86 + a; else v82 = 2879;
+  if (a > 2880) v80 = v87 + a; else v83 = 2880;
+  if (a > 2881) v81 = v88 + a; else v84 = 2881;
+  if (a > 2882) v82 = v89 + a; else v85 = 2882;
+  if (a > 2883) v83 = v90 + a; else v86 = 2883;
+  if (a > 2884) v84 = v91 + a; else v87 = 2884;
+  if (a > 2885) v85 = v92 + a; else v88 = 2885;
+  if (a > 2886) v86 = v93 + a; else v89 = 2886;
+  if (a > 2887) v87 = v94 + a; else v90 = 2887;
+  if (a > 2888) v88 = v95 + a; else v91 = 2888;
+  if (a > 2889) v89 = v96 + a; else v92 = 2889;
+  if (a > 2890) v90 = v97 + a; else v93 = 2890;
+  if (a > 2891) v91 = v98 + a; else v94 = 2891;
+  if (a > 2892) v92 = v99 + a; else v95 = 2892;
+  if (a > 2893) v93 = v100 + a; else v96 = 2893;
+  if (a > 2894) v94 = v101 + a; else v97 = 2894;
+  if (a > 2895) v95 = v102 + a; else v98 = 2895;
+  if (a > 2896) v96 = v103 + a; else v99 = 2896;
+  if (a > 2897) v97 = v104 + a; else v100 = 2897;
+  if (a > 2898) v98 = v105 + a; else v101 = 2898;
+  if (a > 2899) v99 = v106 + a; else v102 = 2899;
+  if (a > 2900) v100 = v107 + a; else v103 = 2900;
+  if (a > 2901) v101 = v108 + a; else v104 = 2901;
+  if (a > 2902) v102 = v109 + a; else v105 = 2902;
+  if (a > 2903) v103 = v110 + a; else v106 = 2903;
+  if (a > 2904) v104 = v111 + a; else v107 = 2904;
+  if (a > 2905) v105 = v112 + a; else v108 = 2905;
+  if (a > 2906) v106 = v113 + a; else v109 = 2906;
+  if (a > 2907) v107 = v114 + a; else v110 = 2907;
+  if (a > 2908) v108 = v115 + a; else v111 = 2908;
+  if (a > 2909) v109 = v116 + a; else v112 = 2909;
+  if (a > 2910) v110 = v117 + a; else v113 = 2910;
+  if (a > 2911) v111 = v118 + a; else v114 = 2911;
+  if (a > 2912) v112 = v119 + a; else v115 = 2912;
+  if (a > 2913) v113 = v120 + a; else v116 = 2913;
+  if (a > 2914) v114 = v121 + a; else v117 = 2914;
+  if (a > 2915) v115 = v122 + a; else v118 = 2915;
+  if (a > 2916) v116 = v123 + a; else v119 = 2916;
+  if (a > 2917) v117 = v124 + a; else v120 = 2917;
+  if (a > 2918) v118 = v125 + a; else v121 = 2918;
+  if (a > 2919) v119 = v126 + a; else v122 = 2919;
+  if (a > 2920) v120 = v127 + a; else v123 = 2920;
+  if (a > 2921) v121 = v128 + a; else v124 = 2921;
+  if (a > 2922) v122 = v129 + a; else v125 = 2922;
+  if (a > 2923) v123 = v130 + a; else v126 = 2923;
+  if (a > 2924) v124 = v131 + a; else v127 = 2924;
+  if (a > 2925) v125 = v132 + a; else v128 = 2925;
+  if (a > 2926) v126 = v133 + a; else v129 = 2926;
+  if (a > 2927) v127 = v134 + a; else v130 = 2927;
+  if (a > 2928) v128 = v135 + a; else v131 = 2928;
+  if (a > 2929) v129 = v136 + a; else v132 = 2929;
+  if (a > 2930) v130 = v137 + a; else v133 = 2930;
+  if (a > 2931) v131 = v138 + a; else v134 = 2931;
+  if (a > 2932) v132 = v139 + a; else v135 = 2932;
+  if (a > 2933) v133 = v140 + a; else v136 = 2933;
+  if (a > 2934) v134 = v141 + a; else v137 = 2934;
+  if (a > 2935) v135 = v142 + a; else v138 = 2935;
+  if (a > 2936) v136 = v143 + a; else v139 = 2936;
+  if (a > 2937) v137 = v144 + a; else v140 = 2937;
+  if (a > 2938) v138 = v145 + a; else v141 = 2938;
+  if (a > 2939) v139 = v146 + a; else v142 = 2939;
+  if (a > 2940) v140 = v147 + a; else v143 = 2940;
+  if (a > 2941) v141 = v148 + a; else v144 = 2941;
+  if (a > 2942) v142 = v149 + a; else v145 = 2942;
+  if (a > 2943) v143 = v150 + a; else v146 = 2943;
+  if (a > 2944) v144 = v151 + a; else v147 = 2944;
+  if (a > 2945) v145 = v152 + a; else v148 = 2945;
+  if (a > 2946) v146 = v153 + a; else v149 = 2946;
+  if (a > 2947) v147 = v154 + a; else v150 = 2947;
+  if (a > 2948) v148 = v155 + a; else v151 = 2948;
+  if (a > 2949) v149 = v156 + a; else v152 = 2949;
+  if (a > 2950) v150 = v157 + a; else v153 = 2950;
+  if (a > 2951) v151 = v158 + a; else v154 = 2951;
+  if (a > 2952) v152 = v159 + a; else v155 = 2952;
+  if (a > 2953) v153 = v160 + a; else v156 = 2953;
+  if (a > 2954) v154 = v161 + a; else v157 = 2954;
+  if (a > 2955) v155 = v162 + a; else v158 = 2955;
+  if (a > 2956) v156 = v163 + a; else v159 = 2956;
+  if (a > 2957) v157 = v164 + a; else v160 = 2957;
+  if (a > 2958) v158 = v165 + a; else v161 = 2958;
+  if (a > 2959) v159 = v166 + a; else v162 = 2959;
+  if (a > 2960) v160 = v167 + a; else v163 = 2960;
+  if (a > 2961) v161 = v168 + a; else v164 = 2961;
+  if (a > 2962) v162 = v169 + a; else v165 = 2962;
+  if (a > 2963) v163 = v170 + a; else v166 = 2963;
+  if (a > 2964) v164 = v171 + a; else v167 = 2964;
+  if (a > 2965) v165 = v172 + a; else v168 = 2965;
+  if (a > 2966) v166 = v173 + a; else v169 = 2966;
+  if (a > 2967) v167 = v174 + a; else v170 = 2967;
+  if (a > 2968) v168 = v175 + a; else v171 = 2968;
+  if (a > 2969) v169 = v176 + a; else v172 = 2969;
+  if (a > 2970) v170 = v177 + a; else v173 = 2970;
+  if (a > 2971) v171 = v178 + a; else v174 = 2971;
+  if (a > 2972) v172 = v179 + a; else v175 = 2972;
+  if (a > 2973) v173 = v180 + a; else v176 = 2973;
+  if (a > 2974) v174 = v181 + a; else v177 = 2974;
+  if (a > 2975) v175 = v182 + a; else v178 = 2975;
+  if (a > 2976) v176 = v183 + a; else v179 = 2976;
+  if (a > 2977) v177 = v184 + a; else v180 = 2977;
+  if (a > 2978) v178 = v185 + a; else v181 = 2978;
+  if (a > 2979) v179 = v186 + a; else v182 = 2979;
+  if (a > 2980) v180 = v187 + a; else v183 = 2980;
+  if (a > 2981) v181 = v188 + a; else v184 = 2981;
+  if (a > 2982) v182 = v189 + a; else v185 = 2982;
+  if (a > 2983) v183 = v190 + a; else v186 = 2983;
+  if (a > 2984) v184 = v191 + a; else v187 = 2984;
+  if (a > 2985) v185 = v192 + a; else v188 = 2985;
+  if (a > 2986) v186 = v193 + a; else v189 = 2986;
+  if (a > 2987) v187 = v194 + a; else v190 = 2987;
+  if (a > 2988) v188 = v195 + a; else v191 = 2988;
+  if (a > 2989) v189 = v196 + a; else v192 = 2989;
+  if (a > 2990) v190 = v197 + a; else v193 = 2990;
+  if (a > 2991) v191 = v198 + a; else v194 = 2991;
+  if (a > 2992) v192 = v199 + a; else v195 = 2992;
+  if (a > 2993) v193 = v0 + a; else v196 = 2993;
+  if (a > 2994) v194 = v1 + a; else v197 = 2994;
+  if (a > 2995) v195 = v2 + a; else v198 = 2995;
+  if (a > 2996) v196 = v3 + a; else v199 = 2996;
+  if (a > 2997) v197 = v4 + a; else v0 = 2997;
+  if (a > 2998) v198 = v5 + a; else v1 = 2998;
+  if (a > 2999) v199 = v6 + a; else v2 = 2999;
+  if (a > 3000) v0 = v7 + a; else v3 = 3000;
+  if (a > 3001) v1 = v8 + a; else v4 = 3001;
+  if (a > 3002) v2 = v9 + a; else v5 = 3002;
+  if (a > 3003) v3 = v10 + a; else v6 = 3003;
+  if (a > 3004) v4 = v11 + a; else v7 = 3004;
+  if (a > 3005) v5 = v12 + a; else v8 = 3005;
+  if (a > 3006) v6 = v13 + a; else v9 = 3006;
+  if (a > 3007) v7 = v14 + a; else v10 = 3007;
+  if (a > 3008) v8 = v15 + a; else v11 = 3008;
+  if (a > 3009) v9 = v16 + a; else v12 = 3009;
+  if (a > 3010) v10 = v17 + a; else v13 = 3010;
+  if (a > 3011) v11 = v18 + a; else v14 = 3011;
+  if (a > 3012) v12 = v19 + a; else v15 = 3012;
+  if (a > 3013) v13 = v20 + a; else v16 = 3013;
+  if (a > 3014) v14 = v21 + a; else v17 = 3014;
+  if (a > 3015) v15 = v22 + a; else v18 = 3015;
+  if (a > 3016) v16 = v23 + a; else v19 = 3016;
+  if (a > 3017) v17 = v24 + a; else v20 = 3017;
+  if (a > 3018) v18 = v25 + a; else v21 = 3018;
+  if (a > 3019) v19 = v26 + a; else v22 = 3019;
+  if (a > 3020) v20 = v27 + a; else v23 = 3020;
+  if (a > 3021) v21 = v28 + a; else v24 = 3021;
+  if (a > 3022) v22 = v29 + a; else v25 = 3022;
+  if (a > 3023) v23 = v30 + a; else v26 = 3023;
+  if (a > 3024) v24 = v31 + a; else v27 = 3024;
+  if (a > 3025) v25 = v32 + a; else v28 = 3025;
+  if (a > 3026) v26 = v33 + a; else v29 = 3026;
+  if (a > 3027) v27 = v34 + a; else v30 = 3027;
+  if (a > 3028) v28 = v35 + a; else v31 = 3028;
+  if (a > 3029) v29 = v36 + a; else v32 = 3029;
+  if (a > 3030) v30 = v37 + a; else v33 = 3030;
+  if (a > 3031) v31 = v38 + a; else v34 = 3031;
+  if (a > 3032) v32 = v39 + a; else v35 = 3032;
+  if (a > 3033) v33 = v40 + a; else v36 = 3033;
+  if (a > 3034) v34 = v41 + a; else v37 = 3034;
+  if (a > 3035) v35 = v42 + a; else v38 = 3035;
+  if (a > 3036) v36 = v43 + a; else v39 = 3036;
+  if (a > 3037) v37 = v44 + a; else v40 = 3037;
+  if (a > 3038) v38 = v45 + a; else v41 = 3038;
+  if (a > 3039) v39 = v46 + a; else v42 = 3039;
+  if (a > 3040) v40 = v47 + a; else v43 = 3040;
+  if (a > 3041) v41 = v48 + a; else v44 = 3041;
+  if (a > 3042) v42 = v49 + a; else v45 = 3042;
+  if (a > 3043) v43 = v50 + a; else v46 = 3043;
+  if (a > 3044) v44 = v51 + a; else v47 = 3044;
+  if (a > 3045) v45 = v52 + a; else v48 = 3045;
+  if (a > 3046) v46 = v53 + a; else v49 = 3046;
+  if (a > 3047) v47 = v54 + a; else v50 = 3047;
+  if (a > 3048) v48 = v55 + a; else v51 = 3048;
+  if (a > 3049) v49 = v56 + a; else v52 = 3049;
+  if (a > 3050) v50 = v57 + a; else v53 = 3050;
+  if (a > 3051) v51 = v58 + a; else v54 = 3051;
+  if (a > 3052) v52 = v59 + a; else v55 = 3052;
+  if (a > 3053) v53 = v60 + a; else v56 = 3053;
+  if (a > 3054) v54 = v61 + a; else v57 = 3054;
+  if (a > 3055) v55 = v62 + a; else v58 = 3055;
+  if (a > 3056) v56 = v63 + a; else v59 = 3056;
+  if (a > 3057) v57 = v64 + a; else v60 = 3057;
+  if (a > 3058) v58 = v65 + a; else v61 = 3058;
+  if (a > 3059) v59 = v66 + a; else v62 = 3059;
+  if (a > 3060) v60 = v67 + a; else v63 = 3060;
+  if (a > 3061) v61 = v68 + a; else v64 = 3061;
+  if (a > 3062) v62 = v69 + a; else v65 = 3062;
+  if (a > 3063) v63 = v70 + a; else v66 = 3063;
+  if (a > 3064) v64 = v71 + a; else v67 = 3064;
+  if (a > 3065) v65 = v72 + a; else v68 = 3065;
+  if (a > 3066) v66 = v73 + a; else v69 = 3066;
+  if (a > 3067) v67 = v74 + a; else v70 = 3067;
+  if (a > 3068) v68 = v75 + a; else v71 = 3068;
+  if (a > 3069) v69 = v76 + a; else v72 = 3069;
+  if (a > 3070) v70 = v77 + a; else v73 = 3070;
+  if (a > 3071) v71 = v78 + a; else v74 = 3071;
+  if (a > 3072) v72 = v79 + a; else v75 = 3072;
+  if (a > 3073) v73 = v80 + a; else v76 = 3073;
+  if (a > 3074) v74 = v81 + a; else v77 = 3074;
+  if (a > 3075) v75 = v82 + a; else v78 = 3075;
+  if (a > 3076) v76 = v83 + a; else v79 = 3076;
+  if (a > 3077) v77 = v84 + a; else v80 = 3077;
+  if (a > 3078) v78 = v85 + a; else v81 = 3078;
+  if (a > 3079) v79 = v86 + a; else v82 = 3079;
+  if (a > 3080) v80 = v87 + a; else v83 = 3080;
+  if (a > 3081) v81 = v88 + a; else v84 = 3081;
+  if (a > 3082) v82 = v89 + a; else v85 = 3082;
+  if (a > 3083) v83 = v90 + a; else v86 = 3083;
+  if (a > 3084) v84 = v91 + a; else v87 = 3084;
+  if (a > 3085) v85 = v92 + a; else v88 = 3085;
+  if (a > 3086) v86 = v93 + a; else v89 = 3086;
+  if (a > 3087) v87 = v94 + a; else v90 = 3087;
+  if (a > 3088) v88 = v95 + a; else v91 = 3088;
+  if (a > 3089) v89 = v96 + a; else v92 = 3089;
+  if (a > 3090) v90 = v97 + a; else v93 = 3090;
+  if (a > 3091) v91 = v98 + a; else v94 = 3091;
+  if (a > 3092) v92 = v99 + a; else v95 = 3092;
+  if (a > 3093) v93 = v100 + a; else v96 = 3093;
+  if (a > 3094) v94 = v101 + a; else v97 = 3094;
+  if (a > 3095) v95 = v102 + a; else v98 = 3095;
+  if (a > 3096) v96 = v103 + a; else v99 = 3096;
+  if (a > 3097) v97 = v104 + a; else v100 = 3097;
+  if (a > 3098) v98 = v105 + a; else v101 = 3098;
+  if (a > 3099) v99 = v106 + a; else v102 = 3099;
+  if (a > 3100) v100 = v107 + a; else v103 = 3100;
+  if (a > 3101) v101 = v108 + a; else v104 = 3101;
+  if (a > 3102) v102 = v109 + a; else v105 = 3102;
+  if (a > 3103) v103 = v110 + a; else v106 = 3103;
+  if (a > 3104) v104 = v111 + a; else v107 = 3104;
+  if (a > 3105) v105 = v112 + a; else v108 = 3105;
+  if (a > 3106) v106 = v113 + a; else v109 = 3106;
+  if (a > 3107) v107 = v114 + a; else v110 = 3107;
+  if (a > 3108) v108 = v115 + a; else v111 = 3108;
+  if (a > 3109) v109 = v116 + a; else v112 = 3109;
+  if (a > 3110) v110 = v117 + a; else v113 = 3110;
+  if (a > 3111) v111 = v118 + a; else v114 = 3111;
+  if (a > 3112) v112 = v119 + a; else v115 = 3112;
+  if (a > 3113) v113 = v120 + a; else v116 = 3113;
+  if (a > 3114) v114 = v121 + a; else v117 = 3114;
+  if (a > 3115) v115 = v122 + a; else v118 = 3115;
+  if (a > 3116) v116 = v123 + a; else v119 = 3116;
+  if (a > 3117) v117 = v124 + a; else v120 = 3117;
+  if (a > 3118) v118 = v125 + a; else v121 = 3118;
+  if (a > 3119) v119 = v126 + a; else v122 = 3119;
+  if (a > 3120) v120 = v127 + a; else v123 = 3120;
+  if (a > 3121) v121 = v128 + a; else v124 = 3121;
+  if (a > 3122) v122 = v129 + a; else v125 = 3122;
+  if (a > 3123) v123 = v130 + a; else v126 = 3123;
+  if (a > 3124) v124 = v131 + a; else v127 = 3124;
+  if (a > 3125) v125 = v132 + a; else v128 = 3125;
+  if (a > 3126) v126 = v133 + a; else v129 = 3126;
+  if (a > 3127) v127 = v134 + a; else v130 = 3127;
+  if (a > 3128) v128 = v135 + a; else v131 = 3128;
+  if (a > 3129) v129 = v136 + a; else v132 = 3129;
+  if (a > 3130) v130 = v137 + a; else v133 = 3130;
+  if (a > 3131) v131 = v138 + a; else v134 = 3131;
+  if (a > 3132) v132 = v139 + a; else v135 = 3132;
+  if (a > 3133) v133 = v140 + a; else v136 = 3133;
+  if (a > 3134) v134 = v141 + a; else v137 = 3134;
+  if (a > 3135) v135 = v142 + a; else v138 = 3135;
+  if (a > 3136) v136 = v143 + a; else v139 = 3136;
+  if (a > 3137) v137 = v144 + a; else v140 = 3137;
+  if (a > 3138) v138 = v145 + a; else v141 = 3138;
+  if (a > 3139) v139 = v146 + a; else v142 = 3139;
+  if (a > 3140) v140 = v147 + a; else v143 = 3140;
+  if (a > 3141) v141 = v148 + a; else v144 = 3141;
+  if (a > 3142) v142 = v149 + a; else v145 = 3142;
+  if (a > 3143) v143 = v150 + a; else v146 = 3143;
+  if (a > 3144) v144 = v151 + a; else v147 = 3144;
+  if (a > 3145) v145 = v152 + a; else v148 = 3145;
+  if (a > 3146) v146 = v153 + a; else v149 = 3146;
+  if (a > 3147) v147 = v154 + a; else v150 = 3147;
+  if (a > 3148) v148 = v155 + a; else v151 = 3148;
+  if (a > 3149) v149 = v156 + a; else v152 = 3149;
+  if (a > 3150) v150 = v157 + a; else v153 = 3150;
+  if (a > 3151) v151 = v158 + a; else v154 = 3151;
+  if (a > 3152) v152 = v159 + a; else v155 = 3152;
+  if (a > 3153) v153 = v160 + a; else v156 = 3153;
+  if (a > 3154) v154 = v161 + a; else v157 = 3154;
+  if (a > 3155) v155 = v162 + a; else v158 = 3155;
+  if (a > 3156) v156 = v163 + a; else v159 = 3156;
+  if (a > 3157) v157 = v164 + a; else v160 = 3157;
+  if (a > 3158) v158 = v165 + a; else v161 = 3158;
+  if (a > 3159) v159 = v166 + a; else v162 = 3159;
+  if (a > 3160) v160 = v167 + a; else v163 = 3160;
+  if (a > 3161) v161 = v168 + a; else v164 = 3161;
+  if (a > 3162) v162 = v169 + a; else v165 = 3162;
+  if (a > 3163) v163 = v170 + a; else v166 = 3163;
+  if (a > 3164) v164 = v171 + a; else v167 = 3164;
+  if (a > 3165) v165 = v172 + a; else v168 = 3165;
+  if (a > 3166) v166 = v173 + a; else v169 = 3166;
+  if (a > 3167) v167 = v174 + a; else v170 = 3167;
+  if (a > 3168) v168 = v175 + a; else v171 = 3168;
+  if (a > 3169) v169 = v176 + a; else v172 = 3169;
+  if (a > 3170) v170 = v177 + a; else v173 = 3170;
+  if (a > 3171) v171 = v178 + a; else v174 = 3171;
+  if (a > 3172) v172 = v179 + a; else v175 = 3172;
+  if (a > 3173) v173 = v180 + a; else v176 = 3173;
+  if (a > 3174) v174 = v181 + a; else v177 = 3174;
+  if (a > 3175) v175 = v182 + a; else v178 = 3175;
+  if (a > 3176) v176 = v183 + a; else v179 = 3176;
+  if (a > 3177) v177 = v184 + a; else v180 = 3177;
+  if (a > 3178) v178 = v185 + a; else v181 = 3178;
+  if (a > 3179) v179 = v186 + a; else v182 = 3179;
+  if (a > 3180) v180 = v187 + a; else v183 = 3180;
+  if (a > 3181) v181 = v188 + a; else v184 = 3181;
+  if (a > 3182) v182 = v189 + a; else v185 = 3182;
+  if (a > 3183) v183 = v190 + a; else v186 = 3183;
+  if (a > 3184) v184 = v191 + a; else v187 = 3184;
+  if (a > 3185) v185 = v192 + a; else v188 = 3185;
+  if (a > 3186) v186 = v193 + a; else v189 = 3186;
+  if (a > 3187) v187 = v194 + a; else v190 = 3187;
+  if (a > 3188) v188 = v195 + a; else v191 = 3188;
+  if (a > 3189) v189 = v196 + a; else v192 = 3189;
+  if (a > 3190) v190 = v197 + a; else v193 = 3190;
+  if (a > 3191) v191 = v198 + a; else v194 = 3191;
+  if (a > 3192) v192 = v199 + a; else v195 = 3192;
+  if (a > 3193) v193 = v0 + a; else v196 = 3193;
+  if (a > 3194) v194 = v1 + a; else v197 = 3194;
+  if (a > 3195) v195 = v2 + a; else v198 = 3195;
+  if (a > 3196) v196 = v3 + a; else v199 = 3196;
+  if (a > 3197) v197 = v4 + a; else v0 = 3197;
+  if (a > 3198) v198 = v5 + a; else v1 = 3198;
+  if (a > 3199) v199 = v6 + a; else v2 = 3199;
+  if (a > 3200) v0 = v7 + a; else v3 = 3200;
+  if (a > 3201) v1 = v8 + a; else v4 = 3201;
+  if (a > 3202) v2 = v9 + a; else v5 = 3202;
+  if (a > 3203) v3 = v10 + a; else v6 = 3203;
+  if (a > 3204) v4 = v11 + a; else v7 = 3204;
+  if (a > 3205) v5 = v12 + a; else v8 = 3205;
+  if (a > 3206) v6 = v13 + a; else v9 = 3206;
+  if (a > 3207) v7 = v14 + a; else v10 = 3207;
+  if (a > 3208) v8 = v15 + a; else v11 = 3208;
+  if (a > 3209) v9 = v16 + a; else v12 = 3209;
+  if (a > 3210) v10 = v17 + a; else v13 = 3210;
+  if (a > 3211) v11 = v18 + a; else v14 = 3211;
+  if (a > 3212) v12 = v19 + a; else v15 = 3212;
+  if (a > 3213) v13 = v20 + a; else v16 = 3213;
+  if (a > 3214) v14 = v21 + a; else v17 = 3214;
+  if (a > 3215) v15 = v22 + a; else v18 = 3215;
+  if (a > 3216) v16 = v23 + a; else v19 = 3216;
+  if (a > 3217) v17 = v24 + a; else v20 = 3217;
+  if (a > 3218) v18 = v25 + a; else v21 = 3218;
+  if (a > 3219) v19 = v26 + a; else v22 = 3219;
+  if (a > 3220) v20 = v27 + a; else v23 = 3220;
+  if (a > 3221) v21 = v28 + a; else v24 = 3221;
+  if (a > 3222) v22 = v29 + a; else v25 = 3222;
+  if (a > 3223) v23 = v30 + a; else v26 = 3223;
+  if (a > 3224) v24 = v31 + a; else v27 = 3224;
+  if (a > 3225) v25 = v32 + a; else v28 = 3225;
+  if (a > 3226) v26 = v33 + a; else v29 = 3226;
+  if (a > 3227) v27 = v34 + a; else v30 = 3227;
+  if (a > 3228) v28 = v35 + a; else v31 = 3228;
+  if (a > 3229) v29 = v36 + a; else v32 = 3229;
+  if (a > 3230) v30 = v37 + a; else v33 = 3230;
+  if (a > 3231) v31 = v38 + a; else v34 = 3231;
+  if (a > 3232) v32 = v39 + a; else v35 = 3232;
+  if (a > 3233) v33 = v40 + a; else v36 = 3233;
+  if (a > 3234) v34 = v41 + a; else v37 = 3234;
+  if (a > 3235) v35 = v42 + a; else v38 = 3235;
+  if (a > 3236) v36 = v43 + a; else v39 = 3236;
+  if (a > 3237) v37 = v44 + a; else v40 = 3237;
+  if (a > 3238) v38 = v45 + a; else v41 = 3238;
+  if (a > 3239) v39 = v46 + a; else v42 = 3239;
+  if (a > 3240) v40 = v47 + a; else v43 = 3240;
+  if (a > 3241) v41 = v48 + a; else v44 = 3241;
+  if (a > 3242) v42 = v49 + a; else v45 = 3242;
+  if (a > 3243) v43 = v50 + a; else v46 = 3243;
+  if (a > 3244) v44 = v51 + a; else v47 = 3244;
+  if (a > 3245) v45 = v52 + a; else v48 = 3245;
+  if (a > 3246) v46 = v53 + a; else v49 = 3246;
+  if (a > 3247) v47 = v54 + a; else v50 = 3247;
+  if (a > 3248) v48 = v55 + a; else v51 = 3248;
+  if (a > 3249) v49 = v56 + a; else v52 = 3249;
+  if (a > 3250) v50 = v57 + a; else v53 = 3250;
+  if (a > 3251) v51 = v58 + a; else v54 = 3251;
+  if (a > 3252) v52 = v59 + a; else v55 = 3252;
+  if (a > 3253) v53 = v60 + a; else v56 = 3253;
+  if (a > 3254) v54 = v61 + a; else v57 = 3254;
+  if (a > 3255) v55 = v62 + a; else v58 = 3255;
+  if (a > 3256) v56 = v63 + a; else v59 = 3256;
+  if (a > 3257) v57 = v64 + a; else v60 = 3257;
+  if (a > 3258) v58 = v65 + a; else v61 = 3258;
+  if (a > 3259) v59 = v66 + a; else v62 = 3259;
+  if (a > 3260) v60 = v67 + a; else v63 = 3260;
+  if (a > 3261) v61 = v68 + a; else v64 = 3261;
+  if (a > 3262) v62 = v69 + a; else v65 = 3262;
+  if (a > 3263) v63 = v70 + a; else v66 = 3263;
+  if (a > 3264) v64 = v71 + a; else v67 = 3264;
+  if (a > 3265) v65 = v72 + a; else v68 = 3265;
+  if (a > 3266) v66 = v73 + a; else v69 = 3266;
+  if (a > 3267) v67 = v74 + a; else v70 = 3267;
+  if (a > 3268) v68 = v75 + a; else v71 = 3268;
+  if (a > 3269) v69 = v76 + a; else v72 = 3269;
+  if (a > 3270) v70 = v77 + a; else v73 = 3270;
+  if (a > 3271) v71 = v78 + a; else v74 = 3271;
+  if (a > 3272) v72 = v79 + a; else v75 = 3272;
+  if (a > 3273) v73 = v80 + a; else v76 = 3273;
+  if (a > 3274) v74 = v81 + a; else v77 = 3274;
+  if (a > 3275) v75 = v82 + a; else v78 = 3275;
+  if (a > 3276) v76 = v83 + a; else v79 = 3276;
+  if (a > 3277) v77 = v84 + a; else v80 = 3277;
+  if (a > 3278) v78 = v85 + a; else v81 = 3278;
+  if (a > 3279) v79 = v86 + a; else v82 = 3279;
+  if (a > 3280) v80 = v87 + a; else v83 = 3280;
+  if (a > 3281) v81 = v88 + a; else v84 = 3281;
+  if (a > 3282) v82 = v89 + a; else v85 = 3282;
+  if (a > 3283) v83 = v90 + a; else v86 = 3283;
+  if (a > 3284) v84 = v91 + a; else v87 = 3284;
+  if (a > 3285) v85 = v92 + a; else v88 = 3285;
+  if (a > 3286) v86 = v93 + a; else v89 = 3286;
+  if (a > 3287) v87 = v94 + a; else v90 = 3287;
+  if (a > 3288) v88 = v95 + a; else v91 = 3288;
+  if (a > 3289) v89 = v96 + a; else v92 = 3289;
+  if (a > 3290) v90 = v97 + a; else v93 = 3290;
+  if (a > 3291) v91 = v98 + a; else v94 = 3291;
+  if (a > 3292) v92 = v99 + a; else v95 = 3292;
+  if (a > 3293) v93 = v100 + a; else v96 = 3293;
+  if (a > 3294) v94 = v101 + a; else v97 = 3294;
+  if (a > 3295) v95 = v102 + a; else v98 = 3295;
+  if (a > 3296) v96 = v103 + a; else v99 = 3296;
+  if (a > 3297) v97 = v104 + a; else v100 = 3297;
+  if (a > 3298) v98 = v105 + a; else v101 = 3298;
+  if (a > 3299) v99 = v106 + a; else v102 = 3299;
+  if (a > 3300) v100 = v107 + a; else v103 = 3300;
+  if (a > 3301) v101 = v108 + a; else v104 = 3301;
+  if (a > 3302) v102 = v109 + a; else v105 = 3302;
+  if (a > 3303) v103 = v110 + a; else v106 = 3303;
+  if (a > 3304) v104 = v111 + a; else v107 = 3304;
+  if (a > 3305) v105 = v112 + a; else v108 = 3305;
+  if (a > 3306) v106 = v113 + a; else v109 = 3306;
+  if (a > 3307) v107 = v114 + a; else v110 = 3307;
+  if (a > 3308) v108 = v115 + a; else v111 = 3308;
+  if (a > 3309) v109 = v116 + a; else v112 = 3309;
+  if (a > 3310) v110 = v117 + a; else v113 = 3310;
+  if (a > 3311) v111 = v118 + a; else v114 = 3311;
+  if (a > 3312) v112 = v119 + a; else v115 = 3312;
+  if (a > 3313) v113 = v120 + a; else v116 = 3313;
+  if (a > 3314) v114 = v121 + a; else v117 = 3314;
+  if (a > 3315) v115 = v122 + a; else v118 = 3315;
+  if (a > 3316) v116 = v123 + a; else v119 = 3316;
+  if (a > 3317) v117 = v124 + a; else v120 = 3317;
+  if (a > 3318) v118 = v125 + a; else v121 = 3318;
+  if (a > 3319) v119 = v126 + a; else v122 = 3319;
+  if (a > 3320) v120 = v127 + a; else v123 = 3320;
+  if (a > 3321) v121 = v128 + a; else v124 = 3321;
+  if (a > 3322) v122 = v129 + a; else v125 = 3322;
+  if (a > 3323) v123 = v130 + a; else v126 = 3323;
+  if (a > 3324) v124 = v131 + a; else v127 = 3324;
+  if (a > 3325) v125 = v132 + a; else v128 = 3325;
+  if (a > 3326) v126 = v133 + a; else v129 = 3326;
+  if (a > 3327) v127 = v134 + a; else v130 = 3327;
+  if (a > 3328) v128 = v135 + a; else v131 = 3328;
+  if (a > 3329) v129 = v136 + a; else v132 = 3329;
+  if (a > 3330) v130 = v137 + a; else v133 = 3330;
+  if (a > 3331) v131 = v138 + a; else v134 = 3331;
+  if (a > 3332) v132 = v139 + a; else v135 = 3332;
+  if (a > 3333) v133 = v140 + a; else v136 = 3333;
+  if (a > 3334) v134 = v141 + a; else v137 = 3334;
+  if (a > 3335) v135 = v142 + a; else v138 = 3335;
+  if (a > 3336) v136 = v143 + a; else v139 = 3336;
+  if (a > 3337) v137 = v144 + a; else v140 = 3337;
+  if (a > 3338) v138 = v145 + a; else v141 = 3338;
+  if (a > 3339) v139 = v146 + a; else v142 = 3339;
+  if (a > 3340) v140 = v147 + a; else v143 = 3340;
+  if (a > 3341) v141 = v148 + a; else v144 = 3341;
+  if (a > 3342) v142 = v149 + a; else v145 = 3342;
+  if (a > 3343) v143 = v150 + a; else v146 = 3343;
+  if (a > 3344) v144 = v151 + a; else v147 = 3344;
+  if (a > 3345) v145 = v152 + a; else v148 = 3345;
+  if (a > 3346) v146 = v153 + a; else v149 = 3346;
+  if (a > 3347) v147 = v154 + a; else v150 = 3347;
+  if (a > 3348) v148 = v155 + a; else v151 = 3348;
+  if (a > 3349) v149 = v156 + a; else v152 = 3349;
+  if (a > 3350) v150 = v157 + a; else v153 = 3350;
+  if (a > 3351) v151 = v158 + a; else v154 = 3351;
+  if (a > 3352) v152 = v159 + a; else v155 = 3352;
+  if (a > 3353) v153 = v160 + a; else v156 = 3353;
+  if (a > 3354) v154 = v161 + a; else v157 = 3354;
+  if (a > 3355) v155 = v162 + a; else v158 = 3355;
+  if (a > 3356) v156 = v163 + a; else v159 = 3356;
+  if (a > 3357) v157 = v164 + a; else v160 = 3357;
+  if (a > 3358) v158 = v165 + a; else v161 = 3358;
+  if (a > 3359) v159 = v166 + a; else v162 = 3359;
+  if (a > 3360) v160 = v167 + a; else v163 = 3360;
+  if (a > 3361) v161 = v168 + a; else v164 = 3361;
+  if (a > 3362) v162 = v169 + a; else v165 = 3362;
+  if (a > 3363) v163 = v170 + a; else v166 = 3363;
+  if (a > 3364) v164 = v171 + a; else v167 = 3364;
+  if (a > 3365) v165 = v172 + a; else v168 = 3365;
+  if (a > 3366) v166 = v173 + a; else v169 = 3366;
+  if (a > 3367) v167 = v174 + a; else v170 = 3367;
+  if (a > 3368) v168 = v175 + a; else v171 = 3368;
+  if (a > 3369) v169 = v176 + a; else v172 = 3369;
+  if (a > 3370) v170 = v177 + a; else v173 = 3370;
+  if (a > 3371) v171 = v178 + a; else v174 = 3371;
+  if (a > 3372) v172 = v179 + a; else v175 = 3372;
+  if (a > 3373) v173 = v180 + a; else v176 = 3373;
+  if (a > 3374) v174 = v181 + a; else v177 = 3374;
+  if (a > 3375) v175 = v182 + a; else v178 = 3375;
+  if (a > 3376) v176 = v183 + a; else v179 = 3376;
+  if (a > 3377) v177 = v184 + a; else v180 = 3377;
+  if (a > 3378) v178 = v185 + a; else v181 = 3378;
+  if (a > 3379) v179 = v186 + a; else v182 = 3379;
+  if (a > 3380) v180 = v187 + a; else v183 = 3380;
+  if (a > 3381) v181 = v188 + a; else v184 = 3381;
+  if (a > 3382) v182 = v189 + a; else v185 = 3382;
+  if (a > 3383) v183 = v190 + a; else v186 = 3383;
+  if (a > 3384) v184 = v191 + a; else v187 = 3384;
+  if (a > 3385) v185 = v192 + a; else v188 = 3385;
+  if (a > 3386) v186 = v193 + a; else v189 = 3386;
+  if (a > 3387) v187 = v194 + a; else v190 = 3387;
+  if (a > 3388) v188 = v195 + a; else v191 = 3388;
+  if (a > 3389) v189 = v196 + a; else v192 = 3389;
+  if (a > 3390) v190 = v197 + a; else v193 = 3390;
+  if (a > 3391) v191 = v198 + a; else v194 = 3391;
+  if (a > 3392) v192 = v199 + a; else v195 = 3392;
+  if (a > 3393) v193 = v0 + a; else v196 = 3393;
+  if (a > 3394) v194 = v1 + a; else v197 = 3394;
+  if (a > 3395) v195 = v2 + a; else v198 = 3395;
+  if (a > 3396) v196 = v3 + a; else v199 = 3396;
+  if (a > 3397) v197 = v4 + a; else v0 = 3397;
+  if (a > 3398) v198 = v5 + a; else v1 = 3398;
+  if (a > 3399) v199 = v6 + a; else v2 = 3399;
+  if (a > 3400) v0 = v7 + a; else v3 = 3400;
+  if (a > 3401) v1 = v8 + a; else v4 = 3401;
+  if (a > 3402) v2 = v9 + a; else v5 = 3402;
+  if (a > 3403) v3 = v10 + a; else v6 = 3403;
+  if (a > 3404) v4 = v11 + a; else v7 = 3404;
+  if (a > 3405) v5 = v12 + a; else v8 = 3405;
+  if (a > 3406) v6 = v13 + a; else v9 = 3406;
+  if (a > 3407) v7 = v14 + a; else v10 = 3407;
+  if (a > 3408) v8 = v15 + a; else v11 = 3408;
+  if (a > 3409) v9 = v16 + a; else v12 = 3409;
+  if (a > 3410) v10 = v17 + a; else v13 = 3410;
+  if (a > 3411) v11 = v18 + a; else v14 = 3411;
+  if (a > 3412) v12 = v19 + a; else v15 = 3412;
+  if (a > 3413) v13 = v20 + a; else v16 = 3413;
+  if (a > 3414) v14 = v21 + a; else v17 = 3414;
+  if (a > 3415) v15 = v22 + a; else v18 = 3415;
+  if (a > 3416) v16 = v23 + a; else v19 = 3416;
+  if (a > 3417) v17 = v24 + a; else v20 = 3417;
+  if (a > 3418) v18 = v25 + a; else v21 = 3418;
+  if (a > 3419) v19 = v26 + a; else v22 = 3419;
+  if (a > 3420) v20 = v27 + a; else v23 = 3420;
+  if (a > 3421) v21 = v28 + a; else v24 = 3421;
+  if (a > 3422) v22 = v29 + a; else v25 = 3422;
+  if (a > 3423) v23 = v30 + a; else v26 = 3423;
+  if (a > 3424) v24 = v31 + a; else v27 = 3424;
+  if (a > 3425) v25 = v32 + a; else v28 = 3425;
+  if (a > 3426) v26 = v33 + a; else v29 = 3426;
+  if (a > 3427) v27 = v34 + a; else v30 = 3427;
+  if (a > 3428) v28 = v35 + a; else v31 = 3428;
+  if (a > 3429) v29 = v36 + a; else v32 = 3429;
+  if (a > 3430) v30 = v37 + a; else v33 = 3430;
+  if (a > 3431) v31 = v38 + a; else v34 = 3431;
+  if (a > 3432) v32 = v39 + a; else v35 = 3432;
+  if (a > 3433) v33 = v40 + a; else v36 = 3433;
+  if (a > 3434) v34 = v41 + a; else v37 = 3434;
+  if (a > 3435) v35 = v42 + a; else v38 = 3435;
+  if (a > 3436) v36 = v43 + a; else v39 = 3436;
+  if (a > 3437) v37 = v44 + a; else v40 = 3437;
+  if (a > 3438) v38 = v45 + a; else v41 = 3438;
+  if (a > 3439) v39 = v46 + a; else v42 = 3439;
+  if (a > 3440) v40 = v47 + a; else v43 = 3440;
+  if (a > 3441) v41 = v48 + a; else v44 = 3441;
+  if (a > 3442) v42 = v49 + a; else v45 = 3442;
+  if (a > 3443) v43 = v50 + a; else v46 = 3443;
+  if (a > 3444) v44 = v51 + a; else v47 = 3444;
+  if (a > 3445) v45 = v52 + a; else v48 = 3445;
+  if (a > 3446) v46 = v53 + a; else v49 = 3446;
+  if (a > 3447) v47 = v54 + a; else v50 = 3447;
+  if (a > 3448) v48 = v55 + a; else v51 = 3448;
+  if (a > 3449) v49 = v56 + a; else v52 = 3449;
+  if (a > 3450) v50 = v57 + a; else v53 = 3450;
+  if (a > 3451) v51 = v58 + a; else v54 = 3451;
+  if (a > 3452) v52 = v59 + a; else v55 = 3452;
+  if (a > 3453) v53 = v60 + a; else v56 = 3453;
+  if (a > 3454) v54 = v61 + a; else v57 = 3454;
+  if (a > 3455) v55 = v62 + a; else v58 = 3455;
+  if (a > 3456) v56 = v63 + a; else v59 = 3456;
+  if (a > 3457) v57 = v64 + a; else v60 = 3457;
+  if (a > 3458) v58 = v65 + a; else v61 = 3458;
+  if (a > 3459) v59 = v66 + a; else v62 = 3459;
+  if (a > 3460) v60 = v67 + a; else v63 = 3460;
+  if (a > 3461) v61 = v68 + a; else v64 = 3461;
+  if (a > 3462) v62 = v69 + a; else v65 = 3462;
+  if (a > 3463) v63 = v70 + a; else v66 = 3463;
+  if (a > 3464) v64 = v71 + a; else v67 = 3464;
+  if (a > 3465) v65 = v72 + a; else v68 = 3465;
+  if (a > 3466) v66 = v73 + a; else v69 = 3466;
+  if (a > 3467) v67 = v74 + a; else v70 = 3467;
+  if (a > 3468) v68 = v75 + a; else v71 = 3468;
+  if (a > 3469) v69 = v76 + a; else v72 = 3469;
+  if (a > 3470) v70 = v77 + a; else v73 = 3470;
+  if (a > 3471) v71 = v78 + a; else v74 = 3471;
+  if (a > 3472) v72 = v79 + a; else v75 = 3472;
+  if (a > 3473) v73 = v80 + a; else v76 = 3473;
+  if (a > 3474) v74 = v81 + a; else v77 = 3474;
+  if (a > 3475) v75 = v82 + a; else v78 = 3475;
+  if (a > 3476) v76 = v83 + a; else v79 = 3476;
+  if (a > 3477) v77 = v84 + a; else v80 = 3477;
+  if (a > 3478) v78 = v85 + a; else v81 = 3478;
+  if (a > 3479) v79 = v86 + a; else v82 = 3479;
+  if (a > 3480) v80 = v87 + a; else v83 = 3480;
+  if (a > 3481) v81 = v88 + a; else v84 = 3481;
+  if (a > 3482) v82 = v89 + a; else v85 = 3482;
+  if (a > 3483) v83 = v90 + a; else v86 = 3483;
+  if (a > 3484) v84 = v91 + a; else v87 = 3484;
+  if (a > 3485) v85 = v92 + a; else v88 = 3485;
+  if (a > 3486) v86 = v93 + a; else v89 = 3486;
+  if (a > 3487) v87 = v94 + a; else v90 = 3487;
+  if (a > 3488) v88 = v95 + a; else v91 = 3488;
+  if (a > 3489) v89 = v96 + a; else v92 = 3489;
+  if (a > 3490) v90 = v97 + a; else v93 = 3490;
+  if (a > 3491) v91 = v98 + a; else v94 = 3491;
+  if (a > 3492) v92 = v99 + a; else v95 = 3492;
+  if (a > 3493) v93 = v100 + a; else v96 = 3493;
+  if (a > 3494) v94 = v101 + a; else v97 = 3494;
+  if (a > 3495) v95 = v102 + a; else v98 = 3495;
+  if (a > 3496) v96 = v103 + a; else v99 = 3496;
+  if (a > 3497) v97 = v104 + a; else v100 = 3497;
+  if (a > 3498) v98 = v105 + a; else v101 = 3498;
+  if (a > 3499) v99 = v106 + a; else v102 = 3499;
+  if (a > 3500) v100 = v107 + a; else v103 = 3500;
+  if (a > 3501) v101 = v108 + a; else v104 = 3501;
+  if (a > 3502) v102 = v109 + a; else v105 = 3502;
+  if (a > 3503) v103 = v110 + a; else v106 = 3503;
+  if (a > 3504) v104 = v111 + a; else v107 = 3504;
+  if (a > 3505) v105 = v112 + a; else v108 = 3505;
+  if (a > 3506) v106 = v113 + a; else v109 = 3506;
+  if (a > 3507) v107 = v114 + a; else v110 = 3507;
+  if (a > 3508) v108 = v115 + a; else v111 = 3508;
+  if (a > 3509) v109 = v116 + a; else v112 = 3509;
+  if (a > 3510) v110 = v117 + a; else v113 = 3510;
+  if (a > 3511) v111 = v118 + a; else v114 = 3511;
+  if (a > 3512) v112 = v119 + a; else v115 = 3512;
+  if (a > 3513) v113 = v120 + a; else v116 = 3513;
+  if (a > 3514) v114 = v121 + a; else v117 = 3514;
+  if (a > 3515) v115 = v122 + a; else v118 = 3515;
+  if (a > 3516) v116 = v123 + a; else v119 = 3516;
+  if (a > 3517) v117 = v124 + a; else v120 = 3517;
+  if (a > 3518) v118 = v125 + a; else v121 = 3518;
+  if (a > 3519) v119 = v126 + a; else v122 = 3519;
+  if (a > 3520) v120 = v127 + a; else v123 = 3520;
+  if (a > 3521) v121 = v128 + a; else v124 = 3521;
+  if (a > 3522) v122 = v129 + a; else v125 = 3522;
+  if (a > 3523) v123 = v130 + a; else v126 = 3523;
+  if (a > 3524) v124 = v131 + a; else v127 = 3524;
+  if (a > 3525) v125 = v132 + a; else v128 = 3525;
+  if (a > 3526) v126 = v133 + a; else v129 = 3526;
+  if (a > 3527) v127 = v134 + a; else v130 = 3527;
+  if (a > 3528) v128 = v135 + a; else v131 = 3528;
+  if (a > 3529) v129 = v136 + a; else v132 = 3529;
+  if (a > 3530) v130 = v137 + a; else v133 = 3530;
+  if (a > 3531) v131 = v138 + a; else v134 = 3531;
+  if (a > 3532) v132 = v139 + a; else v135 = 3532;
+  if (a > 3533) v133 = v140 + a; else v136 = 3533;
+  if (a > 3534) v134 = v141 + a; else v137 = 3534;
+  if (a > 3535) v135 = v142 + a; else v138 = 3535;
+  if (a > 3536) v136 = v143 + a; else v139 = 3536;
+  if (a > 3537) v137 = v144 + a; else v140 = 3537;
+  if (a > 3538) v138 = v145 + a; else v141 = 3538;
+  if (a > 3539) v139 = v146 + a; else v142 = 3539;
+  if (a > 3540) v140 = v147 + a; else v143 = 3540;
+  if (a > 3541) v141 = v148 + a; else v144 = 3541;
+  if (a > 3542) v142 = v149 + a; else v145 = 3542;
+  if (a > 3543) v143 = v150 + a; else v146 = 3543;
+  if (a > 3544) v144 = v151 + a; else v147 = 3544;
+  if (a > 3545) v145 = v152 + a; else v148 = 3545;
+  if (a > 3546) v146 = v153 + a; else v149 = 3546;
+  if (a > 3547) v147 = v154 + a; else v150 = 3547;
+  if (a > 3548) v148 = v155 + a; else v151 = 3548;
+  if (a > 3549) v149 = v156 + a; else v152 = 3549;
+  if (a > 3550) v150 = v157 + a; else v153 = 3550;
+  if (a > 3551) v151 = v158 + a; else v154 = 3551;
+  if (a > 3552) v152 = v159 + a; else v155 = 3552;
+  if (a > 3553) v153 = v160 + a; else v156 = 3553;
+  if (a > 3554) v154 = v161 + a; else v157 = 3554;
+  if (a > 3555) v155 = v162 + a; else v158 = 3555;
+  if (a > 3556) v156 = v163 + a; else v159 = 3556;
+  if (a > 3557) v157 = v164 + a; else v160 = 3557;
+  if (a > 3558) v158 = v165 + a; else v161 = 3558;
+  if (a > 3559) v159 = v166 + a; else v162 = 3559;
+  if (a > 3560) v160 = v167 + a; else v163 = 3560;
+  if (a > 3561) v161 = v168 + a; else v164 = 3561;
+  if (a > 3562) v162 = v169 + a; else v165 = 3562;
+  if (a > 3563) v163 = v170 + a; else v166 = 3563;
+  if (a > 3564) v164 = v171 + a; else v167 = 3564;
+  if (a > 3565) v165 = v172 + a; else v168 = 3565;
+  if (a > 3566) v166 = v173 + a; else v169 = 3566;
+  if (a > 3567) v167 = v174 + a; else v170 = 3567;
+  if (a > 3568) v168 = v175 + a; else v171 = 3568;
+  if (a > 3569) v169 = v176 + a; else v172 = 3569;
+  if (a > 3570) v170 = v177 + a; else v173 = 3570;
+  if (a > 3571) v171 = v178 + a; else v174 = 3571;
+  if (a > 3572) v172 = v179 + a; else v175 = 3572;
+  if (a > 3573) v173 = v180 + a; else v176 = 3573;
+  if (a > 3574) v174 = v181 + a; else v177 = 3574;
+  if (a > 3575) v175 = v182 + a; else v178 = 3575;
+  if (a > 3576) v176 = v183 + a; else v179 = 3576;
+  if (a > 3577) v177 = v184 + a; else v180 = 3577;
+  if (a > 3578) v178 = v185 + a; else v181 = 3578;
+  if (a > 3579) v179 = v186 + a; else v182 = 3579;
+  if (a > 3580) v180 = v187 + a; else v183 = 3580;
+  if (a > 3581) v181 = v188 + a; else v184 = 3581;
+  if (a > 3582) v182 = v189 + a; else v185 = 3582;
+  if (a > 3583) v183 = v190 + a; else v186 = 3583;
+  if (a > 3584) v184 = v191 + a; else v187 = 3584;
+  if (a > 3585) v185 = v192 + a; else v188 = 3585;
+  if (a > 3586) v186 = v193 + a; else v189 = 3586;
+  if (a > 3587) v187 = v194 + a; else v190 = 3587;
+  if (a > 3588) v188 = v195 + a; else v191 = 3588;
+  if (a > 3589) v189 = v196 + a; else v192 = 3589;
+  if (a > 3590) v190 = v197 + a; else v193 = 3590;
+  if (a > 3591) v191 = v198 + a; else v194 = 3591;
+  if (a > 3592) v192 = v199 + a; else v195 = 3592;
+  if (a > 3593) v193 = v0 + a; else v196 = 3593;
+  if (a > 3594) v194 = v1 + a; else v197 = 3594;
+  if (a > 3595) v195 = v2 + a; else v198 = 3595;
+  if (a > 3596) v196 = v3 + a; else v199 = 3596;
+  if (a > 3597) v197 = v4 + a; else v0 = 3597;
+  if (a > 3598) v198 = v5 + a; else v1 = 3598;
+  if (a > 3599) v199 = v6 + a; else v2 = 3599;
+  if (a > 3600) v0 = v7 + a; else v3 = 3600;
+  if (a > 3601) v1 = v8 + a; else v4 = 3601;
+  if (a > 3602) v2 = v9 + a; else v5 = 3602;
+  if (a > 3603) v3 = v10 + a; else v6 = 3603;
+  if (a > 3604) v4 = v11 + a; else v7 = 3604;
+  if (a > 3605) v5 = v12 + a; else v8 = 3605;
+  if (a > 3606) v6 = v13 + a; else v9 = 3606;
+  if (a > 3607) v7 = v14 + a; else v10 = 3607;
+  if (a > 3608) v8 = v15 + a; else v11 = 3608;
+  if (a > 3609) v9 = v16 + a; else v12 = 3609;
+  if (a > 3610) v10 = v17 + a; else v13 = 3610;
+  if (a > 3611) v11 = v18 + a; else v14 = 3611;
+  if (a > 3612) v12 = v19 + a; else v15 = 3612;
+  if (a > 3613) v13 = v20 + a; else v16 = 3613;
+  if (a > 3614) v14 = v21 + a; else v17 = 3614;
+  if (a > 3615) v15 = v22 + a; else v18 = 3615;
+  if (a > 3616) v16 = v23 + a; else v19 = 3616;
+  if (a > 3617) v17 = v24 + a; else v20 = 3617;
+  if (a > 3618) v18 = v25 + a; else v21 = 3618;
+  if (a > 3619) v19 = v26 + a; else v22 = 3619;
+  if (a > 3620) v20 = v27 + a; else v23 = 3620;
+  if (a > 3621) v21 = v28 + a; else v24 = 3621;
+  if (a > 3622) v22 = v29 + a; else v25 = 3622;
+  if (a > 3623) v23 = v30 + a; else v26 = 3623;
+  if (a > 3624) v24 = v31 + a; else v27 = 3624;
+  if (a > 3625) v25 = v32 + a; else v28 = 3625;
+  if (a > 3626) v26 = v33 + a; else v29 = 3626;
+  if (a > 3627) v27 = v34 + a; else v30 = 3627;
+  if (a > 3628) v28 = v35 + a; else v31 = 3628;
+  if (a > 3629) v29 = v36 + a; else v32 = 3629;
+  if (a > 3630) v30 = v37 + a; else v33 = 3630;
+  if (a > 3631) v31 = v38 + a; else v34 = 3631;
+  if (a > 3632) v32 = v39 + a; else v35 = 3632;
+  if (a > 3633) v33 = v40 + a; else v36 = 3633;
+  if (a > 3634) v34 = v41 + a; else v37 = 3634;
+  if (a > 3635) v35 = v42 + a; else v38 = 3635;
+  if (a > 3636) v36 = v43 + a; else v39 = 3636;
+  if (a > 3637) v37 = v44 + a; else v40 = 3637;
+  if (a > 3638) v38 = v45 + a; else v41 = 3638;
+  if (a > 3639) v39 = v46 + a; else v42 = 3639;
+  if (a > 3640) v40 = v47 + a; else v43 = 3640;
+  if (a > 3641) v41 = v48 + a; else v44 = 3641;
+  if (a > 3642) v42 = v49 + a; else v45 = 3642;
+  if (a > 3643) v43 = v50 + a; else v46 = 3643;
+  if (a > 3644) v44 = v51 + a; else v47 = 3644;
+  if (a > 3645) v45 = v52 + a; else v48 = 3645;
+  if (a > 3646) v46 = v53 + a; else v49 = 3646;
+  if (a > 3647) v47 = v54 + a; else v50 = 3647;
+  if (a > 3648) v48 = v55 + a; else v51 = 3648;
+  if (a > 3649) v49 = v56 + a; else v52 = 3649;
+  if (a > 3650) v50 = v57 + a; else v53 = 3650;
+  if (a > 3651) v51 = v58 + a; else v54 = 3651;
+  if (a > 3652) v52 = v59 + a; else v55 = 3652;
+  if (a > 3653) v53 = v60 + a; else v56 = 3653;
+  if (a > 3654) v54 = v61 + a; else v57 = 3654;
+  if (a > 3655) v55 = v62 + a; else v58 = 3655;
+  if (a > 3656) v56 = v63 + a; else v59 = 3656;
+  if (a > 3657) v57 = v64 + a; else v60 = 3657;
+  if (a > 3658) v58 = v65 + a; else v61 = 3658;
+  if (a > 3659) v59 = v66 + a; else v62 = 3659;
+  if (a > 3660) v60 = v67 + a; else v63 = 3660;
+  if (a > 3661) v61 = v68 + a; else v64 = 3661;
+  if (a > 3662) v62 = v69 + a; else v65 = 3662;
+  if (a > 3663) v63 = v70 + a; else v66 = 3663;
+  if (a > 3664) v64 = v71 + a; else v67 = 3664;
+  if (a > 3665) v65 = v72 + a; else v68 = 3665;
+  if (a > 3666) v66 = v73 + a; else v69 = 3666;
+  if (a > 3667) v67 = v74 + a; else v70 = 3667;
+  if (a > 3668) v68 = v75 + a; else v71 = 3668;
+  if (a > 3669) v69 = v76 + a; else v72 = 3669;
+  if (a > 3670) v70 = v77 + a; else v73 = 3670;
+  if (a > 3671) v71 = v78 + a; else v74 = 3671;
+  if (a > 3672) v72 = v79 + a; else v75 = 3672;
+  if (a > 3673) v73 = v80 + a; else v76 = 3673;
+  if (a > 3674) v74 = v81 + a; else v77 = 3674;
+  if (a > 3675) v75 = v82 + a; else v78 = 3675;
+  if (a > 3676) v76 = v83 + a; else v79 = 3676;
+  if (a > 3677) v77 = v84 + a; else v80 = 3677;
+  if (a > 3678) v78 = v85 + a; else v81 = 3678;
+  if (a > 3679) v79 = v86 + a; else v82 = 3679;
+  if (a > 3680) v80 = v87 + a; else v83 = 3680;
+  if (a > 3681) v81 = v88 + a; else v84 = 3681;
+  if (a > 3682) v82 = v89 + a; else v85 = 3682;
+  if (a > 3683) v83 = v90 + a; else v86 = 3683;
+  if (a > 3684) v84 = v91 + a; else v87 = 3684;
+  if (a > 3685) v85 = v92 + a; else v88 = 3685;
+  if (a > 3686) v86 = v93 + a; else v89 = 3686;
+  if (a > 3687) v87 = v94 + a; else v90 = 3687;
+  if (a > 3688) v88 = v95 + a; else v91 = 3688;
+  if (a > 3689) v89 = v96 + a; else v92 = 3689;
+  if (a > 3690) v90 = v97 + a; else v93 = 3690;
+  if (a > 3691) v91 = v98 + a; else v94 = 3691;
+  if (a > 3692) v92 = v99 + a; else v95 = 3692;
+  if (a > 3693) v93 = v100 + a; else v96 = 3693;
+  if (a > 3694) v94 = v101 + a; else v97 = 3694;
+  if (a > 3695) v95 = v102 + a; else v98 = 3695;
+  if (a > 3696) v96 = v103 + a; else v99 = 3696;
+  if (a > 3697) v97 = v104 + a; else v100 = 3697;
+  if (a > 3698) v98 = v105 + a; else v101 = 3698;
+  if (a > 3699) v99 = v106 + a; else v102 = 3699;
+  if (a > 3700) v100 = v107 + a; else v103 = 3700;
+  if (a > 3701) v101 = v108 + a; else v104 = 3701;
+  if (a > 3702) v102 = v109 + a; else v105 = 3702;
+  if (a > 3703) v103 = v110 + a; else v106 = 3703;
+  if (a > 3704) v104 = v111 + a; else v107 = 3704;
+  if (a > 3705) v105 = v112 + a; else v108 = 3705;
+  if (a > 3706) v106 = v113 + a; else v109 = 3706;
+  if (a > 3707) v107 = v114 + a; else v110 = 3707;
+  if (a > 3708) v108 = v115 + a; else v111 = 3708;
+  if (a > 3709) v109 = v116 + a; else v112 = 3709;
+  if (a > 3710) v110 = v117 + a; else v113 = 3710;
+  if (a > 3711) v111 = v118 + a; else v114 = 3711;
+  if (a > 3712) v112 = v119 + a; else v115 = 3712;
+  if (a > 3713) v113 = v120 + a; else v116 = 3713;
+  if (a > 3714) v114 = v121 + a; else v117 = 3714;
+  if (a > 3715) v115 = v122 + a; else v118 = 3715;
+  if (a > 3716) v116 = v123 + a; else v119 = 3716;
+  if (a > 3717) v117 = v124 + a; else v120 = 3717;
+  if (a > 3718) v118 = v125 + a; else v121 = 3718;
+  if (a > 3719) v119 = v126 + a; else v122 = 3719;
+  if (a > 3720) v120 = v127 + a; else v123 = 3720;
+  if (a > 3721) v121 = v128 + a; else v124 = 3721;
+  if (a > 3722) v122 = v129 + a; else v125 = 3722;
+  if (a > 3723) v123 = v130 + a; else v126 = 3723;
+  if (a > 3724) v124 = v131 + a; else v127 = 3724;
+  if (a > 3725) v125 = v132 + a; else v128 = 3725;
+  if (a > 3726) v126 = v133 + a; else v129 = 3726;
+  if (a > 3727) v127 = v134 + a; else v130 = 3727;
+  if (a > 3728) v128 = v135 + a; else v131 = 3728;
+  if (a > 3729) v129 = v136 + a; else v132 = 3729;
+  if (a > 3730) v130 = v137 + a; else v133 = 3730;
+  if (a > 3731) v131 = v138 + a; else v134 = 3731;
+  if (a > 3732) v132 = v139 + a; else v135 = 3732;
+  if (a > 3733) v133 = v140 + a; else v136 = 3733;
+  if (a > 3734) v134 = v141 + a; else v137 = 3734;
+  if (a > 3735) v135 = v142 + a; else v138 = 3735;
+  if (a > 3736) v136 = v143 + a; else v139 = 3736;
+  if (a > 3737) v137 = v144 + a; else v140 = 3737;
+  if (a > 3738) v138 = v145 + a; else v141 = 3738;
+  if (a > 3739) v139 = v146 + a; else v142 = 3739;
+  if (a > 3740) v140 = v147 + a; else v143 = 3740;
+  if (a > 3741) v141 = v148 + a; else v144 = 3741;
+  if (a > 3742) v142 = v149 + a; else v145 = 3742;
+  if (a > 3743) v143 = v150 + a; else v146 = 3743;
+  if (a > 3744) v144 = v151 + a; else v147 = 3744;
+  if (a > 3745) v145 = v152 + a; else v148 = 3745;
+  if (a > 3746) v146 = v153 + a; else v149 = 3746;
+  if (a > 3747) v147 = v154 + a; else v150 = 3747;
+  if (a > 3748) v148 = v155 + a; else v151 = 3748;
+  if (a > 3749) v149 = v156 + a; else v152 = 3749;
+  if (a > 3750) v150 = v157 + a; else v153 = 3750;
+  if (a > 3751) v151 = v158 + a; else v154 = 3751;
+  if (a > 3752) v152 = v159 + a; else v155 = 3752;
+  if (a > 3753) v153 = v160 + a; else v156 = 3753;
+  if (a > 3754) v154 = v161 + a; else v157 = 3754;
+  if (a > 3755) v155 = v162 + a; else v158 = 3755;
+  if (a > 3756) v156 = v163 + a; else v159 = 3756;
+  if (a > 3757) v157 = v164 + a; else v160 = 3757;
+  if (a > 3758) v158 = v165 + a; else v161 = 3758;
+  if (a > 3759) v159 = v166 + a; else v162 = 3759;
+  if (a > 3760) v160 = v167 + a; else v163 = 3760;
+  if (a > 3761) v161 = v168 + a; else v164 = 3761;
+  if (a > 3762) v162 = v169 + a; else v165 = 3762;
+  if (a > 3763) v163 = v170 + a; else v166 = 3763;
+  if (a > 3764) v164 = v171 + a; else v167 = 3764;
+  if (a > 3765) v165 = v172 + a; else v168 = 3765;
+  if (a > 3766) v166 = v173 + a; else v169 = 3766;
+  if (a > 3767) v167 = v174 + a; else v170 = 3767;
+  if (a > 3768) v168 = v175 + a; else v171 = 3768;
+  if (a > 3769) v169 = v176 + a; else v172 = 3769;
+  if (a > 3770) v170 = v177 + a; else v173 = 3770;
+  if (a > 3771) v171 = v178 + a; else v174 = 3771;
+  if (a > 3772) v172 = v179 + a; else v175 = 3772;
+  if (a > 3773) v173 = v180 + a; else v176 = 3773;
+  if (a > 3774) v174 = v181 + a; else v177 = 3774;
+  if (a > 3775) v175 = v182 + a; else v178 = 3775;
+  if (a > 3776) v176 = v183 + a; else v179 = 3776;
+  if (a > 3777) v177 = v184 + a; else v180 = 3777;
+  if (a > 3778) v178 = v185 + a; else v181 = 3778;
+  if (a > 3779) v179 = v186 + a; else v182 = 3779;
+  if (a > 3780) v180 = v187 + a; else v183 = 3780;
+  if (a > 3781) v181 = v188 + a; else v184 = 3781;
+  if (a > 3782) v182 = v189 + a; else v185 = 3782;
+  if (a > 3783) v183 = v190 + a; else v186 = 3783;
+  if (a > 3784) v184 = v191 + a; else v187 = 3784;
+  if (a > 3785) v185 = v192 + a; else v188 = 3785;
+  if (a > 3786) v186 = v193 + a; else v189 = 3786;
+  if (a > 3787) v187 = v194 + a; else v190 = 3787;
+  if (a > 3788) v188 = v195 + a; else v191 = 3788;
+  if (a > 3789) v189 = v196 + a; else v192 = 3789;
+  if (a > 3790) v190 = v197 + a; else v193 = 3790;
+  if (a > 3791) v191 = v198 + a; else v194 = 3791;
+  if (a > 3792) v192 = v199 + a; else v195 = 3792;
+  if (a > 3793) v193 = v0 + a; else v196 = 3793;
+  if (a > 3794) v194 = v1 + a; else v197 = 3794;
+  if (a > 3795) v195 = v2 + a; else v198 = 3795;
+  if (a > 3796) v196 = v3 + a; else v199 = 3796;
+  if (a > 3797) v197 = v4 + a; else v0 = 3797;
+  if (a > 3798) v198 = v5 + a; else v1 = 3798;
+  if (a > 3799) v199 = v6 + a; else v2 = 3799;
+  if (a > 3800) v0 = v7 + a; else v3 = 3800;
+  if (a > 3801) v1 = v8 + a; else v4 = 3801;
+  if (a > 3802) v2 = v9 + a; else v5 = 3802;
+  if (a > 3803) v3 = v10 + a; else v6 = 3803;
+  if (a > 3804) v4 = v11 + a; else v7 = 3804;
+  if (a > 3805) v5 = v12 + a; else v8 = 3805;
+  if (a > 3806) v6 = v13 + a; else v9 = 3806;
+  if (a > 3807) v7 = v14 + a; else v10 = 3807;
+  if (a > 3808) v8 = v15 + a; else v11 = 3808;
+  if (a > 3809) v9 = v16 + a; else v12 = 3809;
+  if (a > 3810) v10 = v17 + a; else v13 = 3810;
+  if (a > 3811) v11 = v18 + a; else v14 = 3811;
+  if (a > 3812) v12 = v19 + a; else v15 = 3812;
+  if (a > 3813) v13 = v20 + a; else v16 = 3813;
+  if (a > 3814) v14 = v21 + a; else v17 = 3814;
+  if (a > 3815) v15 = v22 + a; else v18 = 3815;
+  if (a > 3816) v16 = v23 + a; else v19 = 3816;
+  if (a > 3817) v17 = v24 + a; else v20 = 3817;
+  if (a > 3818) v18 = v25 + a; else v21 = 3818;
+  if (a > 3819) v19 = v26 + a; else v22 = 3819;
+  if (a > 3820) v20 = v27 + a; else v23 = 3820;
+  if (a > 3821) v21 = v28 + a; else v24 = 3821;
+  if (a > 3822) v22 = v29 + a; else v25 = 3822;
+  if (a > 3823) v23 = v30 + a; else v26 = 3823;
+  if (a > 3824) v24 = v31 + a; else v27 = 3824;
+  if (a > 3825) v25 = v32 + a; else v28 = 3825;
+  if (a > 3826) v26 = v33 + a; else v29 = 3826;
+  if (a > 3827) v27 = v34 + a; else v30 = 3827;
+  if (a > 3828) v28 = v35 + a; else v31 = 3828;
+  if (a > 3829) v29 = v36 + a; else v32 = 3829;
+  if (a > 3830) v30 = v37 + a; else v33 = 3830;
+  if (a > 3831) v31 = v38 + a; else v34 = 3831;
+  if (a > 3832) v32 = v39 + a; else v35 = 3832;
+  if (a > 3833) v33 = v40 + a; else v36 = 3833;
+  if (a > 3834) v34 = v41 + a; else v37 = 3834;
+  if (a > 3835) v35 = v42 + a; else v38 = 3835;
+  if (a > 3836) v36 = v43 + a; else v39 = 3836;
+  if (a > 3837) v37 = v44 + a; else v40 = 3837;
+  if (a > 3838) v38 = v45 + a; else v41 = 3838;
+  if (a > 3839) v39 = v46 + a; else v42 = 3839;
+  if (a > 3840) v40 = v47 + a; else v43 = 3840;
+  if (a > 3841) v41 = v48 + a; else v44 = 3841;
+  if (a > 3842) v42 = v49 + a; else v45 = 3842;
+  if (a > 3843) v43 = v50 + a; else v46 = 3843;
+  if (a > 3844) v44 = v51 + a; else v47 = 3844;
+  if (a > 3845) v45 = v52 + a; else v48 = 3845;
+  if (a > 3846) v46 = v53 + a; else v49 = 3846;
+  if (a > 3847) v47 = v54 + a; else v50 = 3847;
+  if (a > 3848) v48 = v55 + a; else v51 = 3848;
+  if (a > 3849) v49 = v56 + a; else v52 = 3849;
+  if (a > 3850) v50 = v57 + a; else v53 = 3850;
+  if (a > 3851) v51 = v58 + a; else v54 = 3851;
+  if (a > 3852) v52 = v59 + a; else v55 = 3852;
+  if (a > 3853) v53 = v60 + a; else v56 = 3853;
+  if (a > 3854) v54 = v61 + a; else v57 = 3854;
+  if (a > 3855) v55 = v62 + a; else v58 = 3855;
+  if (a > 3856) v56 = v63 + a; else v59 = 3856;
+  if (a > 3857) v57 = v64 + a; else v60 = 3857;
+  if (a > 3858) v58 = v65 + a; else v61 = 3858;
+  if (a > 3859) v59 = v66 + a; else v62 = 3859;
+  if (a > 3860) v60 = v67 + a; else v63 = 3860;
+  if (a > 3861) v61 = v68 + a; else v64 = 3861;
+  if (a > 3862) v62 = v69 + a; else v65 = 3862;
+  if (a > 3863) v63 = v70 + a; else v66 = 3863;
+  if (a > 3864) v64 = v71 + a; else v67 = 3864;
+  if (a > 3865) v65 = v72 + a; else v68 = 3865;
+  if (a > 3866) v66 = v73 + a; else v69 = 3866;
+  if (a > 3867) v67 = v74 + a; else v70 = 3867;
+  if (a > 3868) v68 = v75 + a; else v71 = 3868;
+  if (a > 3869) v69 = v76 + a; else v72 = 3869;
+  if (a > 3870) v70 = v77 + a; else v73 = 3870;
+  if (a > 3871) v71 = v78 + a; else v74 = 3871;
+  if (a > 3872) v72 = v79 + a; else v75 = 3872;
+  if (a > 3873) v73 = v80 + a; else v76 = 3873;
+  if (a > 3874) v74 = v81 + a; else v77 = 3874;
+  if (a > 3875) v75 = v82 + a; else v78 = 3875;
+  if (a > 3876) v76 = v83 + a; else v79 = 3876;
+  if (a > 3877) v77 = v84 + a; else v80 = 3877;
+  if (a > 3878) v78 = v85 + a; else v81 = 3878;
+  if (a > 3879) v79 = v86 + a; else v82 = 3879;
+  if (a > 3880) v80 = v87 + a; else v83 = 3880;
+  if (a > 3881) v81 = v88 + a; else v84 = 3881;
+  if (a > 3882) v82 = v89 + a; else v85 = 3882;
+  if (a > 3883) v83 = v90 + a; else v86 = 3883;
+  if (a > 3884) v84 = v91 + a; else v87 = 3884;
+  if (a > 3885) v85 = v92 + a; else v88 = 3885;
+  if (a > 3886) v86 = v93 + a; else v89 = 3886;
+  if (a > 3887) v87 = v94 + a; else v90 = 3887;
+  if (a > 3888) v88 = v95 + a; else v91 = 3888;
+  if (a > 3889) v89 = v96 + a; else v92 = 3889;
+  if (a > 3890) v90 = v97 + a; else v93 = 3890;
+  if (a > 3891) v91 = v98 + a; else v94 = 3891;
+  if (a > 3892) v92 = v99 + a; else v95 = 3892;
+  if (a > 3893) v93 = v100 + a; else v96 = 3893;
+  if (a > 3894) v94 = v101 + a; else v97 = 3894;
+  if (a > 3895) v95 = v102 + a; else v98 = 3895;
+  if (a > 3896) v96 = v103 + a; else v99 = 3896;
+  if (a > 3897) v97 = v104 + a; else v100 = 3897;
+  if (a > 3898) v98 = v105 + a; else v101 = 3898;
+  if (a > 3899) v99 = v106 + a; else v102 = 3899;
+  if (a > 3900) v100 = v107 + a; else v103 = 3900;
+  if (a > 3901) v101 = v108 + a; else v104 = 3901;
+  if (a > 3902) v102 = v109 + a; else v105 = 3902;
+  if (a > 3903) v103 = v110 + a; else v106 = 3903;
+  if (a > 3904) v104 = v111 + a; else v107 = 3904;
+  if (a > 3905) v105 = v112 + a; else v108 = 3905;
+  if (a > 3906) v106 = v113 + a; else v109 = 3906;
+  if (a > 3907) v107 = v114 + a; else v110 = 3907;
+  if (a > 3908) v108 = v115 + a; else v111 = 3908;
+  if (a > 3909) v109 = v116 + a; else v112 = 3909;
+  if (a > 3910) v110 = v117 + a; else v113 = 3910;
+  if (a > 3911) v111 = v118 + a; else v114 = 3911;
+  if (a > 3912) v112 = v119 + a; else v115 = 3912;
+  if (a > 3913) v113 = v120 + a; else v116 = 3913;
+  if (a > 3914) v114 = v121 + a; else v117 = 3914;
+  if (a > 3915) v115 = v122 + a; else v118 = 3915;
+  if (a > 3916) v116 = v123 + a; else v119 = 3916;
+  if (a > 3917) v117 = v124 + a; else v120 = 3917;
+  if (a > 3918) v118 = v125 + a; else v121 = 3918;
+  if (a > 3919) v119 = v126 + a; else v122 = 3919;
+  if (a > 3920) v120 = v127 + a; else v123 = 3920;
+  if (a > 3921) v121 = v128 + a; else v124 = 3921;
+  if (a > 3922) v122 = v129 + a; else v125 = 3922;
+  if (a > 3923) v123 = v130 + a; else v126 = 3923;
+  if (a > 3924) v124 = v131 + a; else v127 = 3924;
+  if (a > 3925) v125 = v132 + a; else v128 = 3925;
+  if (a > 3926) v126 = v133 + a; else v129 = 3926;
+  if (a > 3927) v127 = v134 + a; else v130 = 3927;
+  if (a > 3928) v128 = v135 + a; else v131 = 3928;
+  if (a > 3929) v129 = v136 + a; else v132 = 3929;
+  if (a > 3930) v130 = v137 + a; else v133 = 3930;
+  if (a > 3931) v131 = v138 + a; else v134 = 3931;
+  if (a > 3932) v132 = v139 + a; else v135 = 3932;
+  if (a > 3933) v133 = v140 + a; else v136 = 3933;
+  if (a > 3934) v134 = v141 + a; else v137 = 3934;
+  if (a > 3935) v135 = v142 + a; else v138 = 3935;
+  if (a > 3936) v136 = v143 + a; else v139 = 3936;
+  if (a > 3937) v137 = v144 + a; else v140 = 3937;
+  if (a > 3938) v138 = v145 + a; else v141 = 3938;
+  if (a > 3939) v139 = v146 + a; else v142 = 3939;
+  if (a > 3940) v140 = v147 + a; else v143 = 3940;
+  if (a > 3941) v141 = v148 + a; else v144 = 3941;
+  if (a > 3942) v142 = v149 + a; else v145 = 3942;
+  if (a > 3943) v143 = v150 + a; else v146 = 3943;
+  if (a > 3944) v144 = v151 + a; else v147 = 3944;
+  if (a > 3945) v145 = v152 + a; else v148 = 3945;
+  if (a > 3946) v146 = v153 + a; else v149 = 3946;
+  if (a > 3947) v147 = v154 + a; else v150 = 3947;
+  if (a > 3948) v148 = v155 + a; else v151 = 3948;
+  if (a > 3949) v149 = v156 + a; else v152 = 3949;
+  if (a > 3950) v150 = v157 + a; else v153 = 3950;
+  if (a > 3951) v151 = v158 + a; else v154 = 3951;
+  if (a > 3952) v152 = v159 + a; else v155 = 3952;
+  if (a > 3953) v153 = v160 + a; else v156 = 3953;
+  if (a > 3954) v154 = v161 + a; else v157 = 3954;
+  if (a > 3955) v155 = v162 + a; else v158 = 3955;
+  if (a > 3956) v156 = v163 + a; else v159 = 3956;
+  if (a > 3957) v157 = v164 + a; else v160 = 3957;
+  if (a > 3958) v158 = v165 + a; else v161 = 3958;
+  if (a > 3959) v159 = v166 + a; else v162 = 3959;
+  if (a > 3960) v160 = v167 + a; else v163 = 3960;
+  if (a > 3961) v161 = v168 + a; else v164 = 3961;
+  if (a > 3962) v162 = v169 + a; else v165 = 3962;
+  if (a > 3963) v163 = v170 + a; else v166 = 3963;
+  if (a > 3964) v164 = v171 + a; else v167 = 3964;
+  if (a > 3965) v165 = v172 + a; else v168 = 3965;
+  if (a > 3966) v166 = v173 + a; else v169 = 3966;
+  if (a > 3967) v167 = v174 + a; else v170 = 3967;
+  if (a > 3968) v168 = v175 + a; else v171 = 3968;
+  if (a > 3969) v169 = v176 + a; else v172 = 3969;
+  if (a > 3970) v170 = v177 + a; else v173 = 3970;
+  if (a > 3971) v171 = v178 + a; else v174 = 3971;
+  if (a > 3972) v172 = v179 + a; else v175 = 3972;
+  if (a > 3973) v173 = v180 + a; else v176 = 3973;
+  if (a > 3974) v174 = v181 + a; else v177 = 3974;
+  if (a > 3975) v175 = v182 + a; else v178 = 3975;
+  if (a > 3976) v176 = v183 + a; else v179 = 3976;
+  if (a > 3977) v177 = v184 + a; else v180 = 3977;
+  if (a > 3978) v178 = v185 + a; else v181 = 3978;
+  if (a > 3979) v179 = v186 + a; else v182 = 3979;
+  if (a > 3980) v180 = v187 + a; else v183 = 3980;
+  if (a > 3981) v181 = v188 + a; else v184 = 3981;
+  if (a > 3982) v182 = v189 + a; else v185 = 3982;
+  if (a > 3983) v183 = v190 + a; else v186 = 3983;
+  if (a > 3984) v184 = v191 + a; else v187 = 3984;
+  if (a > 3985) v185 = v192 + a; else v188 = 3985;
+  if (a > 3986) v186 = v193 + a; else v189 = 3986;
+  if (a > 3987) v187 = v194 + a; else v190 = 3987;
+  if (a > 3988) v188 = v195 + a; else v191 = 3988;
+  if (a > 3989) v189 = v196 + a; else v192 = 3989;
+  if (a > 3990) v190 = v197 + a; else v193 = 3990;
+  if (a > 3991) v191 = v198 + a; else v194 = 3991;
+  if (a > 3992) v192 = v199 + a; else v195 = 3992;
+  if (a > 3993) v193 = v0 + a; else v196 = 3993;
+  if (a > 3994) v194 = v1 + a; else v197 = 3994;
+  if (a > 3995) v195 = v2 + a; else v198 = 3995;
+  if (a > 3996) v196 = v3 + a; else v199 = 3996;
+  if (a > 3997) v197 = v4 + a; else v0 = 3997;
+  if (a > 3998) v198 = v5 + a; else v1 = 3998;
+  if (a > 3999) v199 = v6 + a; else v2 = 3999;
+  if (a > 4000) v0 = v7 + a; else v3 = 4000;
+  if (a > 4001) v1 = v8 + a; else v4 = 4001;
+  if (a > 4002) v2 = v9 + a; else v5 = 4002;
+  if (a > 4003) v3 = v10 + a; else v6 = 4003;
+  if (a > 4004) v4 = v11 + a; else v7 = 4004;
+  if (a > 4005) v5 = v12 + a; else v8 = 4005;
+  if (a > 4006) v6 = v13 + a; else v9 = 4006;
+  if (a > 4007) v7 = v14 + a; else v10 = 4007;
+  if (a > 4008) v8 = v15 + a; else v11 = 4008;
+  if (a > 4009) v9 = v16 + a; else v12 = 4009;
+  if (a > 4010) v10 = v17 + a; else v13 = 4010;
+  if (a > 4011) v11 = v18 + a; else v14 = 4011;
+  if (a > 4012) v12 = v19 + a; else v15 = 4012;
+  if (a > 4013) v13 = v20 + a; else v16 = 4013;
+  if (a > 4014) v14 = v21 + a; else v17 = 4014;
+  if (a > 4015) v15 = v22 + a; else v18 = 4015;
+  if (a > 4016) v16 = v23 + a; else v19 = 4016;
+  if (a > 4017) v17 = v24 + a; else v20 = 4017;
+  if (a > 4018) v18 = v25 + a; else v21 = 4018;
+  if (a > 4019) v19 = v26 + a; else v22 = 4019;
+  if (a > 4020) v20 = v27 + a; else v23 = 4020;
+  if (a > 4021) v21 = v28 + a; else v24 = 4021;
+  if (a > 4022) v22 = v29 + a; else v25 = 4022;
+  if (a > 4023) v23 = v30 + a; else v26 = 4023;
+  if (a > 4024) v24 = v31 + a; else v27 = 4024;
+  if (a > 4025) v25 = v32 + a; else v28 = 4025;
+  if (a > 4026) v26 = v33 + a; else v29 = 4026;
+  if (a > 4027) v27 = v34 + a; else v30 = 4027;
+  if (a > 4028) v28 = v35 + a; else v31 = 4028;
+  if (a > 4029) v29 = v36 + a; else v32 = 4029;
+  if (a > 4030) v30 = v37 + a; else v33 = 4030;
+  if (a > 4031) v31 = v38 + a; else v34 = 4031;
+  if (a > 4032) v32 = v39 + a; else v35 = 4032;
+  if (a > 4033) v33 = v40 + a; else v36 = 4033;
+  if (a > 4034) v34 = v41 + a; else v37 = 4034;
+  if (a > 4035) v35 = v42 + a; else v38 = 4035;
+  if (a > 4036) v36 = v43 + a; else v39 = 4036;
+  if (a > 4037) v37 = v44 + a; else v40 = 4037;
+  if (a > 4038) v38 = v45 + a; else v41 = 4038;
+  if (a > 4039) v39 = v46 + a; else v42 = 4039;
+  if (a > 4040) v40 = v47 + a; else v43 = 4040;
+  if (a > 4041) v41 = v48 + a; else v44 = 4041;
+  if (a > 4042) v42 = v49 + a; else v45 = 4042;
+  if (a > 4043) v43 = v50 + a; else v46 = 4043;
+  if (a > 4044) v44 = v51 + a; else v47 = 4044;
+  if (a > 4045) v45 = v52 + a; else v48 = 4045;
+  if (a > 4046) v46 = v53 + a; else v49 = 4046;
+  if (a > 4047) v47 = v54 + a; else v50 = 4047;
+  if (a > 4048) v48 = v55 + a; else v51 = 4048;
+  if (a > 4049) v49 = v56 + a; else v52 = 4049;
+  if (a > 4050) v50 = v57 + a; else v53 = 4050;
+  if (a > 4051) v51 = v58 + a; else v54 = 4051;
+  if (a > 4052) v52 = v59 + a; else v55 = 4052;
+  if (a > 4053) v53 = v60 + a; else v56 = 4053;
+  if (a > 4054) v54 = v61 + a; else v57 = 4054;
+  if (a > 4055) v55 = v62 + a; else v58 = 4055;
+  if (a > 4056) v56 = v63 + a; else v59 = 4056;
+  if (a > 4057) v57 = v64 + a; else v60 = 4057;
+  if (a > 4058) v58 = v65 + a; else v61 = 4058;
+  if (a > 4059) v59 = v66 + a; else v62 = 4059;
+  if (a > 4060) v60 = v67 + a; else v63 = 4060;
+  if (a > 4061) v61 = v68 + a; else v64 = 4061;
+  if (a > 4062) v62 = v69 + a; else v65 = 4062;
+  if (a > 4063) v63 = v70 + a; else v66 = 4063;
+  if (a > 4064) v64 = v71 + a; else v67 = 4064;
+  if (a > 4065) v65 = v72 + a; else v68 = 4065;
+  if (a > 4066) v66 = v73 + a; else v69 = 4066;
+  if (a > 4067) v67 = v74 + a; else v70 = 4067;
+  if (a > 4068) v68 = v75 + a; else v71 = 4068;
+  if (a > 4069) v69 = v76 + a; else v72 = 4069;
+  if (a > 4070) v70 = v77 + a; else v73 = 4070;
+  if (a > 4071) v71 = v78 + a; else v74 = 4071;
+  if (a > 4072) v72 = v79 + a; else v75 = 4072;
+  if (a > 4073) v73 = v80 + a; else v76 = 4073;
+  if (a > 4074) v74 = v81 + a; else v77 = 4074;
+  if (a > 4075) v75 = v82 + a; else v78 = 4075;
+  if (a > 4076) v76 = v83 + a; else v79 = 4076;
+  if (a > 4077) v77 = v84 + a; else v80 = 4077;
+  if (a > 4078) v78 = v85 + a; else v81 = 4078;
+  if (a > 4079) v79 = v86 + a; else v82 = 4079;
+  if (a > 4080) v80 = v87 + a; else v83 = 4080;
+  if (a > 4081) v81 = v88 + a; else v84 = 4081;
+  if (a > 4082) v82 = v89 + a; else v85 = 4082;
+  if (a > 4083) v83 = v90 + a; else v86 = 4083;
+  if (a > 4084) v84 = v91 + a; else v87 = 4084;
+  if (a > 4085) v85 = v92 + a; else v88 = 4085;
+  if (a > 4086) v86 = v93 + a; else v89 = 4086;
+  if (a > 4087) v87 = v94 + a; else v90 = 4087;
+  if (a > 4088) v88 = v95 + a; else v91 = 4088;
+  if (a > 4089) v89 = v96 + a; else v92 = 4089;
+  if (a > 4090) v90 = v97 + a; else v93 = 4090;
+  if (a > 4091) v91 = v98 + a; else v94 = 4091;
+  if (a > 4092) v92 = v99 + a; else v95 = 4092;
+  if (a > 4093) v93 = v100 + a; else v96 = 4093;
+  if (a > 4094) v94 = v101 + a; else v97 = 4094;
+  if (a > 4095) v95 = v102 + a; else v98 = 4095;
+  if (a > 4096) v96 = v103 + a; else v99 = 4096;
+  if (a > 4097) v97 = v104 + a; else v100 = 4097;
+  if (a > 4098) v98 = v105 + a; else v101 = 4098;
+  if (a > 4099) v99 = v106 + a; else v102 = 4099;
+  if (a > 4100) v100 = v107 + a; else v103 = 4100;
+  if (a > 4101) v101 = v108 + a; else v104 = 4101;
+  if (a > 4102) v102 = v109 + a; else v105 = 4102;
+  if (a > 4103) v103 = v110 + a; else v106 = 4103;
+  if (a > 4104) v104 = v111 + a; else v107 = 4104;
+  if (a > 4105) v105 = v112 + a; else v108 = 4105;
+  if (a > 4106) v106 = v113 + a; else v109 = 4106;
+  if (a > 4107) v107 = v114 + a; else v110 = 4107;
+  if (a > 4108) v108 = v115 + a; else v111 = 4108;
+  if (a > 4109) v109 = v116 + a; else v112 = 4109;
+  if (a > 4110) v110 = v117 + a; else v113 = 4110;
+  if (a > 4111) v111 = v118 + a; else v114 = 4111;
+  if (a > 4112) v112 = v119 + a; else v115 = 4112;
+  if (a > 4113) v113 = v120 + a; else v116 = 4113;
+  if (a > 4114) v114 = v121 + a; else v117 = 4114;
+  if (a > 4115) v115 = v122 + a; else v118 = 4115;
+  if (a > 4116) v116 = v123 + a; else v119 = 4116;
+  if (a > 4117) v117 = v124 + a; else v120 = 4117;
+  if (a > 4118) v118 = v125 + a; else v121 = 4118;
+  if (a > 4119) v119 = v126 + a; else v122 = 4119;
+  if (a > 4120) v120 = v127 + a; else v123 = 4120;
+  if (a > 4121) v121 = v128 + a; else v124 = 4121;
+  if (a > 4122) v122 = v129 + a; else v125 = 4122;
+  if (a > 4123) v123 = v130 + a; else v126 = 4123;
+  if (a > 4124) v124 = v131 + a; else v127 = 4124;
+  if (a > 4125) v125 = v132 + a; else v128 = 4125;
+  if (a > 4126) v126 = v133 + a; else v129 = 4126;
+  if (a > 4127) v127 = v134 + a; else v130 = 4127;
+  if (a > 4128) v128 = v135 + a; else v131 = 4128;
+  if (a > 4129) v129 = v136 + a; else v132 = 4129;
+  if (a > 4130) v130 = v137 + a; else v133 = 4130;
+  if (a > 4131) v131 = v138 + a; else v134 = 4131;
+  if (a > 4132) v132 = v139 + a; else v135 = 4132;
+  if (a > 4133) v133 = v140 + a; else v136 = 4133;
+  if (a > 4134) v134 = v141 + a; else v137 = 4134;
+  if (a > 4135) v135 = v142 + a; else v138 = 4135;
+  if (a > 4136) v136 = v143 + a; else v139 = 4136;
+  if (a > 4137) v137 = v144 + a; else v140 = 4137;
+  if (a > 4138) v138 = v145 + a; else v141 = 4138;
+  if (a > 4139) v139 = v146 + a; else v142 = 4139;
+  if (a > 4140) v140 = v147 + a; else v143 = 4140;
+  if (a > 4141) v141 = v148 + a; else v144 = 4141;
+  if (a > 4142) v142 = v149 + a; else v145 = 4142;
+  if (a > 4143) v143 = v150 + a; else v146 = 4143;
+  if (a > 4144) v144 = v151 + a; else v147 = 4144;
+  if (a > 4145) v145 = v152 + a; else v148 = 4145;
+  if (a > 4146) v146 = v153 + a; else v149 = 4146;
+  if (a > 4147) v147 = v154 + a; else v150 = 4147;
+  if (a > 4148) v148 = v155 + a; else v151 = 4148;
+  if (a > 4149) v149 = v156 + a; else v152 = 4149;
+  if (a > 4150) v150 = v157 + a; else v153 = 4150;
+  if (a > 4151) v151 = v158 + a; else v154 = 4151;
+  if (a > 4152) v152 = v159 + a; else v155 = 4152;
+  if (a > 4153) v153 = v160 + a; else v156 = 4153;
+  if (a > 4154) v154 = v161 + a; else v157 = 4154;
+  if (a > 4155) v155 = v162 + a; else v158 = 4155;
+  if (a > 4156) v156 = v163 + a; else v159 = 4156;
+  if (a > 4157) v157 = v164 + a; else v160 = 4157;
+  if (a > 4158) v158 = v165 + a; else v161 = 4158;
+  if (a > 4159) v159 = v166 + a; else v162 = 4159;
+  if (a > 4160) v160 = v167 + a; else v163 = 4160;
+  if (a > 4161) v161 = v168 + a; else v164 = 4161;
+  if (a > 4162) v162 = v169 + a; else v165 = 4162;
+  if (a > 4163) v163 = v170 + a; else v166 = 4163;
+  if (a > 4164) v164 = v171 + a; else v167 = 4164;
+  if (a > 4165) v165 = v172 + a; else v168 = 4165;
+  if (a > 4166) v166 = v173 + a; else v169 = 4166;
+  if (a > 4167) v167 = v174 + a; else v170 = 4167;
+  if (a > 4168) v168 = v175 + a; else v171 = 4168;
+  if (a > 4169) v169 = v176 + a; else v172 = 4169;
+  if (a > 4170) v170 = v177 + a; else v173 = 4170;
+  if (a > 4171) v171 = v178 + a; else v174 = 4171;
+  if (a > 4172) v172 = v179 + a; else v175 = 4172;
+  if (a > 4173) v173 = v180 + a; else v176 = 4173;
+  if (a > 4174) v174 = v181 + a; else v177 = 4174;
+  if (a > 4175) v175 = v182 + a; else v178 = 4175;
+  if (a > 4176) v176 = v183 + a; else v179 = 4176;
+  if (a > 4177) v177 = v184 + a; else v180 = 4177;
+  if (a > 4178) v178 = v185 + a; else v181 = 4178;
+  if (a > 4179) v179 = v186 + a; else v182 = 4179;
+  if (a > 4180) v180 = v187 + a; else v183 = 4180;
+  if (a > 4181) v181 = v188 + a; else v184 = 4181;
+  if (a > 4182) v182 = v189 + a; else v185 = 4182;
+  if (a > 4183) v183 = v190 + a; else v186 = 4183;
+  if (a > 4184) v184 = v191 + a; else v187 = 4184;
+  if (a > 4185) v185 = v192 + a; else v188 = 4185;
+  if (a > 4186) v186 = v193 + a; else v189 = 4186;
+  if (a > 4187) v187 = v194 + a; else v190 = 4187;
+  if (a > 4188) v188 = v195 + a; else v191 = 4188;
+  if (a > 4189) v189 = v196 + a; else v192 = 4189;
+  if (a > 4190) v190 = v197 + a; else v193 = 4190;
+  if (a > 4191) v191 = v198 + a; else v194 = 4191;
+  if (a > 4192) v192 = v199 + a; else v195 = 4192;
+  if (a > 4193) v193 = v0 + a; else v196 = 4193;
+  if (a > 4194) v194 = v1 + a; else v197 = 4194;
+  if (a > 4195) v195 = v2 + a; else v198 = 4195;
+  if (a > 4196) v196 = v3 + a; else v199 = 4196;
+  if (a > 4197) v197 = v4 + a; else v0 = 4197;
+  if (a > 4198) v198 = v5 + a; else v1 = 4198;
+  if (a > 4199) v199 = v6 + a; else v2 = 4199;
+  if (a > 4200) v0 = v7 + a; else v3 = 4200;
+  if (a > 4201) v1 = v8 + a; else v4 = 4201;
+  if (a > 4202) v2 = v9 + a; else v5 = 4202;
+  if (a > 4203) v3 = v10 + a; else v6 = 4203;
+  if (a > 4204) v4 = v11 + a; else v7 = 4204;
+  if (a > 4205) v5 = v12 + a; else v8 = 4205;
+  if (a > 4206) v6 = v13 + a; else v9 = 4206;
+  if (a > 4207) v7 = v14 + a; else v10 = 4207;
+  if (a > 4208) v8 = v15 + a; else v11 = 4208;
+  if (a > 4209) v9 = v16 + a; else v12 = 4209;
+  if (a > 4210) v10 = v17 + a; else v13 = 4210;
+  if (a > 4211) v11 = v18 + a; else v14 = 4211;
+  if (a > 4212) v12 = v19 + a; else v15 = 4212;
+  if (a > 4213) v13 = v20 + a; else v16 = 4213;
+  if (a > 4214) v14 = v21 + a; else v17 = 4214;
+  if (a > 4215) v15 = v22 + a; else v18 = 4215;
+  if (a > 4216) v16 = v23 + a; else v19 = 4216;
+  if (a > 4217) v17 = v24 + a; else v20 = 4217;
+  if (a > 4218) v18 = v25 + a; else v21 = 4218;
+  if (a > 4219) v19 = v26 + a; else v22 = 4219;
+  if (a > 4220) v20 = v27 + a; else v23 = 4220;
+  if (a > 4221) v21 = v28 + a; else v24 = 4221;
+  if (a > 4222) v22 = v29 + a; else v25 = 4222;
+  if (a > 4223) v23 = v30 + a; else v26 = 4223;
+  if (a > 4224) v24 = v31 + a; else v27 = 4224;
+  if (a > 4225) v25 = v32 + a; else v28 = 4225;
+  if (a > 4226) v26 = v33 + a; else v29 = 4226;
+  if (a > 4227) v27 = v34 + a; else v30 = 4227;
+  if (a > 4228) v28 = v35 + a; else v31 = 4228;
+  if (a > 4229) v29 = v36 + a; else v32 = 4229;
+  if (a > 4230) v30 = v37 + a; else v33 = 4230;
+  if (a > 4231) v31 = v38 + a; else v34 = 4231;
+  if (a > 4232) v32 = v39 + a; else v35 = 4232;
+  if (a > 4233) v33 = v40 + a; else v36 = 4233;
+  if (a > 4234) v34 = v41 + a; else v37 = 4234;
+  if (a > 4235) v35 = v42 + a; else v38 = 4235;
+  if (a > 4236) v36 = v43 + a; else v39 = 4236;
+  if (a > 4237) v37 = v44 + a; else v40 = 4237;
+  if (a > 4238) v38 = v45 + a; else v41 = 4238;
+  if (a > 4239) v39 = v46 + a; else v42 = 4239;
+  if (a > 4240) v40 = v47 + a; else v43 = 4240;
+  if (a > 4241) v41 = v48 + a; else v44 = 4241;
+  if (a > 4242) v42 = v49 + a; else v45 = 4242;
+  if (a > 4243) v43 = v50 + a; else v46 = 4243;
+  if (a > 4244) v44 = v51 + a; else v47 = 4244;
+  if (a > 4245) v45 = v52 + a; else v48 = 4245;
+  if (a > 4246) v46 = v53 + a; else v49 = 4246;
+  if (a > 4247) v47 = v54 + a; else v50 = 4247;
+  if (a > 4248) v48 = v55 + a; else v51 = 4248;
+  if (a > 4249) v49 = v56 + a; else v52 = 4249;
+  if (a > 4250) v50 = v57 + a; else v53 = 4250;
+  if (a > 4251) v51 = v58 + a; else v54 = 4251;
+  if (a > 4252) v52 = v59 + a; else v55 = 4252;
+  if (a > 4253) v53 = v60 + a; else v56 = 4253;
+  if (a > 4254) v54 = v61 + a; else v57 = 4254;
+  if (a > 4255) v55 = v62 + a; else v58 = 4255;
+  if (a > 4256) v56 = v63 + a; else v59 = 4256;
+  if (a > 4257) v57 = v64 + a; else v60 = 4257;
+  if (a > 4258) v58 = v65 + a; else v61 = 4258;
+  if (a > 4259) v59 = v66 + a; else v62 = 4259;
+  if (a > 4260) v60 = v67 + a; else v63 = 4260;
+  if (a > 4261) v61 = v68 + a; else v64 = 4261;
+  if (a > 4262) v62 = v69 + a; else v65 = 4262;
+  if (a > 4263) v63 = v70 + a; else v66 = 4263;
+  if (a > 4264) v64 = v71 + a; else v67 = 4264;
+  if (a > 4265) v65 = v72 + a; else v68 = 4265;
+  if (a > 4266) v66 = v73 + a; else v69 = 4266;
+  if (a > 4267) v67 = v74 + a; else v70 = 4267;
+  if (a > 4268) v68 = v75 + a; else v71 = 4268;
+  if (a > 4269) v69 = v76 + a; else v72 = 4269;
+  if (a > 4270) v70 = v77 + a; else v73 = 4270;
+  if (a > 4271) v71 = v78 + a; else v74 = 4271;
+  if (a > 4272) v72 = v79 + a; else v75 = 4272;
+  if (a > 4273) v73 = v80 + a; else v76 = 4273;
+  if (a > 4274) v74 = v81 + a; else v77 = 4274;
+  if (a > 4275) v75 = v82 + a; else v78 = 4275;
+  if (a > 4276) v76 = v83 + a; else v79 = 4276;
+  if (a > 4277) v77 = v84 + a; else v80 = 4277;
+  if (a > 4278) v78 = v85 + a; else v81 = 4278;
+  if (a > 4279) v79 = v86 + a; else v82 = 4279;
+  if (a > 4280) v80 = v87 + a; else v83 = 4280;
+  if (a > 4281) v81 = v88 + a; else v84 = 4281;
+  if (a > 4282) v82 = v89 + a; else v85 = 4282;
+  if (a > 4283) v83 = v90 + a; else v86 = 4283;
+  if (a > 4284) v84 = v91 + a; else v87 = 4284;
+  if (a > 4285) v85 = v92 + a; else v88 = 4285;
+  if (a > 4286) v86 = v93 + a; else v89 = 4286;
+  if (a > 4287) v87 = v94 + a; else v90 = 4287;
+  if (a > 4288) v88 = v95 + a; else v91 = 4288;
+  if (a > 4289) v89 = v96 + a; else v92 = 4289;
+  if (a > 4290) v90 = v97 + a; else v93 = 4290;
+  if (a > 4291) v91 = v98 + a; else v94 = 4291;
+  if (a > 4292) v92 = v99 + a; else v95 = 4292;
+  if (a > 4293) v93 = v100 + a; else v96 = 4293;
+  if (a > 4294) v94 = v101 + a; else v97 = 4294;
+  if (a > 4295) v95 = v102 + a; else v98 = 4295;
+  if (a > 4296) v96 = v103 + a; else v99 = 4296;
+  if (a > 4297) v97 = v104 + a; else v100 = 4297;
+  if (a > 4298) v98 = v105 + a; else v101 = 4298;
+  if (a > 4299) v99 = v106 + a; else v102 = 4299;
+  if (a > 4300) v100 = v107 + a; else v103 = 4300;
+  if (a > 4301) v101 = v108 + a; else v104 = 4301;
+  if (a > 4302) v102 = v109 + a; else v105 = 4302;
+  if (a > 4303) v103 = v110 + a; else v106 = 4303;
+  if (a > 4304) v104 = v111 + a; else v107 = 4304;
+  if (a > 4305) v105 = v112 + a; else v108 = 4305;
+  if (a > 4306) v106 = v113 + a; else v109 = 4306;
+  if (a > 4307) v107 = v114 + a; else v110 = 4307;
+  if (a > 4308) v108 = v115 + a; else v111 = 4308;
+  if (a > 4309) v109 = v116 + a; else v112 = 4309;
+  if (a > 4310) v110 = v117 + a; else v113 = 4310;
+  if (a > 4311) v111 = v118 + a; else v114 = 4311;
+  if (a > 4312) v112 = v119 + a; else v115 = 4312;
+  if (a > 4313) v113 = v120 + a; else v116 = 4313;
+  if (a > 4314) v114 = v121 + a; else v117 = 4314;
+  if (a > 4315) v115 = v122 + a; else v118 = 4315;
+  if (a > 4316) v116 = v123 + a; else v119 = 4316;
+  if (a > 4317) v117 = v124 + a; else v120 = 4317;
+  if (a > 4318) v118 = v125 + a; else v121 = 4318;
+  if (a > 4319) v119 = v126 + a; else v122 = 4319;
+  if (a > 4320) v120 = v127 + a; else v123 = 4320;
+  if (a > 4321) v121 = v128 + a; else v124 = 4321;
+  if (a > 4322) v122 = v129 + a; else v125 = 4322;
+  if (a > 4323) v123 = v130 + a; else v126 = 4323;
+  if (a > 4324) v124 = v131 + a; else v127 = 4324;
+  if (a > 4325) v125 = v132 + a; else v128 = 4325;
+  if (a > 4326) v126 = v133 + a; else v129 = 4326;
+  if (a > 4327) v127 = v134 + a; else v130 = 4327;
+  if (a > 4328) v128 = v135 + a; else v131 = 4328;
+  if (a > 4329) v129 = v136 + a; else v132 = 4329;
+  if (a > 4330) v130 = v137 + a; else v133 = 4330;
+  if (a > 4331) v131 = v138 + a; else v134 = 4331;
+  if (a > 4332) v132 = v139 + a; else v135 = 4332;
+  if (a > 4333) v133 = v140 + a; else v136 = 4333;
+  if (a > 4334) v134 = v141 + a; else v137 = 4334;
+  if (a > 4335) v135 = v142 + a; else v138 = 4335;
+  if (a > 4336) v136 = v143 + a; else v139 = 4336;
+  if (a > 4337) v137 = v144 + a; else v140 = 4337;
+  if (a > 4338) v138 = v145 + a; else v141 = 4338;
+  if (a > 4339) v139 = v146 + a; else v142 = 4339;
+  if (a > 4340) v140 = v147 + a; else v143 = 4340;
+  if (a > 4341) v141 = v148 + a; else v144 = 4341;
+  if (a > 4342) v142 = v149 + a; else v145 = 4342;
+  if (a > 4343) v143 = v150 + a; else v146 = 4343;
+  if (a > 4344) v144 = v151 + a; else v147 = 4344;
+  if (a > 4345) v145 = v152 + a; else v148 = 4345;
+  if (a > 4346) v146 = v153 + a; else v149 = 4346;
+  if (a > 4347) v147 = v154 + a; else v150 = 4347;
+  if (a > 4348) v148 = v155 + a; else v151 = 4348;
+  if (a > 4349) v149 = v156 + a; else v152 = 4349;
+  if (a > 4350) v150 = v157 + a; else v153 = 4350;
+  if (a > 4351) v151 = v158 + a; else v154 = 4351;
+  if (a > 4352) v152 = v159 + a; else v155 = 4352;
+  if (a > 4353) v153 = v160 + a; else v156 = 4353;
+  if (a > 4354) v154 = v161 + a; else v157 = 4354;
+  if (a > 4355) v155 = v162 + a; else v158 = 4355;
+  if (a > 4356) v156 = v163 + a; else v159 = 4356;
+  if (a > 4357) v157 = v164 + a; else v160 = 4357;
+  if (a > 4358) v158 = v165 + a; else v161 = 4358;
+  if (a > 4359) v159 = v166 + a; else v162 = 4359;
+  if (a > 4360) v160 = v167 + a; else v163 = 4360;
+  if (a > 4361) v161 = v168 + a; else v164 = 4361;
+  if (a > 4362) v162 = v169 + a; else v165 = 4362;
+  if (a > 4363) v163 = v170 + a; else v166 = 4363;
+  if (a > 4364) v164 = v171 + a; else v167 = 4364;
+  if (a > 4365) v165 = v172 + a; else v168 = 4365;
+  if (a > 4366) v166 = v173 + a; else v169 = 4366;
+  if (a > 4367) v167 = v174 + a; else v170 = 4367;
+  if (a > 4368) v168 = v175 + a; else v171 = 4368;
+  if (a > 4369) v169 = v176 + a; else v172 = 4369;
+  if (a > 4370) v170 = v177 + a; else v173 = 4370;
+  if (a > 4371) v171 = v178 + a; else v174 = 4371;
+  if (a > 4372) v172 = v179 + a; else v175 = 4372;
+  if (a > 4373) v173 = v180 + a; else v176 = 4373;
+  if (a > 4374) v174 = v181 + a; else v177 = 4374;
+  if (a > 4375) v175 = v182 + a; else v178 = 4375;
+  if (a > 4376) v176 = v183 + a; else v179 = 4376;
+  if (a > 4377) v177 = v184 + a; else v180 = 4377;
+  if (a > 4378) v178 = v185 + a; else v181 = 4378;
+  if (a > 4379) v179 = v186 + a; else v182 = 4379;
+  if (a > 4380) v180 = v187 + a; else v183 = 4380;
+  if (a > 4381) v181 = v188 + a; else v184 = 4381;
+  if (a > 4382) v182 = v189 + a; else v185 = 4382;
+  if (a > 4383) v183 = v190 + a; else v186 = 4383;
+  if (a > 4384) v184 = v191 + a; else v187 = 4384;
+  if (a > 4385) v185 = v192 + a; else v188 = 4385;
+  if (a > 4386) v186 = v193 + a; else v189 = 4386;
+  if (a > 4387) v187 = v194 + a; else v190 = 4387;
+  if (a > 4388) v188 = v195 + a; else v191 = 4388;
+  if (a > 4389) v189 = v196 + a; else v192 = 4389;
+  if (a > 4390) v190 = v197 + a; else v193 = 4390;
+  if (a > 4391) v191 = v198 + a; else v194 = 4391;
+  if (a > 4392) v192 = v199 + a; else v195 = 4392;
+  if (a > 4393) v193 = v0 + a; else v196 = 4393;
+  if (a > 4394) v194 = v1 + a; else v197 = 4394;
+  if (a > 4395) v195 = v2 + a; else v198 = 4395;
+  if (a > 4396) v196 = v3 + a; else v199 = 4396;
+  if (a > 4397) v197 = v4 + a; else v0 = 4397;
+  if (a > 4398) v198 = v5 + a; else v1 = 4398;
+  if (a > 4399) v199 = v6 + a; else v2 = 4399;
+  if (a > 4400) v0 = v7 + a; else v3 = 4400;
+  if (a > 4401) v1 = v8 + a; else v4 = 4401;
+  if (a > 4402) v2 = v9 + a; else v5 = 4402;
+  if (a > 4403) v3 = v10 + a; else v6 = 4403;
+  if (a > 4404) v4 = v11 + a; else v7 = 4404;
+  if (a > 4405) v5 = v12 + a; else v8 = 4405;
+  if (a > 4406) v6 = v13 + a; else v9 = 4406;
+  if (a > 4407) v7 = v14 + a; else v10 = 4407;
+  if (a > 4408) v8 = v15 + a; else v11 = 4408;
+  if (a > 4409) v9 = v16 + a; else v12 = 4409;
+  if (a > 4410) v10 = v17 + a; else v13 = 4410;
+  if (a > 4411) v11 = v18 + a; else v14 = 4411;
+  if (a > 4412) v12 = v19 + a; else v15 = 4412;
+  if (a > 4413) v13 = v20 + a; else v16 = 4413;
+  if (a > 4414) v14 = v21 + a; else v17 = 4414;
+  if (a > 4415) v15 = v22 + a; else v18 = 4415;
+  if (a > 4416) v16 = v23 + a; else v19 = 4416;
+  if (a > 4417) v17 = v24 + a; else v20 = 4417;
+  if (a > 4418) v18 = v25 + a; else v21 = 4418;
+  if (a > 4419) v19 = v26 + a; else v22 = 4419;
+  if (a > 4420) v20 = v27 + a; else v23 = 4420;
+  if (a > 4421) v21 = v28 + a; else v24 = 4421;
+  if (a > 4422) v22 = v29 + a; else v25 = 4422;
+  if (a > 4423) v23 = v30 + a; else v26 = 4423;
+  if (a > 4424) v24 = v31 + a; else v27 = 4424;
+  if (a > 4425) v25 = v32 + a; else v28 = 4425;
+  if (a > 4426) v26 = v33 + a; else v29 = 4426;
+  if (a > 4427) v27 = v34 + a; else v30 = 4427;
+  if (a > 4428) v28 = v35 + a; else v31 = 4428;
+  if (a > 4429) v29 = v36 + a; else v32 = 4429;
+  if (a > 4430) v30 = v37 + a; else v33 = 4430;
+  if (a > 4431) v31 = v38 + a; else v34 = 4431;
+  if (a > 4432) v32 = v39 + a; else v35 = 4432;
+  if (a > 4433) v33 = v40 + a; else v36 = 4433;
+  if (a > 4434) v34 = v41 + a; else v37 = 4434;
+  if (a > 4435) v35 = v42 + a; else v38 = 4435;
+  if (a > 4436) v36 = v43 + a; else v39 = 4436;
+  if (a > 4437) v37 = v44 + a; else v40 = 4437;
+  if (a > 4438) v38 = v45 + a; else v41 = 4438;
+  if (a > 4439) v39 = v46 + a; else v42 = 4439;
+  if (a > 4440) v40 = v47 + a; else v43 = 4440;
+  if (a > 4441) v41 = v48 + a; else v44 = 4441;
+  if (a > 4442) v42 = v49 + a; else v45 = 4442;
+  if (a > 4443) v43 = v50 + a; else v46 = 4443;
+  if (a > 4444) v44 = v51 + a; else v47 = 4444;
+  if (a > 4445) v45 = v52 + a; else v48 = 4445;
+  if (a > 4446) v46 = v53 + a; else v49 = 4446;
+  if (a > 4447) v47 = v54 + a; else v50 = 4447;
+  if (a > 4448) v48 = v55 + a; else v51 = 4448;
+  if (a > 4449) v49 = v56 + a; else v52 = 4449;
+  if (a > 4450) v50 = v57 + a; else v53 = 4450;
+  if (a > 4451) v51 = v58 + a; else v54 = 4451;
+  if (a > 4452) v52 = v59 + a; else v55 = 4452;
+  if (a > 4453) v53 = v60 + a; else v56 = 4453;
+  if (a > 4454) v54 = v61 + a; else v57 = 4454;
+  if (a > 4455) v55 = v62 + a; else v58 = 4455;
+  if (a > 4456) v56 = v63 + a; else v59 = 4456;
+  if (a > 4457) v57 = v64 + a; else v60 = 4457;
+  if (a > 4458) v58 = v65 + a; else v61 = 4458;
+  if (a > 4459) v59 = v66 + a; else v62 = 4459;
+  if (a > 4460) v60 = v67 + a; else v63 = 4460;
+  if (a > 4461) v61 = v68 + a; else v64 = 4461;
+  if (a > 4462) v62 = v69 + a; else v65 = 4462;
+  if (a > 4463) v63 = v70 + a; else v66 = 4463;
+  if (a > 4464) v64 = v71 + a; else v67 = 4464;
+  if (a > 4465) v65 = v72 + a; else v68 = 4465;
+  if (a > 4466) v66 = v73 + a; else v69 = 4466;
+  if (a > 4467) v67 = v74 + a; else v70 = 4467;
+  if (a > 4468) v68 = v75 + a; else v71 = 4468;
+  if (a > 4469) v69 = v76 + a; else v72 = 4469;
+  if (a > 4470) v70 = v77 + a; else v73 = 4470;
+  if (a > 4471) v71 = v78 + a; else v74 = 4471;
+  if (a > 4472) v72 = v79 + a; else v75 = 4472;
+  if (a > 4473) v73 = v80 + a; else v76 = 4473;
+  if (a > 4474) v74 = v81 + a; else v77 = 4474;
+  if (a > 4475) v75 = v82 + a; else v78 = 4475;
+  if (a > 4476) v76 = v83 + a; else v79 = 4476;
+  if (a > 4477) v77 = v84 + a; else v80 = 4477;
+  if (a > 4478) v78 = v85 + a; else v81 = 4478;
+  if (a > 4479) v79 = v86 + a; else v82 = 4479;
+  if (a > 4480) v80 = v87 + a; else v83 = 4480;
+  if (a > 4481) v81 = v88 + a; else v84 = 4481;
+  if (a > 4482) v82 = v89 + a; else v85 = 4482;
+  if (a > 4483) v83 = v90 + a; else v86 = 4483;
+  if (a > 4484) v84 = v91 + a; else v87 = 4484;
+  if (a > 4485) v85 = v92 + a; else v88 = 4485;
+  if (a > 4486) v86 = v93 + a; else v89 = 4486;
+  if (a > 4487) v87 = v94 + a; else v90 = 4487;
+  if (a > 4488) v88 = v95 + a; else v91 = 4488;
+  if (a > 4489) v89 = v96 + a; else v92 = 4489;
+  if (a > 4490) v90 = v97 + a; else v93 = 4490;
+  if (a > 4491) v91 = v98 + a; else v94 = 4491;
+  if (a > 4492) v92 = v99 + a; else v95 = 4492;
+  if (a > 4493) v93 = v100 + a; else v96 = 4493;
+  if (a > 4494) v94 = v101 + a; else v97 = 4494;
+  if (a > 4495) v95 = v102 + a; else v98 = 4495;
+  if (a > 4496) v96 = v103 + a; else v99 = 4496;
+  if (a > 4497) v97 = v104 + a; else v100 = 4497;
+  if (a > 4498) v98 = v105 + a; else v101 = 4498;
+  if (a > 4499) v99 = v106 + a; else v102 = 4499;
+  if (a > 4500) v100 = v107 + a; else v103 = 4500;
+  if (a > 4501) v101 = v108 + a; else v104 = 4501;
+  if (a > 4502) v102 = v109 + a; else v105 = 4502;
+  if (a > 4503) v103 = v110 + a; else v106 = 4503;
+  if (a > 4504) v104 = v111 + a; else v107 = 4504;
+  if (a > 4505) v105 = v112 + a; else v108 = 4505;
+  if (a > 4506) v106 = v113 + a; else v109 = 4506;
+  if (a > 4507) v107 = v114 + a; else v110 = 4507;
+  if (a > 4508) v108 = v115 + a; else v111 = 4508;
+  if (a > 4509) v109 = v116 + a; else v112 = 4509;
+  if (a > 4510) v110 = v117 + a; else v113 = 4510;
+  if (a > 4511) v111 = v118 + a; else v114 = 4511;
+  if (a > 4512) v112 = v119 + a; else v115 = 4512;
+  if (a > 4513) v113 = v120 + a; else v116 = 4513;
+  if (a > 4514) v114 = v121 + a; else v117 = 4514;
+  if (a > 4515) v115 = v122 + a; else v118 = 4515;
+  if (a > 4516) v116 = v123 + a; else v119 = 4516;
+  if (a > 4517) v117 = v124 + a; else v120 = 4517;
+  if (a > 4518) v118 = v125 + a; else v121 = 4518;
+  if (a > 4519) v119 = v126 + a; else v122 = 4519;
+  if (a > 4520) v120 = v127 + a; else v123 = 4520;
+  if (a > 4521) v121 = v128 + a; else v124 = 4521;
+  if (a > 4522) v122 = v129 + a; else v125 = 4522;
+  if (a > 4523) v123 = v130 + a; else v126 = 4523;
+  if (a > 4524) v124 = v131 + a; else v127 = 4524;
+  if (a > 4525) v125 = v132 + a; else v128 = 4525;
+  if (a > 4526) v126 = v133 + a; else v129 = 4526;
+  if (a > 4527) v127 = v134 + a; else v130 = 4527;
+  if (a > 4528) v128 = v135 + a; else v131 = 4528;
+  if (a > 4529) v129 = v136 + a; else v132 = 4529;
+  if (a > 4530) v130 = v137 + a; else v133 = 4530;
+  if (a > 4531) v131 = v138 + a; else v134 = 4531;
+  if (a > 4532) v132 = v139 + a; else v135 = 4532;
+  if (a > 4533) v133 = v140 + a; else v136 = 4533;
+  if (a > 4534) v134 = v141 + a; else v137 = 4534;
+  if (a > 4535) v135 = v142 + a; else v138 = 4535;
+  if (a > 4536) v136 = v143 + a; else v139 = 4536;
+  if (a > 4537) v137 = v144 + a; else v140 = 4537;
+  if (a > 4538) v138 = v145 + a; else v141 = 4538;
+  if (a > 4539) v139 = v146 + a; else v142 = 4539;
+  if (a > 4540) v140 = v147 + a; else v143 = 4540;
+  if (a > 4541) v141 = v148 + a; else v144 = 4541;
+  if (a > 4542) v142 = v149 + a; else v145 = 4542;
+  if (a > 4543) v143 = v150 + a; else v146 = 4543;
+  if (a > 4544) v144 = v151 + a; else v147 = 4544;
+  if (a > 4545) v145 = v152 + a; else v148 = 4545;
+  if (a > 4546) v146 = v153 + a; else v149 = 4546;
+  if (a > 4547) v147 = v154 + a; else v150 = 4547;
+  if (a > 4548) v148 = v155 + a; else v151 = 4548;
+  if (a > 4549) v149 = v156 + a; else v152 = 4549;
+  if (a > 4550) v150 = v157 + a; else v153 = 4550;
+  if (a > 4551) v151 = v158 + a; else v154 = 4551;
+  if (a > 4552) v152 = v159 + a; else v155 = 4552;
+  if (a > 4553) v153 = v160 + a; else v156 = 4553;
+  if (a > 4554) v154 = v161 + a; else v157 = 4554;
+  if (a > 4555) v155 = v162 + a; else v158 = 4555;
+  if (a > 4556) v156 = v163 + a; else v159 = 4556;
+  if (a > 4557) v157 = v164 + a; else v160 = 4557;
+  if (a > 4558) v158 = v165 + a; else v161 = 4558;
+  if (a > 4559) v159 = v166 + a; else v162 = 4559;
+  if (a > 4560) v160 = v167 + a; else v163 = 4560;
+  if (a > 4561) v161 = v168 + a; else v164 = 4561;
+  if (a > 4562) v162 = v169 + a; else v165 = 4562;
+  if (a > 4563) v163 = v170 + a; else v166 = 4563;
+  if (a > 4564) v164 = v171 + a; else v167 = 4564;
+  if (a > 4565) v165 = v172 + a; else v168 = 4565;
+  if (a > 4566) v166 = v173 + a; else v169 = 4566;
+  if (a > 4567) v167 = v174 + a; else v170 = 4567;
+  if (a > 4568) v168 = v175 + a; else v171 = 4568;
+  if (a > 4569) v169 = v176 + a; else v172 = 4569;
+  if (a > 4570) v170 = v177 + a; else v173 = 4570;
+  if (a > 4571) v171 = v178 + a; else v174 = 4571;
+  if (a > 4572) v172 = v179 + a; else v175 = 4572;
+  if (a > 4573) v173 = v180 + a; else v176 = 4573;
+  if (a > 4574) v174 = v181 + a; else v177 = 4574;
+  if (a > 4575) v175 = v182 + a; else v178 = 4575;
+  if (a > 4576) v176 = v183 + a; else v179 = 4576;
+  if (a > 4577) v177 = v184 + a; else v180 = 4577;
+  if (a > 4578) v178 = v185 + a; else v181 = 4578;
+  if (a > 4579) v179 = v186 + a; else v182 = 4579;
+  if (a > 4580) v180 = v187 + a; else v183 = 4580;
+  if (a > 4581) v181 = v188 + a; else v184 = 4581;
+  if (a > 4582) v182 = v189 + a; else v185 = 4582;
+  if (a > 4583) v183 = v190 + a; else v186 = 4583;
+  if (a > 4584) v184 = v191 + a; else v187 = 4584;
+  if (a > 4585) v185 = v192 + a; else v188 = 4585;
+  if (a > 4586) v186 = v193 + a; else v189 = 4586;
+  if (a > 4587) v187 = v194 + a; else v190 = 4587;
+  if (a > 4588) v188 = v195 + a; else v191 = 4588;
+  if (a > 4589) v189 = v196 + a; else v192 = 4589;
+  if (a > 4590) v190 = v197 + a; else v193 = 4590;
+  if (a > 4591) v191 = v198 + a; else v194 = 4591;
+  if (a > 4592) v192 = v199 + a; else v195 = 4592;
+  if (a > 4593) v193 = v0 + a; else v196 = 4593;
+  if (a > 4594) v194 = v1 + a; else v197 = 4594;
+  if (a > 4595) v195 = v2 + a; else v198 = 4595;
+  if (a > 4596) v196 = v3 + a; else v199 = 4596;
+  if (a > 4597) v197 = v4 + a; else v0 = 4597;
+  if (a > 4598) v198 = v5 + a; else v1 = 4598;
+  if (a > 4599) v199 = v6 + a; else v2 = 4599;
+  if (a > 4600) v0 = v7 + a; else v3 = 4600;
+  if (a > 4601) v1 = v8 + a; else v4 = 4601;
+  if (a > 4602) v2 = v9 + a; else v5 = 4602;
+  if (a > 4603) v3 = v10 + a; else v6 = 4603;
+  if (a > 4604) v4 = v11 + a; else v7 = 4604;
+  if (a > 4605) v5 = v12 + a; else v8 = 4605;
+  if (a > 4606) v6 = v13 + a; else v9 = 4606;
+  if (a > 4607) v7 = v14 + a; else v10 = 4607;
+  if (a > 4608) v8 = v15 + a; else v11 = 4608;
+  if (a > 4609) v9 = v16 + a; else v12 = 4609;
+  if (a > 4610) v10 = v17 + a; else v13 = 4610;
+  if (a > 4611) v11 = v18 + a; else v14 = 4611;
+  if (a > 4612) v12 = v19 + a; else v15 = 4612;
+  if (a > 4613) v13 = v20 + a; else v16 = 4613;
+  if (a > 4614) v14 = v21 + a; else v17 = 4614;
+  if (a > 4615) v15 = v22 + a; else v18 = 4615;
+  if (a > 4616) v16 = v23 + a; else v19 = 4616;
+  if (a > 4617) v17 = v24 + a; else v20 = 4617;
+  if (a > 4618) v18 = v25 + a; else v21 = 4618;
+  if (a > 4619) v19 = v26 + a; else v22 = 4619;
+  if (a > 4620) v20 = v27 + a; else v23 = 4620;
+  if (a > 4621) v21 = v28 + a; else v24 = 4621;
+  if (a > 4622) v22 = v29 + a; else v25 = 4622;
+  if (a > 4623) v23 = v30 + a; else v26 = 4623;
+  if (a > 4624) v24 = v31 + a; else v27 = 4624;
+  if (a > 4625) v25 = v32 + a; else v28 = 4625;
+  if (a > 4626) v26 = v33 + a; else v29 = 4626;
+  if (a > 4627) v27 = v34 + a; else v30 = 4627;
+  if (a > 4628) v28 = v35 + a; else v31 = 4628;
+  if (a > 4629) v29 = v36 + a; else v32 = 4629;
+  if (a > 4630) v30 = v37 + a; else v33 = 4630;
+  if (a > 4631) v31 = v38 + a; else v34 = 4631;
+  if (a > 4632) v32 = v39 + a; else v35 = 4632;
+  if (a > 4633) v33 = v40 + a; else v36 = 4633;
+  if (a > 4634) v34 = v41 + a; else v37 = 4634;
+  if (a > 4635) v35 = v42 + a; else v38 = 4635;
+  if (a > 4636) v36 = v43 + a; else v39 = 4636;
+  if (a > 4637) v37 = v44 + a; else v40 = 4637;
+  if (a > 4638) v38 = v45 + a; else v41 = 4638;
+  if (a > 4639) v39 = v46 + a; else v42 = 4639;
+  if (a > 4640) v40 = v47 + a; else v43 = 4640;
+  if (a > 4641) v41 = v48 + a; else v44 = 4641;
+  if (a > 4642) v42 = v49 + a; else v45 = 4642;
+  if (a > 4643) v43 = v50 + a; else v46 = 4643;
+  if (a > 4644) v44 = v51 + a; else v47 = 4644;
+  if (a > 4645) v45 = v52 + a; else v48 = 4645;
+  if (a > 4646) v46 = v53 + a; else v49 = 4646;
+  if (a > 4647) v47 = v54 + a; else v50 = 4647;
+  if (a > 4648) v48 = v55 + a; else v51 = 4648;
+  if (a > 4649) v49 = v56 + a; else v52 = 4649;
+  if (a > 4650) v50 = v57 + a; else v53 = 4650;
+  if (a > 4651) v51 = v58 + a; else v54 = 4651;
+  if (a > 4652) v52 = v59 + a; else v55 = 4652;
+  if (a > 4653) v53 = v60 + a; else v56 = 4653;
+  if (a > 4654) v54 = v61 + a; else v57 = 4654;
+  if (a > 4655) v55 = v62 + a; else v58 = 4655;
+  if (a > 4656) v56 = v63 + a; else v59 = 4656;
+  if (a > 4657) v57 = v64 + a; else v60 = 4657;
+  if (a > 4658) v58 = v65 + a; else v61 = 4658;
+  if (a > 4659) v59 = v66 + a; else v62 = 4659;
+  if (a > 4660) v60 = v67 + a; else v63 = 4660;
+  if (a > 4661) v61 = v68 + a; else v64 = 4661;
+  if (a > 4662) v62 = v69 + a; else v65 = 4662;
+  if (a > 4663) v63 = v70 + a; else v66 = 4663;
+  if (a > 4664) v64 = v71 + a; else v67 = 4664;
+  if (a > 4665) v65 = v72 + a; else v68 = 4665;
+  if (a > 4666) v66 = v73 + a; else v69 = 4666;
+  if (a > 4667) v67 = v74 + a; else v70 = 4667;
+  if (a > 4668) v68 = v75 + a; else v71 = 4668;
+  if (a > 4669) v69 = v76 + a; else v72 = 4669;
+  if (a > 4670) v70 = v77 + a; else v73 = 4670;
+  if (a > 4671) v71 = v78 + a; else v74 = 4671;
+  if (a > 4672) v72 = v79 + a; else v75 = 4672;
+  if (a > 4673) v73 = v80 + a; else v76 = 4673;
+  if (a > 4674) v74 = v81 + a; else v77 = 4674;
+  if (a > 4675) v75 = v82 + a; else v78 = 4675;
+  if (a > 4676) v76 = v83 + a; else v79 = 4676;
+  if (a > 4677) v77 = v84 + a; else v80 = 4677;
+  if (a > 4678) v78 = v85 + a; else v81 = 4678;
+  if (a > 4679) v79 = v86 + a; else v82 = 4679;
+  if (a > 4680) v80 = v87 + a; else v83 = 4680;
+  if (a > 4681) v81 = v88 + a; else v84 = 4681;
+  if (a > 4682) v82 = v89 + a; else v85 = 4682;
+  if (a > 4683) v83 = v90 + a; else v86 = 4683;
+  if (a > 4684) v84 = v91 + a; else v87 = 4684;
+  if (a > 4685) v85 = v92 + a; else v88 = 4685;
+  if (a > 4686) v86 = v93 + a; else v89 = 4686;
+  if (a > 4687) v87 = v94 + a; else v90 = 4687;
+  if (a > 4688) v88 = v95 + a; else v91 = 4688;
+  if (a > 4689) v89 = v96 + a; else v92 = 4689;
+  if (a > 4690) v90 = v97 + a; else v93 = 4690;
+  if (a > 4691) v91 = v98 + a; else v94 = 4691;
+  if (a > 4692) v92 = v99 + a; else v95 = 4692;
+  if (a > 4693) v93 = v100 + a; else v96 = 4693;
+  if (a > 4694) v94 = v101 + a; else v97 = 4694;
+  if (a > 4695) v95 = v102 + a; else v98 = 4695;
+  if (a > 4696) v96 = v103 + a; else v99 = 4696;
+  if (a > 4697) v97 = v104 + a; else v100 = 4697;
+  if (a > 4698) v98 = v105 + a; else v101 = 4698;
+  if (a > 4699) v99 = v106 + a; else v102 = 4699;
+  if (a > 4700) v100 = v107 + a; else v103 = 4700;
+  if (a > 4701) v101 = v108 + a; else v104 = 4701;
+  if (a > 4702) v102 = v109 + a; else v105 = 4702;
+  if (a > 4703) v103 = v110 + a; else v106 = 4703;
+  if (a > 4704) v104 = v111 + a; else v107 = 4704;
+  if (a > 4705) v105 = v112 + a; else v108 = 4705;
+  if (a > 4706) v106 = v113 + a; else v109 = 4706;
+  if (a > 4707) v107 = v114 + a; else v110 = 4707;
+  if (a > 4708) v108 = v115 + a; else v111 = 4708;
+  if (a > 4709) v109 = v116 + a; else v112 = 4709;
+  if (a > 4710) v110 = v117 + a; else v113 = 4710;
+  if (a > 4711) v111 = v118 + a; else v114 = 4711;
+  if (a > 4712) v112 = v119 + a; else v115 = 4712;
+  if (a > 4713) v113 = v120 + a; else v116 = 4713;
+  if (a > 4714) v114 = v121 + a; else v117 = 4714;
+  if (a > 4715) v115 = v122 + a; else v118 = 4715;
+  if (a > 4716) v116 = v123 + a; else v119 = 4716;
+  if (a > 4717) v117 = v124 + a; else v120 = 4717;
+  if (a > 4718) v118 = v125 + a; else v121 = 4718;
+  if (a > 4719) v119 = v126 + a; else v122 = 4719;
+  if (a > 4720) v120 = v127 + a; else v123 = 4720;
+  if (a > 4721) v121 = v128 + a; else v124 = 4721;
+  if (a > 4722) v122 = v129 + a; else v125 = 4722;
+  if (a > 4723) v123 = v130 + a; else v126 = 4723;
+  if (a > 4724) v124 = v131 + a; else v127 = 4724;
+  if (a > 4725) v125 = v132 + a; else v128 = 4725;
+  if (a > 4726) v126 = v133 + a; else v129 = 4726;
+  if (a > 4727) v127 = v134 + a; else v130 = 4727;
+  if (a > 4728) v128 = v135 + a; else v131 = 4728;
+  if (a > 4729) v129 = v136 + a; else v132 = 4729;
+  if (a > 4730) v130 = v137 + a; else v133 = 4730;
+  if (a > 4731) v131 = v138 + a; else v134 = 4731;
+  if (a > 4732) v132 = v139 + a; else v135 = 4732;
+  if (a > 4733) v133 = v140 + a; else v136 = 4733;
+  if (a > 4734) v134 = v141 + a; else v137 = 4734;
+  if (a > 4735) v135 = v142 + a; else v138 = 4735;
+  if (a > 4736) v136 = v143 + a; else v139 = 4736;
+  if (a > 4737) v137 = v144 + a; else v140 = 4737;
+  if (a > 4738) v138 = v145 + a; else v141 = 4738;
+  if (a > 4739) v139 = v146 + a; else v142 = 4739;
+  if (a > 4740) v140 = v147 + a; else v143 = 4740;
+  if (a > 4741) v141 = v148 + a; else v144 = 4741;
+  if (a > 4742) v142 = v149 + a; else v145 = 4742;
+  if (a > 4743) v143 = v150 + a; else v146 = 4743;
+  if (a > 4744) v144 = v151 + a; else v147 = 4744;
+  if (a > 4745) v145 = v152 + a; else v148 = 4745;
+  if (a > 4746) v146 = v153 + a; else v149 = 4746;
+  if (a > 4747) v147 = v154 + a; else v150 = 4747;
+  if (a > 4748) v148 = v155 + a; else v151 = 4748;
+  if (a > 4749) v149 = v156 + a; else v152 = 4749;
+  if (a > 4750) v150 = v157 + a; else v153 = 4750;
+  if (a > 4751) v151 = v158 + a; else v154 = 4751;
+  if (a > 4752) v152 = v159 + a; else v155 = 4752;
+  if (a > 4753) v153 = v160 + a; else v156 = 4753;
+  if (a > 4754) v154 = v161 + a; else v157 = 4754;
+  if (a > 4755) v155 = v162 + a; else v158 = 4755;
+  if (a > 4756) v156 = v163 + a; else v159 = 4756;
+  if (a > 4757) v157 = v164 + a; else v160 = 4757;
+  if (a > 4758) v158 = v165 + a; else v161 = 4758;
+  if (a > 4759) v159 = v166 + a; else v162 = 4759;
+  if (a > 4760) v160 = v167 + a; else v163 = 4760;
+  if (a > 4761) v161 = v168 + a; else v164 = 4761;
+  if (a > 4762) v162 = v169 + a; else v165 = 4762;
+  if (a > 4763) v163 = v170 + a; else v166 = 4763;
+  if (a > 4764) v164 = v171 + a; else v167 = 4764;
+  if (a > 4765) v165 = v172 + a; else v168 = 4765;
+  if (a > 4766) v166 = v173 + a; else v169 = 4766;
+  if (a > 4767) v167 = v174 + a; else v170 = 4767;
+  if (a > 4768) v168 = v175 + a; else v171 = 4768;
+  if (a > 4769) v169 = v176 + a; else v172 = 4769;
+  if (a > 4770) v170 = v177 + a; else v173 = 4770;
+  if (a > 4771) v171 = v178 + a; else v174 = 4771;
+  if (a > 4772) v172 = v179 + a; else v175 = 4772;
+  if (a > 4773) v173 = v180 + a; else v176 = 4773;
+  if (a > 4774) v174 = v181 + a; else v177 = 4774;
+  if (a > 4775) v175 = v182 + a; else v178 = 4775;
+  if (a > 4776) v176 = v183 + a; else v179 = 4776;
+  if (a > 4777) v177 = v184 + a; else v180 = 4777;
+  if (a > 4778) v178 = v185 + a; else v181 = 4778;
+  if (a > 4779) v179 = v186 + a; else v182 = 4779;
+  if (a > 4780) v180 = v187 + a; else v183 = 4780;
+  if (a > 4781) v181 = v188 + a; else v184 = 4781;
+  if (a > 4782) v182 = v189 + a; else v185 = 4782;
+  if (a > 4783) v183 = v190 + a; else v186 = 4783;
+  if (a > 4784) v184 = v191 + a; else v187 = 4784;
+  if (a > 4785) v185 = v192 + a; else v188 = 4785;
+  if (a > 4786) v186 = v193 + a; else v189 = 4786;
+  if (a > 4787) v187 = v194 + a; else v190 = 4787;
+  if (a > 4788) v188 = v195 + a; else v191 = 4788;
+  if (a > 4789) v189 = v196 + a; else v192 = 4789;
+  if (a > 4790) v190 = v197 + a; else v193 = 4790;
+  if (a > 4791) v191 = v198 + a; else v194 = 4791;
+  if (a > 4792) v192 = v199 + a; else v195 = 4792;
+  if (a > 4793) v193 = v0 + a; else v196 = 4793;
+  if (a > 4794) v194 = v1 + a; else v197 = 4794;
+  if (a > 4795) v195 = v2 + a; else v198 = 4795;
+  if (a > 4796) v196 = v3 + a; else v199 = 4796;
+  if (a > 4797) v197 = v4 + a; else v0 = 4797;
+  if (a > 4798) v198 = v5 + a; else v1 = 4798;
+  if (a > 4799) v199 = v6 + a; else v2 = 4799;
+  if (a > 4800) v0 = v7 + a; else v3 = 4800;
+  if (a > 4801) v1 = v8 + a; else v4 = 4801;
+  if (a > 4802) v2 = v9 + a; else v5 = 4802;
+  if (a > 4803) v3 = v10 + a; else v6 = 4803;
+  if (a > 4804) v4 = v11 + a; else v7 = 4804;
+  if (a > 4805) v5 = v12 + a; else v8 = 4805;
+  if (a > 4806) v6 = v13 + a; else v9 = 4806;
+  if (a > 4807) v7 = v14 + a; else v10 = 4807;
+  if (a > 4808) v8 = v15 + a; else v11 = 4808;
+  if (a > 4809) v9 = v16 + a; else v12 = 4809;
+  if (a > 4810) v10 = v17 + a; else v13 = 4810;
+  if (a > 4811) v11 = v18 + a; else v14 = 4811;
+  if (a > 4812) v12 = v19 + a; else v15 = 4812;
+  if (a > 4813) v13 = v20 + a; else v16 = 4813;
+  if (a > 4814) v14 = v21 + a; else v17 = 4814;
+  if (a > 4815) v15 = v22 + a; else v18 = 4815;
+  if (a > 4816) v16 = v23 + a; else v19 = 4816;
+  if (a > 4817) v17 = v24 + a; else v20 = 4817;
+  if (a > 4818) v18 = v25 + a; else v21 = 4818;
+  if (a > 4819) v19 = v26 + a; else v22 = 4819;
+  if (a > 4820) v20 = v27 + a; else v23 = 4820;
+  if (a > 4821) v21 = v28 + a; else v24 = 4821;
+  if (a > 4822) v22 = v29 + a; else v25 = 4822;
+  if (a > 4823) v23 = v30 + a; else v26 = 4823;
+  if (a > 4824) v24 = v31 + a; else v27 = 4824;
+  if (a > 4825) v25 = v32 + a; else v28 = 4825;
+  if (a > 4826) v26 = v33 + a; else v29 = 4826;
+  if (a > 4827) v27 = v34 + a; else v30 = 4827;
+  if (a > 4828) v28 = v35 + a; else v31 = 4828;
+  if (a > 4829) v29 = v36 + a; else v32 = 4829;
+  if (a > 4830) v30 = v37 + a; else v33 = 4830;
+  if (a > 4831) v31 = v38 + a; else v34 = 4831;
+  if (a > 4832) v32 = v39 + a; else v35 = 4832;
+  if (a > 4833) v33 = v40 + a; else v36 = 4833;
+  if (a > 4834) v34 = v41 + a; else v37 = 4834;
+  if (a > 4835) v35 = v42 + a; else v38 = 4835;
+  if (a > 4836) v36 = v43 + a; else v39 = 4836;
+  if (a > 4837) v37 = v44 + a; else v40 = 4837;
+  if (a > 4838) v38 = v45 + a; else v41 = 4838;
+  if (a > 4839) v39 = v46 + a; else v42 = 4839;
+  if (a > 4840) v40 = v47 + a; else v43 = 4840;
+  if (a > 4841) v41 = v48 + a; else v44 = 4841;
+  if (a > 4842) v42 = v49 + a; else v45 = 4842;
+  if (a > 4843) v43 = v50 + a; else v46 = 4843;
+  if (a > 4844) v44 = v51 + a; else v47 = 4844;
+  if (a > 4845) v45 = v52 + a; else v48 = 4845;
+  if (a > 4846) v46 = v53 + a; else v49 = 4846;
+  if (a > 4847) v47 = v54 + a; else v50 = 4847;
+  if (a > 4848) v48 = v55 + a; else v51 = 4848;
+  if (a > 4849) v49 = v56 + a; else v52 = 4849;
+  if (a > 4850) v50 = v57 + a; else v53 = 4850;
+  if (a > 4851) v51 = v58 + a; else v54 = 4851;
+  if (a > 4852) v52 = v59 + a; else v55 = 4852;
+  if (a > 4853) v53 = v60 + a; else v56 = 4853;
+  if (a > 4854) v54 = v61 + a; else v57 = 4854;
+  if (a > 4855) v55 = v62 + a; else v58 = 4855;
+  if (a > 4856) v56 = v63 + a; else v59 = 4856;
+  if (a > 4857) v57 = v64 + a; else v60 = 4857;
+  if (a > 4858) v58 = v65 + a; else v61 = 4858;
+  if (a > 4859) v59 = v66 + a; else v62 = 4859;
+  if (a > 4860) v60 = v67 + a; else v63 = 4860;
+  if (a > 4861) v61 = v68 + a; else v64 = 4861;
+  if (a > 4862) v62 = v69 + a; else v65 = 4862;
+  if (a > 4863) v63 = v70 + a; else v66 = 4863;
+  if (a > 4864) v64 = v71 + a; else v67 = 4864;
+  if (a > 4865) v65 = v72 + a; else v68 = 4865;
+  if (a > 4866) v66 = v73 + a; else v69 = 4866;
+  if (a > 4867) v67 = v74 + a; else v70 = 4867;
+  if (a > 4868) v68 = v75 + a; else v71 = 4868;
+  if (a > 4869) v69 = v76 + a; else v72 = 4869;
+  if (a > 4870) v70 = v77 + a; else v73 = 4870;
+  if (a > 4871) v71 = v78 + a; else v74 = 4871;
+  if (a > 4872) v72 = v79 + a; else v75 = 4872;
+  if (a > 4873) v73 = v80 + a; else v76 = 4873;
+  if (a > 4874) v74 = v81 + a; else v77 = 4874;
+  if (a > 4875) v75 = v82 + a; else v78 = 4875;
+  if (a > 4876) v76 = v83 + a; else v79 = 4876;
+  if (a > 4877) v77 = v84 + a; else v80 = 4877;
+  if (a > 4878) v78 = v85 + a; else v81 = 4878;
+  if (a > 4879) v79 = v86 + a; else v82 = 4879;
+  if (a > 4880) v80 = v87 + a; else v83 = 4880;
+  if (a > 4881) v81 = v88 + a; else v84 = 4881;
+  if (a > 4882) v82 = v89 + a; else v85 = 4882;
+  if (a > 4883) v83 = v90 + a; else v86 = 4883;
+  if (a > 4884) v84 = v91 + a; else v87 = 4884;
+  if (a > 4885) v85 = v92 + a; else v88 = 4885;
+  if (a > 4886) v86 = v93 + a; else v89 = 4886;
+  if (a > 4887) v87 = v94 + a; else v90 = 4887;
+  if (a > 4888) v88 = v95 + a; else v91 = 4888;
+  if (a > 4889) v89 = v96 + a; else v92 = 4889;
+  if (a > 4890) v90 = v97 + a; else v93 = 4890;
+  if (a > 4891) v91 = v98 + a; else v94 = 4891;
+  if (a > 4892) v92 = v99 + a; else v95 = 4892;
+  if (a > 4893) v93 = v100 + a; else v96 = 4893;
+  if (a > 4894) v94 = v101 + a; else v97 = 4894;
+  if (a > 4895) v95 = v102 + a; else v98 = 4895;
+  if (a > 4896) v96 = v103 + a; else v99 = 4896;
+  if (a > 4897) v97 = v104 + a; else v100 = 4897;
+  if (a > 4898) v98 = v105 + a; else v101 = 4898;
+  if (a > 4899) v99 = v106 + a; else v102 = 4899;
+  if (a > 4900) v100 = v107 + a; else v103 = 4900;
+  if (a > 4901) v101 = v108 + a; else v104 = 4901;
+  if (a > 4902) v102 = v109 + a; else v105 = 4902;
+  if (a > 4903) v103 = v110 + a; else v106 = 4903;
+  if (a > 4904) v104 = v111 + a; else v107 = 4904;
+  if (a > 4905) v105 = v112 + a; else v108 = 4905;
+  if (a > 4906) v106 = v113 + a; else v109 = 4906;
+  if (a > 4907) v107 = v114 + a; else v110 = 4907;
+  if (a > 4908) v108 = v115 + a; else v111 = 4908;
+  if (a > 4909) v109 = v116 + a; else v112 = 4909;
+  if (a > 4910) v110 = v117 + a; else v113 = 4910;
+  if (a > 4911) v111 = v118 + a; else v114 = 4911;
+  if (a > 4912) v112 = v119 + a; else v115 = 4912;
+  if (a > 4913) v113 = v120 + a; else v116 = 4913;
+  if (a > 4914) v114 = v121 + a; else v117 = 4914;
+  if (a > 4915) v115 = v122 + a; else v118 = 4915;
+  if (a > 4916) v116 = v123 + a; else v119 = 4916;
+  if (a > 4917) v117 = v124 + a; else v120 = 4917;
+  if (a > 4918) v118 = v125 + a; else v121 = 4918;
+  if (a > 4919) v119 = v126 + a; else v122 = 4919;
+  if (a > 4920) v120 = v127 + a; else v123 = 4920;
+  if (a > 4921) v121 = v128 + a; else v124 = 4921;
+  if (a > 4922) v122 = v129 + a; else v125 = 4922;
+  if (a > 4923) v123 = v130 + a; else v126 = 4923;
+  if (a > 4924) v124 = v131 + a; else v127 = 4924;
+  if (a > 4925) v125 = v132 + a; else v128 = 4925;
+  if (a > 4926) v126 = v133 + a; else v129 = 4926;
+  if (a > 4927) v127 = v134 + a; else v130 = 4927;
+  if (a > 4928) v128 = v135 + a; else v131 = 4928;
+  if (a > 4929) v129 = v136 + a; else v132 = 4929;
+  if (a > 4930) v130 = v137 + a; else v133 = 4930;
+  if (a > 4931) v131 = v138 + a; else v134 = 4931;
+  if (a > 4932) v132 = v139 + a; else v135 = 4932;
+  if (a > 4933) v133 = v140 + a; else v136 = 4933;
+  if (a > 4934) v134 = v141 + a; else v137 = 4934;
+  if (a > 4935) v135 = v142 + a; else v138 = 4935;
+  if (a > 4936) v136 = v143 + a; else v139 = 4936;
+  if (a > 4937) v137 = v144 + a; else v140 = 4937;
+  if (a > 4938) v138 = v145 + a; else v141 = 4938;
+  if (a > 4939) v139 = v146 + a; else v142 = 4939;
+  if (a > 4940) v140 = v147 + a; else v143 = 4940;
+  if (a > 4941) v141 = v148 + a; else v144 = 4941;
+  if (a > 4942) v142 = v149 + a; else v145 = 4942;
+  if (a > 4943) v143 = v150 + a; else v146 = 4943;
+  if (a > 4944) v144 = v151 + a; else v147 = 4944;
+  if (a > 4945) v145 = v152 + a; else v148 = 4945;
+  if (a > 4946) v146 = v153 + a; else v149 = 4946;
+  if (a > 4947) v147 = v154 + a; else v150 = 4947;
+  if (a > 4948) v148 = v155 + a; else v151 = 4948;
+  if (a > 4949) v149 = v156 + a; else v152 = 4949;
+  if (a > 4950) v150 = v157 + a; else v153 = 4950;
+  if (a > 4951) v151 = v158 + a; else v154 = 4951;
+  if (a > 4952) v152 = v159 + a; else v155 = 4952;
+  if (a > 4953) v153 = v160 + a; else v156 = 4953;
+  if (a > 4954) v154 = v161 + a; else v157 = 4954;
+  if (a > 4955) v155 = v162 + a; else v158 = 4955;
+  if (a > 4956) v156 = v163 + a; else v159 = 4956;
+  if (a > 4957) v157 = v164 + a; else v160 = 4957;
+  if (a > 4958) v158 = v165 + a; else v161 = 4958;
+  if (a > 4959) v159 = v166 + a; else v162 = 4959;
+  if (a > 4960) v160 = v167 + a; else v163 = 4960;
+  if (a > 4961) v161 = v168 + a; else v164 = 4961;
+  if (a > 4962) v162 = v169 + a; else v165 = 4962;
+  if (a > 4963) v163 = v170 + a; else v166 = 4963;
+  if (a > 4964) v164 = v171 + a; else v167 = 4964;
+  if (a > 4965) v165 = v172 + a; else v168 = 4965;
+  if (a > 4966) v166 = v173 + a; else v169 = 4966;
+  if (a > 4967) v167 = v174 + a; else v170 = 4967;
+  if (a > 4968) v168 = v175 + a; else v171 = 4968;
+  if (a > 4969) v169 = v176 + a; else v172 = 4969;
+  if (a > 4970) v170 = v177 + a; else v173 = 4970;
+  if (a > 4971) v171 = v178 + a; else v174 = 4971;
+  if (a > 4972) v172 = v179 + a; else v175 = 4972;
+  if (a > 4973) v173 = v180 + a; else v176 = 4973;
+  if (a > 4974) v174 = v181 + a; else v177 = 4974;
+  if (a > 4975) v175 = v182 + a; else v178 = 4975;
+  if (a > 4976) v176 = v183 + a; else v179 = 4976;
+  if (a > 4977) v177 = v184 + a; else v180 = 4977;
+  if (a > 4978) v178 = v185 + a; else v181 = 4978;
+  if (a > 4979) v179 = v186 + a; else v182 = 4979;
+  if (a > 4980) v180 = v187 + a; else v183 = 4980;
+  if (a > 4981) v181 = v188 + a; else v184 = 4981;
+  if (a > 4982) v182 = v189 + a; else v185 = 4982;
+  if (a > 4983) v183 = v190 + a; else v186 = 4983;
+  if (a > 4984) v184 = v191 + a; else v187 = 4984;
+  if (a > 4985) v185 = v192 + a; else v188 = 4985;
+  if (a > 4986) v186 = v193 + a; else v189 = 4986;
+  if (a > 4987) v187 = v194 + a; else v190 = 4987;
+  if (a > 4988) v188 = v195 + a; else v191 = 4988;
+  if (a > 4989) v189 = v196 + a; else v192 = 4989;
+  if (a > 4990) v190 = v197 + a; else v193 = 4990;
+  if (a > 4991) v191 = v198 + a; else v194 = 4991;
+  if (a > 4992) v192 = v199 + a; else v195 = 4992;
+  if (a > 4993) v193 = v0 + a; else v196 = 4993;
+  if (a > 4994) v194 = v1 + a; else v197 = 4994;
+  if (a > 4995) v195 = v2 + a; else v198 = 4995;
+  if (a > 4996) v196 = v3 + a; else v199 = 4996;
+  if (a > 4997) v197 = v4 + a; else v0 = 4997;
+  if (a > 4998) v198 = v5 + a; else v1 = 4998;
+  if (a > 4999) v199 = v6 + a; else v2 = 4999;
+  return v0 + v1 + v2 + v3 + v4 + v5 + v6 + v7 + v8 + v9 + v10 + v11 + v12 + v13 + v14 + v15 + v16 + v17 + v18 + v19 + v20 + v21 + v22 + v23 + v24 + v25 + v26 + v27 + v28 + v29 + v30 + v31 + v32 + v33 + v34 + v35 + v36 + v37 + v38 + v39 + v40 + v41 + v42 + v43 + v44 + v45 + v46 + v47 + v48 + v49 + v50 + v51 + v52 + v53 + v54 + v55 + v56 + v57 + v58 + v59 + v60 + v61 + v62 + v63 + v64 + v65 + v66 + v67 + v68 + v69 + v70 + v71 + v72 + v73 + v74 + v75 + v76 + v77 + v78 + v79 + v80 + v81 + v82 + v83 + v84 + v85 + v86 + v87 + v88 + v89 + v90 + v91 + v92 + v93 + v94 + v95 + v96 + v97 + v98 + v99 + v100 + v101 + v102 + v103 + v104 + v105 + v106 + v107 + v108 + v109 + v110 + v111 + v112 + v113 + v114 + v115 + v116 + v117 + v118 + v119 + v120 + v121 + v122 + v123 + v124 + v125 + v126 + v127 + v128 + v129 + v130 + v131 + v132 + v133 + v134 + v135 + v136 + v137 + v138 + v139 + v140 + v141 + v142 + v143 + v144 + v145 + v146 + v147 + v148 + v149 + v150 + v151 + v152 + v153 + v154 + v155 + v156 + v157 + v158 + v159 + v160 + v161 + v162 + v163 + v164 + v165 + v166 + v167 + v168 + v169 + v170 + v171 + v172 + v173 + v174 + v175 + v176 + v177 + v178 + v179 + v180 + v181 + v182 + v183 + v184 + v185 + v186 + v187 + v188 + v189 + v190 + v191 + v192 + v193 + v194 + v195 + v196 + v197 + v198 + v199;
+}
@@ -0,0 +1,7503 @@
+.intel_syntax noprefix
+.section .rodata.str1.1,"aMS",@progbits,1
+.L.data.285:
+  .string "OK\012"
+.L.data.284:
+  .string "cdup2[3]"
+.L.data.283:
+  .string "cdup_sum(2)"
+.L.data.282:
+  .string "({ int x=100; int y=20; x + (y + realigned_callee(0)); })"
+.L.data.281:
+  .string "({ int x=1; set_through(&x); x; })"
+.L.data.280:
+  .string "({ int a[3]; int b[3]; b[0]=1; b[1]=2; b[2]=4; restrict_sum(a, b, 3); })"
+.L.data.279:
+  .string "({ int x; int y; restrict_store(&x, &y); })"
+.L.data.278:
+  .string "sizeof(ctab)"
+.L.data.277:
+  .string "({ const int *p=ctab; p[1]+*ctab; })"
+.L.data.276:
+  .string "({ const int x=5; int const y=2; x*y; })"
+.L.data.275:
+  .string "cptr[2]"
+.L.data.274:
+  .string "cmsg[1]"
+.L.data.273:
+  .string "ccfg.tag"
+.L.data.272:
+  .string "ccfg.w"
+.L.data.271:
+  .string "const_index(1)"
+.L.data.270:
+  .string "ctab[3]"
+.L.data.269:
+  .string "ctab[2]"
+.L.data.268:
+  .string "diff_made(1, 5)"
+.L.data.267:
+  .string "diff_small(({ Small s; s.a=1; s.b=2; s.c=3; s; }), ({ Small t; t.a=4; t.b=5; t.c=9; t; }))"
+.L.data.266:
+  .string "({ Big b; int *p; b=c_make_big(2); p=b.x; p[9]; })"
+.L.data.265:
+  .string "c_sum_structs(make_small(1), make_big(1), 2)"
+.L.data.264:
+  .string "sum_big(make_small(1), make_big(0), 100)"
+.L.data.263:
+  .string "({ Big b; int *p; b=make_big(3); p=b.x; p[9]; })"
+.L.data.262:
+  .string "make_small(1).c"
+.L.data.261:
+  .string "sum_small(make_small(1))"
+.L.data.260:
+  .string "({ Small x; Small y; Small z; x=make_small(4); z=y=x; z.c; })"
+.L.data.259:
+  .string "({ Small x; Small y; x.a=1; x.b=2; x.c=3; y=x; y.a+y.b+y.c; })"
+.L.data.258:
+  .string "*g7[0].p"
+.L.data.257:
+  .string "*g7[1].p"
+.L.data.256:
+  .string "g7[1].c"
+.L.data.255:
+  .string "g6[1]"
+.L.data.254:
+  .string "g5[1]"
+.L.data.253:
+  .string "*g4"
+.L.data.252:
+  .string "g3[3]"
+.L.data.251:
+  .string "g3[2]"
+.L.data.250:
+  .string "pooled_strings()"
+.L.data.249:
+  .string "sibling_blocks(0)"
+.L.data.248:
+  .string "sibling_blocks(1)"
+.L.data.247:
+  .string "aligned_locals()"
+.L.data.246:
+  .string "triangle(7)"
+.L.data.245:
+  .string "triangle(6)"
+.L.data.244:
+  .string "sum_to(5)"
+.L.data.243:
+  .string "sum_to(10)"
+.L.data.242:
+  .string "({ int i; int s=10; for (i=0; i<3; i++) s=static_op(1, s, 1); s; })"
+.L.data.241:
+  .string "({ int i; int s=0; for (i=0; i<5; i++) s=static_op(0, s, i); static_op(2, s, 3); })"
+.L.data.240:
+  .string "({ int x=7; static_scale(x, 3, 0) + static_scale(x, 3, 0); })"
+.L.data.239:
+  .string "static_scale(4, 3, 1)"
+.L.data.238:
+  .string "static_scale(7, 3, 0)"
+.L.data.237:
+  .string "({ int x[2]; store_fields(x); })"
+.L.data.236:
+  .string "({ int x; int y; store_twice(&x, &y); })"
+.L.data.235:
+  .string "({ int x; store_twice(&x, &x); })"
+.L.data.234:
+  .string "({ int i=2; int j=3; (i=5,j)=6; j; })"
+.L.data.233:
+  .string "({ int i=2; int j=3; (i=5,j)=6; i; })"
+.L.data.232:
+  .string "(1,2,3)"
+.L.data.231:
+  .string "({ InitStruct x[8]={{'a', g3}, {'b', g4}}; *x[0].p + *x[1].p + x[2].c; })"
+.L.data.229:
+  .string "({ char x[80]=\"abc\"; x[79]; })"
+.L.data.227:
+  .string "({ char x[20]=\"abc\"; x[1]; })"
+.L.data.226:
+  .string "({ int x[40]={}; x[20]; })"
+.L.data.225:
+  .string "({ int y=7; int x[40]={1,y}; x[1]; })"
+.L.data.223:
+  .string "({ int x[40]={1,2}; x[1]; })"
+.L.data.221:
+  .string "({ int x[40]={1,2}; x[39]; })"
+.L.data.219:
+  .string "({ int x[3]={1}; x[2]; })"
+.L.data.218:
+  .string "({ int x[3]={1,2,3}; x[2]; })"
+.L.data.217:
+  .string "({ int x[3]={1,2,3}; x[1]; })"
+.L.data.216:
+  .string "({ int x[3]={1,2,3}; x[0]; })"
+.L.data.215:
+  .string "({ int i=0; switch(3) { case 0: 0; case 1: 0; case 2: 0; i=2; } i; })"
+.L.data.214:
+  .string "({ int i=0; switch(1) { case 0: 0; case 1: 0; case 2: 0; i=2; } i; })"
+.L.data.213:
+  .string "({ int i=0; switch(1) { case 0:i=5;break; default:i=7; } i; })"
+.L.data.212:
+  .string "({ int i=0; switch(0) { case 0:i=5;break; default:i=7; } i; })"
+.L.data.211:
+  .string "({ int i=0; switch(3) { case 0:i=5;break; case 1:i=6;break; case 2:i=7;break; } i; })"
+.L.data.210:
+  .string "({ int i=0; switch(2) { case 0:i=5;break; case 1:i=6;break; case 2:i=7;break; } i; })"
+.L.data.209:
+  .string "({ int i=0; switch(1) { case 0:i=5;break; case 1:i=6;break; case 2:i=7;break; } i; })"
+.L.data.208:
+  .string "({ int i=0; switch(0) { case 0:i=5;break; case 1:i=6;break; case 2:i=7;break; } i; })"
+.L.data.207:
+  .string "({ int i=4; switch (i) { case 1: i=11; break; case 2: i=22; break; case 3: i=33; break; default: i=44; } i; })"
+.L.data.206:
+  .string "({ int i=2; switch (i) { case 1: i=11; break; case 2: i=22; break; case 3: i=33; break; } i; })"
+.L.data.205:
+  .string "({ int i=0; int j=0; while (i++<10) { if (i>5) continue; j++; } j; })"
+.L.data.204:
+  .string "({ int i=0; int j=0; while (i++<10) { if (i>5) continue; j++; } i; })"
+.L.data.203:
+  .string "({ int i=0; int j=0; for (;i<10;i++) { if (i>5) continue; j++; } j; })"
+.L.data.202:
+  .string "({ int i=0; int j=0; for (;i<10;i++) { if (i>5) continue; j++; } i; })"
+.L.data.201:
+  .string "({ int i; int k=0; for (i=0; i<10; i++) { if (i==3) continue; k++; } k; })"
+.L.data.200:
+  .string "({ int i; int k=0; for (i=0; i<10; i++) { k++; } k; })"
+.L.data.199:
+  .string "({ int i=0; while (1) { while(1) break; if (i++ == 3) break; } i; })"
+.L.data.198:
+  .string "({ int i=0; for(;i<10;i++) { for (;;) break; if (i == 3) break; } i; })"
+.L.data.197:
+  .string "({ int i=0; while (1) { if (i++ == 3) break; } i; })"
+.L.data.196:
+  .string "({ int i=0; for(;i<10;i++) { if (i == 3) break; } i; })"
+.L.data.195:
+  .string "({ int i=0; while (i<10) { if (i==3) break; i++; } i; })"
+.L.data.194:
+  .string "({ int i; for (i=0; i<10; i++) { if (i==3) break; } i; })"
+.L.data.193:
+  .string "1&&5"
+.L.data.192:
+  .string "(2-2)&&5"
+.L.data.191:
+  .string "0&&1"
+.L.data.190:
+  .string "0||(2-2)"
+.L.data.189:
+  .string "0||0"
+.L.data.188:
+  .string "0||(2-2)||5"
+.L.data.187:
+  .string "0||1"
+.L.data.186:
+  .string "-1&10"
+.L.data.185:
+  .string "7&3"
+.L.data.184:
+  .string "3&1"
+.L.data.183:
+  .string "0&1"
+.L.data.182:
+  .string "~-1"
+.L.data.181:
+  .string "~0"
+.L.data.180:
+  .string "({ int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; *p--; })"
+.L.data.179:
+  .string "({ int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; *p++; })"
+.L.data.178:
+  .string "({ int i=2; i--; i; })"
+.L.data.177:
+  .string "({ int i=2; i--; })"
+.L.data.176:
+  .string "({ int i=2; i++; i; })"
+.L.data.175:
+  .string "({ int i=2; i++; })"
+.L.data.174:
+  .string "({ int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; --*p; })"
+.L.data.173:
+  .string "({ int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; ++*p; })"
+.L.data.172:
+  .string "({ int i=2; --i; i; })"
+.L.data.171:
+  .string "({ int i=2; --i; })"
+.L.data.170:
+  .string "({ int i=2; ++i; i; })"
+.L.data.169:
+  .string "({ int i=2; ++i; })"
+.L.data.168:
+  .string "({ int i=6; i/=2; })"
+.L.data.167:
+  .string "({ int i=6; i/=2; i; })"
+.L.data.166:
+  .string "({ int i=3; i*=2; })"
+.L.data.165:
+  .string "({ int i=3; i*=2; i; })"
+.L.data.164:
+  .string "({ int i=5; i-=2; })"
+.L.data.163:
+  .string "({ int i=5; i-=2; i; })"
+.L.data.162:
+  .string "({ int i=2; i+=5; })"
+.L.data.161:
+  .string "({ int i=2; i+=5; i; })"
+.L.data.160:
+  .string "({ int i=3; int j=0; for (int i=0; i<=10; i=i+1) j=j+i; i; })"
+.L.data.159:
+  .string "({ int j=0; for (int i=0; i<=10; i = i+1) j=j+i; j; })"
+.L.data.158:
+  .string "static_fn()"
+.L.data.157:
+  .string "({ enum { zero, one, two } x; { char x = 'a'; } sizeof(x); })"
+.L.data.156:
+  .string "({ char x = 'a'; { enum { zero, one, two } x; } sizeof(x); })"
+.L.data.155:
+  .string "({ int one = 10; { enum { zero, one, two } x; } one; })"
+.L.data.154:
+  .string "({ enum { zero, one, two }; one + 1; })"
+.L.data.153:
+  .string "({ enum { zero, one, two } x; sizeof(x); })"
+.L.data.152:
+  .string "({ enum { zero, one, two }; two; })"
+.L.data.151:
+  .string "({ enum { zero, one, two }; one; })"
+.L.data.150:
+  .string "({ enum { zero, one, two }; zero; })"
+.L.data.149:
+  .string "({ _Bool x = 2; x; })"
+.L.data.148:
+  .string "({ _Bool x = 1; x; })"
+.L.data.147:
+  .string "({ _Bool x = 0; x; })"
+.L.data.146:
+  .string "sizeof('a')"
+.L.data.145:
+  .string "'\\n'"
+.L.data.144:
+  .string "'a'"
+.L.data.143:
+  .string "({ MyInt x=3; x; })"
+.L.data.142:
+  .string "({ typedef struct {int a;} t; { typedef int t; } t x; x.a=2; x.a; })"
+.L.data.141:
+  .string "({ typedef int t; t t=1; t; })"
+.L.data.140:
+  .string "({ typedef struct {int a;} t; t x; x.a=1; x.a; })"
+.L.data.139:
+  .string "({ typedef int t; t x=1; x; })"
+.L.data.138:
+  .string "({ struct t {int a; int b;}; struct t y; sizeof(y); })"
+.L.data.137:
+  .string "({ struct t {int a; int b;} x; struct t y; sizeof(y); })"
+.L.data.136:
+  .string "({ struct t {char a;} x; struct t *y = &x; y->a=3; x.a; })"
+.L.data.135:
+  .string "({ struct t {char a;} x; struct t *y = &x; x.a=3; y->a; })"
+.L.data.134:
+  .string "({ struct t {int x;}; int t=1; struct t y; y.x=2; t+y.x; })"
+.L.data.133:
+  .string "({ struct t {char a[2];}; { struct t {char a[4];}; } struct t y; sizeof(y); })"
+.L.data.132:
+  .string "({ struct {int a; char b;} x; sizeof(x); })"
+.L.data.131:
+  .string "({ struct {char a; int b;} x; sizeof(x); })"
+.L.data.130:
+  .string "({ struct {char a; char b;} x; sizeof(x); })"
+.L.data.129:
+  .string "({ struct {int a[3];} x[2]; sizeof(x); })"
+.L.data.128:
+  .string "({ struct {int a;} x[4]; sizeof(x); })"
+.L.data.127:
+  .string "({ struct {int a[3];} x; sizeof(x); })"
+.L.data.126:
+  .string "({ struct {int a; int b;} x; sizeof(x); })"
+.L.data.125:
+  .string "({ struct {int a;} x; sizeof(x); })"
+.L.data.124:
+  .string "({ struct {int a; int b;} x[3]; int *p=x; p[3]=3; x[1].b; })"
+.L.data.123:
+  .string "({ struct {int a; int b;} x[3]; int *p=x; p[2]=2; x[1].a; })"
+.L.data.122:
+  .string "({ struct {int a; int b;} x[3]; int *p=x; p[1]=1; x[0].b; })"
+.L.data.121:
+  .string "({ struct {int a; int b;} x[3]; int *p=x; p[0]=0; x[0].a; })"
+.L.data.120:
+  .string "({ struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.c; })"
+.L.data.119:
+  .string "({ struct {char a; int b; char c;} x; x.b=1; x.b=2; x.c=3; x.b; })"
+.L.data.118:
+  .string "({ struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.a; })"
+.L.data.117:
+  .string "({ struct { int a; int b; } x; x.a = 2; x.b = 3; x.b; })"
+.L.data.116:
+  .string "({ struct { int a; int b; } x; x.a = 2; x.b = 3; x.a; })"
+.L.data.115:
+  .string "({ int x=2; { x=3; } x; })"
+.L.data.114:
+  .string "({ int x=2; { int x=3; } int y=4; x; })"
+.L.data.113:
+  .string "({ int x=2; { int x=3; } x; })"
+.L.data.112:
+  .string "sizeof(abc)"
+.L.data.111:
+  .string "abc[3]"
+.L.data.110:
+  .string "abc[2]"
+.L.data.109:
+  .string "abc[1]"
+.L.data.108:
+  .string "abc[0]"
+.L.data.107:
+  .string "({ sub_char(7, 3, 3); })"
+.L.data.106:
+  .string "({ char x[10]; sizeof(x); })"
+.L.data.105:
+  .string "({ char x; sizeof(x); })"
+.L.data.104:
+  .string "({ char x=1; char y=2; y; })"
+.L.data.103:
+  .string "({ char x=1; char y=2; x; })"
+.L.data.102:
+  .string "({ char x=1; x; })"
+.L.data.101:
+  .string "sizeof(g2)"
+.L.data.100:
+  .string "sizeof(g1)"
+.L.data.99:
+  .string "({ g2[0]=0; g2[1]=1; g2[2]=2; g2[3]=3; g2[3]; })"
+.L.data.98:
+  .string "({ g2[0]=0; g2[1]=1; g2[2]=2; g2[3]=3; g2[2]; })"
+.L.data.97:
+  .string "({ g2[0]=0; g2[1]=1; g2[2]=2; g2[3]=3; g2[1]; })"
+.L.data.96:
+  .string "({ g2[0]=0; g2[1]=1; g2[2]=2; g2[3]=3; g2[0]; })"
+.L.data.95:
+  .string "({ g1=3; g1; })"
+.L.data.94:
+  .string "g1"
+.L.data.93:
+  .string "({ int x=1; sizeof(x=2); x; })"
+.L.data.92:
+  .string "({ int x=1; sizeof(x=2); })"
+.L.data.91:
+  .string "({ int x[3][4]; sizeof(**x + 1); })"
+.L.data.90:
+  .string "({ int x[3][4]; sizeof **x + 1; })"
+.L.data.89:
+  .string "({ int x[3][4]; sizeof(**x) + 1; })"
+.L.data.88:
+  .string "({ int x[3][4]; sizeof(**x); })"
+.L.data.87:
+  .string "({ int x[3][4]; sizeof(*x); })"
+.L.data.86:
+  .string "({ int x[3][4]; sizeof(x); })"
+.L.data.85:
+  .string "({ int x[4]; sizeof(x); })"
+.L.data.84:
+  .string "({ int *x; sizeof(x); })"
+.L.data.83:
+  .string "({ int x; sizeof x; })"
+.L.data.82:
+  .string "({ int x; sizeof(x); })"
+.L.data.81:
+  .string "({ int x[2][3]; int *y=x; y[5]=5; x[1][2]; })"
+.L.data.80:
+  .string "({ int x[2][3]; int *y=x; y[4]=4; x[1][1]; })"
+.L.data.79:
+  .string "({ int x[2][3]; int *y=x; y[3]=3; x[1][0]; })"
+.L.data.78:
+  .string "({ int x[2][3]; int *y=x; y[2]=2; x[0][2]; })"
+.L.data.77:
+  .string "({ int x[2][3]; int *y=x; y[1]=1; x[0][1]; })"
+.L.data.76:
+  .string "({ int x[2][3]; int *y=x; y[0]=0; x[0][0]; })"
+.L.data.75:
+  .string "({ int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2); })"
+.L.data.74:
+  .string "({ int x[3]; *x=3; x[1]=4; x[2]=5; *(x+1); })"
+.L.data.73:
+  .string "({ int x[3]; *x=3; x[1]=4; x[2]=5; *x; })"
+.L.data.72:
+  .string "({ int x[2][3]; int *y=x; *(y+5)=5; *(*(x+1)+2); })"
+.L.data.71:
+  .string "({ int x[2][3]; int *y=x; *(y+4)=4; *(*(x+1)+1); })"
+.L.data.70:
+  .string "({ int x[2][3]; int *y=x; *(y+3)=3; **(x+1); })"
+.L.data.69:
+  .string "({ int x[2][3]; int *y=x; *(y+2)=2; *(*x+2); })"
+.L.data.68:
+  .string "({ int x[2][3]; int *y=x; *(y+1)=1; *(*x+1); })"
+.L.data.67:
+  .string "({ int x[2][3]; int *y=x; *y=0; **x; })"
+.L.data.66:
+  .string "({ int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+2); })"
+.L.data.65:
+  .string "({ int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+1); })"
+.L.data.64:
+  .string "({ int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *x; })"
+.L.data.63:
+  .string "({ int x[2]; int *y=&x; *y=3; *x; })"
+.L.data.62:
+  .string "fib(9)"
+.L.data.61:
+  .string "sub2(4,3)"
+.L.data.60:
+  .string "add2(3,4)"
+.L.data.59:
+  .string "add5(1,2,3,4,5)"
+.L.data.58:
+  .string "sub2(5, 3)"
+.L.data.57:
+  .string "add2(3, 5)"
+.L.data.56:
+  .string "ret3()"
+.L.data.55:
+  .string "({ int x=3, y=5; x+y; })"
+.L.data.54:
+  .string "({ int x, y; x=3; y=5; x+y; })"
+.L.data.53:
+  .string "({ int x=3; (&x+2)-&x; })"
+.L.data.52:
+  .string "({ int x=3; int y=5; *(&y-1)=7; x; })"
+.L.data.51:
+  .string "({ int x=3; int y=5; *(&x+1)=7; y; })"
+.L.data.50:
+  .string "({ int x=3; int *y=&x; *y=5; x; })"
+.L.data.49:
+  .string "({ int x=3; int y=5; *(&y-1); })"
+.L.data.48:
+  .string "({ int x=3; int y=5; *(&x+1); })"
+.L.data.47:
+  .string "({ int x=3; int *y=&x; int **z=&y; **z; })"
+.L.data.46:
+  .string "({ int x=3; *&x; })"
+.L.data.45:
+  .string "({ int i=0; int j=0; while(i<=10) {j=i+j; i=i+1;} j; })"
+.L.data.44:
+  .string "({ 1; {2;} 3; })"
+.L.data.43:
+  .string "({ int i=0; while(i<10) i=i+1; i; })"
+.L.data.42:
+  .string "({ int i=0; int j=0; for (i=0; i<=10; i=i+1) j=i+j; j; })"
+.L.data.41:
+  .string "({ int x; if (2-1) x=2; else x=3; x; })"
+.L.data.40:
+  .string "({ int x; if (1) x=2; else x=3; x; })"
+.L.data.39:
+  .string "({ int x; if (1-1) x=2; else x=3; x; })"
+.L.data.38:
+  .string "({ int x; if (0) x=2; else x=3; x; })"
+.L.data.37:
+  .string "({ int foo123=3; int bar=5; foo123+bar; })"
+.L.data.36:
+  .string "({ int foo=3; foo; })"
+.L.data.35:
+  .string "({ int a; int b; a=b=3; a+b; })"
+.L.data.34:
+  .string "({ int a=3; int z=5; a+z; })"
+.L.data.33:
+  .string "({ int a=3; a; })"
+.L.data.32:
+  .string "({ int a; a=3; a; })"
+.L.data.31:
+  .string "1>=2"
+.L.data.30:
+  .string "1>=1"
+.L.data.29:
+  .string "1>=0"
+.L.data.28:
+  .string "1>2"
+.L.data.27:
+  .string "1>1"
+.L.data.26:
+  .string "1>0"
+.L.data.25:
+  .string "2<=1"
+.L.data.24:
+  .string "1<=1"
+.L.data.23:
+  .string "0<=1"
+.L.data.22:
+  .string "2<1"
+.L.data.21:
+  .string "1<1"
+.L.data.20:
+  .string "0<1"
+.L.data.19:
+  .string "42!=42"
+.L.data.18:
+  .string "0!=1"
+.L.data.17:
+  .string "42==42"
+.L.data.16:
+  .string "0==1"
+.L.data.15:
+  .string "- - +10"
+.L.data.14:
+  .string "- -10"
+.L.data.13:
+  .string "-10+20"
+.L.data.12:
+  .string "(3+5)/2"
+.L.data.11:
+  .string "5*(9-6)"
+.L.data.10:
+  .string "5+6*7"
+.L.data.9:
+  .string " 12 + 34 - 5 "
+.L.data.8:
+  .string "5+20-4"
+  .set .L.data.7, .L.data.19+4
+  .set .L.data.6, .L.data.186+4
+.L.data.5:
+  .string "spool"
+  .set .L.data.4, .L.data.5+1
+.L.data.3:
+  .string "%s => %d expected but got %d\012"
+.L.data.2:
+  .string "%s => %d\012"
+.L.data.1:
+  .string "hi"
+.L.data.0:
+  .string "abc"
+.section .rodata
+  .align 16
+  .type .L.data.230, @object
+  .size .L.data.230, 128
+.L.data.230:
+  .quad 0x61
+  .quad g3
+  .quad 0x62
+  .zero 104
+  .align 16
+  .type .L.data.228, @object
+  .size .L.data.228, 80
+.L.data.228:
+  .ascii "abc\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  .ascii "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  .align 16
+  .type .L.data.224, @object
+  .size .L.data.224, 160
+.L.data.224:
+  .quad 0x1
+  .zero 152
+  .align 16
+  .type .L.data.222, @object
+  .size .L.data.222, 160
+.L.data.222:
+  .quad 0x200000001
+  .zero 152
+  .align 16
+  .type cdup2, @object
+  .size cdup2, 16
+cdup2:
+  .quad 0x100000003, 0x100000004
+  .align 16
+  .type cdup1, @object
+  .size cdup1, 16
+cdup1:
+  .quad 0x100000003, 0x100000004
+  .align 8
+  .type cptr, @object
+  .size cptr, 8
+cptr:
+  .quad g6
+  .align 16
+  .type ctab, @object
+  .size ctab, 16
+ctab:
+  .quad 0x140000000a, 0x1e
+.data
+  .align 8
+  .type cmsg, @object
+  .size cmsg, 8
+cmsg:
+  .quad .L.data.1
+  .align 16
+  .type g7, @object
+  .size g7, 32
+g7:
+  .quad 0x61
+  .quad g3
+  .quad 0x62
+  .quad g3+8
+  .align 1
+  .type g6, @object
+  .size g6, 4
+g6:
+  .ascii "xyz\000"
+  .align 8
+  .type g5, @object
+  .size g5, 8
+g5:
+  .quad .L.data.0+1
+  .align 8
+  .type g4, @object
+  .size g4, 8
+g4:
+  .quad g3+4
+  .align 16
+  .type g3, @object
+  .size g3, 16
+g3:
+  .quad 0x200000001, 0x3
+.bss
+  .align 16
+  .type g2, @object
+  .size g2, 16
+g2:
+  .zero 16
+  .align 4
+  .type g1, @object
+  .size g1, 4
+g1:
+  .zero 4
+.text
+.globl assert
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-24], r12
+  mov [rbp-32], r13
+  mov [rbp-16], edi
+  mov [rbp-12], esi
+  mov [rbp-8], rdx
+  lea r10, [rbp-16]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-12]
+  movsx r11, dword ptr [r11]
+  cmp r10, r11
+  sete al
+  movzx r10, al
+  cmp r10, 0
+  je  .L.end.1
+  lea r10, [rip+.L.data.2]
+  lea r11, [rbp-8]
+  mov r11, [r11]
+  lea r12, [rbp-12]
+  movsx r12, dword ptr [r12]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call printf
+  mov r10, rax
+  mov r10, 1
+  mov rax, r10
+  jmp .L.return.assert
+.L.end.1:
+  lea r10, [rip+.L.data.3]
+  lea r11, [rbp-8]
+  mov r11, [r11]
+  lea r12, [rbp-16]
+  movsx r12, dword ptr [r12]
+  lea r13, [rbp-12]
+  movsx r13, dword ptr [r13]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rcx, r13
+  mov rax, 0
+  call printf
+  mov r10, rax
+  mov r10, 1
+  mov rdi, r10
+  mov rax, 0
+  call exit
+  mov r10, rax
+.L.return.assert:
+  mov r12, [rbp-24]
+  mov r13, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl ret3
+ret3:
+  push rbp
+  mov rbp, rsp
+  mov r10, 3
+  mov rax, r10
+  jmp .L.return.ret3
+  mov r10, 5
+  mov rax, r10
+  jmp .L.return.ret3
+.L.return.ret3:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl add2
+add2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], edi
+  mov [rbp-4], esi
+  lea r10, [rbp-8]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-4]
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.add2
+.L.return.add2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl sub2
+sub2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], edi
+  mov [rbp-4], esi
+  lea r10, [rbp-8]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-4]
+  movsx r11, dword ptr [r11]
+  sub r10, r11
+  mov rax, r10
+  jmp .L.return.sub2
+.L.return.sub2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl add5
+add5:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-20], edi
+  mov [rbp-16], esi
+  mov [rbp-12], edx
+  mov [rbp-8], ecx
+  mov [rbp-4], r8d
+  lea r10, [rbp-20]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-16]
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  lea r11, [rbp-12]
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  lea r11, [rbp-8]
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  lea r11, [rbp-4]
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.add5
+.L.return.add5:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl addx
+addx:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rdi
+  mov [rbp-12], esi
+  lea r10, [rbp-8]
+  mov r10, [r10]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-12]
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.addx
+.L.return.addx:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl sub_char
+sub_char:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-3], dil
+  mov [rbp-2], sil
+  mov [rbp-1], dl
+  lea r10, [rbp-3]
+  movsx r10, byte ptr [r10]
+  lea r11, [rbp-2]
+  movsx r11, byte ptr [r11]
+  sub r10, r11
+  lea r11, [rbp-1]
+  movsx r11, byte ptr [r11]
+  sub r10, r11
+  mov rax, r10
+  jmp .L.return.sub_char
+.L.return.sub_char:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl fib
+fib:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], r12
+  mov [rbp-4], edi
+  lea r10, [rbp-4]
+  movsx r10, dword ptr [r10]
+  mov r11, 1
+  cmp r10, r11
+  setle al
+  movzx r10, al
+  cmp r10, 0
+  je  .L.end.2
+  mov r10, 1
+  mov rax, r10
+  jmp .L.return.fib
+.L.end.2:
+  lea r10, [rbp-4]
+  movsx r10, dword ptr [r10]
+  mov r11, 1
+  sub r10, r11
+  mov rdi, r10
+  mov rax, 0
+  call fib
+  mov r10, rax
+  lea r11, [rbp-4]
+  movsx r11, dword ptr [r11]
+  mov r12, 2
+  sub r11, r12
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rax, 0
+  call fib
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.fib
+.L.return.fib:
+  mov r12, [rbp-16]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl store_twice
+store_twice:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov r10, 1
+  lea r11, [rbp-16]
+  mov r11, [r11]
+  mov [r11], r10d
+  mov r10, 2
+  lea r11, [rbp-8]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-16]
+  mov r10, [r10]
+  movsx r10, dword ptr [r10]
+  mov rax, r10
+  jmp .L.return.store_twice
+.L.return.store_twice:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl store_fields
+store_fields:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-24], r12
+  mov [rbp-8], rdi
+  mov r10, 3
+  lea r11, [rbp-16]
+  mov [r11], r10d
+  mov r10, 4
+  lea r11, [rbp-12]
+  mov [r11], r10d
+  mov r10, 5
+  lea r11, [rbp-8]
+  mov r11, [r11]
+  mov r12, 4
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-16]
+  movsx r10, dword ptr [r10]
+  mov r11, 10
+  imul r10, r11
+  lea r11, [rbp-12]
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.store_fields
+.L.return.store_fields:
+  mov r12, [rbp-24]
+  mov rsp, rbp
+  pop rbp
+  ret
+static_op.spec.2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-12], edi
+  mov r10, 3
+  lea r11, [rbp-4]
+  mov [r11], r10d
+  mov r10, 2
+  lea r11, [rbp-8]
+  mov [r11], r10d
+  lea r10, [rbp-8]
+  movsx r10, dword ptr [r10]
+  mov r11, 0
+  cmp r10, r11
+  sete al
+  movzx r10, al
+  cmp r10, 0
+  je  .L.end.3
+  lea r10, [rbp-12]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-4]
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.static_op.spec.2
+.L.end.3:
+  lea r10, [rbp-8]
+  movsx r10, dword ptr [r10]
+  mov r11, 1
+  cmp r10, r11
+  sete al
+  movzx r10, al
+  cmp r10, 0
+  je  .L.end.4
+  lea r10, [rbp-12]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-4]
+  movsx r11, dword ptr [r11]
+  sub r10, r11
+  mov rax, r10
+  jmp .L.return.static_op.spec.2
+.L.end.4:
+  lea r10, [rbp-12]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-4]
+  movsx r11, dword ptr [r11]
+  imul r10, r11
+  mov rax, r10
+  jmp .L.return.static_op.spec.2
+.L.return.static_op.spec.2:
+  mov rsp, rbp
+  pop rbp
+  ret
+static_op.spec.1:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-12], edi
+  mov [rbp-8], esi
+  mov r10, 0
+  lea r11, [rbp-4]
+  mov [r11], r10d
+  lea r10, [rbp-4]
+  movsx r10, dword ptr [r10]
+  mov r11, 0
+  cmp r10, r11
+  sete al
+  movzx r10, al
+  cmp r10, 0
+  je  .L.end.5
+  lea r10, [rbp-12]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-8]
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.static_op.spec.1
+.L.end.5:
+  lea r10, [rbp-4]
+  movsx r10, dword ptr [r10]
+  mov r11, 1
+  cmp r10, r11
+  sete al
+  movzx r10, al
+  cmp r10, 0
+  je  .L.end.6
+  lea r10, [rbp-12]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-8]
+  movsx r11, dword ptr [r11]
+  sub r10, r11
+  mov rax, r10
+  jmp .L.return.static_op.spec.1
+.L.end.6:
+  lea r10, [rbp-12]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-8]
+  movsx r11, dword ptr [r11]
+  imul r10, r11
+  mov rax, r10
+  jmp .L.return.static_op.spec.1
+.L.return.static_op.spec.1:
+  mov rsp, rbp
+  pop rbp
+  ret
+static_op.spec.0:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-12], edi
+  mov r10, 1
+  lea r11, [rbp-4]
+  mov [r11], r10d
+  mov r10, 1
+  lea r11, [rbp-8]
+  mov [r11], r10d
+  lea r10, [rbp-8]
+  movsx r10, dword ptr [r10]
+  mov r11, 0
+  cmp r10, r11
+  sete al
+  movzx r10, al
+  cmp r10, 0
+  je  .L.end.7
+  lea r10, [rbp-12]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-4]
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.static_op.spec.0
+.L.end.7:
+  lea r10, [rbp-8]
+  movsx r10, dword ptr [r10]
+  mov r11, 1
+  cmp r10, r11
+  sete al
+  movzx r10, al
+  cmp r10, 0
+  je  .L.end.8
+  lea r10, [rbp-12]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-4]
+  movsx r11, dword ptr [r11]
+  sub r10, r11
+  mov rax, r10
+  jmp .L.return.static_op.spec.0
+.L.end.8:
+  lea r10, [rbp-12]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-4]
+  movsx r11, dword ptr [r11]
+  imul r10, r11
+  mov rax, r10
+  jmp .L.return.static_op.spec.0
+.L.return.static_op.spec.0:
+  mov rsp, rbp
+  pop rbp
+  ret
+sum_to:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-12], edi
+  mov r10, 0
+  lea r11, [rbp-8]
+  mov [r11], r10d
+  mov r10, 1
+  lea r11, [rbp-4]
+  mov [r11], r10d
+.L.begin.9:
+  lea r10, [rbp-4]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-12]
+  movsx r11, dword ptr [r11]
+  cmp r10, r11
+  setle al
+  movzx r10, al
+  cmp r10, 0
+  je  .L.break.9
+  lea r10, [rbp-8]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-4]
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  lea r11, [rbp-8]
+  mov [r11], r10d
+.L.continue.9:
+  lea r10, [rbp-4]
+  movsx r10, dword ptr [r10]
+  mov r11, 1
+  add r10, r11
+  lea r11, [rbp-4]
+  mov [r11], r10d
+  lea r10, [rbp-4]
+  movsx r10, dword ptr [r10]
+  mov r11, 1
+  sub r10, r11
+  jmp .L.begin.9
+.L.break.9:
+  lea r10, [rbp-8]
+  movsx r10, dword ptr [r10]
+  mov rax, r10
+  jmp .L.return.sum_to
+.L.return.sum_to:
+  mov rsp, rbp
+  pop rbp
+  ret
+.set triangle, sum_to
+.globl aligned_locals
+aligned_locals:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-40], r12
+  mov r10, 1
+  lea r11, [rbp-7]
+  mov [r11], r10b
+  mov r10, 2
+  lea r11, [rbp-6]
+  mov [r11], r10b
+  mov r10, 3
+  lea r11, [rbp-5]
+  mov [r11], r10b
+  mov r10, 4
+  lea r11, [rbp-4]
+  mov [r11], r10d
+  mov r10, 5
+  lea r11, [rbp-32]
+  mov r12, 16
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-4]
+  mov r11, 4
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call is_aligned
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.12
+  lea r10, [rbp-32]
+  mov r11, 16
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call is_aligned
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.12
+  mov r10, 1
+  jmp .L.end.12
+.L.false.12:
+  mov r10, 0
+.L.end.12:
+  cmp r10, 0
+  je .L.false.11
+  lea r10, [rbp-7]
+  movsx r10, byte ptr [r10]
+  lea r11, [rbp-6]
+  movsx r11, byte ptr [r11]
+  add r10, r11
+  lea r11, [rbp-5]
+  movsx r11, byte ptr [r11]
+  add r10, r11
+  lea r11, [rbp-4]
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  lea r11, [rbp-32]
+  mov r12, 16
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  mov r11, 15
+  cmp r10, r11
+  sete al
+  movzx r10, al
+  cmp r10, 0
+  je .L.false.11
+  mov r10, 1
+  jmp .L.end.11
+.L.false.11:
+  mov r10, 0
+.L.end.11:
+  mov rax, r10
+  jmp .L.return.aligned_locals
+.L.return.aligned_locals:
+  mov r12, [rbp-40]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl sibling_blocks
+sibling_blocks:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-20], edi
+  mov r10, 0
+  lea r11, [rbp-16]
+  mov [r11], r10d
+  lea r10, [rbp-20]
+  movsx r10, dword ptr [r10]
+  cmp r10, 0
+  je  .L.else.13
+  mov r10, 3
+  lea r11, [rbp-12]
+  mov [r11], r10d
+  lea r10, [rbp-12]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-16]
+  mov [r11], r10d
+  jmp .L.end.13
+.L.else.13:
+  mov r10, 4
+  lea r11, [rbp-8]
+  mov [r11], r10d
+  lea r10, [rbp-8]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-16]
+  mov [r11], r10d
+.L.end.13:
+  lea r10, [rbp-16]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-4]
+  mov [r11], r10d
+  lea r10, [rbp-4]
+  movsx r10, dword ptr [r10]
+  mov r11, 1
+  add r10, r11
+  lea r11, [rbp-16]
+  mov [r11], r10d
+  lea r10, [rbp-16]
+  movsx r10, dword ptr [r10]
+  mov rax, r10
+  jmp .L.return.sibling_blocks
+.L.return.sibling_blocks:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl pooled_strings
+pooled_strings:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-32], r12
+  lea r10, [rip+.L.data.4]
+  lea r11, [rbp-24]
+  mov [r11], r10
+  lea r10, [rip+.L.data.5]
+  lea r11, [rbp-16]
+  mov [r11], r10
+  lea r10, [rip+.L.data.4]
+  lea r11, [rbp-8]
+  mov [r11], r10
+  lea r10, [rbp-24]
+  mov r10, [r10]
+  lea r11, [rbp-8]
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzx r10, al
+  lea r11, [rbp-16]
+  mov r11, [r11]
+  mov r12, 1
+  add r11, r12
+  movsx r11, byte ptr [r11]
+  mov r12, 112
+  cmp r11, r12
+  sete al
+  movzx r11, al
+  add r10, r11
+  lea r11, [rbp-24]
+  mov r11, [r11]
+  mov r12, 4
+  add r11, r12
+  movsx r11, byte ptr [r11]
+  mov r12, 0
+  cmp r11, r12
+  sete al
+  movzx r11, al
+  add r10, r11
+  lea r11, [rbp-16]
+  mov r11, [r11]
+  mov r12, 4
+  add r11, r12
+  movsx r11, byte ptr [r11]
+  mov r12, 108
+  cmp r11, r12
+  sete al
+  movzx r11, al
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.pooled_strings
+.L.return.pooled_strings:
+  mov r12, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl make_small
+make_small:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-4], edi
+  lea r10, [rbp-4]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-7]
+  add r11, 0
+  mov [r11], r10b
+  lea r10, [rbp-4]
+  movsx r10, dword ptr [r10]
+  mov r11, 1
+  add r10, r11
+  lea r11, [rbp-7]
+  add r11, 1
+  mov [r11], r10b
+  lea r10, [rbp-4]
+  movsx r10, dword ptr [r10]
+  mov r11, 2
+  add r10, r11
+  lea r11, [rbp-7]
+  add r11, 2
+  mov [r11], r10b
+  lea r10, [rbp-7]
+  movzx eax, byte ptr [r10+2]
+  movzx ecx, word ptr [r10+0]
+  shl rax, 16
+  or rax, rcx
+  jmp .L.return.make_small
+.L.return.make_small:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl diff_small
+diff_small:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-10+0], di
+  shr rdi, 16
+  mov [rbp-10+2], dil
+  mov [rbp-7+0], si
+  shr rsi, 16
+  mov [rbp-7+2], sil
+  lea r10, [rbp-7]
+  add r10, 0
+  movsx r10, byte ptr [r10]
+  lea r11, [rbp-10]
+  add r11, 0
+  movsx r11, byte ptr [r11]
+  sub r10, r11
+  lea r11, [rbp-4]
+  mov [r11], r10d
+  lea r10, [rbp-4]
+  movsx r10, dword ptr [r10]
+  mov r11, 10
+  imul r10, r11
+  lea r11, [rbp-7]
+  add r11, 1
+  movsx r11, byte ptr [r11]
+  add r10, r11
+  lea r11, [rbp-10]
+  add r11, 1
+  movsx r11, byte ptr [r11]
+  sub r10, r11
+  mov r11, 1
+  sub r10, r11
+  lea r11, [rbp-4]
+  mov [r11], r10d
+  lea r10, [rbp-4]
+  movsx r10, dword ptr [r10]
+  mov r11, 10
+  imul r10, r11
+  lea r11, [rbp-7]
+  add r11, 2
+  movsx r11, byte ptr [r11]
+  add r10, r11
+  lea r11, [rbp-10]
+  add r11, 2
+  movsx r11, byte ptr [r11]
+  sub r10, r11
+  lea r11, [rbp-4]
+  mov [r11], r10d
+  lea r10, [rbp-10]
+  add r10, 0
+  movsx r10, byte ptr [r10]
+  lea r11, [rbp-7]
+  add r11, 0
+  movsx r11, byte ptr [r11]
+  cmp r11, r10
+  setl al
+  movzx r10, al
+  cmp r10, 0
+  jne .L.true.16
+  lea r10, [rbp-10]
+  add r10, 1
+  movsx r10, byte ptr [r10]
+  lea r11, [rbp-7]
+  add r11, 1
+  movsx r11, byte ptr [r11]
+  cmp r11, r10
+  setl al
+  movzx r10, al
+  cmp r10, 0
+  jne .L.true.16
+  mov r10, 0
+  jmp .L.end.16
+.L.true.16:
+  mov r10, 1
+.L.end.16:
+  cmp r10, 0
+  jne .L.true.15
+  lea r10, [rbp-10]
+  add r10, 2
+  movsx r10, byte ptr [r10]
+  lea r11, [rbp-7]
+  add r11, 2
+  movsx r11, byte ptr [r11]
+  cmp r11, r10
+  setl al
+  movzx r10, al
+  cmp r10, 0
+  jne .L.true.15
+  mov r10, 0
+  jmp .L.end.15
+.L.true.15:
+  mov r10, 1
+.L.end.15:
+  cmp r10, 0
+  je  .L.end.14
+  mov r10, 0
+  lea r11, [rbp-4]
+  movsx r11, dword ptr [r11]
+  sub r10, r11
+  mov rax, r10
+  jmp .L.return.diff_small
+.L.end.14:
+  lea r10, [rbp-4]
+  movsx r10, dword ptr [r10]
+  mov r11, 10
+  imul r10, r11
+  lea r11, [rbp-10]
+  add r11, 1
+  movsx r11, byte ptr [r11]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.diff_small
+.L.return.diff_small:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl diff_made
+diff_made:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-40], r12
+  mov [rbp-16], edi
+  mov [rbp-12], esi
+  lea r10, [rbp-16]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-4]
+  mov [r11], r10d
+  lea r10, [rbp-4]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-25]
+  add r11, 0
+  mov [r11], r10b
+  lea r10, [rbp-4]
+  movsx r10, dword ptr [r10]
+  mov r11, 1
+  add r10, r11
+  lea r11, [rbp-25]
+  add r11, 1
+  mov [r11], r10b
+  lea r10, [rbp-4]
+  movsx r10, dword ptr [r10]
+  mov r11, 2
+  add r10, r11
+  lea r11, [rbp-25]
+  add r11, 2
+  mov [r11], r10b
+  lea r10, [rbp-25]
+  lea r11, [rbp-22]
+  mov ax, [r10+0]
+  mov [r11+0], ax
+  mov ax, [r10+1]
+  mov [r11+1], ax
+  mov r10, r11
+  lea r11, [rbp-12]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-8]
+  mov [r12], r11d
+  lea r11, [rbp-8]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-25]
+  add r12, 0
+  mov [r12], r11b
+  lea r11, [rbp-8]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-25]
+  add r12, 1
+  mov [r12], r11b
+  lea r11, [rbp-8]
+  movsx r11, dword ptr [r11]
+  mov r12, 2
+  add r11, r12
+  lea r12, [rbp-25]
+  add r12, 2
+  mov [r12], r11b
+  lea r11, [rbp-25]
+  lea r12, [rbp-19]
+  mov ax, [r11+0]
+  mov [r12+0], ax
+  mov ax, [r11+1]
+  mov [r12+1], ax
+  mov r11, r12
+  movzx edi, byte ptr [r10+2]
+  movzx eax, word ptr [r10+0]
+  shl rdi, 16
+  or rdi, rax
+  movzx esi, byte ptr [r11+2]
+  movzx eax, word ptr [r11+0]
+  shl rsi, 16
+  or rsi, rax
+  mov rax, 0
+  call diff_small
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.diff_made
+.L.return.diff_made:
+  mov r12, [rbp-40]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl sum_small
+sum_small:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-3+0], di
+  shr rdi, 16
+  mov [rbp-3+2], dil
+  lea r10, [rbp-3]
+  add r10, 0
+  movsx r10, byte ptr [r10]
+  lea r11, [rbp-3]
+  add r11, 1
+  movsx r11, byte ptr [r11]
+  add r10, r11
+  lea r11, [rbp-3]
+  add r11, 2
+  movsx r11, byte ptr [r11]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.sum_small
+.L.return.sum_small:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl make_big
+make_big:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-72], r12
+  mov [rbp-80], r13
+  mov [rbp-64], rdi
+  mov [rbp-16], esi
+  lea r10, [rbp-56]
+  add r10, 0
+  lea r11, [rbp-8]
+  mov [r11], r10
+  mov r10, 0
+  lea r11, [rbp-12]
+  mov [r11], r10d
+.L.begin.17:
+  lea r10, [rbp-12]
+  movsx r10, dword ptr [r10]
+  mov r11, 10
+  cmp r10, r11
+  setl al
+  movzx r10, al
+  cmp r10, 0
+  je  .L.break.17
+  lea r10, [rbp-16]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-12]
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  lea r11, [rbp-8]
+  mov r11, [r11]
+  lea r12, [rbp-12]
+  movsx r12, dword ptr [r12]
+  mov r13, 4
+  imul r12, r13
+  add r11, r12
+  mov [r11], r10d
+.L.continue.17:
+  lea r10, [rbp-12]
+  movsx r10, dword ptr [r10]
+  mov r11, 1
+  add r10, r11
+  lea r11, [rbp-12]
+  mov [r11], r10d
+  lea r10, [rbp-12]
+  movsx r10, dword ptr [r10]
+  mov r11, 1
+  sub r10, r11
+  jmp .L.begin.17
+.L.break.17:
+  lea r10, [rbp-56]
+  mov rdx, [rbp-64]
+  movups xmm0, [r10+0]
+  movups [rdx+0], xmm0
+  movups xmm0, [r10+16]
+  movups [rdx+16], xmm0
+  movups xmm0, [r10+24]
+  movups [rdx+24], xmm0
+  mov rax, rdx
+  jmp .L.return.make_big
+.L.return.make_big:
+  mov r12, [rbp-72]
+  mov r13, [rbp-80]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl sum_big
+sum_big:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-72], r12
+  mov [rbp-80], r13
+  mov [rbp-63+0], di
+  shr rdi, 16
+  mov [rbp-63+2], dil
+  mov [rbp-20], esi
+  movups xmm0, [rbp+16+0+0]
+  movups [rbp-60+0], xmm0
+  movups xmm0, [rbp+16+0+16]
+  movups [rbp-60+16], xmm0
+  movups xmm0, [rbp+16+0+24]
+  movups [rbp-60+24], xmm0
+  lea r10, [rbp-60]
+  add r10, 0
+  lea r11, [rbp-8]
+  mov [r11], r10
+  lea r10, [rbp-63]
+  add r10, 2
+  movsx r10, byte ptr [r10]
+  lea r11, [rbp-20]
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  lea r11, [rbp-16]
+  mov [r11], r10d
+  mov r10, 0
+  lea r11, [rbp-12]
+  mov [r11], r10d
+.L.begin.18:
+  lea r10, [rbp-12]
+  movsx r10, dword ptr [r10]
+  mov r11, 10
+  cmp r10, r11
+  setl al
+  movzx r10, al
+  cmp r10, 0
+  je  .L.break.18
+  lea r10, [rbp-16]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-8]
+  mov r11, [r11]
+  lea r12, [rbp-12]
+  movsx r12, dword ptr [r12]
+  mov r13, 4
+  imul r12, r13
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  lea r11, [rbp-16]
+  mov [r11], r10d
+.L.continue.18:
+  lea r10, [rbp-12]
+  movsx r10, dword ptr [r10]
+  mov r11, 1
+  add r10, r11
+  lea r11, [rbp-12]
+  mov [r11], r10d
+  lea r10, [rbp-12]
+  movsx r10, dword ptr [r10]
+  mov r11, 1
+  sub r10, r11
+  jmp .L.begin.18
+.L.break.18:
+  lea r10, [rbp-16]
+  movsx r10, dword ptr [r10]
+  mov rax, r10
+  jmp .L.return.sum_big
+.L.return.sum_big:
+  mov r12, [rbp-72]
+  mov r13, [rbp-80]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl const_index
+const_index:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], r12
+  mov [rbp-4], edi
+  lea r10, [rip+ctab]
+  lea r11, [rbp-4]
+  movsx r11, dword ptr [r11]
+  mov r12, 4
+  imul r11, r12
+  add r10, r11
+  movsx r10, dword ptr [r10]
+  mov rax, r10
+  jmp .L.return.const_index
+.L.return.const_index:
+  mov r12, [rbp-16]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl cdup_sum
+cdup_sum:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-16], r12
+  mov [rbp-24], r13
+  mov [rbp-4], edi
+  lea r10, [rip+cdup1]
+  lea r11, [rbp-4]
+  movsx r11, dword ptr [r11]
+  mov r12, 4
+  imul r11, r12
+  add r10, r11
+  movsx r10, dword ptr [r10]
+  mov r11, 10
+  imul r10, r11
+  lea r11, [rip+cdup2]
+  lea r12, [rbp-4]
+  movsx r12, dword ptr [r12]
+  mov r13, 4
+  imul r12, r13
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.cdup_sum
+.L.return.cdup_sum:
+  mov r12, [rbp-16]
+  mov r13, [rbp-24]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl restrict_store
+restrict_store:
+  jmp store_twice
+.globl restrict_sum
+restrict_sum:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-32], r12
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov [rbp-24], edx
+  mov r10, 0
+  lea r11, [rbp-20]
+  mov [r11], r10d
+.L.begin.19:
+  lea r10, [rbp-20]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-24]
+  movsx r11, dword ptr [r11]
+  cmp r10, r11
+  setl al
+  movzx r10, al
+  cmp r10, 0
+  je  .L.break.19
+  lea r10, [rbp-8]
+  mov r10, [r10]
+  mov r11, 4
+  add r10, r11
+  lea r11, [rbp-8]
+  mov [r11], r10
+  lea r10, [rbp-8]
+  mov r10, [r10]
+  mov r11, 4
+  sub r10, r11
+  movsx r10, dword ptr [r10]
+  mov r11, 2
+  imul r10, r11
+  lea r11, [rbp-16]
+  mov r11, [r11]
+  mov r12, 4
+  add r11, r12
+  lea r12, [rbp-16]
+  mov [r12], r11
+  lea r11, [rbp-16]
+  mov r11, [r11]
+  mov r12, 4
+  sub r11, r12
+  mov [r11], r10d
+.L.continue.19:
+  lea r10, [rbp-20]
+  movsx r10, dword ptr [r10]
+  mov r11, 1
+  add r10, r11
+  lea r11, [rbp-20]
+  mov [r11], r10d
+  lea r10, [rbp-20]
+  movsx r10, dword ptr [r10]
+  mov r11, 1
+  sub r10, r11
+  jmp .L.begin.19
+.L.break.19:
+  lea r10, [rbp-16]
+  mov r10, [r10]
+  mov r11, -4
+  add r10, r11
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-8]
+  mov r11, [r11]
+  mov r12, -4
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.restrict_sum
+.L.return.restrict_sum:
+  mov r12, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl set_through
+set_through:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rdi
+  mov r10, 3
+  lea r11, [rbp-8]
+  mov r11, [r11]
+  mov [r11], r10d
+  mov r10, 0
+  mov rax, r10
+  jmp .L.return.set_through
+.L.return.set_through:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl realigned_callee
+realigned_callee:
+  mov rax, rsp
+  and rsp, -64
+  push rax
+  push rbp
+  mov rbp, rsp
+  sub rsp, 176
+  mov [rbp-4], edi
+  lea r10, [rbp-4]
+  movsx r10, dword ptr [r10]
+  cmp r10, 0
+  je  .L.end.20
+  mov r10, 0
+  mov rax, r10
+  jmp .L.return.realigned_callee
+.L.end.20:
+  mov r10, 5
+  mov rax, r10
+  jmp .L.return.realigned_callee
+.L.return.realigned_callee:
+  mov rsp, rbp
+  pop rbp
+  pop rsp
+  ret
+.globl main
+main:
+  mov rax, rsp
+  and rsp, -64
+  push rax
+  push rbp
+  mov rbp, rsp
+  sub rsp, 480
+  mov [rbp-448], r12
+  mov [rbp-456], r13
+  mov [rbp-464], r14
+  mov [rbp-472], r15
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rip+.L.data.6]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 42
+  mov r11, 42
+  lea r12, [rip+.L.data.7]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 21
+  mov r11, 21
+  lea r12, [rip+.L.data.8]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 41
+  mov r11, 41
+  lea r12, [rip+.L.data.9]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 47
+  mov r11, 47
+  lea r12, [rip+.L.data.10]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 15
+  mov r11, 15
+  lea r12, [rip+.L.data.11]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  mov r11, 4
+  lea r12, [rip+.L.data.12]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 10
+  mov r11, 10
+  lea r12, [rip+.L.data.13]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 10
+  mov r11, 10
+  lea r12, [rip+.L.data.14]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 10
+  mov r11, 10
+  lea r12, [rip+.L.data.15]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rip+.L.data.16]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rip+.L.data.17]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rip+.L.data.18]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rip+.L.data.19]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rip+.L.data.20]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rip+.L.data.21]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rip+.L.data.22]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rip+.L.data.23]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rip+.L.data.24]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rip+.L.data.25]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rip+.L.data.26]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rip+.L.data.27]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rip+.L.data.28]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rip+.L.data.29]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rip+.L.data.30]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rip+.L.data.31]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.32]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.33]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 8
+  mov r11, 3
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 5
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-232]
+  movsx r12, dword ptr [r12]
+  add r11, r12
+  lea r12, [rip+.L.data.34]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.33]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 8
+  mov r11, 3
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 5
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-232]
+  movsx r12, dword ptr [r12]
+  add r11, r12
+  lea r12, [rip+.L.data.34]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 6
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-232]
+  movsx r12, dword ptr [r12]
+  add r11, r12
+  lea r12, [rip+.L.data.35]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.36]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 8
+  mov r11, 3
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 5
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-232]
+  movsx r12, dword ptr [r12]
+  add r11, r12
+  lea r12, [rip+.L.data.37]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.38]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.39]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.40]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.41]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 55
+  mov r11, 0
+  lea r12, [rbp-128]
+  mov [r12], r11d
+  mov r11, 0
+  lea r12, [rbp-124]
+  mov [r12], r11d
+  mov r11, 0
+  lea r12, [rbp-128]
+  mov [r12], r11d
+.L.begin.21:
+  lea r11, [rbp-128]
+  movsx r11, dword ptr [r11]
+  mov r12, 10
+  cmp r11, r12
+  setle al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.break.21
+  lea r11, [rbp-128]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-124]
+  movsx r12, dword ptr [r12]
+  add r11, r12
+  lea r12, [rbp-124]
+  mov [r12], r11d
+.L.continue.21:
+  lea r11, [rbp-128]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-128]
+  mov [r12], r11d
+  jmp .L.begin.21
+.L.break.21:
+  lea r11, [rbp-124]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.42]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 10
+  mov r11, 0
+  lea r12, [rbp-120]
+  mov [r12], r11d
+.L.begin.22:
+  lea r11, [rbp-120]
+  movsx r11, dword ptr [r11]
+  mov r12, 10
+  cmp r11, r12
+  setl al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.break.22
+  lea r11, [rbp-120]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-120]
+  mov [r12], r11d
+.L.continue.22:
+  jmp .L.begin.22
+.L.break.22:
+  lea r11, [rbp-120]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.43]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 1
+  mov r11, 2
+  mov r11, 3
+  lea r12, [rip+.L.data.44]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 10
+  mov r11, 0
+  lea r12, [rbp-116]
+  mov [r12], r11d
+.L.begin.23:
+  lea r11, [rbp-116]
+  movsx r11, dword ptr [r11]
+  mov r12, 10
+  cmp r11, r12
+  setl al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.break.23
+  lea r11, [rbp-116]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-116]
+  mov [r12], r11d
+.L.continue.23:
+  jmp .L.begin.23
+.L.break.23:
+  lea r11, [rbp-116]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.43]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 55
+  mov r11, 0
+  lea r12, [rbp-112]
+  mov [r12], r11d
+  mov r11, 0
+  lea r12, [rbp-108]
+  mov [r12], r11d
+.L.begin.24:
+  lea r11, [rbp-112]
+  movsx r11, dword ptr [r11]
+  mov r12, 10
+  cmp r11, r12
+  setle al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.break.24
+  lea r11, [rbp-112]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-108]
+  movsx r12, dword ptr [r12]
+  add r11, r12
+  lea r12, [rbp-108]
+  mov [r12], r11d
+  lea r11, [rbp-112]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-112]
+  mov [r12], r11d
+.L.continue.24:
+  jmp .L.begin.24
+.L.break.24:
+  lea r11, [rbp-108]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.45]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.46]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 3
+  lea r12, [rbp-252]
+  mov [r12], r11d
+  lea r11, [rbp-252]
+  lea r12, [rbp-248]
+  mov [r12], r11
+  lea r11, [rbp-248]
+  lea r12, [rbp-240]
+  mov [r12], r11
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  mov r11, [r11]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.47]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  mov r11, 3
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 5
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  mov r12, 4
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.48]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 3
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 5
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  mov r12, 4
+  sub r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.49]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  mov r11, 3
+  lea r12, [rbp-244]
+  mov [r12], r11d
+  lea r11, [rbp-244]
+  lea r12, [rbp-240]
+  mov [r12], r11
+  mov r11, 5
+  lea r12, [rbp-240]
+  mov r12, [r12]
+  mov [r12], r11d
+  lea r11, [rbp-244]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.50]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 7
+  mov r11, 3
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 5
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  mov r11, 7
+  lea r12, [rbp-236]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.51]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 7
+  mov r11, 3
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 5
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  mov r11, 7
+  lea r12, [rbp-232]
+  mov r13, 4
+  sub r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.52]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  mov r12, 8
+  add r11, r12
+  lea r12, [rbp-232]
+  sub r11, r12
+  mov r12, 4
+  mov rax, r11
+  cqo
+  idiv r12
+  mov r11, rax
+  lea r12, [rip+.L.data.53]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 8
+  mov r11, 3
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 5
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-232]
+  movsx r12, dword ptr [r12]
+  add r11, r12
+  lea r12, [rip+.L.data.54]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 8
+  mov r11, 3
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 5
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-232]
+  movsx r12, dword ptr [r12]
+  add r11, r12
+  lea r12, [rip+.L.data.55]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  push r10
+  sub rsp, 8
+  mov rax, 0
+  call ret3
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.56]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 8
+  mov r11, 3
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 5
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-232]
+  movsx r12, dword ptr [r12]
+  add r11, r12
+  lea r12, [rip+.L.data.57]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 5
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-232]
+  movsx r12, dword ptr [r12]
+  sub r11, r12
+  lea r12, [rip+.L.data.58]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 15
+  mov r11, 1
+  mov r12, 2
+  mov r13, 3
+  mov r14, 4
+  mov r15, 5
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rsi, r12
+  mov rdx, r13
+  mov rcx, r14
+  mov r8, r15
+  mov rax, 0
+  call add5
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.59]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 7
+  mov r11, 3
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 4
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-232]
+  movsx r12, dword ptr [r12]
+  add r11, r12
+  lea r12, [rip+.L.data.60]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 4
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-232]
+  movsx r12, dword ptr [r12]
+  sub r11, r12
+  lea r12, [rip+.L.data.61]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 55
+  mov r11, 9
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rax, 0
+  call fib
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.62]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  lea r11, [rbp-248]
+  lea r12, [rbp-240]
+  mov [r12], r11
+  mov r11, 3
+  lea r12, [rbp-240]
+  mov r12, [r12]
+  mov [r12], r11d
+  lea r11, [rbp-248]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.63]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 3
+  lea r12, [rbp-240]
+  mov [r12], r11d
+  mov r11, 4
+  lea r12, [rbp-240]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 5
+  lea r12, [rbp-240]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-240]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.64]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  mov r11, 3
+  lea r12, [rbp-240]
+  mov [r12], r11d
+  mov r11, 4
+  lea r12, [rbp-240]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 5
+  lea r12, [rbp-240]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-240]
+  mov r12, 4
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.65]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  mov r11, 3
+  lea r12, [rbp-240]
+  mov [r12], r11d
+  mov r11, 4
+  lea r12, [rbp-240]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 5
+  lea r12, [rbp-240]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-240]
+  mov r12, 8
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.66]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  lea r11, [rbp-256]
+  lea r12, [rbp-264]
+  mov [r12], r11
+  mov r11, 0
+  lea r12, [rbp-264]
+  mov r12, [r12]
+  mov [r12], r11d
+  lea r11, [rbp-256]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.67]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  lea r11, [rbp-256]
+  lea r12, [rbp-264]
+  mov [r12], r11
+  mov r11, 1
+  lea r12, [rbp-264]
+  mov r12, [r12]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-256]
+  mov r12, 4
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.68]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  lea r11, [rbp-256]
+  lea r12, [rbp-264]
+  mov [r12], r11
+  mov r11, 2
+  lea r12, [rbp-264]
+  mov r12, [r12]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-256]
+  mov r12, 8
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.69]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  lea r11, [rbp-256]
+  lea r12, [rbp-264]
+  mov [r12], r11
+  mov r11, 3
+  lea r12, [rbp-264]
+  mov r12, [r12]
+  mov r13, 12
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-256]
+  mov r12, 12
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.70]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  lea r11, [rbp-256]
+  lea r12, [rbp-264]
+  mov [r12], r11
+  mov r11, 4
+  lea r12, [rbp-264]
+  mov r12, [r12]
+  mov r13, 16
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-256]
+  mov r12, 12
+  add r11, r12
+  mov r12, 4
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.71]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  lea r11, [rbp-256]
+  lea r12, [rbp-264]
+  mov [r12], r11
+  mov r11, 5
+  lea r12, [rbp-264]
+  mov r12, [r12]
+  mov r13, 20
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-256]
+  mov r12, 12
+  add r11, r12
+  mov r12, 8
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.72]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 3
+  lea r12, [rbp-240]
+  mov [r12], r11d
+  mov r11, 4
+  lea r12, [rbp-240]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 5
+  lea r12, [rbp-240]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-240]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.73]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  mov r11, 3
+  lea r12, [rbp-240]
+  mov [r12], r11d
+  mov r11, 4
+  lea r12, [rbp-240]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 5
+  lea r12, [rbp-240]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-240]
+  mov r12, 4
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.74]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  mov r11, 3
+  lea r12, [rbp-240]
+  mov [r12], r11d
+  mov r11, 4
+  lea r12, [rbp-240]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 5
+  lea r12, [rbp-240]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-240]
+  mov r12, 8
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.75]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  mov r11, 3
+  lea r12, [rbp-240]
+  mov [r12], r11d
+  mov r11, 4
+  lea r12, [rbp-240]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 5
+  lea r12, [rbp-240]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-240]
+  mov r12, 8
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.75]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  lea r11, [rbp-256]
+  lea r12, [rbp-264]
+  mov [r12], r11
+  mov r11, 0
+  lea r12, [rbp-264]
+  mov r12, [r12]
+  mov [r12], r11d
+  lea r11, [rbp-256]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.76]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  lea r11, [rbp-256]
+  lea r12, [rbp-264]
+  mov [r12], r11
+  mov r11, 1
+  lea r12, [rbp-264]
+  mov r12, [r12]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-256]
+  mov r12, 4
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.77]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  lea r11, [rbp-256]
+  lea r12, [rbp-264]
+  mov [r12], r11
+  mov r11, 2
+  lea r12, [rbp-264]
+  mov r12, [r12]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-256]
+  mov r12, 8
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.78]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  lea r11, [rbp-256]
+  lea r12, [rbp-264]
+  mov [r12], r11
+  mov r11, 3
+  lea r12, [rbp-264]
+  mov r12, [r12]
+  mov r13, 12
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-256]
+  mov r12, 12
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.79]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  lea r11, [rbp-256]
+  lea r12, [rbp-264]
+  mov [r12], r11
+  mov r11, 4
+  lea r12, [rbp-264]
+  mov r12, [r12]
+  mov r13, 16
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-256]
+  mov r12, 12
+  add r11, r12
+  mov r12, 4
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.80]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  lea r11, [rbp-256]
+  lea r12, [rbp-264]
+  mov [r12], r11
+  mov r11, 5
+  lea r12, [rbp-264]
+  mov r12, [r12]
+  mov r13, 20
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-256]
+  mov r12, 12
+  add r11, r12
+  mov r12, 8
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.81]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  mov r11, 4
+  lea r12, [rip+.L.data.82]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  mov r11, 4
+  lea r12, [rip+.L.data.83]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 8
+  mov r11, 8
+  lea r12, [rip+.L.data.84]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 16
+  mov r11, 16
+  lea r12, [rip+.L.data.85]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 48
+  mov r11, 48
+  lea r12, [rip+.L.data.86]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 16
+  mov r11, 16
+  lea r12, [rip+.L.data.87]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  mov r11, 4
+  lea r12, [rip+.L.data.88]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  mov r11, 5
+  lea r12, [rip+.L.data.89]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  mov r11, 5
+  lea r12, [rip+.L.data.90]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  mov r11, 4
+  lea r12, [rip+.L.data.91]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  mov r11, 1
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  mov r11, 4
+  lea r12, [rip+.L.data.92]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  mov r11, 4
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.93]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  movsx r11, dword ptr [rip+g1]
+  lea r12, [rip+.L.data.94]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 3
+  mov [rip+g1], r11d
+  movsx r11, dword ptr [rip+g1]
+  lea r12, [rip+.L.data.95]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rip+g2]
+  mov [r12], r11d
+  mov r11, 1
+  lea r12, [rip+g2]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 2
+  lea r12, [rip+g2]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rip+g2]
+  mov r13, 12
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rip+g2]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.96]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 0
+  lea r12, [rip+g2]
+  mov [r12], r11d
+  mov r11, 1
+  lea r12, [rip+g2]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 2
+  lea r12, [rip+g2]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rip+g2]
+  mov r13, 12
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rip+g2]
+  mov r12, 4
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.97]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 0
+  lea r12, [rip+g2]
+  mov [r12], r11d
+  mov r11, 1
+  lea r12, [rip+g2]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 2
+  lea r12, [rip+g2]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rip+g2]
+  mov r13, 12
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rip+g2]
+  mov r12, 8
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.98]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 0
+  lea r12, [rip+g2]
+  mov [r12], r11d
+  mov r11, 1
+  lea r12, [rip+g2]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 2
+  lea r12, [rip+g2]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rip+g2]
+  mov r13, 12
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rip+g2]
+  mov r12, 12
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.99]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  mov r11, 4
+  lea r12, [rip+.L.data.100]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 16
+  mov r11, 16
+  lea r12, [rip+.L.data.101]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rbp-227]
+  mov [r12], r11b
+  lea r11, [rbp-227]
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.102]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rbp-228]
+  mov [r12], r11b
+  mov r11, 2
+  lea r12, [rbp-227]
+  mov [r12], r11b
+  lea r11, [rbp-228]
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.103]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 1
+  lea r12, [rbp-228]
+  mov [r12], r11b
+  mov r11, 2
+  lea r12, [rbp-227]
+  mov [r12], r11b
+  lea r11, [rbp-227]
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.104]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rip+.L.data.105]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 10
+  mov r11, 10
+  lea r12, [rip+.L.data.106]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 7
+  lea r12, [rbp-229]
+  mov [r12], r11b
+  mov r11, 3
+  lea r12, [rbp-228]
+  mov [r12], r11b
+  mov r11, 3
+  lea r12, [rbp-227]
+  mov [r12], r11b
+  lea r11, [rbp-229]
+  movsx r11, byte ptr [r11]
+  lea r12, [rbp-228]
+  movsx r12, byte ptr [r12]
+  sub r11, r12
+  lea r12, [rbp-227]
+  movsx r12, byte ptr [r12]
+  sub r11, r12
+  lea r12, [rip+.L.data.107]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 97
+  lea r11, [rip+.L.data.0]
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.108]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 98
+  lea r11, [rip+.L.data.0]
+  mov r12, 1
+  add r11, r12
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.109]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 99
+  lea r11, [rip+.L.data.0]
+  mov r12, 2
+  add r11, r12
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.110]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  lea r11, [rip+.L.data.0]
+  mov r12, 3
+  add r11, r12
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.111]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  mov r11, 4
+  lea r12, [rip+.L.data.112]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.113]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 2
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rbp-240]
+  mov [r12], r11d
+  mov r11, 4
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.114]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.115]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 2
+  lea r12, [rbp-236]
+  add r12, 0
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rbp-236]
+  add r12, 4
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  add r11, 0
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.116]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 2
+  lea r12, [rbp-236]
+  add r12, 0
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rbp-236]
+  add r12, 4
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  add r11, 4
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.117]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rbp-240]
+  add r12, 0
+  mov [r12], r11b
+  mov r11, 2
+  lea r12, [rbp-240]
+  add r12, 4
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rbp-240]
+  add r12, 8
+  mov [r12], r11b
+  lea r11, [rbp-240]
+  add r11, 0
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.118]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 1
+  lea r12, [rbp-240]
+  add r12, 4
+  mov [r12], r11d
+  mov r11, 2
+  lea r12, [rbp-240]
+  add r12, 4
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rbp-240]
+  add r12, 8
+  mov [r12], r11b
+  lea r11, [rbp-240]
+  add r11, 4
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.119]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 1
+  lea r12, [rbp-240]
+  add r12, 0
+  mov [r12], r11b
+  mov r11, 2
+  lea r12, [rbp-240]
+  add r12, 4
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rbp-240]
+  add r12, 8
+  mov [r12], r11b
+  lea r11, [rbp-240]
+  add r11, 8
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.120]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  lea r11, [rbp-256]
+  lea r12, [rbp-264]
+  mov [r12], r11
+  mov r11, 0
+  lea r12, [rbp-264]
+  mov r12, [r12]
+  mov [r12], r11d
+  lea r11, [rbp-256]
+  add r11, 0
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.121]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  lea r11, [rbp-256]
+  lea r12, [rbp-264]
+  mov [r12], r11
+  mov r11, 1
+  lea r12, [rbp-264]
+  mov r12, [r12]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-256]
+  add r11, 4
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.122]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  lea r11, [rbp-256]
+  lea r12, [rbp-264]
+  mov [r12], r11
+  mov r11, 2
+  lea r12, [rbp-264]
+  mov r12, [r12]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-256]
+  mov r12, 8
+  add r11, r12
+  add r11, 0
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.123]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  lea r11, [rbp-256]
+  lea r12, [rbp-264]
+  mov [r12], r11
+  mov r11, 3
+  lea r12, [rbp-264]
+  mov r12, [r12]
+  mov r13, 12
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-256]
+  mov r12, 8
+  add r11, r12
+  add r11, 4
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.124]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  mov r11, 4
+  lea r12, [rip+.L.data.125]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 8
+  mov r11, 8
+  lea r12, [rip+.L.data.126]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 12
+  mov r11, 12
+  lea r12, [rip+.L.data.127]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 16
+  mov r11, 16
+  lea r12, [rip+.L.data.128]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 24
+  mov r11, 24
+  lea r12, [rip+.L.data.129]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 2
+  lea r12, [rip+.L.data.130]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 8
+  mov r11, 8
+  lea r12, [rip+.L.data.131]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 8
+  mov r11, 8
+  lea r12, [rip+.L.data.132]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 2
+  lea r12, [rip+.L.data.133]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 1
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-232]
+  movsx r12, dword ptr [r12]
+  add r11, r12
+  lea r12, [rip+.L.data.134]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  lea r11, [rbp-241]
+  lea r12, [rbp-240]
+  mov [r12], r11
+  mov r11, 3
+  lea r12, [rbp-241]
+  add r12, 0
+  mov [r12], r11b
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  add r11, 0
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.135]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  lea r11, [rbp-241]
+  lea r12, [rbp-240]
+  mov [r12], r11
+  mov r11, 3
+  lea r12, [rbp-240]
+  mov r12, [r12]
+  add r12, 0
+  mov [r12], r11b
+  lea r11, [rbp-241]
+  add r11, 0
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.136]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 8
+  mov r11, 8
+  lea r12, [rip+.L.data.137]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 8
+  mov r11, 8
+  lea r12, [rip+.L.data.138]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.139]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.140]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.141]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.142]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.143]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 97
+  mov r11, 97
+  lea r12, [rip+.L.data.144]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 10
+  mov r11, 10
+  lea r12, [rip+.L.data.145]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  mov r11, 4
+  lea r12, [rip+.L.data.146]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rbp-227]
+cmp r11, 0
+setne r11b
+movzx r11, r11b
+  mov [r12], r11b
+  lea r11, [rbp-227]
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.147]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rbp-227]
+cmp r11, 0
+setne r11b
+movzx r11, r11b
+  mov [r12], r11b
+  lea r11, [rbp-227]
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.148]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 2
+  lea r12, [rbp-227]
+cmp r11, 0
+setne r11b
+movzx r11, r11b
+  mov [r12], r11b
+  lea r11, [rbp-227]
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.149]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rip+.L.data.150]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rip+.L.data.151]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 2
+  lea r12, [rip+.L.data.152]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  mov r11, 4
+  lea r12, [rip+.L.data.153]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 2
+  lea r12, [rip+.L.data.154]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 10
+  mov r11, 10
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.155]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 97
+  lea r12, [rbp-227]
+  mov [r12], r11b
+  mov r11, 1
+  lea r12, [rip+.L.data.156]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  mov r11, 97
+  lea r12, [rbp-233]
+  mov [r12], r11b
+  mov r11, 4
+  lea r12, [rip+.L.data.157]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 3
+  lea r12, [rip+.L.data.158]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 55
+  mov r11, 0
+  lea r12, [rbp-104]
+  mov [r12], r11d
+  mov r11, 0
+  lea r12, [rbp-100]
+  mov [r12], r11d
+.L.begin.25:
+  lea r11, [rbp-100]
+  movsx r11, dword ptr [r11]
+  mov r12, 10
+  cmp r11, r12
+  setle al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.break.25
+  lea r11, [rbp-104]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-100]
+  movsx r12, dword ptr [r12]
+  add r11, r12
+  lea r12, [rbp-104]
+  mov [r12], r11d
+.L.continue.25:
+  lea r11, [rbp-100]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-100]
+  mov [r12], r11d
+  jmp .L.begin.25
+.L.break.25:
+  lea r11, [rbp-104]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.159]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  mov r11, 0
+  lea r12, [rbp-96]
+  mov [r12], r11d
+  mov r11, 0
+  lea r12, [rbp-92]
+  mov [r12], r11d
+.L.begin.26:
+  lea r11, [rbp-92]
+  movsx r11, dword ptr [r11]
+  mov r12, 10
+  cmp r11, r12
+  setle al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.break.26
+  lea r11, [rbp-96]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-92]
+  movsx r12, dword ptr [r12]
+  add r11, r12
+  lea r12, [rbp-96]
+  mov [r12], r11d
+.L.continue.26:
+  lea r11, [rbp-92]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-92]
+  mov [r12], r11d
+  jmp .L.begin.26
+.L.break.26:
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.160]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 7
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 5
+  add r11, r12
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.161]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 7
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 5
+  add r11, r12
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r12, [rip+.L.data.162]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 5
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 2
+  sub r11, r12
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.163]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 5
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 2
+  sub r11, r12
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r12, [rip+.L.data.164]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 6
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 2
+  imul r11, r12
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.165]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 6
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 2
+  imul r11, r12
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r12, [rip+.L.data.166]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 6
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 2
+  mov rax, r11
+  cqo
+  idiv r12
+  mov r11, rax
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.167]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 6
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 2
+  mov rax, r11
+  cqo
+  idiv r12
+  mov r11, rax
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r12, [rip+.L.data.168]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r12, [rip+.L.data.169]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.170]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r12, [rip+.L.data.171]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.172]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 0
+  lea r12, [rbp-252]
+  mov [r12], r11d
+  mov r11, 1
+  lea r12, [rbp-252]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 2
+  lea r12, [rbp-252]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-252]
+  mov r12, 4
+  add r11, r12
+  lea r12, [rbp-240]
+  mov [r12], r11
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-240]
+  mov r12, [r12]
+  mov [r12], r11d
+  lea r12, [rip+.L.data.173]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rbp-252]
+  mov [r12], r11d
+  mov r11, 1
+  lea r12, [rbp-252]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 2
+  lea r12, [rbp-252]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-252]
+  mov r12, 4
+  add r11, r12
+  lea r12, [rbp-240]
+  mov [r12], r11
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  lea r12, [rbp-240]
+  mov r12, [r12]
+  mov [r12], r11d
+  lea r12, [rip+.L.data.174]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  lea r12, [rip+.L.data.175]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.176]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rip+.L.data.177]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.178]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 11
+  mov r11, 0
+  lea r12, [rbp-252]
+  mov [r12], r11d
+  mov r11, 11
+  lea r12, [rbp-252]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 22
+  lea r12, [rbp-252]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-252]
+  lea r12, [rbp-240]
+  mov [r12], r11
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  mov r12, 4
+  add r11, r12
+  lea r12, [rbp-240]
+  mov [r12], r11
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  mov r12, 4
+  sub r11, r12
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.179]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 11
+  mov r11, 0
+  lea r12, [rbp-252]
+  mov [r12], r11d
+  mov r11, 11
+  lea r12, [rbp-252]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 22
+  lea r12, [rbp-252]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-252]
+  lea r12, [rbp-240]
+  mov [r12], r11
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  mov r12, 4
+  add r11, r12
+  lea r12, [rbp-240]
+  mov [r12], r11
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  mov r12, 4
+  sub r11, r12
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  mov r12, 4
+  add r11, r12
+  lea r12, [rbp-240]
+  mov [r12], r11
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  mov r12, 4
+  sub r11, r12
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  mov r12, 4
+  sub r11, r12
+  lea r12, [rbp-240]
+  mov [r12], r11
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  mov r12, 4
+  add r11, r12
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.179]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 0
+  lea r12, [rbp-252]
+  mov [r12], r11d
+  mov r11, 1
+  lea r12, [rbp-252]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 2
+  lea r12, [rbp-252]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-252]
+  mov r12, 4
+  add r11, r12
+  lea r12, [rbp-240]
+  mov [r12], r11
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  mov r12, 4
+  add r11, r12
+  lea r12, [rbp-240]
+  mov [r12], r11
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  mov r12, 4
+  sub r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.179]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 0
+  lea r12, [rbp-252]
+  mov [r12], r11d
+  mov r11, 1
+  lea r12, [rbp-252]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 2
+  lea r12, [rbp-252]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-252]
+  mov r12, 4
+  add r11, r12
+  lea r12, [rbp-240]
+  mov [r12], r11
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  mov r12, 4
+  sub r11, r12
+  lea r12, [rbp-240]
+  mov [r12], r11
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  mov r12, 4
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.180]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, -1
+  mov r11, -1
+  lea r12, [rip+.L.data.181]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rip+.L.data.182]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rip+.L.data.183]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rip+.L.data.184]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 3
+  lea r12, [rip+.L.data.185]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 10
+  mov r11, 10
+  lea r12, [rip+.L.data.186]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rip+.L.data.187]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rip+.L.data.188]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rip+.L.data.189]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rip+.L.data.190]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rip+.L.data.191]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rip+.L.data.192]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rip+.L.data.193]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 0
+  lea r12, [rbp-88]
+  mov [r12], r11d
+.L.begin.27:
+  lea r11, [rbp-88]
+  movsx r11, dword ptr [r11]
+  mov r12, 10
+  cmp r11, r12
+  setl al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.break.27
+  lea r11, [rbp-88]
+  movsx r11, dword ptr [r11]
+  mov r12, 3
+  cmp r11, r12
+  sete al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.end.28
+  jmp .L.break.27
+.L.end.28:
+.L.continue.27:
+  lea r11, [rbp-88]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-88]
+  mov [r12], r11d
+  lea r11, [rbp-88]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  jmp .L.begin.27
+.L.break.27:
+  lea r11, [rbp-88]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.194]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 0
+  lea r12, [rbp-84]
+  mov [r12], r11d
+.L.begin.29:
+  lea r11, [rbp-84]
+  movsx r11, dword ptr [r11]
+  mov r12, 10
+  cmp r11, r12
+  setl al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.break.29
+  lea r11, [rbp-84]
+  movsx r11, dword ptr [r11]
+  mov r12, 3
+  cmp r11, r12
+  sete al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.end.30
+  jmp .L.break.29
+.L.end.30:
+  lea r11, [rbp-84]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-84]
+  mov [r12], r11d
+  lea r11, [rbp-84]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+.L.continue.29:
+  jmp .L.begin.29
+.L.break.29:
+  lea r11, [rbp-84]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.195]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 0
+  lea r12, [rbp-80]
+  mov [r12], r11d
+.L.begin.31:
+  lea r11, [rbp-80]
+  movsx r11, dword ptr [r11]
+  mov r12, 10
+  cmp r11, r12
+  setl al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.break.31
+  lea r11, [rbp-80]
+  movsx r11, dword ptr [r11]
+  mov r12, 3
+  cmp r11, r12
+  sete al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.end.32
+  jmp .L.break.31
+.L.end.32:
+.L.continue.31:
+  lea r11, [rbp-80]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-80]
+  mov [r12], r11d
+  lea r11, [rbp-80]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  jmp .L.begin.31
+.L.break.31:
+  lea r11, [rbp-80]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.196]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  mov r11, 0
+  lea r12, [rbp-76]
+  mov [r12], r11d
+.L.begin.33:
+  mov r11, 1
+  cmp r11, 0
+  je  .L.break.33
+  lea r11, [rbp-76]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-76]
+  mov [r12], r11d
+  lea r11, [rbp-76]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  mov r12, 3
+  cmp r11, r12
+  sete al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.end.34
+  jmp .L.break.33
+.L.end.34:
+.L.continue.33:
+  jmp .L.begin.33
+.L.break.33:
+  lea r11, [rbp-76]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.197]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 0
+  lea r12, [rbp-72]
+  mov [r12], r11d
+.L.begin.35:
+  lea r11, [rbp-72]
+  movsx r11, dword ptr [r11]
+  mov r12, 10
+  cmp r11, r12
+  setl al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.break.35
+.L.begin.36:
+  jmp .L.break.36
+.L.continue.36:
+  jmp .L.begin.36
+.L.break.36:
+  lea r11, [rbp-72]
+  movsx r11, dword ptr [r11]
+  mov r12, 3
+  cmp r11, r12
+  sete al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.end.37
+  jmp .L.break.35
+.L.end.37:
+.L.continue.35:
+  lea r11, [rbp-72]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-72]
+  mov [r12], r11d
+  lea r11, [rbp-72]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  jmp .L.begin.35
+.L.break.35:
+  lea r11, [rbp-72]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.198]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  mov r11, 0
+  lea r12, [rbp-68]
+  mov [r12], r11d
+.L.begin.38:
+  mov r11, 1
+  cmp r11, 0
+  je  .L.break.38
+.L.begin.39:
+  mov r11, 1
+  cmp r11, 0
+  je  .L.break.39
+  jmp .L.break.39
+.L.continue.39:
+  jmp .L.begin.39
+.L.break.39:
+  lea r11, [rbp-68]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-68]
+  mov [r12], r11d
+  lea r11, [rbp-68]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  mov r12, 3
+  cmp r11, r12
+  sete al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.end.40
+  jmp .L.break.38
+.L.end.40:
+.L.continue.38:
+  jmp .L.begin.38
+.L.break.38:
+  lea r11, [rbp-68]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.199]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 10
+  mov r11, 0
+  lea r12, [rbp-60]
+  mov [r12], r11d
+  mov r11, 0
+  lea r12, [rbp-64]
+  mov [r12], r11d
+.L.begin.41:
+  lea r11, [rbp-64]
+  movsx r11, dword ptr [r11]
+  mov r12, 10
+  cmp r11, r12
+  setl al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.break.41
+  lea r11, [rbp-60]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-60]
+  mov [r12], r11d
+  lea r11, [rbp-60]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+.L.continue.41:
+  lea r11, [rbp-64]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-64]
+  mov [r12], r11d
+  lea r11, [rbp-64]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  jmp .L.begin.41
+.L.break.41:
+  lea r11, [rbp-60]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.200]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 9
+  mov r11, 0
+  lea r12, [rbp-52]
+  mov [r12], r11d
+  mov r11, 0
+  lea r12, [rbp-56]
+  mov [r12], r11d
+.L.begin.42:
+  lea r11, [rbp-56]
+  movsx r11, dword ptr [r11]
+  mov r12, 10
+  cmp r11, r12
+  setl al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.break.42
+  lea r11, [rbp-56]
+  movsx r11, dword ptr [r11]
+  mov r12, 3
+  cmp r11, r12
+  sete al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.end.43
+  jmp .L.continue.42
+.L.end.43:
+  lea r11, [rbp-52]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-52]
+  mov [r12], r11d
+  lea r11, [rbp-52]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+.L.continue.42:
+  lea r11, [rbp-56]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-56]
+  mov [r12], r11d
+  lea r11, [rbp-56]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  jmp .L.begin.42
+.L.break.42:
+  lea r11, [rbp-52]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.201]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 10
+  mov r11, 0
+  lea r12, [rbp-48]
+  mov [r12], r11d
+  mov r11, 0
+  lea r12, [rbp-44]
+  mov [r12], r11d
+.L.begin.44:
+  lea r11, [rbp-48]
+  movsx r11, dword ptr [r11]
+  mov r12, 10
+  cmp r11, r12
+  setl al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.break.44
+  lea r11, [rbp-48]
+  movsx r11, dword ptr [r11]
+  mov r12, 5
+  cmp r12, r11
+  setl al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.end.45
+  jmp .L.continue.44
+.L.end.45:
+  lea r11, [rbp-44]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-44]
+  mov [r12], r11d
+  lea r11, [rbp-44]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+.L.continue.44:
+  lea r11, [rbp-48]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-48]
+  mov [r12], r11d
+  lea r11, [rbp-48]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  jmp .L.begin.44
+.L.break.44:
+  lea r11, [rbp-48]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.202]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 6
+  mov r11, 0
+  lea r12, [rbp-40]
+  mov [r12], r11d
+  mov r11, 0
+  lea r12, [rbp-36]
+  mov [r12], r11d
+.L.begin.46:
+  lea r11, [rbp-40]
+  movsx r11, dword ptr [r11]
+  mov r12, 10
+  cmp r11, r12
+  setl al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.break.46
+  lea r11, [rbp-40]
+  movsx r11, dword ptr [r11]
+  mov r12, 5
+  cmp r12, r11
+  setl al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.end.47
+  jmp .L.continue.46
+.L.end.47:
+  lea r11, [rbp-36]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-36]
+  mov [r12], r11d
+  lea r11, [rbp-36]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+.L.continue.46:
+  lea r11, [rbp-40]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-40]
+  mov [r12], r11d
+  lea r11, [rbp-40]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  jmp .L.begin.46
+.L.break.46:
+  lea r11, [rbp-36]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.203]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 11
+  mov r11, 0
+  lea r12, [rbp-32]
+  mov [r12], r11d
+  mov r11, 0
+  lea r12, [rbp-28]
+  mov [r12], r11d
+.L.begin.48:
+  lea r11, [rbp-32]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-32]
+  mov [r12], r11d
+  lea r11, [rbp-32]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  mov r12, 10
+  cmp r11, r12
+  setl al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.break.48
+  lea r11, [rbp-32]
+  movsx r11, dword ptr [r11]
+  mov r12, 5
+  cmp r12, r11
+  setl al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.end.49
+  jmp .L.continue.48
+.L.end.49:
+  lea r11, [rbp-28]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-28]
+  mov [r12], r11d
+  lea r11, [rbp-28]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+.L.continue.48:
+  jmp .L.begin.48
+.L.break.48:
+  lea r11, [rbp-32]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.204]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  mov r11, 0
+  lea r12, [rbp-24]
+  mov [r12], r11d
+  mov r11, 0
+  lea r12, [rbp-20]
+  mov [r12], r11d
+.L.begin.50:
+  lea r11, [rbp-24]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-24]
+  mov [r12], r11d
+  lea r11, [rbp-24]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  mov r12, 10
+  cmp r11, r12
+  setl al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.break.50
+  lea r11, [rbp-24]
+  movsx r11, dword ptr [r11]
+  mov r12, 5
+  cmp r12, r11
+  setl al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.end.51
+  jmp .L.continue.50
+.L.end.51:
+  lea r11, [rbp-20]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-20]
+  mov [r12], r11d
+  lea r11, [rbp-20]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+.L.continue.50:
+  jmp .L.begin.50
+.L.break.50:
+  lea r11, [rbp-20]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.205]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 22
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  cmp r11, 3
+  je .L.case.53
+  cmp r11, 2
+  je .L.case.54
+  cmp r11, 1
+  je .L.case.55
+  jmp .L.break.52
+.L.case.55:
+  mov r11, 11
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.52
+.L.case.54:
+  mov r11, 22
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.52
+.L.case.53:
+  mov r11, 33
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.52
+.L.break.52:
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.206]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 44
+  mov r11, 4
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  cmp r11, 3
+  je .L.case.57
+  cmp r11, 2
+  je .L.case.58
+  cmp r11, 1
+  je .L.case.59
+  jmp .L.case.60
+  jmp .L.break.56
+.L.case.59:
+  mov r11, 11
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.56
+.L.case.58:
+  mov r11, 22
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.56
+.L.case.57:
+  mov r11, 33
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.56
+.L.case.60:
+  mov r11, 44
+  lea r12, [rbp-232]
+  mov [r12], r11d
+.L.break.56:
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.207]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  mov r11, 0
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  mov r11, 0
+  cmp r11, 2
+  je .L.case.62
+  cmp r11, 1
+  je .L.case.63
+  cmp r11, 0
+  je .L.case.64
+  jmp .L.break.61
+.L.case.64:
+  mov r11, 5
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.61
+.L.case.63:
+  mov r11, 6
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.61
+.L.case.62:
+  mov r11, 7
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.61
+.L.break.61:
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.208]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 6
+  mov r11, 0
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  mov r11, 1
+  cmp r11, 2
+  je .L.case.66
+  cmp r11, 1
+  je .L.case.67
+  cmp r11, 0
+  je .L.case.68
+  jmp .L.break.65
+.L.case.68:
+  mov r11, 5
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.65
+.L.case.67:
+  mov r11, 6
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.65
+.L.case.66:
+  mov r11, 7
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.65
+.L.break.65:
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.209]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 7
+  mov r11, 0
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  mov r11, 2
+  cmp r11, 2
+  je .L.case.70
+  cmp r11, 1
+  je .L.case.71
+  cmp r11, 0
+  je .L.case.72
+  jmp .L.break.69
+.L.case.72:
+  mov r11, 5
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.69
+.L.case.71:
+  mov r11, 6
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.69
+.L.case.70:
+  mov r11, 7
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.69
+.L.break.69:
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.210]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  mov r11, 3
+  cmp r11, 2
+  je .L.case.74
+  cmp r11, 1
+  je .L.case.75
+  cmp r11, 0
+  je .L.case.76
+  jmp .L.break.73
+.L.case.76:
+  mov r11, 5
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.73
+.L.case.75:
+  mov r11, 6
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.73
+.L.case.74:
+  mov r11, 7
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.73
+.L.break.73:
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.211]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  mov r11, 0
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  mov r11, 0
+  cmp r11, 0
+  je .L.case.78
+  jmp .L.case.79
+  jmp .L.break.77
+.L.case.78:
+  mov r11, 5
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.77
+.L.case.79:
+  mov r11, 7
+  lea r12, [rbp-232]
+  mov [r12], r11d
+.L.break.77:
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.212]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 7
+  mov r11, 0
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  mov r11, 1
+  cmp r11, 0
+  je .L.case.81
+  jmp .L.case.82
+  jmp .L.break.80
+.L.case.81:
+  mov r11, 5
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  jmp .L.break.80
+.L.case.82:
+  mov r11, 7
+  lea r12, [rbp-232]
+  mov [r12], r11d
+.L.break.80:
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.213]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 0
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  mov r11, 1
+  cmp r11, 2
+  je .L.case.84
+  cmp r11, 1
+  je .L.case.85
+  cmp r11, 0
+  je .L.case.86
+  jmp .L.break.83
+.L.case.86:
+  mov r11, 0
+.L.case.85:
+  mov r11, 0
+.L.case.84:
+  mov r11, 0
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+.L.break.83:
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.214]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  mov r11, 3
+  cmp r11, 2
+  je .L.case.88
+  cmp r11, 1
+  je .L.case.89
+  cmp r11, 0
+  je .L.case.90
+  jmp .L.break.87
+.L.case.90:
+  mov r11, 0
+.L.case.89:
+  mov r11, 0
+.L.case.88:
+  mov r11, 0
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+.L.break.87:
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.215]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rbp-240]
+  mov [r12], r11d
+  mov r11, 2
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-240]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.216]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, 1
+  lea r12, [rbp-240]
+  mov [r12], r11d
+  mov r11, 2
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.217]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 1
+  lea r12, [rbp-240]
+  mov [r12], r11d
+  mov r11, 2
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.218]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 1
+  lea r12, [rbp-240]
+  mov [r12], r11d
+  mov r11, 0
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 0
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.219]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  lea r11, [rip+.L.data.222]
+  lea r12, [rbp-432]
+  lea rsi, [r11]
+  lea rdi, [r12]
+  mov ecx, 160
+  rep movsb
+  mov r11, r12
+  lea r11, [rbp-432]
+  mov r12, 156
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.221]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  lea r11, [rip+.L.data.222]
+  lea r12, [rbp-432]
+  lea rsi, [r11]
+  lea rdi, [r12]
+  mov ecx, 160
+  rep movsb
+  mov r11, r12
+  lea r11, [rbp-432]
+  mov r12, 4
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.223]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 7
+  mov r11, 7
+  lea r12, [rbp-436]
+  mov [r12], r11d
+  lea r11, [rip+.L.data.224]
+  lea r12, [rbp-432]
+  lea rsi, [r11]
+  lea rdi, [r12]
+  mov ecx, 160
+  rep movsb
+  mov r11, r12
+  lea r11, [rbp-436]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-432]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-432]
+  mov r12, 4
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.225]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  lea r11, [rbp-432]
+  lea rdi, [r11]
+  xor eax, eax
+  mov ecx, 20
+  rep stosq
+  lea r11, [rbp-432]
+  mov r12, 80
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.226]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 98
+  mov r11, 97
+  lea r12, [rbp-246]
+  mov [r12], r11b
+  mov r11, 98
+  lea r12, [rbp-245]
+  mov [r12], r11b
+  mov r11, 99
+  lea r12, [rbp-244]
+  mov [r12], r11b
+  mov r11, 0
+  lea r12, [rbp-243]
+  mov [r12], r11b
+  mov r11, 0
+  lea r12, [rbp-242]
+  mov [r12], r11b
+  mov r11, 0
+  lea r12, [rbp-241]
+  mov [r12], r11b
+  mov r11, 0
+  lea r12, [rbp-240]
+  mov [r12], r11b
+  mov r11, 0
+  lea r12, [rbp-239]
+  mov [r12], r11b
+  mov r11, 0
+  lea r12, [rbp-238]
+  mov [r12], r11b
+  mov r11, 0
+  lea r12, [rbp-237]
+  mov [r12], r11b
+  mov r11, 0
+  lea r12, [rbp-236]
+  mov [r12], r11b
+  mov r11, 0
+  lea r12, [rbp-235]
+  mov [r12], r11b
+  mov r11, 0
+  lea r12, [rbp-234]
+  mov [r12], r11b
+  mov r11, 0
+  lea r12, [rbp-233]
+  mov [r12], r11b
+  mov r11, 0
+  lea r12, [rbp-232]
+  mov [r12], r11b
+  mov r11, 0
+  lea r12, [rbp-231]
+  mov [r12], r11b
+  mov r11, 0
+  lea r12, [rbp-230]
+  mov [r12], r11b
+  mov r11, 0
+  lea r12, [rbp-229]
+  mov [r12], r11b
+  mov r11, 0
+  lea r12, [rbp-228]
+  mov [r12], r11b
+  mov r11, 0
+  lea r12, [rbp-227]
+  mov [r12], r11b
+  lea r11, [rbp-245]
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.227]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  lea r11, [rip+.L.data.228]
+  lea r12, [rbp-368]
+  movups xmm0, [r11+0]
+  movups [r12+0], xmm0
+  movups xmm0, [r11+16]
+  movups [r12+16], xmm0
+  movups xmm0, [r11+32]
+  movups [r12+32], xmm0
+  movups xmm0, [r11+48]
+  movups [r12+48], xmm0
+  movups xmm0, [r11+64]
+  movups [r12+64], xmm0
+  mov r11, r12
+  lea r11, [rbp-368]
+  mov r12, 79
+  add r11, r12
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.229]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  lea r11, [rip+.L.data.230]
+  lea r12, [rbp-368]
+  movups xmm0, [r11+0]
+  movups [r12+0], xmm0
+  movups xmm0, [r11+16]
+  movups [r12+16], xmm0
+  movups xmm0, [r11+32]
+  movups [r12+32], xmm0
+  movups xmm0, [r11+48]
+  movups [r12+48], xmm0
+  movups xmm0, [r11+64]
+  movups [r12+64], xmm0
+  movups xmm0, [r11+80]
+  movups [r12+80], xmm0
+  movups xmm0, [r11+96]
+  movups [r12+96], xmm0
+  movups xmm0, [r11+112]
+  movups [r12+112], xmm0
+  mov r11, r12
+  mov r11, [rip+g4]
+  lea r12, [rbp-368]
+  mov r13, 16
+  add r12, r13
+  add r12, 8
+  mov [r12], r11
+  lea r11, [rbp-368]
+  add r11, 8
+  mov r11, [r11]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-368]
+  mov r13, 16
+  add r12, r13
+  add r12, 8
+  mov r12, [r12]
+  movsx r12, dword ptr [r12]
+  add r11, r12
+  lea r12, [rbp-368]
+  mov r13, 32
+  add r12, r13
+  add r12, 0
+  movsx r12, byte ptr [r12]
+  add r11, r12
+  lea r12, [rip+.L.data.231]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 3
+  lea r12, [rip+.L.data.232]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  mov r11, 2
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  mov r11, 6
+  mov r12, 5
+  lea r13, [rbp-236]
+  mov [r13], r12d
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.233]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 6
+  mov r11, 2
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  mov r11, 6
+  mov r12, 5
+  lea r13, [rbp-236]
+  mov [r13], r12d
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.234]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  lea r11, [rbp-232]
+  lea r12, [rbp-232]
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rsi, r12
+  mov rax, 0
+  call store_twice
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.235]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  lea r11, [rbp-236]
+  lea r12, [rbp-232]
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rsi, r12
+  mov rax, 0
+  call store_twice
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.236]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 34
+  lea r11, [rbp-236]
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rax, 0
+  call store_fields
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.237]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 21
+  mov r11, 7
+  lea r12, [rbp-240]
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 0
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-240]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-236]
+  movsx r12, dword ptr [r12]
+  imul r11, r12
+  lea r12, [rip+.L.data.238]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 12
+  mov r11, 4
+  lea r12, [rbp-240]
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 1
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-240]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-236]
+  movsx r12, dword ptr [r12]
+  imul r11, r12
+  lea r12, [rip+.L.data.239]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 42
+  mov r11, 7
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-244]
+  mov [r12], r11d
+  mov r11, 3
+  lea r12, [rbp-240]
+  mov [r12], r11d
+  mov r11, 0
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  lea r11, [rbp-244]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-240]
+  movsx r12, dword ptr [r12]
+  imul r11, r12
+  lea r12, [rbp-232]
+  movsx r12, dword ptr [r12]
+  lea r13, [rbp-244]
+  mov [r13], r12d
+  mov r12, 3
+  lea r13, [rbp-240]
+  mov [r13], r12d
+  mov r12, 0
+  lea r13, [rbp-236]
+  mov [r13], r12d
+  lea r12, [rbp-244]
+  movsx r12, dword ptr [r12]
+  lea r13, [rbp-240]
+  movsx r13, dword ptr [r13]
+  imul r12, r13
+  add r11, r12
+  lea r12, [rip+.L.data.240]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 30
+  mov r11, 0
+  lea r12, [rbp-12]
+  mov [r12], r11d
+  mov r11, 0
+  lea r12, [rbp-16]
+  mov [r12], r11d
+.L.begin.91:
+  lea r11, [rbp-16]
+  movsx r11, dword ptr [r11]
+  mov r12, 5
+  cmp r11, r12
+  setl al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.break.91
+  lea r11, [rbp-12]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-16]
+  movsx r12, dword ptr [r12]
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rsi, r12
+  mov rax, 0
+  call static_op.spec.1
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rbp-12]
+  mov [r12], r11d
+.L.continue.91:
+  lea r11, [rbp-16]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-16]
+  mov [r12], r11d
+  lea r11, [rbp-16]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  jmp .L.begin.91
+.L.break.91:
+  lea r11, [rbp-12]
+  movsx r11, dword ptr [r11]
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rax, 0
+  call static_op.spec.2
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.241]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 7
+  mov r11, 10
+  lea r12, [rbp-4]
+  mov [r12], r11d
+  mov r11, 0
+  lea r12, [rbp-8]
+  mov [r12], r11d
+.L.begin.92:
+  lea r11, [rbp-8]
+  movsx r11, dword ptr [r11]
+  mov r12, 3
+  cmp r11, r12
+  setl al
+  movzx r11, al
+  cmp r11, 0
+  je  .L.break.92
+  lea r11, [rbp-4]
+  movsx r11, dword ptr [r11]
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rax, 0
+  call static_op.spec.0
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rbp-4]
+  mov [r12], r11d
+.L.continue.92:
+  lea r11, [rbp-8]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  add r11, r12
+  lea r12, [rbp-8]
+  mov [r12], r11d
+  lea r11, [rbp-8]
+  movsx r11, dword ptr [r11]
+  mov r12, 1
+  sub r11, r12
+  jmp .L.begin.92
+.L.break.92:
+  lea r11, [rbp-4]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.242]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 55
+  mov r11, 10
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rax, 0
+  call sum_to
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.243]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 15
+  mov r11, 5
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rax, 0
+  call sum_to
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.244]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 21
+  mov r11, 6
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rax, 0
+  call triangle
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.245]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 28
+  mov r11, 7
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rax, 0
+  call triangle
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.246]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  push r10
+  sub rsp, 8
+  mov rax, 0
+  call aligned_locals
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.247]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  mov r11, 1
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rax, 0
+  call sibling_blocks
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.248]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  mov r11, 0
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rax, 0
+  call sibling_blocks
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.249]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  push r10
+  sub rsp, 8
+  mov rax, 0
+  call pooled_strings
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.250]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  lea r11, [rip+g3]
+  mov r12, 8
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.251]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  lea r11, [rip+g3]
+  mov r12, 12
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.252]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  mov r11, [rip+g4]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.253]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 99
+  mov r11, [rip+g5]
+  mov r12, 1
+  add r11, r12
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.254]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 121
+  lea r11, [rip+g6]
+  mov r12, 1
+  add r11, r12
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.255]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 98
+  lea r11, [rip+g7]
+  mov r12, 16
+  add r11, r12
+  add r11, 0
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.256]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  lea r11, [rip+g7]
+  mov r12, 16
+  add r11, r12
+  add r11, 8
+  mov r11, [r11]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.257]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  lea r11, [rip+g7]
+  add r11, 8
+  mov r11, [r11]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.258]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 6
+  mov r11, 1
+  lea r12, [rbp-232]
+  add r12, 0
+  mov [r12], r11b
+  mov r11, 2
+  lea r12, [rbp-232]
+  add r12, 1
+  mov [r12], r11b
+  mov r11, 3
+  lea r12, [rbp-232]
+  add r12, 2
+  mov [r12], r11b
+  lea r11, [rbp-232]
+  lea r12, [rbp-229]
+  mov ax, [r11+0]
+  mov [r12+0], ax
+  mov ax, [r11+1]
+  mov [r12+1], ax
+  mov r11, r12
+  lea r11, [rbp-229]
+  add r11, 0
+  movsx r11, byte ptr [r11]
+  lea r12, [rbp-229]
+  add r12, 1
+  movsx r12, byte ptr [r12]
+  add r11, r12
+  lea r12, [rbp-229]
+  add r12, 2
+  movsx r12, byte ptr [r12]
+  add r11, r12
+  lea r12, [rip+.L.data.259]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 6
+  mov r11, 4
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rax, 0
+  call make_small
+  add rsp, 8
+  pop r10
+  lea r11, [rbp-229]
+  mov [r11+0], ax
+  shr rax, 16
+  mov [r11+2], al
+  lea r12, [rbp-238]
+  mov ax, [r11+0]
+  mov [r12+0], ax
+  mov ax, [r11+1]
+  mov [r12+1], ax
+  mov r11, r12
+  lea r11, [rbp-238]
+  lea r12, [rbp-235]
+  mov ax, [r11+0]
+  mov [r12+0], ax
+  mov ax, [r11+1]
+  mov [r12+1], ax
+  mov r11, r12
+  lea r12, [rbp-232]
+  mov ax, [r11+0]
+  mov [r12+0], ax
+  mov ax, [r11+1]
+  mov [r12+1], ax
+  mov r11, r12
+  lea r11, [rbp-232]
+  add r11, 2
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.260]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 6
+  mov r11, 1
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rax, 0
+  call make_small
+  add rsp, 8
+  pop r10
+  lea r11, [rbp-226]
+  mov [r11+0], ax
+  shr rax, 16
+  mov [r11+2], al
+  lea r12, [rbp-229]
+  mov ax, [r11+0]
+  mov [r12+0], ax
+  mov ax, [r11+1]
+  mov [r12+1], ax
+  mov r11, r12
+  lea r11, [rbp-229]
+  add r11, 0
+  movsx r11, byte ptr [r11]
+  lea r12, [rbp-229]
+  add r12, 1
+  movsx r12, byte ptr [r12]
+  add r11, r12
+  lea r12, [rbp-229]
+  add r12, 2
+  movsx r12, byte ptr [r12]
+  add r11, r12
+  lea r12, [rip+.L.data.261]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 1
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rax, 0
+  call make_small
+  add rsp, 8
+  pop r10
+  lea r11, [rbp-223]
+  mov [r11+0], ax
+  shr rax, 16
+  mov [r11+2], al
+  add r11, 2
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.262]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 12
+  mov r11, 3
+  push r10
+  sub rsp, 8
+  mov rsi, r11
+  lea rdi, [rbp-280]
+  mov rax, 0
+  call make_big
+  add rsp, 8
+  pop r10
+  lea r11, [rbp-280]
+  lea r12, [rbp-320]
+  movups xmm0, [r11+0]
+  movups [r12+0], xmm0
+  movups xmm0, [r11+16]
+  movups [r12+16], xmm0
+  movups xmm0, [r11+24]
+  movups [r12+24], xmm0
+  mov r11, r12
+  lea r11, [rbp-320]
+  add r11, 0
+  lea r12, [rbp-240]
+  mov [r12], r11
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  mov r12, 36
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.263]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 148
+  mov r11, 1
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rax, 0
+  call make_small
+  add rsp, 8
+  pop r10
+  lea r11, [rbp-220]
+  mov [r11+0], ax
+  shr rax, 16
+  mov [r11+2], al
+  mov r12, 0
+  push r10
+  push r11
+  mov rsi, r12
+  lea rdi, [rbp-208]
+  mov rax, 0
+  call make_big
+  pop r11
+  pop r10
+  lea r12, [rbp-208]
+  mov r13, 100
+  push r10
+  sub rsp, 56
+  movups xmm0, [r12+0]
+  movups [rsp+0+0], xmm0
+  movups xmm0, [r12+16]
+  movups [rsp+0+16], xmm0
+  movups xmm0, [r12+24]
+  movups [rsp+0+24], xmm0
+  movzx edi, byte ptr [r11+2]
+  movzx eax, word ptr [r11+0]
+  shl rdi, 16
+  or rdi, rax
+  mov rsi, r13
+  mov rax, 0
+  call sum_big
+  add rsp, 56
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.264]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 60
+  mov r11, 1
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rax, 0
+  call make_small
+  add rsp, 8
+  pop r10
+  lea r11, [rbp-217]
+  mov [r11+0], ax
+  shr rax, 16
+  mov [r11+2], al
+  mov r12, 1
+  push r10
+  push r11
+  mov rsi, r12
+  lea rdi, [rbp-168]
+  mov rax, 0
+  call make_big
+  pop r11
+  pop r10
+  lea r12, [rbp-168]
+  mov r13, 2
+  push r10
+  sub rsp, 56
+  movups xmm0, [r12+0]
+  movups [rsp+0+0], xmm0
+  movups xmm0, [r12+16]
+  movups [rsp+0+16], xmm0
+  movups xmm0, [r12+24]
+  movups [rsp+0+24], xmm0
+  movzx edi, byte ptr [r11+2]
+  movzx eax, word ptr [r11+0]
+  shl rdi, 16
+  or rdi, rax
+  mov rsi, r13
+  mov rax, 0
+  call c_sum_structs
+  add rsp, 56
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.265]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 18
+  mov r11, 2
+  push r10
+  sub rsp, 8
+  mov rsi, r11
+  lea rdi, [rbp-280]
+  mov rax, 0
+  call c_make_big
+  add rsp, 8
+  pop r10
+  lea r11, [rbp-280]
+  lea r12, [rbp-320]
+  movups xmm0, [r11+0]
+  movups [r12+0], xmm0
+  movups xmm0, [r11+16]
+  movups [r12+16], xmm0
+  movups xmm0, [r11+24]
+  movups [r12+24], xmm0
+  mov r11, r12
+  lea r11, [rbp-320]
+  add r11, 0
+  lea r12, [rbp-240]
+  mov [r12], r11
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  mov r12, 36
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.266]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3262
+  mov r11, 1
+  lea r12, [rbp-229]
+  add r12, 0
+  mov [r12], r11b
+  mov r11, 2
+  lea r12, [rbp-229]
+  add r12, 1
+  mov [r12], r11b
+  mov r11, 3
+  lea r12, [rbp-229]
+  add r12, 2
+  mov [r12], r11b
+  lea r11, [rbp-229]
+  lea r12, [rbp-214]
+  mov ax, [r11+0]
+  mov [r12+0], ax
+  mov ax, [r11+1]
+  mov [r12+1], ax
+  mov r11, r12
+  mov r12, 4
+  lea r13, [rbp-229]
+  add r13, 0
+  mov [r13], r12b
+  mov r12, 5
+  lea r13, [rbp-229]
+  add r13, 1
+  mov [r13], r12b
+  mov r12, 9
+  lea r13, [rbp-229]
+  add r13, 2
+  mov [r13], r12b
+  lea r12, [rbp-229]
+  lea r13, [rbp-211]
+  mov ax, [r12+0]
+  mov [r13+0], ax
+  mov ax, [r12+1]
+  mov [r13+1], ax
+  mov r12, r13
+  push r10
+  sub rsp, 8
+  movzx edi, byte ptr [r11+2]
+  movzx eax, word ptr [r11+0]
+  shl rdi, 16
+  or rdi, rax
+  movzx esi, byte ptr [r12+2]
+  movzx eax, word ptr [r12+0]
+  shl rsi, 16
+  or rsi, rax
+  mov rax, 0
+  call diff_small
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.267]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4342
+  mov r11, 1
+  mov r12, 5
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rsi, r12
+  mov rax, 0
+  call diff_made
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.268]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 30
+  mov r11, 30
+  lea r12, [rip+.L.data.269]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  mov r11, 0
+  lea r12, [rip+.L.data.270]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 20
+  mov r11, 1
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rip+ctab]
+  lea r12, [rbp-232]
+  movsx r12, dword ptr [r12]
+  mov r13, 4
+  imul r12, r13
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.271]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 640
+  mov r11, 640
+  lea r12, [rip+.L.data.272]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 120
+  mov r11, 120
+  lea r12, [rip+.L.data.273]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 105
+  mov r11, [rip+cmsg]
+  mov r12, 1
+  add r11, r12
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.274]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 122
+  mov r11, [rip+cptr]
+  mov r12, 2
+  add r11, r12
+  movsx r11, byte ptr [r11]
+  lea r12, [rip+.L.data.275]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 10
+  mov r11, 5
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 2
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-232]
+  movsx r12, dword ptr [r12]
+  imul r11, r12
+  lea r12, [rip+.L.data.276]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 30
+  lea r11, [rip+ctab]
+  lea r12, [rbp-240]
+  mov [r12], r11
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  mov r12, 4
+  add r11, r12
+  movsx r11, dword ptr [r11]
+  mov r12, 10
+  add r11, r12
+  lea r12, [rip+.L.data.277]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 16
+  mov r11, 16
+  lea r12, [rip+.L.data.278]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  lea r11, [rbp-236]
+  lea r12, [rbp-232]
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rsi, r12
+  mov rax, 0
+  call restrict_store
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.279]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 12
+  mov r11, 1
+  lea r12, [rbp-240]
+  mov [r12], r11d
+  mov r11, 2
+  lea r12, [rbp-240]
+  mov r13, 4
+  add r12, r13
+  mov [r12], r11d
+  mov r11, 4
+  lea r12, [rbp-240]
+  mov r13, 8
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-252]
+  lea r12, [rbp-240]
+  mov r13, 3
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rsi, r12
+  mov rdx, r13
+  mov rax, 0
+  call restrict_sum
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.280]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  mov r11, 1
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-232]
+  lea r12, [rbp-240]
+  mov [r12], r11
+  mov r11, 3
+  lea r12, [rbp-240]
+  mov r12, [r12]
+  mov [r12], r11d
+  mov r11, 0
+  lea r11, [rbp-232]
+  movsx r11, dword ptr [r11]
+  lea r12, [rip+.L.data.281]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 125
+  mov r11, 100
+  lea r12, [rbp-236]
+  mov [r12], r11d
+  mov r11, 20
+  lea r12, [rbp-232]
+  mov [r12], r11d
+  lea r11, [rbp-236]
+  movsx r11, dword ptr [r11]
+  lea r12, [rbp-232]
+  movsx r12, dword ptr [r12]
+  mov r13, 0
+  push r10
+  sub rsp, 8
+  mov rdi, r13
+  mov rax, 0
+  call realigned_callee
+  add rsp, 8
+  pop r10
+  mov r13, rax
+  add r12, r13
+  add r11, r12
+  lea r12, [rip+.L.data.282]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 44
+  mov r11, 2
+  push r10
+  sub rsp, 8
+  mov rdi, r11
+  mov rax, 0
+  call cdup_sum
+  add rsp, 8
+  pop r10
+  mov r11, rax
+  lea r12, [rip+.L.data.283]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  mov r11, 1
+  lea r12, [rip+.L.data.284]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r12
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r10, [rip+.L.data.285]
+  mov rdi, r10
+  mov rax, 0
+  call printf
+  mov r10, rax
+  mov r10, 0
+  mov rax, r10
+  jmp .L.return.main
+.L.return.main:
+  mov r12, [rbp-448]
+  mov r13, [rbp-456]
+  mov r14, [rbp-464]
+  mov r15, [rbp-472]
+  mov rsp, rbp
+  pop rbp
+  pop rsp
+  ret
@@ -0,0 +1,76 @@
+.intel_syntax noprefix
+.data
+  .align 4
+  .type counter.1, @object
+  .size counter.1, 4
+counter.1:
+  .byte 10, 0, 0, 0
+.bss
+  .align 4
+  .type counter, @object
+  .size counter, 4
+counter:
+  .zero 4
+.text
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov r10, 3
+  lea r11, [rbp-4]
+  mov [r11], r10d
+  movsx r10, dword ptr [rip+counter]
+  lea r11, [rbp-4]
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  mov [rip+counter], r10d
+  movsx r10, dword ptr [rip+counter]
+  mov r11, 2
+  imul r10, r11
+  lea r11, [rbp-12]
+  mov [r11], r10d
+  mov r10, 4
+  mov rdi, r10
+  mov rax, 0
+  call from_b
+  mov r10, rax
+  lea r11, [rbp-8]
+  mov [r11], r10d
+  lea r10, [rbp-12]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-8]
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  movsx r11, dword ptr [rip+counter]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.main
+.L.return.main:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl from_b
+from_b:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], edi
+  lea r10, [rbp-8]
+  movsx r10, dword ptr [r10]
+  lea r11, [rbp-4]
+  mov [r11], r10d
+  movsx r10, dword ptr [rip+counter.1]
+  lea r11, [rbp-4]
+  movsx r11, dword ptr [r11]
+  add r10, r11
+  mov [rip+counter.1], r10d
+  movsx r10, dword ptr [rip+counter.1]
+  movsx r11, dword ptr [rip+counter.1]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.from_b
+.L.return.from_b:
+  mov rsp, rbp
+  pop rbp
+  ret
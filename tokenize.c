@@ -71,7 +71,8 @@ static bool is_alnum(char c) {
 static char *keywords[] = {
   "return", "if", "else", "for", "while", "sizeof", "int", "char",
   "struct", "void", "typedef", "_Bool", "enum", "static", "break",
-  "continue", "switch", "case", "default"
+  "continue", "switch", "case", "default", "const",
+  "restrict"
 };
 
 static char read_escaped_char(char *p) {
@@ -153,6 +154,21 @@ static Token *read_string_literal(Token *cur, char *start) {
   return tok;
 }
 
+// Assigns a line number to each token.
+static void add_line_numbers(Token *tok) {
+  char *p = user_input;
+  int n = 1;
+
+  do {
+    if (p == tok->loc) {
+      tok->line_no = n;
+      tok = tok->next;
+    }
+    if (*p == '\n')
+      n++;
+  } while (*p++);
+}
+
 // tokenのlinked listを構築する。
 Token *tokenize(char *p) {
   user_input = p;
@@ -266,10 +282,11 @@ Token *tokenize(char *p) {
   }
 
   new_token(TK_EOF, cur, p, 0);
+  add_line_numbers(head.next);
   return head.next;
 }
 
-static char *read_file(char *path) {
+char *read_file(char *path) {
   filename = path;
 
   FILE *fp;
@@ -18,6 +18,12 @@ int align_to(int n, int align) {
   return (n + align - 1) & ~(align - 1);
 }
 
+Type *copy_type(Type *ty) {
+  Type *ret = calloc(1, sizeof(Type));
+  *ret = *ty;
+  return ret;
+}
+
 Type *pointer_to(Type *base) {
   Type *ty = new_type(TY_PTR, 8, 8);
   ty->base = base;
@@ -80,9 +86,11 @@ void add_type(Node *node) {
     case ND_LAE:
     case ND_LEE:
     case ND_NUM:
-    case ND_FUNCALL:
       node->ty = ty_int;
       return;
+    case ND_FUNCALL:
+      node->ty = node->var ? node->var->ty : ty_int;
+      return;
     case ND_VAR:
       node->ty = node->var->ty;
       return;